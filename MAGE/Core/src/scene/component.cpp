@@ -13,6 +13,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	AtomicU64 Component::s_termination_version = 0u;
+
 	Component::Component() noexcept
 		: m_state(State::Active),
 		m_guid(GetNextGuid()),
@@ -35,15 +37,24 @@ namespace mage {
 	Component& Component::operator=(Component&& component) noexcept = default;
 
 	void Component::SetState(State state) noexcept {
-		if (State::Terminated == state) {
+		if (State::Terminated == m_state) {
 			return;
 		}
 
-		if (HasOwner() && State::Terminated == m_owner->GetState()) {
-			m_state = State::Terminated;
+		const auto owner_terminated = HasOwner()
+			&& State::Terminated == m_owner->GetState();
+		if (owner_terminated) {
+			state = State::Terminated;
 		}
-		else {
-			m_state = state;
+
+		m_state = state;
+
+		if (State::Terminated == m_state) {
+			if (HasOwner() && !owner_terminated) {
+				m_owner->RemoveComponent(*this);
+			}
+
+			UpdateTerminationVersion();
 		}
 	}
 }
\ No newline at end of file
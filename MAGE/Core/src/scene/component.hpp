@@ -6,6 +6,7 @@
 #pragma region
 
 #include "scene\state.hpp"
+#include "type\atomic_types.hpp"
 #include "type\types.hpp"
 
 #pragma endregion
@@ -30,6 +31,21 @@ namespace mage {
 
 	public:
 
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the termination version of all components and nodes. The
+		 version changes each time a component or node is terminated.
+
+		 @return		The termination version of all components and nodes.
+		 */
+		[[nodiscard]]
+		static U64 GetTerminationVersion() noexcept {
+			return s_termination_version.load(std::memory_order_relaxed);
+		}
+
 		//---------------------------------------------------------------------
 		// Destructors
 		//---------------------------------------------------------------------
@@ -80,6 +96,10 @@ namespace mage {
 		/**
 		 Sets the state of this component to the given state.
 
+		 A terminated component cannot change its state anymore, and is
+		 removed from its owner. A component whose owner is terminated, is
+		 terminated as well.
+
 		 @param[in]		state
 						The state.
 		 */
@@ -165,6 +185,26 @@ namespace mage {
 
 		friend class ComponentClient;
 
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Changes the termination version of all components and nodes.
+		 */
+		static void UpdateTerminationVersion() noexcept {
+			s_termination_version.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The termination version of all components and nodes.
+		 */
+		static AtomicU64 s_termination_version;
+
 		//---------------------------------------------------------------------
 		// Member Methods: Update
 		//---------------------------------------------------------------------
@@ -240,6 +280,13 @@ namespace mage {
 
 			component.SetOwner(std::move(owner));
 		}
+
+		/**
+		 Changes the termination version of all components and nodes.
+		 */
+		static void UpdateTerminationVersion() noexcept {
+			Component::UpdateTerminationVersion();
+		}
 	};
 
 	#pragma endregion
@@ -13,6 +13,8 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	AtomicU64 Node::s_graph_version = 0u;
+
 	Node::Node(std::string name)
 		: m_transform(),
 		m_parent(nullptr),
@@ -41,14 +43,32 @@ namespace mage {
 		m_state(node.m_state),
 		m_guid(node.m_guid),
 		m_this(std::move(node.m_this)),
-		m_name(std::move(node.m_name)) {}
+		m_name(std::move(node.m_name)) {
+
+		UpdateGraphVersion();
+	}
 
-	Node::~Node() = default;
+	Node::~Node() {
+		UpdateGraphVersion();
+	}
 
-	Node& Node::operator=(Node&& node) noexcept = default;
+	Node& Node::operator=(Node&& node) noexcept {
+		m_transform  = std::move(node.m_transform);
+		m_parent     = std::move(node.m_parent);
+		m_childs     = std::move(node.m_childs);
+		m_components = std::move(node.m_components);
+		m_state      = node.m_state;
+		m_guid       = node.m_guid;
+		m_this       = std::move(node.m_this);
+		m_name       = std::move(node.m_name);
+
+		UpdateGraphVersion();
+		return *this;
+	}
 
 	void Node::Set(NodePtr ptr) noexcept {
 		m_this = std::move(ptr);
+		UpdateGraphVersion();
 
 		TransformClient::SetOwner(m_transform, m_this);
 
@@ -80,6 +100,7 @@ namespace mage {
 
 		node->m_parent = m_this;
 		node->m_transform.SetDirty();
+		UpdateGraphVersion();
 
 		m_childs.push_back(std::move(node));
 	}
@@ -95,6 +116,7 @@ namespace mage {
 
 		node->m_parent = nullptr;
 		node->m_transform.SetDirty();
+		UpdateGraphVersion();
 
 		if (const auto it = std::find(cbegin(m_childs), cend(m_childs), node);
 			it != cend(m_childs)) {
@@ -113,6 +135,7 @@ namespace mage {
 		});
 
 		m_childs.clear();
+		UpdateGraphVersion();
 	}
 
 	//-------------------------------------------------------------------------
@@ -120,11 +143,20 @@ namespace mage {
 	//-------------------------------------------------------------------------
 
 	void Node::SetState(State state) noexcept {
-		if (State::Terminated == state
+		if (State::Terminated == m_state
 			|| m_state == state) {
 			return;
 		}
 
+		if (State::Terminated == state) {
+			if (m_parent) {
+				m_parent->RemoveChild(m_this);
+			}
+
+			Terminate();
+			return;
+		}
+
 		m_state = state;
 
 		ForEachComponent([state](Component& component) noexcept {
@@ -135,4 +167,31 @@ namespace mage {
 			node.SetState(state);
 		});
 	}
+
+	void Node::Terminate() noexcept {
+		m_state = State::Terminated;
+		ComponentClient::UpdateTerminationVersion();
+
+		ForEachComponent([](Component& component) noexcept {
+			component.SetState(State::Terminated);
+		});
+
+		ForEachChild([](Node& node) noexcept {
+			node.m_parent = nullptr;
+			node.Terminate();
+		});
+
+		m_childs.clear();
+		UpdateGraphVersion();
+	}
+
+	void Node::RemoveComponent(const Component& component) noexcept {
+		const auto range = m_components.equal_range(typeid(component));
+		for (auto it = range.first; it != range.second; ++it) {
+			if (&component == it->second.Get()) {
+				m_components.erase(it);
+				return;
+			}
+		}
+	}
 }
\ No newline at end of file
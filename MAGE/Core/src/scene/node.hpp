@@ -47,6 +47,21 @@ namespace mage {
 		 */
 		using ComponentPtr = ProxyPtr< Component >;
 
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the version of the graph of all nodes. The version changes
+		 each time a node is relocated, destructed or (dis)connected.
+
+		 @return		The version of the graph of all nodes.
+		 */
+		[[nodiscard]]
+		static U64 GetGraphVersion() noexcept {
+			return s_graph_version.load(std::memory_order_relaxed);
+		}
+
 		//---------------------------------------------------------------------
 		// Constructors and Destructors
 		//---------------------------------------------------------------------
@@ -421,6 +436,10 @@ namespace mage {
 		/**
 		 Sets the state of this node to the given state.
 
+		 A terminated node cannot change its state anymore. Terminating a
+		 node terminates its components and descendants as well, and removes
+		 the node from its parent.
+
 		 @param[in]		state
 						The state.
 		 */
@@ -480,6 +499,49 @@ namespace mage {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Friends
+		//---------------------------------------------------------------------
+
+		friend class Component;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Changes the version of the graph of all nodes.
+		 */
+		static void UpdateGraphVersion() noexcept {
+			s_graph_version.fetch_add(1u, std::memory_order_relaxed);
+		}
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The version of the graph of all nodes.
+		 */
+		static AtomicU64 s_graph_version;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Terminates this node, its components and its descendants.
+		 */
+		void Terminate() noexcept;
+
+		/**
+		 Removes the given component from the components of this node.
+
+		 @param[in]		component
+						A reference to the component.
+		 */
+		void RemoveComponent(const Component& component) noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Transform
 		//---------------------------------------------------------------------
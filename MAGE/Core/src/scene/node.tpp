@@ -24,7 +24,7 @@ namespace mage {
 			// Visit child node.
 			action(*child);
 			// Visit child node's child nodes.
-			child->ForEachDescendantNode(action);
+			child->ForEachDescendant(action);
 		}
 	}
 
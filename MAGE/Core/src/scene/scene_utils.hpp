@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "collection\vector.hpp"
+#include "collection\proxy_vector.hpp"
 
 #pragma endregion
 
@@ -15,12 +15,18 @@
 namespace mage {
 
 	template< typename ElementT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElement(AlignedVector< ElementT >& elements,
+	ProxyPtr< ElementT > AddElement(ProxyVector< ElementT >& elements,
 									ConstructorArgsT&&... args);
 
 	template< typename ElementT, typename BaseT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElementPtr(AlignedVector< UniquePtr< BaseT > >& elements,
+	ProxyPtr< ElementT > AddElementPtr(ProxyVector< UniquePtr< BaseT > >& elements,
 									   ConstructorArgsT&&... args);
+
+	template< typename ElementT >
+	void RemoveTerminatedElements(ProxyVector< ElementT >& elements);
+
+	template< typename BaseT >
+	void RemoveTerminatedElements(ProxyVector< UniquePtr< BaseT > >& elements);
 }
 
 //-----------------------------------------------------------------------------
@@ -15,42 +15,31 @@
 namespace mage {
 
 	template< typename ElementT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElement(AlignedVector< ElementT >& elements,
+	ProxyPtr< ElementT > AddElement(ProxyVector< ElementT >& elements,
 									ConstructorArgsT&&... args) {
-		std::size_t index = 0u;
-		for (auto& element : elements) {
-			if (State::Terminated == element.GetState()) {
-				element = ElementT(std::forward< ConstructorArgsT >(args)...);
-				return ProxyPtr< ElementT >(elements, index);
-			}
-
-			++index;
-		}
-
-		elements.emplace_back(std::forward< ConstructorArgsT >(args)...);
-		return ProxyPtr< ElementT >(elements, index);
+
+		return elements.emplace(std::forward< ConstructorArgsT >(args)...);
 	}
 
 	template< typename ElementT, typename BaseT, typename... ConstructorArgsT >
-	ProxyPtr< ElementT > AddElementPtr(AlignedVector< UniquePtr< BaseT > >& elements,
+	ProxyPtr< ElementT > AddElementPtr(ProxyVector< UniquePtr< BaseT > >& elements,
 									   ConstructorArgsT&&... args) {
-		std::size_t index = 0u;
-		for (auto& element : elements) {
-			if (State::Terminated == element->GetState()) {
-				element = MakeUnique< ElementT >(
-					std::forward< ConstructorArgsT >(args)...);
-				return ProxyPtr< ElementT >([&elements, index]() noexcept {
-						return static_cast< ElementT* >(elements[index].get());
-				});
-			}
-
-			++index;
-		}
-
-		elements.push_back(MakeUnique< ElementT >(
-			std::forward< ConstructorArgsT >(args)...));
-		return ProxyPtr< ElementT >([&elements, index]() noexcept {
-				return static_cast< ElementT * >(elements[index].get());
+
+		return static_pointer_cast< ElementT >(elements.emplace(
+			MakeUnique< ElementT >(std::forward< ConstructorArgsT >(args)...)));
+	}
+
+	template< typename ElementT >
+	void RemoveTerminatedElements(ProxyVector< ElementT >& elements) {
+		elements.erase_if([](const ElementT& element) noexcept {
+			return State::Terminated == element.GetState();
+		});
+	}
+
+	template< typename BaseT >
+	void RemoveTerminatedElements(ProxyVector< UniquePtr< BaseT > >& elements) {
+		elements.erase_if([](const UniquePtr< BaseT >& element) noexcept {
+			return State::Terminated == element->GetState();
 		});
 	}
 }
\ No newline at end of file
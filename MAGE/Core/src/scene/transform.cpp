@@ -12,48 +12,104 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	AtomicU64 Transform::s_epoch = 0u;
+
+	AtomicU64 Transform::s_version = 0u;
+
 	void Transform::SetDirty() const noexcept {
-		m_dirty_object_to_world = true;
-		m_dirty_world_to_object = true;
+		m_dirty = true;
+		m_version = GetNextVersion();
+
+		s_epoch.fetch_add(1u, std::memory_order_relaxed);
+	}
 
-		if (HasOwner()) {
-			m_owner->ForEachChild([](const Node& node) noexcept {
-				node.GetTransform().SetDirty();
-			});
+	void Transform::Resolve() const noexcept {
+		// No transform is set to dirty since the last resolution.
+		const auto epoch = s_epoch.load(std::memory_order_relaxed);
+		if (epoch == m_resolved_epoch) {
+			return;
+		}
+
+		m_resolved_epoch = epoch;
+
+		if (!HasOwner()) {
+			return;
+		}
+
+		const auto parent = m_owner->GetParent();
+		if (nullptr == parent) {
+			return;
+		}
+
+		const auto& parent_transform = parent->GetTransform();
+		parent_transform.Resolve();
+
+		if (parent_transform.m_version != m_parent_version) {
+			m_parent_version = parent_transform.m_version;
+			m_dirty          = true;
+			m_version = GetNextVersion();
 		}
 	}
 
-	void Transform::UpdateObjectToWorldMatrix() const noexcept {
-		if (m_dirty_object_to_world) {
-			m_dirty_object_to_world = false;
+	void Transform::Update(const Transform* parent, U64 epoch) const noexcept {
+		if (nullptr != parent && parent->m_version != m_parent_version) {
+			m_parent_version = parent->m_version;
+			m_dirty          = true;
+			m_version = GetNextVersion();
+		}
+
+		if (m_dirty) {
+			m_dirty = false;
+			ComputeMatrices(parent);
+		}
+
+		m_resolved_epoch = epoch;
+	}
+
+	void Transform::UpdateMatrices() const noexcept {
+		if (m_dirty) {
+			m_dirty = false;
 
 			Assert(HasOwner());
 			const auto parent = m_owner->GetParent();
 
 			if (nullptr != parent) {
-				m_object_to_world = GetObjectToParentMatrix()
-					              * parent->GetTransform().GetObjectToWorldMatrix();
+				const auto& parent_transform = parent->GetTransform();
+				parent_transform.UpdateMatrices();
+
+				ComputeMatrices(&parent_transform);
 			}
 			else {
-				m_object_to_world = GetObjectToParentMatrix();
+				ComputeMatrices(nullptr);
 			}
 		}
 	}
 
-	void Transform::UpdateWorldToObjectMatrix() const noexcept {
-		if (m_dirty_world_to_object) {
-			m_dirty_world_to_object = false;
+	void Transform::ComputeMatrices(const Transform* parent) const noexcept {
+		const auto scale = m_transform.GetScale();
+		const auto uniform_scale
+			= XMVector3Equal(XMVectorSplatX(scale), scale);
 
-			Assert(HasOwner());
-			const auto parent = m_owner->GetParent();
+		// Scale . Rotation . Translation (. Parent)
+		m_object_to_world = GetObjectToParentMatrix();
+		if (nullptr != parent) {
+			m_object_to_world *= parent->m_object_to_world;
+		}
 
-			if (nullptr != parent) {
-				m_world_to_object = parent->GetTransform().GetWorldToObjectMatrix()
-					              * GetParentToObjectMatrix();
-			}
-			else {
-				m_world_to_object = GetParentToObjectMatrix();
-			}
+		if (nullptr == parent || parent->m_uniform_scale) {
+			m_uniform_scale = uniform_scale;
+
+			// The rows of the upper-left 3x3 block are mutually orthogonal.
+			m_world_to_object = uniform_scale
+				? GetUniformInverseAffineTransformationMatrix(m_object_to_world)
+				: GetInverseAffineTransformationMatrix(m_object_to_world);
+		}
+		else {
+			m_uniform_scale = false;
+
+			// The object-to-world matrix may contain shear.
+			m_world_to_object = parent->m_world_to_object
+				              * GetParentToObjectMatrix();
 		}
 	}
 }
\ No newline at end of file
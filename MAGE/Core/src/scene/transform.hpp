@@ -6,6 +6,7 @@
 #pragma region
 
 #include "transform\transform.hpp"
+#include "type\atomic_types.hpp"
 
 #pragma endregion
 
@@ -40,8 +41,11 @@ namespace mage {
 			: m_transform(),
 			m_object_to_world(),
 			m_world_to_object(),
-			m_dirty_object_to_world(true),
-			m_dirty_world_to_object(true),
+			m_dirty(true),
+			m_uniform_scale(true),
+			m_version(GetNextVersion()),
+			m_parent_version(0u),
+			m_resolved_epoch(0u),
 			m_owner() {}
 
 		/**
@@ -54,8 +58,11 @@ namespace mage {
 			: m_transform(transform.m_transform),
 			m_object_to_world(),
 			m_world_to_object(),
-			m_dirty_object_to_world(true),
-			m_dirty_world_to_object(true),
+			m_dirty(true),
+			m_uniform_scale(true),
+			m_version(GetNextVersion()),
+			m_parent_version(0u),
+			m_resolved_epoch(0u),
 			m_owner() {}
 
 		/**
@@ -1188,7 +1195,8 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetObjectToWorldMatrix() const noexcept {
-			UpdateObjectToWorldMatrix();
+			Resolve();
+			UpdateMatrices();
 			return m_object_to_world;
 		}
 
@@ -1199,7 +1207,42 @@ namespace mage {
 		 */
 		[[nodiscard]]
 		const XMMATRIX XM_CALLCONV GetWorldToObjectMatrix() const noexcept {
-			UpdateWorldToObjectMatrix();
+			Resolve();
+			UpdateMatrices();
+			return m_world_to_object;
+		}
+
+		/**
+		 Returns the object-to-world matrix of this transform without
+		 resolving this transform. Unlike GetObjectToWorldMatrix, this method
+		 does not write to this transform or its ancestors, and can be called
+		 concurrently.
+
+		 @pre			The matrices of this transform are up to date (i.e.
+						GetObjectToWorldMatrix or GetWorldToObjectMatrix is
+						called after this transform or one of its ancestors
+						was last set to dirty).
+		 @return		The object-to-world matrix of this transform.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetResolvedObjectToWorldMatrix() const noexcept {
+			return m_object_to_world;
+		}
+
+		/**
+		 Returns the world-to-object matrix of this transform without
+		 resolving this transform. Unlike GetWorldToObjectMatrix, this method
+		 does not write to this transform or its ancestors, and can be called
+		 concurrently.
+
+		 @pre			The matrices of this transform are up to date (i.e.
+						GetObjectToWorldMatrix or GetWorldToObjectMatrix is
+						called after this transform or one of its ancestors
+						was last set to dirty).
+		 @return		The world-to-object matrix of this transform.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetResolvedWorldToObjectMatrix() const noexcept {
 			return m_world_to_object;
 		}
 
@@ -1441,10 +1484,45 @@ namespace mage {
 		#pragma region
 
 		/**
-		 Sets this transform to dirty.
+		 Sets this transform to dirty. The descendants of this transform are
+		 not visited: they detect the change through the version of their
+		 parent transform the next time they are resolved.
 		 */
 		void SetDirty() const noexcept;
 
+		/**
+		 Returns the version of this transform. The version changes each time
+		 this transform or one of its ancestors is set to dirty (i.e. each
+		 time the object-to-world matrix of this transform may have changed).
+
+		 Versions are unique across all transforms: a version identifies both
+		 a transform and its state, independently of the address of the
+		 transform (which changes when its node is relocated). A version is
+		 never equal to zero.
+
+		 @return		The version of this transform.
+		 */
+		[[nodiscard]]
+		U64 GetVersion() const noexcept {
+			Resolve();
+			return m_version;
+		}
+
+		/**
+		 Returns the version of this transform without resolving this
+		 transform. Unlike GetVersion, this method does not write to this
+		 transform or its ancestors, and can be called concurrently.
+
+		 @pre			This transform is resolved (e.g. by GetVersion or
+						GetObjectToWorldMatrix) after this transform or one of
+						its ancestors was last set to dirty.
+		 @return		The version of this transform.
+		 */
+		[[nodiscard]]
+		U64 GetResolvedVersion() const noexcept {
+			return m_version;
+		}
+
 		#pragma endregion
 
 	private:
@@ -1455,6 +1533,39 @@ namespace mage {
 
 		friend class TransformClient;
 
+		friend class TransformHierarchy;
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of times a transform has been set to dirty. Transforms
+		 resolved at the current epoch are known to be up to date with their
+		 ancestors.
+		 */
+		static AtomicU64 s_epoch;
+
+		/**
+		 The most recent version of all transforms.
+		 */
+		static AtomicU64 s_version;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns a new version for a transform.
+
+		 @return		A version which differs from all versions returned
+						before.
+		 */
+		[[nodiscard]]
+		static U64 GetNextVersion() noexcept {
+			return s_version.fetch_add(1u, std::memory_order_relaxed) + 1u;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Update
 		//---------------------------------------------------------------------
@@ -1472,18 +1583,45 @@ namespace mage {
 		}
 
 		/**
-		 Updates the object-to-world matrix of this transform if dirty.
+		 Resolves this transform and its ancestors: this transform is set to
+		 dirty if the version of its parent transform changed since this
+		 transform was last resolved.
+		 */
+		void Resolve() const noexcept;
+
+		/**
+		 Updates this transform from the given parent transform. The parent
+		 transform must already be updated. Unlike the lazy resolution, this
+		 update does not visit any other transform.
 
-		 @pre			This transform must have an owner.
+		 @param[in]		parent
+						A pointer to the parent transform of this transform.
+		 @param[in]		epoch
+						The current epoch.
 		 */
-		void UpdateObjectToWorldMatrix() const noexcept;
+		void Update(const Transform* parent, U64 epoch) const noexcept;
 
 		/**
-		 Updates the world-to-object matrix of this transform if dirty.
+		 Updates the object-to-world and world-to-object matrices of this
+		 transform if dirty.
 
 		 @pre			This transform must have an owner.
+		 @pre			This transform must be resolved.
+		 */
+		void UpdateMatrices() const noexcept;
+
+		/**
+		 Computes the object-to-world and world-to-object matrices of this
+		 transform from the given parent transform. The world-to-object
+		 matrix is obtained in closed form from the object-to-world matrix,
+		 unless an ancestor has a non-uniform scale.
+
+		 @param[in]		parent
+						A pointer to the parent transform of this transform.
+						The matrices of the parent transform must be up to
+						date.
 		 */
-		void UpdateWorldToObjectMatrix() const noexcept;
+		void ComputeMatrices(const Transform* parent) const noexcept;
 
 		#pragma endregion
 
@@ -1507,16 +1645,33 @@ namespace mage {
 		mutable XMMATRIX m_world_to_object;
 
 		/**
-		 A flag indicating whether the object-to-world matrix of this transform
-		 is dirty.
+		 A flag indicating whether the object-to-world and world-to-object
+		 matrices of this transform are dirty.
+		 */
+		mutable bool m_dirty;
+
+		/**
+		 A flag indicating whether this transform and all its ancestors have
+		 a uniform scale (i.e. whether the object-to-world matrix of this
+		 transform is a similarity transformation).
+		 */
+		mutable bool m_uniform_scale;
+
+		/**
+		 The version of this transform.
+		 */
+		mutable U64 m_version;
+
+		/**
+		 The version of the parent transform of this transform at the time
+		 this transform was last resolved.
 		 */
-		mutable bool m_dirty_object_to_world;
+		mutable U64 m_parent_version;
 
 		/**
-		 A flag indicating whether the world-to-object matrix of this transform
-		 is dirty.
+		 The epoch at which this transform was last resolved.
 		 */
-		mutable bool m_dirty_world_to_object;
+		mutable U64 m_resolved_epoch;
 
 		/**
 		 A pointer to the node owning this transform.
@@ -0,0 +1,97 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\transform_hierarchy.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	TransformHierarchy::TransformHierarchy()
+		: m_transforms(),
+		m_parents(),
+		m_levels(),
+		m_graph_version(Node::GetGraphVersion() - 1u) {}
+
+	TransformHierarchy::TransformHierarchy(
+		TransformHierarchy&& hierarchy) noexcept = default;
+
+	TransformHierarchy::~TransformHierarchy() = default;
+
+	TransformHierarchy& TransformHierarchy
+		::operator=(TransformHierarchy&& hierarchy) noexcept = default;
+
+	void TransformHierarchy::Update(const ProxyVector< Node >& nodes,
+									JobSystem& job_system) {
+
+		if (const auto graph_version = Node::GetGraphVersion();
+			graph_version != m_graph_version) {
+
+			Build(nodes);
+			m_graph_version = graph_version;
+		}
+
+		// No transform is set to dirty during the update.
+		const auto epoch = Transform::s_epoch.load(std::memory_order_relaxed);
+
+		std::size_t begin = 0u;
+		for (const auto end : m_levels) {
+			job_system.ParallelFor(begin, end,
+								   [this, epoch](std::size_t first,
+												 std::size_t last) noexcept {
+				for (auto i = first; i < last; ++i) {
+					const auto parent = m_parents[i];
+					m_transforms[i]->Update((s_no_parent == parent)
+											? nullptr : m_transforms[parent],
+											epoch);
+				}
+			}, s_grain_size);
+
+			begin = end;
+		}
+	}
+
+	void TransformHierarchy::Clear() noexcept {
+		m_transforms.clear();
+		m_parents.clear();
+		m_levels.clear();
+		m_graph_version = Node::GetGraphVersion() - 1u;
+	}
+
+	void TransformHierarchy::Build(const ProxyVector< Node >& nodes) {
+		m_transforms.clear();
+		m_parents.clear();
+		m_levels.clear();
+
+		// The first level contains the root transforms.
+		for (const auto& node : nodes) {
+			if (State::Terminated != node.GetState() && !node.HasParent()) {
+				m_transforms.push_back(&node.GetTransform());
+				m_parents.push_back(s_no_parent);
+			}
+		}
+
+		// Each next level contains the child transforms of the previous level.
+		std::size_t begin = 0u;
+		while (begin != m_transforms.size()) {
+			const auto end = m_transforms.size();
+			m_levels.push_back(end);
+
+			for (auto i = begin; i < end; ++i) {
+				const auto parent = static_cast< U32 >(i);
+				m_transforms[i]->GetOwner()->ForEachChild(
+					[this, parent](const Node& child) {
+						m_transforms.push_back(&child.GetTransform());
+						m_parents.push_back(parent);
+					});
+			}
+
+			begin = end;
+		}
+	}
+}
\ No newline at end of file
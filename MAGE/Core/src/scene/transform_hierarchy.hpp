@@ -0,0 +1,177 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection\proxy_vector.hpp"
+#include "parallel\job_system.hpp"
+#include "scene\node.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of transform hierarchies.
+
+	 A transform hierarchy flattens the transforms of a collection of nodes
+	 into arrays sorted by depth (i.e. each parent transform precedes its
+	 child transforms). The flattened arrays are only rebuilt when the graph
+	 of the nodes changes. Each update walks the arrays linearly, one level
+	 at a time, and brings the object-to-world and world-to-object matrices
+	 of all transforms up to date from their (already updated) parent
+	 transforms. The transforms of a level are independent and updated in
+	 parallel.
+	 */
+	class TransformHierarchy {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a transform hierarchy.
+		 */
+		TransformHierarchy();
+
+		/**
+		 Constructs a transform hierarchy from the given transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to copy.
+		 */
+		TransformHierarchy(const TransformHierarchy& hierarchy) = delete;
+
+		/**
+		 Constructs a transform hierarchy by moving the given transform
+		 hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to move.
+		 */
+		TransformHierarchy(TransformHierarchy&& hierarchy) noexcept;
+
+		/**
+		 Destructs this transform hierarchy.
+		 */
+		~TransformHierarchy();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given transform hierarchy to this transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to copy.
+		 @return		A reference to the copy of the given transform
+						hierarchy (i.e. this transform hierarchy).
+		 */
+		TransformHierarchy& operator=(
+			const TransformHierarchy& hierarchy) = delete;
+
+		/**
+		 Moves the given transform hierarchy to this transform hierarchy.
+
+		 @param[in]		hierarchy
+						A reference to the transform hierarchy to move.
+		 @return		A reference to the moved transform hierarchy (i.e.
+						this transform hierarchy).
+		 */
+		TransformHierarchy& operator=(
+			TransformHierarchy&& hierarchy) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates the transforms of the given nodes.
+
+		 @param[in]		nodes
+						A reference to a vector containing the nodes.
+		 @param[in]		job_system
+						A reference to the job system.
+		 */
+		void Update(const ProxyVector< Node >& nodes, JobSystem& job_system);
+
+		/**
+		 Clears this transform hierarchy.
+		 */
+		void Clear() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the parent transform of root transforms.
+		 */
+		static constexpr U32 s_no_parent = U32(-1);
+
+		/**
+		 The number of transforms per job.
+		 */
+		static constexpr std::size_t s_grain_size = 256u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rebuilds the flattened arrays of this transform hierarchy for the
+		 given nodes.
+
+		 @param[in]		nodes
+						A reference to a vector containing the nodes.
+		 */
+		void Build(const ProxyVector< Node >& nodes);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing pointers to the transforms of this transform
+		 hierarchy sorted by depth.
+		 */
+		std::vector< const Transform* > m_transforms;
+
+		/**
+		 A vector containing the index of the parent transform of each
+		 transform of this transform hierarchy.
+		 */
+		std::vector< U32 > m_parents;
+
+		/**
+		 A vector containing the end index of each level of this transform
+		 hierarchy.
+		 */
+		std::vector< std::size_t > m_levels;
+
+		/**
+		 The version of the graph of all nodes at the time this transform
+		 hierarchy was last built.
+		 */
+		U64 m_graph_version;
+	};
+}
\ No newline at end of file
@@ -47,32 +47,8 @@ namespace mage {
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
 
-		const auto teapot_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/teapot/teapot.mdl", mesh_desc);
-		const auto skull_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/skull/skull.mdl", mesh_desc);
-		const auto cone_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/cone/cone.mdl", mesh_desc);
-		const auto cube_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/cube/cube.mdl", mesh_desc);
-		const auto cylinder_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/cylinder/cylinder.mdl", mesh_desc);
-		const auto plane_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/plane/plane.mdl", mesh_desc);
-		const auto sphere_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/sphere/sphere.mdl", mesh_desc);
-		const auto trous_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/torus/torus.mdl", mesh_desc);
 		const auto sky_texture
-			= rendering_factory.GetOrCreate< Texture >(L"assets/textures/sky/sky.dds");
+			= rendering_factory.GetOrCreateAsync< Texture >(L"assets/textures/sky/sky.dds");
 		const auto logo_texture = CreateMAGETexture(rendering_factory);
 
 		//---------------------------------------------------------------------
@@ -89,14 +65,22 @@ namespace mage {
 		//---------------------------------------------------------------------
 		// Models
 		//---------------------------------------------------------------------
-		const auto teapot_node   = Import(engine, *teapot_model_desc);
-		const auto skull_node    = Import(engine, *skull_model_desc);
-		const auto cone_node     = Import(engine, *cone_model_desc);
-		const auto cube_node     = Import(engine, *cube_model_desc);
-		const auto cylinder_node = Import(engine, *cylinder_model_desc);
-		const auto plane_node    = Import(engine, *plane_model_desc);
-		const auto sphere_node   = Import(engine, *sphere_model_desc);
-		const auto torus_node    = Import(engine, *trous_model_desc);
+		const auto teapot_node
+			= ImportAsync(engine, L"assets/models/teapot/teapot.mdl", mesh_desc);
+		const auto skull_node
+			= ImportAsync(engine, L"assets/models/skull/skull.mdl", mesh_desc);
+		const auto cone_node
+			= ImportAsync(engine, L"assets/models/cone/cone.mdl", mesh_desc);
+		const auto cube_node
+			= ImportAsync(engine, L"assets/models/cube/cube.mdl", mesh_desc);
+		const auto cylinder_node
+			= ImportAsync(engine, L"assets/models/cylinder/cylinder.mdl", mesh_desc);
+		const auto plane_node
+			= ImportAsync(engine, L"assets/models/plane/plane.mdl", mesh_desc);
+		const auto sphere_node
+			= ImportAsync(engine, L"assets/models/sphere/sphere.mdl", mesh_desc);
+		const auto torus_node
+			= ImportAsync(engine, L"assets/models/torus/torus.mdl", mesh_desc);
 
 		teapot_node->GetTransform().SetScale(30.0f);
 		teapot_node->GetTransform().SetTranslationY(10.0f);
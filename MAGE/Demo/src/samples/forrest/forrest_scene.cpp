@@ -50,38 +50,8 @@ namespace mage {
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
 
-		const auto plane_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/plane/plane.obj", mesh_desc);
-		const auto tree1_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
-		const auto tree2_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree1b_lod0.mdl", mesh_desc);
-		const auto tree3_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree2a_lod0.mdl", mesh_desc);
-		const auto tree4_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree2b_lod0.mdl", mesh_desc);
-		const auto tree5_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree3a_lod0.mdl", mesh_desc);
-		const auto tree6_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree3b_lod0.mdl", mesh_desc);
-		const auto tree7_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree4a_lod0.mdl", mesh_desc);
-		const auto tree8_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree4b_lod0.mdl", mesh_desc);
-		const auto windmill_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/windmill/windmill.mdl", mesh_desc);
 		const auto sky_texture
-			= rendering_factory.GetOrCreate< Texture >(
+			= rendering_factory.GetOrCreateAsync< Texture >(
 				L"assets/textures/sky/sky.dds");
 		const auto logo_texture = CreateMAGETexture(rendering_factory);
 
@@ -99,37 +69,52 @@ namespace mage {
 		//---------------------------------------------------------------------
 		// Models
 		//---------------------------------------------------------------------
-		const auto plane_node = Import(engine, *plane_model_desc);
+		const auto plane_node
+			= ImportAsync(engine, L"assets/models/plane/plane.obj", mesh_desc);
 		plane_node->GetTransform().SetScale(30.0f);
 
-		const auto tree1_node = Import(engine, *tree1_model_desc);
+		const auto tree1_node
+			= ImportAsync(engine, L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
 		tree1_node->GetTransform().SetScale(5.0f);
 		tree1_node->GetTransform().SetTranslation(-5.0f, 2.5f, -10.0f);
-		const auto tree2_node = Import(engine, *tree2_model_desc);
+		const auto tree2_node
+			= ImportAsync(engine, L"assets/models/tree/tree1b_lod0.mdl", mesh_desc);
 		tree2_node->GetTransform().SetScale(5.0f);
 		tree2_node->GetTransform().SetTranslation(-5.0f, 2.5f, -5.0f);
-		const auto tree3_node = Import(engine, *tree3_model_desc);
+		const auto tree3_node
+			= ImportAsync(engine, L"assets/models/tree/tree2a_lod0.mdl", mesh_desc);
 		tree3_node->GetTransform().SetScale(5.0f);
 		tree3_node->GetTransform().SetTranslation(-5.0f, 2.5f, 5.0f);
-		const auto tree4_node = Import(engine, *tree4_model_desc);
+		const auto tree4_node
+			= ImportAsync(engine, L"assets/models/tree/tree2b_lod0.mdl", mesh_desc);
 		tree4_node->GetTransform().SetScale(5.0f);
 		tree4_node->GetTransform().SetTranslation(-5.0f, 2.5f, 10.0f);
-		const auto tree5_node = Import(engine, *tree5_model_desc);
+		const auto tree5_node
+			= ImportAsync(engine, L"assets/models/tree/tree3a_lod0.mdl", mesh_desc);
 		tree5_node->GetTransform().SetScale(5.0f);
 		tree5_node->GetTransform().SetTranslation(-10.0f, 2.5f, -10.0f);
-		const auto tree6_node = Import(engine, *tree6_model_desc);
+		const auto tree6_node
+			= ImportAsync(engine, L"assets/models/tree/tree3b_lod0.mdl", mesh_desc);
 		tree6_node->GetTransform().SetScale(5.0f);
 		tree6_node->GetTransform().SetTranslation(-10.0f, 2.5f, -5.0f);
-		const auto tree7_node = Import(engine, *tree7_model_desc);
+		const auto tree7_node
+			= ImportAsync(engine, L"assets/models/tree/tree4a_lod0.mdl", mesh_desc);
 		tree7_node->GetTransform().SetScale(5.0f);
 		tree7_node->GetTransform().SetTranslation(-10.0f, 2.5f, 5.0f);
-		const auto tree8_node = Import(engine, *tree8_model_desc);
+		const auto tree8_node
+			= ImportAsync(engine, L"assets/models/tree/tree4b_lod0.mdl", mesh_desc);
 		tree8_node->GetTransform().SetScale(5.0f);
 		tree8_node->GetTransform().SetTranslation(-10.0f, 2.5f, 10.0f);
 
-		std::vector< ProxyPtr< Node > >windmill_nodes;
-		const auto windmill_node = Import(engine, *windmill_model_desc,
-										  windmill_nodes);
+		const auto windmill_node = ImportAsync(engine, L"assets/models/windmill/windmill.mdl", mesh_desc,
+			[this, &engine](const std::vector< ProxyPtr< Node > >& nodes) {
+				auto script = Create< script::RotationScript >();
+				script->SetRotationAxis(script::RotationScript::RotationAxis::X);
+
+				nodes[0]->Add(script);
+				// The scripts of this scene are already loaded.
+				script->Load(engine);
+			});
 		windmill_node->GetTransform().SetScale(10.0f);
 		windmill_node->GetTransform().SetTranslationY(4.25f);
 
@@ -187,10 +172,5 @@ namespace mage {
 		camera_node->Add(Create< script::StatsScript >());
 		camera_node->Add(Create< script::MouseLookScript >());
 		camera_node->Add(Create< script::CharacterMotorScript >());
-
-		auto script = Create< script::RotationScript >();
-		script->SetRotationAxis(script::RotationScript::RotationAxis::X);
-
-		windmill_nodes[0]->Add(script);
 	}
 }
\ No newline at end of file
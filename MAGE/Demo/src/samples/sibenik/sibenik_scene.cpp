@@ -50,14 +50,8 @@ namespace mage {
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
 
-		const auto sibenik_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/sibenik/sibenik.mdl",  mesh_desc);
-		const auto tree_model_desc_tree
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
 		const auto sky_texture
-			= rendering_factory.GetOrCreate< Texture >(
+			= rendering_factory.GetOrCreateAsync< Texture >(
 				L"assets/textures/sky/sky.dds");
 		const auto logo_texture = CreateMAGETexture(rendering_factory);
 
@@ -75,11 +69,13 @@ namespace mage {
 		//---------------------------------------------------------------------
 		// Models
 		//---------------------------------------------------------------------
-		const auto sibenik_node = Import(engine, *sibenik_model_desc);
+		const auto sibenik_node
+			= ImportAsync(engine, L"assets/models/sibenik/sibenik.mdl", mesh_desc);
 		sibenik_node->GetTransform().SetScale(30.0f);
 		sibenik_node->GetTransform().SetTranslationY(12.1f);
 
-		const auto tree_node = Import(engine, *tree_model_desc_tree);
+		const auto tree_node
+			= ImportAsync(engine, L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
 		tree_node->GetTransform().SetScale(5.0f);
 		tree_node->GetTransform().AddTranslationY(2.5f);
 
@@ -51,20 +51,8 @@ namespace mage {
 		//---------------------------------------------------------------------
 		MeshDescriptor< VertexPositionNormalTexture > mesh_desc(true, true);
 
-		const auto teapot_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/teapot/teapot.mdl", mesh_desc);
-		const auto plane_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/plane/plane.obj", mesh_desc);
-		const auto sponza_model_desc
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/sponza/sponza.mdl",    mesh_desc);
-		const auto tree_model_desc_tree
-			= rendering_factory.GetOrCreate< ModelDescriptor >(
-				L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
 		const auto sky_texture
-			= rendering_factory.GetOrCreate< Texture >(
+			= rendering_factory.GetOrCreateAsync< Texture >(
 				L"assets/textures/sky/sky.dds");
 		const auto logo_texture = CreateMAGETexture(rendering_factory);
 
@@ -82,17 +70,21 @@ namespace mage {
 		//---------------------------------------------------------------------
 		// Models
 		//---------------------------------------------------------------------
-		const auto teapot_node = Import(engine, *teapot_model_desc);
+		const auto teapot_node
+			= ImportAsync(engine, L"assets/models/teapot/teapot.mdl", mesh_desc);
 		teapot_node->GetTransform().SetScale(30.0f);
 		
-		const auto plane_node = Import(engine, *plane_model_desc);
+		const auto plane_node
+			= ImportAsync(engine, L"assets/models/plane/plane.obj", mesh_desc);
 		plane_node->GetTransform().SetScale(30.0f);
 
-		const auto sponza_node = Import(engine, *sponza_model_desc);
+		const auto sponza_node
+			= ImportAsync(engine, L"assets/models/sponza/sponza.mdl", mesh_desc);
 		sponza_node->GetTransform().SetScale(10.0f);
 		sponza_node->GetTransform().SetTranslationY(2.1f);
 
-		const auto tree_node = Import(engine, *tree_model_desc_tree);
+		const auto tree_node
+			= ImportAsync(engine, L"assets/models/tree/tree1a_lod0.mdl", mesh_desc);
 		tree_node->GetTransform().AddTranslationY(1.0f);
 
 		//---------------------------------------------------------------------
@@ -10,6 +10,7 @@
 #include "meta\targetver.hpp"
 #include "meta\version.hpp"
 #include "scene\scene.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -124,6 +125,7 @@ namespace mage {
 		m_message_handler(),
 		m_input_manager(),
 		m_rendering_manager(),
+		m_job_system(),
 		m_scene(),
 		m_requested_scene(),
 		m_timer(),
@@ -195,6 +197,9 @@ namespace mage {
 															   std::move(display_config));
 		m_rendering_manager->BindPersistentState();
 
+		// Initialize the job system.
+		m_job_system = MakeUnique< JobSystem >();
+
 		// Initializes the COM library for use by the calling thread and sets
 		// the thread's concurrency model to multithreaded concurrency.
 		CoInitializeEx(nullptr, COINIT_MULTITHREADED);
@@ -209,12 +214,17 @@ namespace mage {
 
 		// Uninitialize the scene system.
 		m_scene.reset();
+		// Uninitialize the job system.
+		m_job_system.reset();
 		// Uninitialize the rendering system.
 		m_rendering_manager.reset();
 		// Uninitialize the input system.
 		m_input_manager.reset();
 		// Uninitialize the window system.
 		m_window.reset();
+
+		// Write all pending log records.
+		AsyncLogger::Get().Stop();
 	}
 
 	void Engine::RequestScene(UniquePtr< Scene >&& scene) noexcept {
@@ -242,6 +252,8 @@ namespace mage {
 
 	[[nodiscard]]
 	bool Engine::UpdateInput() {
+		MAGE_PROFILE_ZONE("Engine::UpdateInput");
+
 		// Update the input manager.
 		m_input_manager->Update();
 
@@ -256,6 +268,8 @@ namespace mage {
 
 	[[nodiscard]]
 	bool Engine::UpdateRendering() {
+		MAGE_PROFILE_ZONE("Engine::UpdateRendering");
+
 		// Handle switch between full screen and windowed mode.
 		auto& swap_chain     = m_rendering_manager->GetSwapChain();
 		const auto lost_mode = swap_chain.LostMode();
@@ -273,6 +287,8 @@ namespace mage {
 
 	[[nodiscard]]
 	bool Engine::UpdateScripting() {
+		MAGE_PROFILE_ZONE("Engine::UpdateScripting");
+
 		// Perform the fixed delta time updates of the current scene.
 		if (TimeIntervalSeconds::zero() != m_fixed_delta_time) {
 			m_fixed_time_budget += m_time.GetWallClockDeltaTime();
@@ -303,6 +319,9 @@ namespace mage {
 			}
 		});
 
+		// Recycle the elements terminated during this frame.
+		m_scene->RemoveTerminated(*this);
+
 		if (m_has_requested_scene) {
 			ApplyRequestedScene();
 
@@ -352,6 +371,9 @@ namespace mage {
 				continue;
 			}
 
+			// Profile this frame.
+			MAGE_PROFILE_FRAME();
+
 			if (UpdateInput()) {
 				continue;
 			}
@@ -367,7 +389,10 @@ namespace mage {
 				continue;
 			}
 
-			m_rendering_manager->Render(m_time);
+			// Update the transforms of the current scene.
+			m_scene->UpdateTransforms(*m_job_system);
+
+			m_rendering_manager->Render(m_time, *m_job_system);
 		}
 
 		return static_cast< int >(msg.wParam);
@@ -394,6 +419,8 @@ namespace mage {
 		// Initialize a console.
 		InitializeConsole();
 		PrintConsoleHeader();
+		// Write the log records on a background thread.
+		AsyncLogger::Get().Start();
 
 		// Enumerate the display configurations.
 		auto configurator = MakeUnique< rendering::DisplayConfigurator >();
@@ -7,6 +7,7 @@
 
 #include "engine_setup.hpp"
 #include "input_manager.hpp"
+#include "parallel\job_system.hpp"
 #include "rendering_manager.hpp"
 #include "ui\window.hpp"
 
@@ -328,6 +329,11 @@ namespace mage {
 		 */
 		UniquePtr< rendering::Manager > m_rendering_manager;
 
+		/**
+		 A pointer to the job system of this engine.
+		 */
+		UniquePtr< JobSystem > m_job_system;
+
 		/**
 		 A pointer to the current scene of this engine.
 		 */
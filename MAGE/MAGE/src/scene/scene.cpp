@@ -5,6 +5,7 @@
 
 #include "scene\scene.hpp"
 #include "resource\model\material_factory.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -16,7 +17,10 @@ namespace mage {
 	Scene::Scene(std::string name)
 		: m_name(std::move(name)),
 		m_nodes(),
-		m_scripts() {}
+		m_scripts(),
+		m_transform_hierarchy(),
+		m_termination_version(Component::GetTerminationVersion()),
+		m_lifetime() {}
 
 	Scene::Scene(Scene&& scene) noexcept = default;
 
@@ -29,6 +33,8 @@ namespace mage {
 	//-------------------------------------------------------------------------
 
 	void Scene::Initialize(Engine& engine) {
+		m_lifetime = MakeShared< bool >(true);
+
 		// Loads this scene.
 		Load(engine);
 
@@ -39,6 +45,9 @@ namespace mage {
 	}
 
 	void Scene::Uninitialize(Engine& engine) {
+		// Cancels the pending asynchronous imports of this scene.
+		m_lifetime.reset();
+
 		// Closes the behavior scripts of this scene.
 		ForEach< BehaviorScript >([&engine](BehaviorScript& script) {
 			script.Close(engine);
@@ -53,11 +62,35 @@ namespace mage {
 		Clear();
 	}
 
+	void Scene::RemoveTerminated(Engine& engine) {
+		// Only sweep if a component or node has been terminated.
+		const auto termination_version = Component::GetTerminationVersion();
+		if (termination_version == m_termination_version) {
+			return;
+		}
+		m_termination_version = termination_version;
+
+		MAGE_PROFILE_ZONE("Scene::RemoveTerminated");
+
+		// Removes the terminated components before their owners.
+		engine.GetRenderingManager().GetWorld().RemoveTerminated();
+
+		RemoveTerminatedElements(m_nodes);
+		RemoveTerminatedElements(m_scripts);
+	}
+
+	void Scene::UpdateTransforms(JobSystem& job_system) {
+		MAGE_PROFILE_ZONE("Scene::UpdateTransforms");
+
+		m_transform_hierarchy.Update(m_nodes, job_system);
+	}
+
 	void Scene::Load([[maybe_unused]] Engine& engine) {}
 
 	void Scene::Close([[maybe_unused]] Engine& engine) {}
 
 	void Scene::Clear() noexcept {
+		m_transform_hierarchy.Clear();
 		m_nodes.clear();
 		m_scripts.clear();
 	}
@@ -8,7 +8,18 @@
 #include "engine.hpp"
 #include "scene\node.hpp"
 #include "scene\scene_utils.hpp"
+#include "scene\transform_hierarchy.hpp"
 #include "scene\script\behavior_script.hpp"
+#include "resource\model\model_factory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
 
 #pragma endregion
 
@@ -80,6 +91,26 @@ namespace mage {
 		 */
 		void Uninitialize(Engine& engine);
 
+		/**
+		 Removes the terminated nodes and behavior scripts of this scene and
+		 the terminated components of the world of the given engine. The
+		 slots of the removed elements are reused by subsequently created
+		 elements. Nothing is removed if no component or node has been
+		 terminated since the previous removal.
+
+		 @param[in,out]	engine
+						A reference to the engine.
+		 */
+		void RemoveTerminated(Engine& engine);
+
+		/**
+		 Updates the transforms of the nodes of this scene.
+
+		 @param[in,out]	job_system
+						A reference to the job system.
+		 */
+		void UpdateTransforms(JobSystem& job_system);
+
 		//---------------------------------------------------------------------
 		// Member Methods: Nodes and Components
 		//---------------------------------------------------------------------
@@ -90,6 +121,41 @@ namespace mage {
 								const rendering::ModelDescriptor& desc,
 								std::vector< ProxyPtr< Node > >& nodes);
 
+		/**
+		 Imports the model with the given filename into this scene
+		 asynchronously.
+
+		 The returned node contains a placeholder model until the model is
+		 created. The model is then imported as a child of the returned node
+		 on the rendering thread, unless this scene is uninitialized or the
+		 returned node is terminated in the meantime.
+
+		 @pre			This scene is initialized.
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in,out]	engine
+						A reference to the engine.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		desc
+						A reference to the mesh descriptor.
+		 @param[in]		on_import
+						The function to call with the imported nodes once the
+						model is imported.
+		 @return		A pointer to the node.
+		 @throws		Exception
+						Failed to create the placeholder model.
+		 */
+		template< typename VertexT, typename IndexT >
+		ProxyPtr< Node > ImportAsync(Engine& engine,
+									 const std::wstring& fname,
+									 const rendering::MeshDescriptor< VertexT, IndexT >&
+									 desc = rendering::MeshDescriptor< VertexT, IndexT >(),
+									 std::function< void(const std::vector< ProxyPtr< Node > >&) >
+									 on_import = {});
+
 		template< typename ElementT, typename... ConstructorArgsT >
 		typename std::enable_if_t< std::is_same_v< Node, ElementT >,
 			ProxyPtr< ElementT > > Create(ConstructorArgsT&&... args);
@@ -202,12 +268,30 @@ namespace mage {
 		/**
 		 A vector containing the nodes of this scene.
 		 */
-		AlignedVector< Node > m_nodes;
+		ProxyVector< Node > m_nodes;
 
 		/**
 		 A vector containing the pointers to the scripts of this scene.
 		 */
-		AlignedVector< UniquePtr< BehaviorScript > > m_scripts;
+		ProxyVector< UniquePtr< BehaviorScript > > m_scripts;
+
+		/**
+		 The transform hierarchy of the nodes of this scene.
+		 */
+		TransformHierarchy m_transform_hierarchy;
+
+		/**
+		 The termination version of all components and nodes at the
+		 previous removal of the terminated elements of this scene.
+		 */
+		U64 m_termination_version;
+
+		/**
+		 A pointer to the lifetime token of this scene. The token only exists
+		 while this scene is initialized: asynchronous callbacks capturing
+		 this scene are cancelled once their weak pointer to it expired.
+		 */
+		SharedPtr< bool > m_lifetime;
 
 		//---------------------------------------------------------------------
 		// Member Variables: Identification
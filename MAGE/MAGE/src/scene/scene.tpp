@@ -32,6 +32,58 @@ namespace mage {
 
 	#pragma endregion
 
+	//-------------------------------------------------------------------------
+	// Scene: Import
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	template< typename VertexT, typename IndexT >
+	ProxyPtr< Node > Scene::ImportAsync(Engine& engine,
+										const std::wstring& fname,
+										const rendering::MeshDescriptor< VertexT, IndexT >& desc,
+										std::function< void(const std::vector< ProxyPtr< Node > >&) >
+										on_import) {
+
+		using namespace rendering;
+
+		auto& resource_manager = engine.GetRenderingManager().GetResourceManager();
+
+		const auto root        = Create< Node >("model");
+		const auto placeholder = Import(engine,
+										*CreatePlaceholderModel(resource_manager));
+		root->AddChild(placeholder);
+
+		resource_manager.GetOrCreateAsync< ModelDescriptor >(fname, desc,
+			[this, &engine, root, placeholder, on_import,
+			 lifetime = WeakPtr< const bool >(m_lifetime)]
+			(const ModelDescriptorPtr& model) {
+
+			// The nodes are cleared once this scene is uninitialized.
+			if (lifetime.expired()
+				|| nullptr == root
+				|| State::Terminated == root->GetState()) {
+				return;
+			}
+
+			if (nullptr != placeholder) {
+				placeholder->SetState(State::Terminated);
+			}
+
+			std::vector< ProxyPtr< Node > > nodes;
+			const auto node = Import(engine, *model, nodes);
+			node->SetState(root->GetState());
+			root->AddChild(node);
+
+			if (on_import) {
+				on_import(nodes);
+			}
+		});
+
+		return root;
+	}
+
+	#pragma endregion
+
 	//-------------------------------------------------------------------------
 	// Scene: Count
 	//-------------------------------------------------------------------------
@@ -537,6 +537,33 @@ namespace mage {
 			return AABB(p_min, p_max);
 		}
 
+		/**
+		 Returns the AABB enclosing the given AABB transformed by the given
+		 transformation matrix.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @param[in]		transform
+						The transformation matrix.
+		 @return		The AABB enclosing @a aabb transformed by
+						@a transform.
+		 */
+		[[nodiscard]]
+		static const AABB XM_CALLCONV Transform(const AABB& aabb,
+												FXMMATRIX transform) noexcept {
+
+			const auto r = aabb.Radius();
+
+			// The radius of the enclosing AABB along each axis is the sum of
+			// the absolute projections of the radius of the given AABB.
+			const auto centroid = XMVector3Transform(aabb.Centroid(), transform);
+			const auto radius   = XMVectorAbs(transform.r[0]) * XMVectorSplatX(r)
+				                + XMVectorAbs(transform.r[1]) * XMVectorSplatY(r)
+				                + XMVectorAbs(transform.r[2]) * XMVectorSplatZ(r);
+
+			return AABB(centroid - radius, centroid + radius);
+		}
+
 		/**
 		 Returns the overlap AABB of the two given AABBs.
 
@@ -1193,6 +1220,25 @@ namespace mage {
 		BoundingFrustum& operator=(BoundingFrustum&&
 								   frustum) noexcept = default;
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the (inward facing, normalized) plane of this bounding frustum
+		 at the given index.
+
+		 @pre			@a index is smaller than six.
+		 @param[in]		index
+						The index of the plane (i.e. left, right, bottom, top,
+						near, far).
+		 @return		The plane of this bounding frustum at the given index.
+		 */
+		[[nodiscard]]
+		const XMVECTOR XM_CALLCONV GetPlane(std::size_t index) const noexcept {
+			return m_planes[index];
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Enclosing = Full Coverage
 		//---------------------------------------------------------------------
@@ -0,0 +1,286 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <numeric>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The number of bins used for evaluating the SAH.
+		 */
+		constexpr std::size_t g_nb_bins = 16u;
+
+		/**
+		 The maximum number of primitives of leaf nodes which are cheaper
+		 (according to the SAH) than any split.
+		 */
+		constexpr U32 g_max_leaf_size = 8u;
+
+		/**
+		 The cost of traversing a node relative to the cost of testing a
+		 primitive.
+		 */
+		constexpr F32 g_traversal_cost = 1.0f;
+
+		/**
+		 Returns the half surface area of the given AABB.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 @return		The half surface area of the given AABB.
+		 */
+		[[nodiscard]]
+		F32 HalfSurfaceArea(const AABB& aabb) noexcept {
+			const auto d = XMStore< F32x3 >(XMVectorMax(aabb.Diagonal(),
+														XMVectorZero()));
+			return d[0] * d[1] + d[1] * d[2] + d[2] * d[0];
+		}
+
+		/**
+		 A struct of SAH bins.
+		 */
+		struct Bin {
+
+		public:
+
+			/**
+			 The AABB of the primitives of this bin.
+			 */
+			AABB m_aabb;
+
+			/**
+			 The number of primitives of this bin.
+			 */
+			U32 m_count = 0u;
+		};
+	}
+
+	BVH::BVH() noexcept
+		: m_nodes(),
+		m_aabbs(),
+		m_indices(),
+		m_build_cost(0.0f),
+		m_cost(0.0f) {}
+
+	BVH::BVH(const BVH& bvh) = default;
+
+	BVH::BVH(BVH&& bvh) noexcept = default;
+
+	BVH::~BVH() = default;
+
+	BVH& BVH::operator=(const BVH& bvh) = default;
+
+	BVH& BVH::operator=(BVH&& bvh) noexcept = default;
+
+	void BVH::Build(const AABB* aabbs, std::size_t nb_aabbs) {
+		Clear();
+
+		if (0u == nb_aabbs) {
+			return;
+		}
+
+		std::vector< F32x3 > centroids;
+		centroids.reserve(nb_aabbs);
+		for (std::size_t i = 0u; i < nb_aabbs; ++i) {
+			centroids.push_back(XMStore< F32x3 >(aabbs[i].Centroid()));
+		}
+
+		m_indices.resize(nb_aabbs);
+		std::iota(m_indices.begin(), m_indices.end(), 0u);
+
+		m_nodes.reserve(2u * nb_aabbs - 1u);
+		BuildNode(aabbs, centroids.data(), 0u, static_cast< U32 >(nb_aabbs), 0u);
+
+		m_aabbs.reserve(nb_aabbs);
+		for (const auto index : m_indices) {
+			m_aabbs.push_back(aabbs[index]);
+		}
+
+		m_build_cost = ComputeCost();
+		m_cost       = m_build_cost;
+	}
+
+	void BVH::Refit(const AABB* aabbs) {
+		for (std::size_t i = 0u; i < m_indices.size(); ++i) {
+			m_aabbs[i] = aabbs[m_indices[i]];
+		}
+
+		// The children of a node succeed their parent.
+		for (auto i = m_nodes.size(); 0u < i--;) {
+			auto& node = m_nodes[i];
+
+			if (0u == node.m_right) {
+				AABB aabb;
+				for (auto j = node.m_first; j < node.m_first + node.m_count; ++j) {
+					aabb = AABB::Union(aabb, m_aabbs[j]);
+				}
+				node.m_aabb = aabb;
+			}
+			else {
+				node.m_aabb = AABB::Union(m_nodes[i + 1u].m_aabb,
+										  m_nodes[node.m_right].m_aabb);
+			}
+		}
+
+		m_cost = ComputeCost();
+	}
+
+	void BVH::Clear() noexcept {
+		m_nodes.clear();
+		m_aabbs.clear();
+		m_indices.clear();
+		m_build_cost = 0.0f;
+		m_cost       = 0.0f;
+	}
+
+	U32 BVH::BuildNode(const AABB* aabbs,
+					   const F32x3* centroids,
+					   U32 first,
+					   U32 count,
+					   std::size_t depth) {
+
+		const auto index = static_cast< U32 >(m_nodes.size());
+		m_nodes.push_back({ AABB(), first, count, 0u });
+
+		AABB aabb;
+		auto centroid_min = XMVectorReplicate(std::numeric_limits< F32 >::infinity());
+		auto centroid_max = -centroid_min;
+		for (auto i = first; i < first + count; ++i) {
+			const auto& primitive = aabbs[m_indices[i]];
+			aabb = AABB::Union(aabb, primitive);
+			centroid_min = XMVectorMin(centroid_min, primitive.Centroid());
+			centroid_max = XMVectorMax(centroid_max, primitive.Centroid());
+		}
+		m_nodes[index].m_aabb = aabb;
+
+		if (1u == count || s_max_depth <= depth) {
+			return index;
+		}
+
+		// Find the cheapest split (according to the binned SAH).
+		const auto lower  = XMStore< F32x3 >(centroid_min);
+		const auto extent = XMStore< F32x3 >(centroid_max - centroid_min);
+
+		const auto get_bin = [&lower, &extent](const F32x3& centroid,
+											   std::size_t axis) noexcept {
+			const auto t = (centroid[axis] - lower[axis]) / extent[axis];
+			return std::min(static_cast< std::size_t >(t * g_nb_bins),
+							g_nb_bins - 1u);
+		};
+
+		auto best_cost  = std::numeric_limits< F32 >::infinity();
+		auto best_axis  = std::size_t(3u);
+		auto best_split = std::size_t(0u);
+
+		for (std::size_t axis = 0u; axis < 3u; ++axis) {
+			if (extent[axis] <= 0.0f) {
+				continue;
+			}
+
+			Bin bins[g_nb_bins];
+			for (auto i = first; i < first + count; ++i) {
+				const auto primitive = m_indices[i];
+				auto& bin = bins[get_bin(centroids[primitive], axis)];
+				bin.m_aabb = AABB::Union(bin.m_aabb, aabbs[primitive]);
+				++bin.m_count;
+			}
+
+			// Sweep from the right to accumulate the right partitions.
+			F32 right_areas[g_nb_bins - 1u];
+			U32 right_counts[g_nb_bins - 1u];
+			AABB right;
+			U32 right_count = 0u;
+			for (auto b = g_nb_bins - 1u; 0u < b; --b) {
+				right        = AABB::Union(right, bins[b].m_aabb);
+				right_count += bins[b].m_count;
+				right_areas[b - 1u]  = HalfSurfaceArea(right);
+				right_counts[b - 1u] = right_count;
+			}
+
+			// Sweep from the left to evaluate the splits.
+			AABB left;
+			U32 left_count = 0u;
+			for (std::size_t b = 0u; b < g_nb_bins - 1u; ++b) {
+				left        = AABB::Union(left, bins[b].m_aabb);
+				left_count += bins[b].m_count;
+
+				if (0u == left_count || 0u == right_counts[b]) {
+					continue;
+				}
+
+				const auto cost = left_count * HalfSurfaceArea(left)
+					            + right_counts[b] * right_areas[b];
+				if (cost < best_cost) {
+					best_cost  = cost;
+					best_axis  = axis;
+					best_split = b;
+				}
+			}
+		}
+
+		// All centroids coincide.
+		if (3u == best_axis) {
+			return index;
+		}
+
+		const auto area = HalfSurfaceArea(aabb);
+		const auto leaf_cost  = count * area;
+		const auto split_cost = g_traversal_cost * area + best_cost;
+		if (count <= g_max_leaf_size && leaf_cost <= split_cost) {
+			return index;
+		}
+
+		const auto begin  = m_indices.begin() + first;
+		const auto middle = std::partition(begin, begin + count,
+			[centroids, &get_bin, best_axis, best_split](U32 primitive) noexcept {
+				return get_bin(centroids[primitive], best_axis) <= best_split;
+			});
+		const auto left_count = static_cast< U32 >(middle - begin);
+
+		BuildNode(aabbs, centroids, first, left_count, depth + 1u);
+		const auto right = BuildNode(aabbs, centroids, first + left_count,
+									 count - left_count, depth + 1u);
+		m_nodes[index].m_right = right;
+
+		return index;
+	}
+
+	[[nodiscard]]
+	F32 BVH::ComputeCost() const noexcept {
+		if (m_nodes.empty()) {
+			return 0.0f;
+		}
+
+		const auto root_area = HalfSurfaceArea(m_nodes[0].m_aabb);
+		if (root_area <= 0.0f) {
+			return 0.0f;
+		}
+
+		F32 cost = 0.0f;
+		for (const auto& node : m_nodes) {
+			const auto area = HalfSurfaceArea(node.m_aabb);
+			cost += (0u == node.m_right) ? node.m_count * area
+				                         : g_traversal_cost * area;
+		}
+
+		return cost / root_area;
+	}
+}
\ No newline at end of file
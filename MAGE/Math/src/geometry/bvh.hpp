@@ -0,0 +1,337 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of Bounding Volume Hierarchies (BVHs).
+
+	 A BVH is a binary tree of AABBs over a set of primitives, each
+	 represented by its AABB and referred to by its index. The BVH is built
+	 top-down using the binned Surface Area Heuristic (SAH). If the AABBs of
+	 the primitives change, the BVH can be refitted (i.e. the AABBs of the
+	 nodes are recomputed while the topology is preserved), which is much
+	 cheaper than a rebuild but degrades the quality of the BVH over time.
+
+	 The nodes are stored in depth-first order: the left child of a node
+	 directly follows its parent, and the primitives of each subtree are
+	 contiguous.
+	 */
+	class BVH {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty BVH.
+		 */
+		BVH() noexcept;
+
+		/**
+		 Constructs a BVH from the given BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to copy.
+		 */
+		BVH(const BVH& bvh);
+
+		/**
+		 Constructs a BVH by moving the given BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to move.
+		 */
+		BVH(BVH&& bvh) noexcept;
+
+		/**
+		 Destructs this BVH.
+		 */
+		~BVH();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given BVH to this BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to copy.
+		 @return		A reference to the copy of the given BVH (i.e. this
+						BVH).
+		 */
+		BVH& operator=(const BVH& bvh);
+
+		/**
+		 Moves the given BVH to this BVH.
+
+		 @param[in]		bvh
+						A reference to the BVH to move.
+		 @return		A reference to the moved BVH (i.e. this BVH).
+		 */
+		BVH& operator=(BVH&& bvh) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of primitives of this BVH.
+
+		 @return		The number of primitives of this BVH.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfPrimitives() const noexcept {
+			return m_indices.size();
+		}
+
+		/**
+		 Returns the number of nodes of this BVH.
+
+		 @return		The number of nodes of this BVH.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfNodes() const noexcept {
+			return m_nodes.size();
+		}
+
+		/**
+		 Returns the SAH cost of this BVH at the time it was built.
+
+		 @return		The SAH cost of this BVH at the time it was built.
+		 */
+		[[nodiscard]]
+		F32 GetBuildCost() const noexcept {
+			return m_build_cost;
+		}
+
+		/**
+		 Returns the SAH cost of this BVH. The cost is expressed relative to
+		 the surface area of the root node, and increases as the BVH is
+		 refitted.
+
+		 @return		The SAH cost of this BVH.
+		 */
+		[[nodiscard]]
+		F32 GetCost() const noexcept {
+			return m_cost;
+		}
+
+		/**
+		 Builds this BVH for the given primitives.
+
+		 @param[in]		aabbs
+						A pointer to the AABBs of the primitives.
+		 @param[in]		nb_aabbs
+						The number of primitives.
+		 */
+		void Build(const AABB* aabbs, std::size_t nb_aabbs);
+
+		/**
+		 Refits this BVH for the given primitives.
+
+		 @pre			@a aabbs points to as many AABBs as the number of
+						primitives this BVH was built for, in the same order.
+		 @param[in]		aabbs
+						A pointer to the AABBs of the primitives.
+		 */
+		void Refit(const AABB* aabbs);
+
+		/**
+		 Removes all primitives and nodes of this BVH.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Applies the given action to each primitive of this BVH whose AABB
+		 is not culled by the given bounding frustum.
+
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(U32)@endcode taking the index of
+						a primitive.
+		 @param[in]		frustum
+						A reference to the bounding frustum.
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ActionT >
+		void ForEach(const BoundingFrustum& frustum, ActionT&& action) const;
+
+		/**
+		 Applies the given action to each primitive of this BVH whose AABB
+		 overlaps the given bounding sphere.
+
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(U32)@endcode taking the index of
+						a primitive.
+		 @param[in]		sphere
+						A reference to the bounding sphere.
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ActionT >
+		void ForEach(const BoundingSphere& sphere, ActionT&& action) const;
+
+		/**
+		 Applies the given action to each primitive of this BVH whose AABB
+		 is intersected by the given ray segment.
+
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(U32)@endcode taking the index of
+						a primitive.
+		 @param[in]		origin
+						The origin of the ray.
+		 @param[in]		direction
+						The direction of the ray.
+		 @param[in]		max_distance
+						The maximum distance along the ray (expressed in units
+						of @a direction).
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ActionT >
+		void XM_CALLCONV ForEach(FXMVECTOR origin,
+								 FXMVECTOR direction,
+								 F32 max_distance,
+								 ActionT&& action) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of BVH nodes.
+		 */
+		struct Node {
+
+		public:
+
+			/**
+			 The AABB of this node.
+			 */
+			AABB m_aabb;
+
+			/**
+			 The index of the first primitive of the subtree of this node.
+			 */
+			U32 m_first;
+
+			/**
+			 The number of primitives of the subtree of this node.
+			 */
+			U32 m_count;
+
+			/**
+			 The index of the right child of this node, or zero if this
+			 node is a leaf node.
+			 */
+			U32 m_right;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum depth of BVHs. Deeper nodes are leaf nodes.
+		 */
+		static constexpr std::size_t s_max_depth = 64u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds the subtree for the primitives in the given range.
+
+		 @param[in]		aabbs
+						A pointer to the AABBs of the primitives.
+		 @param[in]		centroids
+						A pointer to the centroids of the AABBs of the
+						primitives.
+		 @param[in]		first
+						The index of the first primitive of the range.
+		 @param[in]		count
+						The number of primitives of the range.
+		 @param[in]		depth
+						The depth of the subtree.
+		 @return		The index of the root node of the subtree.
+		 */
+		U32 BuildNode(const AABB* aabbs,
+					  const F32x3* centroids,
+					  U32 first,
+					  U32 count,
+					  std::size_t depth);
+
+		/**
+		 Computes the SAH cost of this BVH.
+
+		 @return		The SAH cost of this BVH.
+		 */
+		[[nodiscard]]
+		F32 ComputeCost() const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The nodes of this BVH (in depth-first order).
+		 */
+		AlignedVector< Node > m_nodes;
+
+		/**
+		 The AABBs of the primitives of this BVH (in leaf order).
+		 */
+		AlignedVector< AABB > m_aabbs;
+
+		/**
+		 The indices of the primitives of this BVH (in leaf order).
+		 */
+		std::vector< U32 > m_indices;
+
+		/**
+		 The SAH cost of this BVH at the time it was built.
+		 */
+		F32 m_build_cost;
+
+		/**
+		 The SAH cost of this BVH.
+		 */
+		F32 m_cost;
+	};
+
+	/**
+	 A class of Bounding Volume Hierarchies (BVHs).
+	 */
+	using BoundingVolumeHierarchy = BVH;
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bvh.tpp"
+
+#pragma endregion
\ No newline at end of file
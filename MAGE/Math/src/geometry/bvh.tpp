@@ -0,0 +1,166 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ActionT >
+	void BVH::ForEach(const BoundingFrustum& frustum, ActionT&& action) const {
+		if (m_nodes.empty()) {
+			return;
+		}
+
+		U32 stack[s_max_depth + 1u];
+		std::size_t size = 0u;
+		stack[size++] = 0u;
+
+		while (0u != size) {
+			const auto& node = m_nodes[stack[--size]];
+
+			if (!frustum.Overlaps(node.m_aabb)) {
+				continue;
+			}
+
+			// The primitives of a completely enclosed subtree are not culled.
+			if (frustum.Encloses(node.m_aabb)) {
+				for (auto i = node.m_first; i < node.m_first + node.m_count; ++i) {
+					action(m_indices[i]);
+				}
+				continue;
+			}
+
+			if (0u == node.m_right) {
+				for (auto i = node.m_first; i < node.m_first + node.m_count; ++i) {
+					if (frustum.Overlaps(m_aabbs[i])) {
+						action(m_indices[i]);
+					}
+				}
+				continue;
+			}
+
+			stack[size++] = node.m_right;
+			stack[size++] = static_cast< U32 >(&node - m_nodes.data()) + 1u;
+		}
+	}
+
+	template< typename ActionT >
+	void BVH::ForEach(const BoundingSphere& sphere, ActionT&& action) const {
+		if (m_nodes.empty()) {
+			return;
+		}
+
+		const auto centroid = sphere.Centroid();
+		const auto radius   = sphere.Radius();
+		const auto sqr_radius = radius * radius;
+
+		// Checks whether the sphere overlaps the given AABB, based on the
+		// squared distance between the centroid of the sphere and the AABB.
+		const auto overlaps = [centroid, sqr_radius](const AABB& aabb) noexcept {
+			const auto d = XMVectorMax(
+				XMVectorMax(aabb.MinPoint() - centroid, centroid - aabb.MaxPoint()),
+				XMVectorZero());
+			return XMVectorGetX(XMVector3LengthSq(d)) <= sqr_radius;
+		};
+
+		U32 stack[s_max_depth + 1u];
+		std::size_t size = 0u;
+		stack[size++] = 0u;
+
+		while (0u != size) {
+			const auto& node = m_nodes[stack[--size]];
+
+			if (!overlaps(node.m_aabb)) {
+				continue;
+			}
+
+			if (0u == node.m_right) {
+				for (auto i = node.m_first; i < node.m_first + node.m_count; ++i) {
+					if (overlaps(m_aabbs[i])) {
+						action(m_indices[i]);
+					}
+				}
+				continue;
+			}
+
+			stack[size++] = node.m_right;
+			stack[size++] = static_cast< U32 >(&node - m_nodes.data()) + 1u;
+		}
+	}
+
+	template< typename ActionT >
+	void XM_CALLCONV BVH::ForEach(FXMVECTOR origin,
+								  FXMVECTOR direction,
+								  F32 max_distance,
+								  ActionT&& action) const {
+		if (m_nodes.empty()) {
+			return;
+		}
+
+		const auto o     = XMStore< F32x3 >(origin);
+		const auto inv_d = XMStore< F32x3 >(XMVectorReciprocal(direction));
+
+		// Checks whether the ray segment intersects the given AABB (slab
+		// test). Axes along which the direction vanishes are handled
+		// separately, since (0 * inf) would result in NaN.
+		const auto intersects = [o, inv_d, max_distance]
+			(const AABB& aabb) noexcept {
+
+			const auto p_min = XMStore< F32x3 >(aabb.MinPoint());
+			const auto p_max = XMStore< F32x3 >(aabb.MaxPoint());
+
+			auto t_enter = 0.0f;
+			auto t_exit  = max_distance;
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				if (!std::isfinite(inv_d[i])) {
+					// The ray is parallel to the slab.
+					if (o[i] < p_min[i] || p_max[i] < o[i]) {
+						return false;
+					}
+					continue;
+				}
+
+				const auto t1 = (p_min[i] - o[i]) * inv_d[i];
+				const auto t2 = (p_max[i] - o[i]) * inv_d[i];
+				t_enter = std::max(t_enter, std::min(t1, t2));
+				t_exit  = std::min(t_exit,  std::max(t1, t2));
+			}
+
+			return t_enter <= t_exit;
+		};
+
+		U32 stack[s_max_depth + 1u];
+		std::size_t size = 0u;
+		stack[size++] = 0u;
+
+		while (0u != size) {
+			const auto& node = m_nodes[stack[--size]];
+
+			if (!intersects(node.m_aabb)) {
+				continue;
+			}
+
+			if (0u == node.m_right) {
+				for (auto i = node.m_first; i < node.m_first + node.m_count; ++i) {
+					if (intersects(m_aabbs[i])) {
+						action(m_indices[i]);
+					}
+				}
+				continue;
+			}
+
+			stack[size++] = node.m_right;
+			stack[size++] = static_cast< U32 >(&node - m_nodes.data()) + 1u;
+		}
+	}
+}
\ No newline at end of file
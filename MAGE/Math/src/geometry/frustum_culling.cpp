@@ -0,0 +1,455 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\frustum_culling.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#ifdef __AVX2__
+	#include <immintrin.h>
+#endif
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 A struct of frustum planes.
+
+		 A bounding volume with centroid c and radius r is not culled by the
+		 frustum planes if for each frustum plane (n, d):
+		 0 <= n . c + d + (a_x r_x + a_y r_y + a_z r_z)
+		 with a = |n| for AABBs, and a = (1, 0, 0) and r_x = r_y = r_z = r for
+		 bounding spheres.
+		 */
+		struct FrustumPlanes {
+
+		public:
+
+			/**
+			 The x components of the normals of the frustum planes.
+			 */
+			F32 m_nx[6];
+
+			/**
+			 The y components of the normals of the frustum planes.
+			 */
+			F32 m_ny[6];
+
+			/**
+			 The z components of the normals of the frustum planes.
+			 */
+			F32 m_nz[6];
+
+			/**
+			 The offsets of the frustum planes.
+			 */
+			F32 m_d[6];
+
+			/**
+			 The x components of the radius weights of the frustum planes.
+			 */
+			F32 m_ax[6];
+
+			/**
+			 The y components of the radius weights of the frustum planes.
+			 */
+			F32 m_ay[6];
+
+			/**
+			 The z components of the radius weights of the frustum planes.
+			 */
+			F32 m_az[6];
+		};
+
+		/**
+		 A struct of bounding volume streams.
+		 */
+		struct VolumeStreams {
+
+		public:
+
+			/**
+			 A pointer to the x components of the centroids.
+			 */
+			const F32* m_cx;
+
+			/**
+			 A pointer to the y components of the centroids.
+			 */
+			const F32* m_cy;
+
+			/**
+			 A pointer to the z components of the centroids.
+			 */
+			const F32* m_cz;
+
+			/**
+			 A pointer to the x components of the radii.
+			 */
+			const F32* m_rx;
+
+			/**
+			 A pointer to the y components of the radii.
+			 */
+			const F32* m_ry;
+
+			/**
+			 A pointer to the z components of the radii.
+			 */
+			const F32* m_rz;
+
+			/**
+			 The number of bounding volumes.
+			 */
+			std::size_t m_size;
+		};
+
+		/**
+		 Extracts the frustum planes of the given bounding frustum.
+
+		 @param[in]		frustum
+						A reference to the bounding frustum.
+		 @param[in]		spheres
+						@c true if the frustum planes are used for culling
+						bounding spheres. @c false if the frustum planes are
+						used for culling AABBs.
+		 @return		The frustum planes of the given bounding frustum.
+		 */
+		[[nodiscard]]
+		const FrustumPlanes ExtractPlanes(const BoundingFrustum& frustum,
+										  bool spheres) noexcept {
+			FrustumPlanes planes;
+
+			for (std::size_t i = 0u; i < std::size(planes.m_d); ++i) {
+				const auto plane = XMStore< F32x4 >(frustum.GetPlane(i));
+				planes.m_nx[i] = plane[0];
+				planes.m_ny[i] = plane[1];
+				planes.m_nz[i] = plane[2];
+				planes.m_d[i]  = plane[3];
+
+				if (spheres) {
+					planes.m_ax[i] = 1.0f;
+					planes.m_ay[i] = 0.0f;
+					planes.m_az[i] = 0.0f;
+				}
+				else {
+					planes.m_ax[i] = std::abs(plane[0]);
+					planes.m_ay[i] = std::abs(plane[1]);
+					planes.m_az[i] = std::abs(plane[2]);
+				}
+			}
+
+			return planes;
+		}
+
+		/**
+		 Culls the given bounding volumes against the given frustum planes.
+
+		 The bounding volumes are processed eight (AVX2) or four (SSE) at a
+		 time; the remaining bounding volumes are processed one at a time.
+		 The indices of the non-culled bounding volumes are compacted without
+		 branches: each index is written, but the output position only
+		 advances for non-culled bounding volumes.
+
+		 @param[in]		planes
+						A reference to the frustum planes.
+		 @param[in]		volumes
+						A reference to the bounding volume streams.
+		 @param[out]	indices
+						A reference to a vector which will contain the indices
+						of the non-culled bounding volumes.
+		 */
+		void CullVolumes(const FrustumPlanes& planes,
+						 const VolumeStreams& volumes,
+						 std::vector< U32 >& indices) {
+
+			indices.resize(volumes.m_size);
+			const auto output = indices.data();
+
+			std::size_t i     = 0u;
+			std::size_t count = 0u;
+
+			#ifdef __AVX2__
+
+			{
+				__m256 nx[6], ny[6], nz[6], d[6], ax[6], ay[6], az[6];
+				for (std::size_t p = 0u; p < std::size(d); ++p) {
+					nx[p] = _mm256_set1_ps(planes.m_nx[p]);
+					ny[p] = _mm256_set1_ps(planes.m_ny[p]);
+					nz[p] = _mm256_set1_ps(planes.m_nz[p]);
+					d[p]  = _mm256_set1_ps(planes.m_d[p]);
+					ax[p] = _mm256_set1_ps(planes.m_ax[p]);
+					ay[p] = _mm256_set1_ps(planes.m_ay[p]);
+					az[p] = _mm256_set1_ps(planes.m_az[p]);
+				}
+
+				const auto zero = _mm256_setzero_ps();
+
+				for (; i + 8u <= volumes.m_size; i += 8u) {
+					const auto cx = _mm256_loadu_ps(volumes.m_cx + i);
+					const auto cy = _mm256_loadu_ps(volumes.m_cy + i);
+					const auto cz = _mm256_loadu_ps(volumes.m_cz + i);
+					const auto rx = _mm256_loadu_ps(volumes.m_rx + i);
+					const auto ry = _mm256_loadu_ps(volumes.m_ry + i);
+					const auto rz = _mm256_loadu_ps(volumes.m_rz + i);
+
+					auto visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+					for (std::size_t p = 0u; p < std::size(d); ++p) {
+						auto distance = _mm256_fmadd_ps(nx[p], cx, d[p]);
+						distance = _mm256_fmadd_ps(ny[p], cy, distance);
+						distance = _mm256_fmadd_ps(nz[p], cz, distance);
+						distance = _mm256_fmadd_ps(ax[p], rx, distance);
+						distance = _mm256_fmadd_ps(ay[p], ry, distance);
+						distance = _mm256_fmadd_ps(az[p], rz, distance);
+						visible  = _mm256_and_ps(visible,
+							_mm256_cmp_ps(distance, zero, _CMP_GE_OQ));
+					}
+
+					const auto mask = static_cast< U32 >(_mm256_movemask_ps(visible));
+					for (U32 j = 0u; j < 8u; ++j) {
+						output[count] = static_cast< U32 >(i) + j;
+						count += (mask >> j) & 1u;
+					}
+				}
+			}
+
+			#endif
+
+			#ifdef _XM_SSE_INTRINSICS_
+
+			{
+				__m128 nx[6], ny[6], nz[6], d[6], ax[6], ay[6], az[6];
+				for (std::size_t p = 0u; p < std::size(d); ++p) {
+					nx[p] = _mm_set1_ps(planes.m_nx[p]);
+					ny[p] = _mm_set1_ps(planes.m_ny[p]);
+					nz[p] = _mm_set1_ps(planes.m_nz[p]);
+					d[p]  = _mm_set1_ps(planes.m_d[p]);
+					ax[p] = _mm_set1_ps(planes.m_ax[p]);
+					ay[p] = _mm_set1_ps(planes.m_ay[p]);
+					az[p] = _mm_set1_ps(planes.m_az[p]);
+				}
+
+				const auto zero = _mm_setzero_ps();
+
+				for (; i + 4u <= volumes.m_size; i += 4u) {
+					const auto cx = _mm_loadu_ps(volumes.m_cx + i);
+					const auto cy = _mm_loadu_ps(volumes.m_cy + i);
+					const auto cz = _mm_loadu_ps(volumes.m_cz + i);
+					const auto rx = _mm_loadu_ps(volumes.m_rx + i);
+					const auto ry = _mm_loadu_ps(volumes.m_ry + i);
+					const auto rz = _mm_loadu_ps(volumes.m_rz + i);
+
+					auto visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+					for (std::size_t p = 0u; p < std::size(d); ++p) {
+						auto distance = _mm_add_ps(_mm_mul_ps(nx[p], cx), d[p]);
+						distance = _mm_add_ps(_mm_mul_ps(ny[p], cy), distance);
+						distance = _mm_add_ps(_mm_mul_ps(nz[p], cz), distance);
+						distance = _mm_add_ps(_mm_mul_ps(ax[p], rx), distance);
+						distance = _mm_add_ps(_mm_mul_ps(ay[p], ry), distance);
+						distance = _mm_add_ps(_mm_mul_ps(az[p], rz), distance);
+						visible  = _mm_and_ps(visible, _mm_cmpge_ps(distance, zero));
+					}
+
+					const auto mask = static_cast< U32 >(_mm_movemask_ps(visible));
+					for (U32 j = 0u; j < 4u; ++j) {
+						output[count] = static_cast< U32 >(i) + j;
+						count += (mask >> j) & 1u;
+					}
+				}
+			}
+
+			#endif
+
+			for (; i < volumes.m_size; ++i) {
+				bool visible = true;
+				for (std::size_t p = 0u; p < std::size(planes.m_d); ++p) {
+					const auto distance
+						= planes.m_nx[p] * volumes.m_cx[i]
+						+ planes.m_ny[p] * volumes.m_cy[i]
+						+ planes.m_nz[p] * volumes.m_cz[i]
+						+ planes.m_d[p]
+						+ planes.m_ax[p] * volumes.m_rx[i]
+						+ planes.m_ay[p] * volumes.m_ry[i]
+						+ planes.m_az[p] * volumes.m_rz[i];
+					visible &= (0.0f <= distance);
+				}
+
+				output[count] = static_cast< U32 >(i);
+				count += visible ? 1u : 0u;
+			}
+
+			indices.resize(count);
+		}
+	}
+
+	//-------------------------------------------------------------------------
+	// AABB Array
+	//-------------------------------------------------------------------------
+
+	AABBArray::AABBArray() noexcept
+		: m_centroids_x(),
+		m_centroids_y(),
+		m_centroids_z(),
+		m_radii_x(),
+		m_radii_y(),
+		m_radii_z() {}
+
+	AABBArray::AABBArray(const AABBArray& aabbs) = default;
+
+	AABBArray::AABBArray(AABBArray&& aabbs) noexcept = default;
+
+	AABBArray::~AABBArray() = default;
+
+	AABBArray& AABBArray::operator=(const AABBArray& aabbs) = default;
+
+	AABBArray& AABBArray::operator=(AABBArray&& aabbs) noexcept = default;
+
+	void AABBArray::clear() noexcept {
+		m_centroids_x.clear();
+		m_centroids_y.clear();
+		m_centroids_z.clear();
+		m_radii_x.clear();
+		m_radii_y.clear();
+		m_radii_z.clear();
+	}
+
+	void AABBArray::reserve(std::size_t new_capacity) {
+		m_centroids_x.reserve(new_capacity);
+		m_centroids_y.reserve(new_capacity);
+		m_centroids_z.reserve(new_capacity);
+		m_radii_x.reserve(new_capacity);
+		m_radii_y.reserve(new_capacity);
+		m_radii_z.reserve(new_capacity);
+	}
+
+	void AABBArray::push_back(const AABB& aabb) {
+		const auto centroid = XMStore< F32x3 >(aabb.Centroid());
+		const auto radius   = XMStore< F32x3 >(aabb.Radius());
+
+		m_centroids_x.push_back(centroid[0]);
+		m_centroids_y.push_back(centroid[1]);
+		m_centroids_z.push_back(centroid[2]);
+		m_radii_x.push_back(radius[0]);
+		m_radii_y.push_back(radius[1]);
+		m_radii_z.push_back(radius[2]);
+	}
+
+	void XM_CALLCONV AABBArray::push_back(const AABB& aabb,
+										  FXMMATRIX object_to_world) {
+
+		push_back(AABB::Transform(aabb, object_to_world));
+	}
+
+	void AABBArray::Cull(const BoundingFrustum& frustum,
+						 std::vector< U32 >& indices) const {
+
+		const auto planes = ExtractPlanes(frustum, false);
+		const VolumeStreams volumes = {
+			m_centroids_x.data(),
+			m_centroids_y.data(),
+			m_centroids_z.data(),
+			m_radii_x.data(),
+			m_radii_y.data(),
+			m_radii_z.data(),
+			size()
+		};
+
+		CullVolumes(planes, volumes, indices);
+	}
+
+	//-------------------------------------------------------------------------
+	// Bounding Sphere Array
+	//-------------------------------------------------------------------------
+
+	BoundingSphereArray::BoundingSphereArray() noexcept
+		: m_centroids_x(),
+		m_centroids_y(),
+		m_centroids_z(),
+		m_radii() {}
+
+	BoundingSphereArray::BoundingSphereArray(
+		const BoundingSphereArray& spheres) = default;
+
+	BoundingSphereArray::BoundingSphereArray(
+		BoundingSphereArray&& spheres) noexcept = default;
+
+	BoundingSphereArray::~BoundingSphereArray() = default;
+
+	BoundingSphereArray& BoundingSphereArray
+		::operator=(const BoundingSphereArray& spheres) = default;
+
+	BoundingSphereArray& BoundingSphereArray
+		::operator=(BoundingSphereArray&& spheres) noexcept = default;
+
+	void BoundingSphereArray::clear() noexcept {
+		m_centroids_x.clear();
+		m_centroids_y.clear();
+		m_centroids_z.clear();
+		m_radii.clear();
+	}
+
+	void BoundingSphereArray::reserve(std::size_t new_capacity) {
+		m_centroids_x.reserve(new_capacity);
+		m_centroids_y.reserve(new_capacity);
+		m_centroids_z.reserve(new_capacity);
+		m_radii.reserve(new_capacity);
+	}
+
+	void BoundingSphereArray::push_back(const BoundingSphere& sphere) {
+		const auto centroid = XMStore< F32x3 >(sphere.Centroid());
+
+		m_centroids_x.push_back(centroid[0]);
+		m_centroids_y.push_back(centroid[1]);
+		m_centroids_z.push_back(centroid[2]);
+		m_radii.push_back(sphere.Radius());
+	}
+
+	void XM_CALLCONV BoundingSphereArray::push_back(const BoundingSphere& sphere,
+													FXMMATRIX object_to_world) {
+
+		// The radius is scaled by the largest scale factor of the
+		// transformation matrix.
+		const auto scale = std::max({
+			XMVectorGetX(XMVector3Length(object_to_world.r[0])),
+			XMVectorGetX(XMVector3Length(object_to_world.r[1])),
+			XMVectorGetX(XMVector3Length(object_to_world.r[2]))
+		});
+		const auto centroid = XMVector3Transform(sphere.Centroid(),
+												 object_to_world);
+
+		push_back(BoundingSphere(centroid, scale * sphere.Radius()));
+	}
+
+	void BoundingSphereArray::Cull(const BoundingFrustum& frustum,
+								   std::vector< U32 >& indices) const {
+
+		const auto planes = ExtractPlanes(frustum, true);
+		const VolumeStreams volumes = {
+			m_centroids_x.data(),
+			m_centroids_y.data(),
+			m_centroids_z.data(),
+			m_radii.data(),
+			m_radii.data(),
+			m_radii.data(),
+			size()
+		};
+
+		CullVolumes(planes, volumes, indices);
+	}
+}
\ No newline at end of file
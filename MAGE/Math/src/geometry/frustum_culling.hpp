@@ -0,0 +1,389 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "geometry\bounding_volume.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// AABB Array
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of arrays of AABBs.
+
+	 The AABBs are stored as a structure of arrays of centroids and radii
+	 (i.e. half extents), which allows testing multiple AABBs at once against
+	 the planes of a bounding frustum.
+	 */
+	class AABBArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an AABB array.
+		 */
+		AABBArray() noexcept;
+
+		/**
+		 Constructs an AABB array from the given AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to copy.
+		 */
+		AABBArray(const AABBArray& aabbs);
+
+		/**
+		 Constructs an AABB array by moving the given AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to move.
+		 */
+		AABBArray(AABBArray&& aabbs) noexcept;
+
+		/**
+		 Destructs this AABB array.
+		 */
+		~AABBArray();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given AABB array to this AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to copy.
+		 @return		A reference to the copy of the given AABB array (i.e.
+						this AABB array).
+		 */
+		AABBArray& operator=(const AABBArray& aabbs);
+
+		/**
+		 Moves the given AABB array to this AABB array.
+
+		 @param[in]		aabbs
+						A reference to the AABB array to move.
+		 @return		A reference to the moved AABB array (i.e. this AABB
+						array).
+		 */
+		AABBArray& operator=(AABBArray&& aabbs) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of AABBs of this AABB array.
+
+		 @return		The number of AABBs of this AABB array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_centroids_x.size();
+		}
+
+		/**
+		 Checks whether this AABB array is empty.
+
+		 @return		@c true if this AABB array is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_centroids_x.empty();
+		}
+
+		/**
+		 Removes all AABBs of this AABB array.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Reserves storage for the given number of AABBs.
+
+		 @param[in]		new_capacity
+						The number of AABBs.
+		 */
+		void reserve(std::size_t new_capacity);
+
+		/**
+		 Appends the given AABB to this AABB array.
+
+		 @param[in]		aabb
+						A reference to the AABB.
+		 */
+		void push_back(const AABB& aabb);
+
+		/**
+		 Appends the AABB enclosing the given AABB transformed by the given
+		 transformation matrix to this AABB array.
+
+		 @param[in]		aabb
+						A reference to the AABB (expressed in object space
+						coordinates).
+		 @param[in]		object_to_world
+						The object-to-world transformation matrix.
+		 */
+		void XM_CALLCONV push_back(const AABB& aabb,
+								   FXMMATRIX object_to_world);
+
+		/**
+		 Culls the AABBs of this AABB array against the given bounding
+		 frustum.
+
+		 @param[in]		frustum
+						A reference to the bounding frustum (expressed in the
+						same coordinate space as the AABBs).
+		 @param[out]	indices
+						A reference to a vector which will contain the
+						(increasing) indices of all AABBs of this AABB array
+						which are not culled by the given bounding frustum.
+		 */
+		void Cull(const BoundingFrustum& frustum,
+				  std::vector< U32 >& indices) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The x components of the centroids of the AABBs of this AABB array.
+		 */
+		std::vector< F32 > m_centroids_x;
+
+		/**
+		 The y components of the centroids of the AABBs of this AABB array.
+		 */
+		std::vector< F32 > m_centroids_y;
+
+		/**
+		 The z components of the centroids of the AABBs of this AABB array.
+		 */
+		std::vector< F32 > m_centroids_z;
+
+		/**
+		 The x components of the radii of the AABBs of this AABB array.
+		 */
+		std::vector< F32 > m_radii_x;
+
+		/**
+		 The y components of the radii of the AABBs of this AABB array.
+		 */
+		std::vector< F32 > m_radii_y;
+
+		/**
+		 The z components of the radii of the AABBs of this AABB array.
+		 */
+		std::vector< F32 > m_radii_z;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Bounding Sphere Array
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of arrays of bounding spheres.
+
+	 The bounding spheres are stored as a structure of arrays of centroids and
+	 radii, which allows testing multiple bounding spheres at once against the
+	 planes of a bounding frustum.
+	 */
+	class BoundingSphereArray {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a bounding sphere array.
+		 */
+		BoundingSphereArray() noexcept;
+
+		/**
+		 Constructs a bounding sphere array from the given bounding sphere
+		 array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to copy.
+		 */
+		BoundingSphereArray(const BoundingSphereArray& spheres);
+
+		/**
+		 Constructs a bounding sphere array by moving the given bounding
+		 sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to move.
+		 */
+		BoundingSphereArray(BoundingSphereArray&& spheres) noexcept;
+
+		/**
+		 Destructs this bounding sphere array.
+		 */
+		~BoundingSphereArray();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given bounding sphere array to this bounding sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to copy.
+		 @return		A reference to the copy of the given bounding sphere
+						array (i.e. this bounding sphere array).
+		 */
+		BoundingSphereArray& operator=(const BoundingSphereArray& spheres);
+
+		/**
+		 Moves the given bounding sphere array to this bounding sphere array.
+
+		 @param[in]		spheres
+						A reference to the bounding sphere array to move.
+		 @return		A reference to the moved bounding sphere array (i.e.
+						this bounding sphere array).
+		 */
+		BoundingSphereArray& operator=(BoundingSphereArray&& spheres) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of bounding spheres of this bounding sphere array.
+
+		 @return		The number of bounding spheres of this bounding sphere
+						array.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_centroids_x.size();
+		}
+
+		/**
+		 Checks whether this bounding sphere array is empty.
+
+		 @return		@c true if this bounding sphere array is empty.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_centroids_x.empty();
+		}
+
+		/**
+		 Removes all bounding spheres of this bounding sphere array.
+		 */
+		void clear() noexcept;
+
+		/**
+		 Reserves storage for the given number of bounding spheres.
+
+		 @param[in]		new_capacity
+						The number of bounding spheres.
+		 */
+		void reserve(std::size_t new_capacity);
+
+		/**
+		 Appends the given bounding sphere to this bounding sphere array.
+
+		 @param[in]		sphere
+						A reference to the bounding sphere.
+		 */
+		void push_back(const BoundingSphere& sphere);
+
+		/**
+		 Appends the bounding sphere enclosing the given bounding sphere
+		 transformed by the given transformation matrix to this bounding
+		 sphere array.
+
+		 @param[in]		sphere
+						A reference to the bounding sphere (expressed in
+						object space coordinates).
+		 @param[in]		object_to_world
+						The object-to-world transformation matrix.
+		 */
+		void XM_CALLCONV push_back(const BoundingSphere& sphere,
+								   FXMMATRIX object_to_world);
+
+		/**
+		 Culls the bounding spheres of this bounding sphere array against the
+		 given bounding frustum.
+
+		 @param[in]		frustum
+						A reference to the bounding frustum (expressed in the
+						same coordinate space as the bounding spheres).
+		 @param[out]	indices
+						A reference to a vector which will contain the
+						(increasing) indices of all bounding spheres of this
+						bounding sphere array which are not culled by the
+						given bounding frustum.
+		 */
+		void Cull(const BoundingFrustum& frustum,
+				  std::vector< U32 >& indices) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The x components of the centroids of the bounding spheres of this
+		 bounding sphere array.
+		 */
+		std::vector< F32 > m_centroids_x;
+
+		/**
+		 The y components of the centroids of the bounding spheres of this
+		 bounding sphere array.
+		 */
+		std::vector< F32 > m_centroids_y;
+
+		/**
+		 The z components of the centroids of the bounding spheres of this
+		 bounding sphere array.
+		 */
+		std::vector< F32 > m_centroids_z;
+
+		/**
+		 The radii of the bounding spheres of this bounding sphere array.
+		 */
+		std::vector< F32 > m_radii;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file
@@ -162,6 +162,57 @@ namespace mage {
 													translation);
 	}
 
+	[[nodiscard]]
+	inline const XMMATRIX XM_CALLCONV
+		GetInverseAffineTransformationMatrix(FXMMATRIX transformation) noexcept {
+
+		// The upper-left 3x3 block A of the given transformation with rows
+		// A0, A1, A2 must be invertible.
+		//
+		//   [ A 0 ]^-1   [ A^-1    0 ]
+		// = [ T 1 ]    = [ -T.A^-1 1 ]
+		//
+		// A^-1 = [ A1xA2, A2xA0, A0xA1 ] / (A0.(A1xA2))
+		//
+		// Unlike A^T . diag(1/|A0|^2, 1/|A1|^2, 1/|A2|^2), the adjugate does
+		// not assume mutually orthogonal rows, whose rounding errors are
+		// amplified by the ratio of the scale factors.
+
+		const auto& r = transformation.r;
+		const auto c0 = XMVector3Cross(r[1u], r[2u]);
+		const auto c1 = XMVector3Cross(r[2u], r[0u]);
+		const auto c2 = XMVector3Cross(r[0u], r[1u]);
+		const auto inv_det = XMVectorReciprocal(XMVector3Dot(r[0u], c0));
+
+		auto inverse = XMMatrixTranspose(
+			XMMATRIX(c0 * inv_det, c1 * inv_det, c2 * inv_det, g_XMIdentityR3));
+		inverse.r[3u]  = XMVectorSetW(-XMVector3TransformNormal(r[3u], inverse),
+									  1.0f);
+		return inverse;
+	}
+
+	[[nodiscard]]
+	inline const XMMATRIX XM_CALLCONV
+		GetUniformInverseAffineTransformationMatrix(FXMMATRIX transformation) noexcept {
+
+		// The upper-left 3x3 block A of the given transformation must be a
+		// uniformly scaled rotation (i.e. a similarity transformation).
+		//
+		// A^-1 = A^T / |A0|^2
+
+		const auto& r = transformation.r;
+		const auto s = XMVectorReciprocal(XMVector3LengthSq(r[0u]));
+
+		auto inverse = XMMatrixTranspose(
+			XMMATRIX(r[0u], r[1u], r[2u], g_XMIdentityR3));
+		inverse.r[0u] *= s;
+		inverse.r[1u] *= s;
+		inverse.r[2u] *= s;
+		inverse.r[3u]  = XMVectorSetW(-XMVector3TransformNormal(r[3u], inverse),
+									  1.0f);
+		return inverse;
+	}
+
 	[[nodiscard]]
 	inline const XMMATRIX XM_CALLCONV
 		GetAffineTransformationMatrix(FXMVECTOR scale,
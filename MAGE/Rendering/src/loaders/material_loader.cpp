@@ -6,6 +6,7 @@
 #include "loaders\material_loader.hpp"
 #include "loaders\mtl\mtl_loader.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -17,6 +18,7 @@ namespace mage::rendering::loader {
 	void ImportMaterialFromFile(const std::filesystem::path& path,
 								ResourceManager& resource_manaer,
 								std::vector< Material >& materials) {
+		MAGE_PROFILE_ZONE("ImportMaterialFromFile");
 
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
@@ -7,6 +7,7 @@
 
 #include "loaders\mdl\mdl_loader.hpp"
 #include "loaders\obj\obj_loader.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -20,6 +21,7 @@ namespace mage::rendering::loader {
 							 ResourceManager& resource_manager,
 							 ModelOutput< VertexT, IndexT >& model_output,
 							 const MeshDescriptor< VertexT, IndexT >& mesh_desc) {
+		MAGE_PROFILE_ZONE("ImportModelFromFile");
 
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
@@ -28,7 +30,9 @@ namespace mage::rendering::loader {
 			ImportMDLModelFromFile(path, resource_manager, model_output);
 		}
 		else if (L".obj" == extension) {
-			ImportOBJMeshFromFile(path, resource_manager, model_output, mesh_desc);
+			// Large OBJ files are split in chunks which are read in parallel.
+			ImportOBJMeshFromFile(path, resource_manager, model_output, mesh_desc,
+								  true);
 		}
 		else {
 			throw Exception("Unknown model file extension: {}", path);
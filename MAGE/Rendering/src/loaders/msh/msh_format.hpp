@@ -0,0 +1,219 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	//-------------------------------------------------------------------------
+	// MSH v2 File Layout
+	//-------------------------------------------------------------------------
+	//
+	// An MSH v2 file is a little-endian container consisting of:
+	//  1. the magic token (8 bytes);
+	//  2. an MSHHeader (56 bytes);
+	//  3. a chunk table of MSHHeader::m_nb_chunks MSHChunks (32 bytes each);
+	//  4. the chunk payloads, each starting at a multiple of
+	//     g_msh_v2_alignment bytes from the start of the file.
+	//
+	// Since memory-mapped file views are page aligned, all payloads can be
+	// consumed in place.
+	//-------------------------------------------------------------------------
+
+	/**
+	 The version of MSH v2 files.
+	 */
+	constexpr U32 g_msh_v2_version = 2u;
+
+	/**
+	 The byte order mark of MSH v2 files (as read on a little-endian system).
+	 */
+	constexpr U32 g_msh_v2_byte_order = 0x01020304u;
+
+	/**
+	 The alignment in bytes of the chunk payloads of MSH v2 files.
+	 */
+	constexpr std::size_t g_msh_v2_alignment = 64u;
+
+	/**
+	 An enumeration of the different vertex attributes of MSH v2 files.
+
+	 This contains:
+	 @c Position,
+	 @c Normal,
+	 @c Texture and
+	 @c Color.
+	 */
+	enum class MSHVertexAttribute : U32 {
+		Position = 1u << 0u,
+		Normal   = 1u << 1u,
+		Texture  = 1u << 2u,
+		Color    = 1u << 3u
+	};
+
+	/**
+	 An enumeration of the different chunk types of MSH v2 files.
+
+	 This contains:
+	 @c Vertices,
+	 @c Indices and
+	 @c Bounds.
+	 */
+	enum class MSHChunkType : U32 {
+		Vertices = 0u,
+		Indices  = 1u,
+		Bounds   = 2u
+	};
+
+	/**
+	 The chunk flag indicating that the payload of a chunk is compressed.
+	 */
+	constexpr U32 g_msh_v2_chunk_flag_compressed = 1u << 0u;
+
+	/**
+	 A struct of MSH v2 headers.
+	 */
+	struct MSHHeader {
+
+	public:
+
+		/**
+		 The version of this MSH header.
+		 */
+		U32 m_version;
+
+		/**
+		 The byte order mark of this MSH header.
+		 */
+		U32 m_byte_order;
+
+		/**
+		 The vertex layout (i.e. combination of MSH vertex attributes) of
+		 this MSH header.
+		 */
+		U32 m_vertex_layout;
+
+		/**
+		 The vertex size in bytes of this MSH header.
+		 */
+		U32 m_vertex_size;
+
+		/**
+		 The index size in bytes of this MSH header.
+		 */
+		U32 m_index_size;
+
+		/**
+		 The number of chunks of this MSH header.
+		 */
+		U32 m_nb_chunks;
+
+		/**
+		 The reserved bytes of this MSH header.
+		 */
+		U8 m_reserved[32u];
+	};
+
+	static_assert(56u == sizeof(MSHHeader));
+
+	/**
+	 A struct of MSH v2 chunk table entries.
+	 */
+	struct MSHChunk {
+
+	public:
+
+		/**
+		 The type of this MSH chunk.
+		 */
+		MSHChunkType m_type;
+
+		/**
+		 The flags of this MSH chunk.
+		 */
+		U32 m_flags;
+
+		/**
+		 The offset in bytes from the start of the file to the payload of
+		 this MSH chunk.
+		 */
+		U64 m_offset;
+
+		/**
+		 The size in bytes of the payload of this MSH chunk.
+		 */
+		U64 m_size;
+
+		/**
+		 The number of elements of the payload of this MSH chunk.
+		 */
+		U64 m_count;
+	};
+
+	static_assert(32u == sizeof(MSHChunk));
+
+	/**
+	 A struct of MSH v2 bounds.
+	 */
+	struct MSHBounds {
+
+	public:
+
+		/**
+		 The minimum point of the AABB of this MSH bounds.
+		 */
+		F32x3 m_min;
+
+		/**
+		 The maximum point of the AABB of this MSH bounds.
+		 */
+		F32x3 m_max;
+
+		/**
+		 The centroid of the bounding sphere of this MSH bounds.
+		 */
+		F32x3 m_centroid;
+
+		/**
+		 The radius of the bounding sphere of this MSH bounds.
+		 */
+		F32 m_radius;
+	};
+
+	static_assert(40u == sizeof(MSHBounds));
+
+	/**
+	 Returns the MSH v2 vertex layout of the given vertex type.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @return		The MSH v2 vertex layout of the given vertex type.
+	 */
+	template< typename VertexT >
+	[[nodiscard]]
+	constexpr U32 GetMSHVertexLayout() noexcept {
+		U32 layout = 0u;
+		if constexpr (VertexT::HasPosition()) {
+			layout |= static_cast< U32 >(MSHVertexAttribute::Position);
+		}
+		if constexpr (VertexT::HasNormal()) {
+			layout |= static_cast< U32 >(MSHVertexAttribute::Normal);
+		}
+		if constexpr (VertexT::HasTexture()) {
+			layout |= static_cast< U32 >(MSHVertexAttribute::Texture);
+		}
+		if constexpr (VertexT::HasColor()) {
+			layout |= static_cast< U32 >(MSHVertexAttribute::Color);
+		}
+		return layout;
+	}
+}
\ No newline at end of file
@@ -5,7 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "resource\mesh\mesh_view.hpp"
 
 #pragma endregion
 
@@ -46,6 +46,29 @@ namespace mage::rendering::loader {
 		                       std::vector< VertexT >& vertices,
 		                       std::vector< IndexT >& indices);
 
+	/**
+	 Imports the mesh from the MSH file associated with the given path
+	 without copying its vertices and indices.
+
+	 The MSH file is memory-mapped and the vertices and indices of the
+	 resulting mesh view reference the mapping in place. The mapping is
+	 released once the last copy of the mesh view is destructed.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path.
+	 @param[out]	mesh_view
+					A reference to the mesh view.
+	 @throws		Exception
+					Failed to import the mesh from file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ImportMSHMeshFromFile(const std::filesystem::path& path,
+							   MeshView< VertexT, IndexT >& mesh_view);
+
 	/**
 	 Exports the given mesh to the MSH file associated with the given path.
 
@@ -67,6 +90,22 @@ namespace mage::rendering::loader {
 	void ExportMSHMeshToFile(const std::filesystem::path& path,
 		                     const std::vector< VertexT >& vertices,
 		                     const std::vector< IndexT >& indices);
+
+	/**
+	 Converts the MSH file associated with the given path in place to the
+	 latest MSH format version (i.e. MSH v2).
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 @param[in]		path
+					A reference to the path.
+	 @throws		Exception
+					Failed to convert the MSH file.
+	 */
+	template< typename VertexT, typename IndexT >
+	void ConvertMSHMeshFile(const std::filesystem::path& path);
 }
 
 //-----------------------------------------------------------------------------
@@ -20,8 +20,37 @@ namespace mage::rendering::loader {
 		                       std::vector< VertexT >& vertices,
 		                       std::vector< IndexT >& indices) {
 
-		MSHReader< VertexT, IndexT > reader(vertices, indices);
-		reader.ReadFromFile(path);
+		using std::empty;
+		ThrowIfFailed(empty(vertices),
+					  "{}: vertex buffer must be empty.", path);
+		ThrowIfFailed(empty(indices),
+					  "{}: index buffer must be empty.", path);
+
+		// Map the file to avoid copying its bytes into an intermediate buffer.
+		const MemoryMappedFile file(path);
+
+		MSHReader< VertexT, IndexT > reader;
+		reader.ReadFromMemory(file.GetData(), path);
+
+		const auto read_vertices = reader.GetVertices();
+		vertices.assign(read_vertices.cbegin(), read_vertices.cend());
+		const auto read_indices  = reader.GetIndices();
+		indices.assign(read_indices.cbegin(), read_indices.cend());
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ImportMSHMeshFromFile(const std::filesystem::path& path,
+							   MeshView< VertexT, IndexT >& mesh_view) {
+
+		SharedPtr< const MemoryMappedFile > file
+			= MakeShared< MemoryMappedFile >(path);
+
+		MSHReader< VertexT, IndexT > reader;
+		reader.ReadFromMemory(file->GetData(), path);
+
+		mesh_view = MeshView< VertexT, IndexT >(std::move(file),
+												reader.GetVertices(),
+												reader.GetIndices());
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -32,4 +61,14 @@ namespace mage::rendering::loader {
 		MSHWriter< VertexT, IndexT > writer(vertices, indices);
 		writer.WriteToFile(path);
 	}
+
+	template< typename VertexT, typename IndexT >
+	void ConvertMSHMeshFile(const std::filesystem::path& path) {
+		std::vector< VertexT > vertices;
+		std::vector< IndexT >  indices;
+		ImportMSHMeshFromFile(path, vertices, indices);
+
+		// The file is no longer mapped and can be overwritten.
+		ExportMSHMeshToFile(path, vertices, indices);
+	}
 }
\ No newline at end of file
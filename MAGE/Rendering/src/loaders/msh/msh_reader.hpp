@@ -6,6 +6,7 @@
 #pragma region
 
 #include "io\binary_reader.hpp"
+#include "loaders\msh\msh_format.hpp"
 
 #pragma endregion
 
@@ -14,7 +15,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <vector>
+#include <optional>
 
 #pragma endregion
 
@@ -26,6 +27,9 @@ namespace mage::rendering::loader {
 	/**
 	 A class of MSH file readers for reading meshes.
 
+	 Both MSH v1 files (i.e. a magic token, vertex and index counts, and raw
+	 vertex and index arrays) and MSH v2 files are supported.
+
 	 @tparam		VertexT
 					The vertex type.
 	 @tparam		IndexT
@@ -42,16 +46,8 @@ namespace mage::rendering::loader {
 
 		/**
 		 Constructs a MSH reader.
-
-		 @param[in,out]	vertices
-						A reference to a vector for storing the read vertices
-						from file.
-		 @param[in,out]	indices
-						A reference to a vector for storing the read indices
-						from file.
 		 */
-		explicit MSHReader(std::vector< VertexT >& vertices,
-			               std::vector< IndexT >& indices);
+		MSHReader() noexcept;
 
 		/**
 		 Constructs a MSH reader from the given MSH reader.
@@ -106,6 +102,41 @@ namespace mage::rendering::loader {
 
 		using BigEndianBinaryReader::ReadFromMemory;
 
+		/**
+		 Returns the read vertices of this MSH reader.
+
+		 @return		The read vertices of this MSH reader. The vertices
+						reside in the data read by this MSH reader and are
+						only valid as long as that data is alive.
+		 */
+		[[nodiscard]]
+		gsl::span< const VertexT > GetVertices() const noexcept {
+			return m_vertices;
+		}
+
+		/**
+		 Returns the read indices of this MSH reader.
+
+		 @return		The read indices of this MSH reader. The indices reside
+						in the data read by this MSH reader and are only valid
+						as long as that data is alive.
+		 */
+		[[nodiscard]]
+		gsl::span< const IndexT > GetIndices() const noexcept {
+			return m_indices;
+		}
+
+		/**
+		 Returns the read bounds of this MSH reader.
+
+		 @return		The read bounds of this MSH reader, if the read MSH file
+						contains bounds.
+		 */
+		[[nodiscard]]
+		const std::optional< MSHBounds >& GetBounds() const noexcept {
+			return m_bounds;
+		}
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -121,29 +152,39 @@ namespace mage::rendering::loader {
 		virtual void ReadData() override;
 
 		/**
-		 Checks whether the header of the file is valid.
+		 Reads the data following the magic token of an MSH v1 file.
 
-		 @return		@c true if the header of the file is valid. @c false
-						otherwise.
+		 @throws		Exception
+						Failed to read from the given file.
 		 */
-		[[nodiscard]]
-		bool IsHeaderValid();
+		void ReadDataV1();
+
+		/**
+		 Reads the data following the magic token of an MSH v2 file.
+
+		 @throws		Exception
+						Failed to read from the given file.
+		 */
+		void ReadDataV2();
 
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		/**
-		 A reference to a vector containing the read vertices of this MSH
-		 reader.
+		 The read vertices of this MSH reader.
+		 */
+		gsl::span< const VertexT > m_vertices;
+
+		/**
+		 The read indices of this MSH reader.
 		 */
-		std::vector< VertexT >& m_vertices;
+		gsl::span< const IndexT > m_indices;
 
 		/**
-		 A reference to a vector containing the read indices of this MSH
-		 reader.
+		 The read bounds of this MSH reader.
 		 */
-		std::vector< IndexT >& m_indices;
+		std::optional< MSHBounds > m_bounds;
 	};
 }
 
@@ -10,18 +10,26 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string_view>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
 namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
-	MSHReader< VertexT, IndexT >
-		::MSHReader(std::vector< VertexT >& vertices,
-		            std::vector< IndexT >& indices)
+	MSHReader< VertexT, IndexT >::MSHReader() noexcept
 		: BigEndianBinaryReader(),
-		m_vertices(vertices),
-		m_indices(indices) {}
+		m_vertices(),
+		m_indices(),
+		m_bounds() {}
 
 	template< typename VertexT, typename IndexT >
 	MSHReader< VertexT, IndexT >::MSHReader(
@@ -32,37 +40,114 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	void MSHReader< VertexT, IndexT >::ReadData() {
-		using std::empty;
-		ThrowIfFailed(empty(m_vertices),
-					  "{}: vertex buffer must be empty.", GetPath());
-		ThrowIfFailed(empty(m_indices),
-					  "{}: index buffer must be empty.", GetPath());
+		constexpr auto magic_size = std::char_traits< char >
+			::length(g_msh_token_magic);
+		static_assert(magic_size == std::char_traits< char >
+			::length(g_msh_v2_token_magic));
 
-		// Read the header.
-		{
-			const bool result = IsHeaderValid();
-			ThrowIfFailed(result, "{}: invalid mesh header.", GetPath());
+		m_vertices = {};
+		m_indices  = {};
+		m_bounds.reset();
+
+		// Read the magic token.
+		const std::string_view magic(ReadArray< char >(magic_size),
+									 magic_size);
+
+		if (g_msh_token_magic == magic) {
+			ReadDataV1();
 		}
+		else if (g_msh_v2_token_magic == magic) {
+			ReadDataV2();
+		}
+		else {
+			throw Exception("{}: invalid mesh header.", GetPath());
+		}
+	}
 
+	template< typename VertexT, typename IndexT >
+	void MSHReader< VertexT, IndexT >::ReadDataV1() {
 		const auto nb_vertices = Read< U32 >();
 		const auto nb_indices  = Read< U32 >();
 
 		const auto vertices = ReadArray< VertexT >(nb_vertices);
-		m_vertices.assign(vertices, vertices + nb_vertices);
+		m_vertices = gsl::make_span(vertices, nb_vertices);
 
-		const auto indices   = ReadArray< IndexT >(nb_indices);
-		m_indices.assign(indices, indices + nb_indices);
+		const auto indices  = ReadArray< IndexT >(nb_indices);
+		m_indices  = gsl::make_span(indices, nb_indices);
 	}
 
 	template< typename VertexT, typename IndexT >
-	[[nodiscard]]
-	bool MSHReader< VertexT, IndexT >::IsHeaderValid() {
-		for (auto magic = g_msh_token_magic; *magic != L'\0'; ++magic) {
-			if (*magic != Read< U8 >()) {
-				return false;
+	void MSHReader< VertexT, IndexT >::ReadDataV2() {
+		// Read the header.
+		const auto header = Read< MSHHeader >();
+		ThrowIfFailed((g_msh_v2_version == header.m_version),
+					  "{}: unsupported mesh version: {}.",
+					  GetPath(), header.m_version);
+		ThrowIfFailed((g_msh_v2_byte_order == header.m_byte_order),
+					  "{}: unsupported mesh byte order.", GetPath());
+		ThrowIfFailed((GetMSHVertexLayout< VertexT >() == header.m_vertex_layout
+					   && sizeof(VertexT) == header.m_vertex_size),
+					  "{}: mesh vertex layout mismatch.", GetPath());
+		ThrowIfFailed((sizeof(IndexT) == header.m_index_size),
+					  "{}: mesh index size mismatch.", GetPath());
+
+		// Read the chunk table.
+		const auto nb_chunks = header.m_nb_chunks;
+		const auto chunks    = gsl::make_span(ReadArray< MSHChunk >(nb_chunks),
+											  nb_chunks);
+
+		// Read the chunk payloads in place.
+		U64 offset = std::char_traits< char >::length(g_msh_v2_token_magic)
+			       + sizeof(MSHHeader) + sizeof(MSHChunk) * nb_chunks;
+		const U64 file_size = offset + GetNumberOfRemainingBytes();
+		for (const auto& chunk : chunks) {
+			ThrowIfFailed((offset <= chunk.m_offset),
+						  "{}: overlapping mesh chunks.", GetPath());
+			ThrowIfFailed((chunk.m_size <= file_size
+						   && chunk.m_offset <= file_size - chunk.m_size),
+						  "{}: mesh chunk out of bounds.", GetPath());
+			// The payloads are accessed in place as typed arrays.
+			ThrowIfFailed((0u == chunk.m_offset % g_msh_v2_alignment),
+						  "{}: misaligned mesh chunk.", GetPath());
+			ThrowIfFailed(!(g_msh_v2_chunk_flag_compressed & chunk.m_flags),
+						  "{}: compressed mesh chunks are not supported.",
+						  GetPath());
+
+			// Skip the padding.
+			ReadArray< U8 >(static_cast< std::size_t >(chunk.m_offset - offset));
+			offset = chunk.m_offset + chunk.m_size;
+
+			const auto count = static_cast< std::size_t >(chunk.m_count);
+
+			switch (chunk.m_type) {
+
+			case MSHChunkType::Vertices: {
+				ThrowIfFailed((0u == chunk.m_size % sizeof(VertexT)
+							   && chunk.m_size / sizeof(VertexT) == count),
+							  "{}: invalid mesh vertex chunk.", GetPath());
+				m_vertices = gsl::make_span(ReadArray< VertexT >(count),
+											count);
+				break;
+			}
+			case MSHChunkType::Indices: {
+				ThrowIfFailed((0u == chunk.m_size % sizeof(IndexT)
+							   && chunk.m_size / sizeof(IndexT) == count),
+							  "{}: invalid mesh index chunk.", GetPath());
+				m_indices = gsl::make_span(ReadArray< IndexT >(count), count);
+				break;
+			}
+			case MSHChunkType::Bounds: {
+				ThrowIfFailed((sizeof(MSHBounds) == chunk.m_size),
+							  "{}: invalid mesh bounds chunk.", GetPath());
+				m_bounds = Read< MSHBounds >();
+				break;
+			}
+			default: {
+				// Skip unknown chunks for forward compatibility.
+				ReadArray< U8 >(static_cast< std::size_t >(chunk.m_size));
+				break;
+			}
 			}
 		}
-
-		return true;
 	}
 }
\ No newline at end of file
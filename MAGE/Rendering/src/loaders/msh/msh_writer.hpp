@@ -6,6 +6,7 @@
 #pragma region
 
 #include "io\binary_writer.hpp"
+#include "loaders\msh\msh_format.hpp"
 
 #pragma endregion
 
@@ -26,11 +27,13 @@ namespace mage::rendering::loader {
 	/**
 	 A class of MSH file writers for writing meshes.
 
+	 MSH files are always written in the MSH v2 format (i.e. a little-endian,
+	 chunked container with 64-byte aligned payloads).
+
 	 @tparam		VertexT
 					The vertex type.
 	 @tparam		IndexT
 					The index type.
-
 	 */
 	template< typename VertexT, typename IndexT >
 	class MSHWriter : private BigEndianBinaryWriter {
@@ -117,6 +120,26 @@ namespace mage::rendering::loader {
 		 */
 		virtual void WriteData() override;
 
+		/**
+		 Writes the given number of padding bytes.
+
+		 @pre			@a size is smaller than @c g_msh_v2_alignment.
+		 @param[in]		size
+						The number of padding bytes.
+		 @throws		Exception
+						Failed to write.
+		 */
+		void WritePadding(std::size_t size);
+
+		/**
+		 Computes the bounds of the vertices of this MSH writer.
+
+		 @pre			The vertices of this MSH writer are not empty.
+		 @return		The bounds of the vertices of this MSH writer.
+		 */
+		[[nodiscard]]
+		const MSHBounds ComputeBounds() const noexcept;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
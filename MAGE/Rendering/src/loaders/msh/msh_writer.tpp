@@ -9,6 +9,16 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -31,15 +41,105 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	void MSHWriter< VertexT, IndexT >::WriteData() {
+		std::vector< MSHChunk > chunks;
+		chunks.push_back({ MSHChunkType::Vertices, 0u, 0u,
+						   sizeof(VertexT) * m_vertices.size(),
+						   m_vertices.size() });
+		chunks.push_back({ MSHChunkType::Indices, 0u, 0u,
+						   sizeof(IndexT) * m_indices.size(),
+						   m_indices.size() });
+		if constexpr (VertexT::HasPosition()) {
+			if (!m_vertices.empty()) {
+				chunks.push_back({ MSHChunkType::Bounds, 0u, 0u,
+								   sizeof(MSHBounds), 1u });
+			}
+		}
+
+		const auto magic_size = std::char_traits< char >
+			::length(g_msh_v2_token_magic);
+
+		// Lay out the chunk payloads.
+		U64 offset = magic_size + sizeof(MSHHeader)
+			       + sizeof(MSHChunk) * chunks.size();
+		for (auto& chunk : chunks) {
+			offset = (offset + g_msh_v2_alignment - 1u)
+				   & ~static_cast< U64 >(g_msh_v2_alignment - 1u);
+			chunk.m_offset = offset;
+			offset        += chunk.m_size;
+		}
+
+		MSHHeader header = {};
+		header.m_version       = g_msh_v2_version;
+		header.m_byte_order    = g_msh_v2_byte_order;
+		header.m_vertex_layout = GetMSHVertexLayout< VertexT >();
+		header.m_vertex_size   = static_cast< U32 >(sizeof(VertexT));
+		header.m_index_size    = static_cast< U32 >(sizeof(IndexT));
+		header.m_nb_chunks     = static_cast< U32 >(chunks.size());
+
+		WriteString(NotNull< const_zstring >(g_msh_v2_token_magic));
+		Write< MSHHeader >(header);
+		WriteArray(gsl::span< const MSHChunk >(chunks));
+
+		offset = magic_size + sizeof(MSHHeader)
+			   + sizeof(MSHChunk) * chunks.size();
+		for (const auto& chunk : chunks) {
+			WritePadding(static_cast< std::size_t >(chunk.m_offset - offset));
+			offset = chunk.m_offset + chunk.m_size;
+
+			switch (chunk.m_type) {
+
+			case MSHChunkType::Vertices: {
+				WriteArray(gsl::make_span(m_vertices));
+				break;
+			}
+			case MSHChunkType::Indices: {
+				WriteArray(gsl::make_span(m_indices));
+				break;
+			}
+			case MSHChunkType::Bounds: {
+				Write< MSHBounds >(ComputeBounds());
+				break;
+			}
+			}
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void MSHWriter< VertexT, IndexT >::WritePadding(std::size_t size) {
+		static constexpr U8 s_padding[g_msh_v2_alignment] = {};
+		WriteArray(gsl::make_span(s_padding, size));
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	const MSHBounds MSHWriter< VertexT, IndexT >
+		::ComputeBounds() const noexcept {
+
+		MSHBounds bounds = {};
+		bounds.m_min = m_vertices.front().m_p;
+		bounds.m_max = m_vertices.front().m_p;
+		for (const auto& vertex : m_vertices) {
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				bounds.m_min[i] = std::min(bounds.m_min[i], vertex.m_p[i]);
+				bounds.m_max[i] = std::max(bounds.m_max[i], vertex.m_p[i]);
+			}
+		}
 
-		WriteString(NotNull< const_zstring >(g_msh_token_magic));
+		for (std::size_t i = 0u; i < 3u; ++i) {
+			bounds.m_centroid[i] = 0.5f * (bounds.m_min[i] + bounds.m_max[i]);
+		}
 
-		const auto nb_vertices = static_cast< U32 >(m_vertices.size());
-		Write< U32 >(nb_vertices);
-		const auto nb_indices  = static_cast< U32 >(m_indices.size());
-		Write< U32 >(nb_indices);
+		F32 radius_sq = 0.0f;
+		for (const auto& vertex : m_vertices) {
+			F32 distance_sq = 0.0f;
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				const auto d = vertex.m_p[i] - bounds.m_centroid[i];
+				distance_sq += d * d;
+			}
+			radius_sq = std::max(radius_sq, distance_sq);
+		}
+		bounds.m_radius = std::sqrt(radius_sq);
 
-		WriteArray(gsl::make_span(m_vertices));
-		WriteArray(gsl::make_span(m_indices));
+		return bounds;
 	}
 }
\ No newline at end of file
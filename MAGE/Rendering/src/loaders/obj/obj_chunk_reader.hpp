@@ -0,0 +1,406 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\line_reader.hpp"
+#include "resource\mesh\mesh_descriptor.hpp"
+#include "geometry\geometry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 An enumeration of the different OBJ record types whose processing depends
+	 on the order of appearance in an OBJ file.
+
+	 This contains:
+	 @c Face,
+	 @c MaterialLibrary,
+	 @c MaterialUse and
+	 @c Group.
+	 */
+	enum class OBJRecordType : U8 {
+		Face,
+		MaterialLibrary,
+		MaterialUse,
+		Group
+	};
+
+	/**
+	 A struct of OBJ records.
+	 */
+	struct OBJRecord {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The type of this OBJ record.
+		 */
+		OBJRecordType m_type;
+
+		/**
+		 The number of vertices of this OBJ record. Only used for @c Face
+		 records.
+		 */
+		U32 m_nb_vertices;
+
+		/**
+		 The name of this OBJ record. Not used for @c Face records.
+		 */
+		std::string_view m_name;
+	};
+
+	/**
+	 A class of OBJ chunk readers for reading a chunk (i.e. a consecutive
+	 range of complete lines) of an OBJ file independently of the other chunks
+	 of that OBJ file.
+
+	 Each chunk is read in two passes. The first pass only counts the lines,
+	 the vertex position, texture and normal coordinates definitions and the
+	 face definitions of the chunk. The second pass stores the vertex coordinates at the global
+	 offsets (derived from the counts of all preceding chunks) of the vertex
+	 coordinates buffers shared by all chunks, and records all definitions
+	 that need to be processed in order (i.e. faces, material libraries,
+	 material usages, groups and objects).
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	class OBJChunkReader : private LineReader {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an OBJ chunk reader.
+
+		 @param[in]		mesh_desc
+						A reference to a mesh descriptor.
+		 */
+		explicit OBJChunkReader(
+			const MeshDescriptor< VertexT, IndexT >& mesh_desc) noexcept;
+
+		/**
+		 Constructs an OBJ chunk reader from the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to copy.
+		 */
+		OBJChunkReader(const OBJChunkReader& reader) = delete;
+
+		/**
+		 Constructs an OBJ chunk reader by moving the given OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to the OBJ chunk reader to move.
+		 */
+		OBJChunkReader(OBJChunkReader&& reader) noexcept;
+
+		/**
+		 Destructs this OBJ chunk reader.
+		 */
+		~OBJChunkReader();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to copy.
+		 @return		A reference to the copy of the given OBJ chunk reader
+						(i.e. this OBJ chunk reader).
+		 */
+		OBJChunkReader& operator=(const OBJChunkReader& reader) = delete;
+
+		/**
+		 Moves the given OBJ chunk reader to this OBJ chunk reader.
+
+		 @param[in]		reader
+						A reference to a OBJ chunk reader to move.
+		 @return		A reference to the moved OBJ chunk reader (i.e. this
+						OBJ chunk reader).
+		 */
+		OBJChunkReader& operator=(OBJChunkReader&& reader) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Counts the lines, the vertex position, texture and normal coordinates
+		 definitions and the face definitions of the given chunk.
+
+		 @param[in]		chunk
+						The chunk.
+		 @param[in]		path
+						The path of the OBJ file containing the given chunk.
+		 @throws		Exception
+						Failed to count the given chunk.
+		 */
+		void Count(std::string_view chunk, std::filesystem::path path);
+
+		/**
+		 Reads the given chunk.
+
+		 @pre			The given chunk is counted with this OBJ chunk reader.
+		 @param[in]		chunk
+						The chunk.
+		 @param[in]		path
+						The path of the OBJ file containing the given chunk.
+		 @param[in]		line_number
+						The line number of the first line of the given chunk.
+		 @param[in]		offsets
+						A reference to the number of vertex position, texture
+						and normal coordinates of all preceding chunks.
+		 @param[out]	vertex_coordinates
+						The vertex position coordinates of all chunks.
+		 @param[out]	vertex_texture_coordinates
+						The vertex texture coordinates of all chunks.
+		 @param[out]	vertex_normal_coordinates
+						The vertex normal coordinates of all chunks.
+		 @throws		Exception
+						Failed to read the given chunk.
+		 */
+		void Read(std::string_view chunk,
+				  std::filesystem::path path,
+				  U32 line_number,
+				  const U32x3& offsets,
+				  gsl::span< Point3 > vertex_coordinates,
+				  gsl::span< UV > vertex_texture_coordinates,
+				  gsl::span< Normal3 > vertex_normal_coordinates);
+
+		/**
+		 Returns the number of lines of the chunk of this OBJ chunk reader.
+
+		 @return		The number of lines of the chunk of this OBJ chunk
+						reader.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfLines() const noexcept {
+			return m_nb_lines;
+		}
+
+		/**
+		 Returns the number of vertex position, texture and normal coordinates
+		 of the chunk of this OBJ chunk reader.
+
+		 @return		A reference to the number of vertex position, texture
+						and normal coordinates of the chunk of this OBJ chunk
+						reader.
+		 */
+		[[nodiscard]]
+		const U32x3& GetNumberOfCoordinates() const noexcept {
+			return m_nb_coordinates;
+		}
+
+		/**
+		 Returns the number of faces of the chunk of this OBJ chunk reader.
+
+		 @return		The number of faces of the chunk of this OBJ chunk
+						reader.
+		 */
+		[[nodiscard]]
+		U32 GetNumberOfFaces() const noexcept {
+			return m_nb_faces;
+		}
+
+		/**
+		 Returns the records of the chunk of this OBJ chunk reader.
+
+		 @return		A reference to the records of the chunk of this OBJ
+						chunk reader.
+		 */
+		[[nodiscard]]
+		const std::vector< OBJRecord >& GetRecords() const noexcept {
+			return m_records;
+		}
+
+		/**
+		 Returns the (global) vertex indices of the faces of the chunk of this
+		 OBJ chunk reader.
+
+		 @return		A reference to the (global) vertex indices of the
+						faces of the chunk of this OBJ chunk reader.
+		 */
+		[[nodiscard]]
+		const std::vector< U32x3 >& GetFaceVertexIndices() const noexcept {
+			return m_face_vertex_indices;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reads the current line of this OBJ chunk reader.
+
+		 @throws		Exception
+						Failed to the current line of this OBJ chunk reader.
+		 */
+		virtual void ReadLine() override;
+
+		/**
+		 Counts the current line of this OBJ chunk reader.
+		 */
+		void CountLine();
+
+		/**
+		 Reads a Vertex Position Coordinates definition.
+
+		 @throws		Exception
+						Failed to read a Vertex Position Coordinates
+						definition.
+		 */
+		void ReadOBJVertex();
+
+		/**
+		 Reads a Vertex Texture Coordinates definition.
+
+		 @note			Only UV texture coordinates are supported,
+						The W component of UVW texture coordinates
+						is, if present, silently ignored.
+		 @throws		Exception
+						Failed to read a Vertex Texture Coordinates definition.
+		 */
+		void ReadOBJVertexTexture();
+
+		/**
+		 Reads a Vertex Normal Coordinates definition.
+
+		 @pre			All the vertex normals in the OBJ file are normalized.
+		 @throws		Exception
+						Failed to read a Vertex Normal Coordinates definition.
+		 */
+		void ReadOBJVertexNormal();
+
+		/**
+		 Reads a Face definition.
+
+		 @throws		Exception
+						Failed to read a Face definition.
+		 */
+		void ReadOBJFace();
+
+		/**
+		 Reads a definition consisting of a single name.
+
+		 @param[in]		type
+						The record type of the definition.
+		 @throws		Exception
+						Failed to read the definition.
+		 */
+		void ReadOBJName(OBJRecordType type);
+
+		/**
+		 Reads a set of vertex indices.
+
+		 @return		The (global) vertex indices represented by the next
+						token of this OBJ chunk reader. A zero indicates the
+						absence of a component.
+		 @throws		Exception
+						Failed to read the vertex indices.
+		 */
+		[[nodiscard]]
+		const U32x3 ReadOBJVertexIndices();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of lines of the chunk of this OBJ chunk reader.
+		 */
+		U32 m_nb_lines;
+
+		/**
+		 The number of vertex position, texture and normal coordinates of the
+		 chunk of this OBJ chunk reader.
+		 */
+		U32x3 m_nb_coordinates;
+
+		/**
+		 The number of faces of the chunk of this OBJ chunk reader.
+		 */
+		U32 m_nb_faces;
+
+		/**
+		 The number of vertex position, texture and normal coordinates of all
+		 chunks preceding the chunk of this OBJ chunk reader.
+		 */
+		U32x3 m_offsets;
+
+		/**
+		 The number of vertex position, texture and normal coordinates read so
+		 far by this OBJ chunk reader.
+		 */
+		U32x3 m_nb_read_coordinates;
+
+		/**
+		 The vertex position coordinates of all chunks.
+		 */
+		gsl::span< Point3 > m_vertex_coordinates;
+
+		/**
+		 The vertex texture coordinates of all chunks.
+		 */
+		gsl::span< UV > m_vertex_texture_coordinates;
+
+		/**
+		 The vertex normal coordinates of all chunks.
+		 */
+		gsl::span< Normal3 > m_vertex_normal_coordinates;
+
+		/**
+		 A vector containing the records of the chunk of this OBJ chunk
+		 reader.
+		 */
+		std::vector< OBJRecord > m_records;
+
+		/**
+		 A vector containing the (global) vertex indices of the faces of the
+		 chunk of this OBJ chunk reader.
+		 */
+		std::vector< U32x3 > m_face_vertex_indices;
+
+		/**
+		 A flag indicating whether this OBJ chunk reader only counts.
+		 */
+		bool m_count_only;
+
+		/**
+		 A reference to the mesh descriptor for this OBJ chunk reader.
+		 */
+		const MeshDescriptor< VertexT, IndexT >& m_mesh_desc;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\obj\obj_chunk_reader.tpp"
+
+#pragma endregion
\ No newline at end of file
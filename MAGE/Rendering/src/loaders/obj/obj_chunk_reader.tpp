@@ -0,0 +1,211 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\obj\obj_tokens.hpp"
+#include "loaders\obj\obj_vertex_indices.hpp"
+#include "logging\logging.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename VertexT, typename IndexT >
+	OBJChunkReader< VertexT, IndexT >
+		::OBJChunkReader(const MeshDescriptor< VertexT, IndexT >& mesh_desc) noexcept
+		: LineReader(),
+		m_nb_lines(0u),
+		m_nb_coordinates(0u),
+		m_nb_faces(0u),
+		m_offsets(0u),
+		m_nb_read_coordinates(0u),
+		m_vertex_coordinates(),
+		m_vertex_texture_coordinates(),
+		m_vertex_normal_coordinates(),
+		m_records(),
+		m_face_vertex_indices(),
+		m_count_only(false),
+		m_mesh_desc(mesh_desc) {}
+
+	template< typename VertexT, typename IndexT >
+	OBJChunkReader< VertexT, IndexT >
+		::OBJChunkReader(OBJChunkReader&& reader) noexcept = default;
+
+	template< typename VertexT, typename IndexT >
+	OBJChunkReader< VertexT, IndexT >::~OBJChunkReader() = default;
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >
+		::Count(std::string_view chunk, std::filesystem::path path) {
+
+		m_nb_coordinates = U32x3(0u);
+		m_nb_faces       = 0u;
+		m_count_only     = true;
+
+		ReadFromMemory(chunk, std::move(path), 0u);
+
+		m_nb_lines       = GetCurrentLineNumber();
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >
+		::Read(std::string_view chunk,
+			   std::filesystem::path path,
+			   U32 line_number,
+			   const U32x3& offsets,
+			   gsl::span< Point3 > vertex_coordinates,
+			   gsl::span< UV > vertex_texture_coordinates,
+			   gsl::span< Normal3 > vertex_normal_coordinates) {
+
+		m_offsets                    = offsets;
+		m_nb_read_coordinates        = U32x3(0u);
+		m_vertex_coordinates         = vertex_coordinates;
+		m_vertex_texture_coordinates = vertex_texture_coordinates;
+		m_vertex_normal_coordinates  = vertex_normal_coordinates;
+		m_records.clear();
+		m_face_vertex_indices.clear();
+		m_count_only                 = false;
+
+		ReadFromMemory(chunk, std::move(path), line_number);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >::CountLine() {
+		const auto token = LineReader::Read< std::string_view >();
+
+		// The remaining tokens of the current line are not scanned.
+		if (g_obj_token_vertex        == token) {
+			++m_nb_coordinates[0u];
+		}
+		else if (g_obj_token_texture  == token) {
+			++m_nb_coordinates[1u];
+		}
+		else if (g_obj_token_normal   == token) {
+			++m_nb_coordinates[2u];
+		}
+		else if (g_obj_token_face     == token) {
+			++m_nb_faces;
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >::ReadLine() {
+		if (m_count_only) {
+			CountLine();
+			return;
+		}
+
+		const auto token = LineReader::Read< std::string_view >();
+
+		if (g_obj_token_comment == token[0]) {
+			return;
+		}
+		else if (g_obj_token_vertex           == token) {
+			ReadOBJVertex();
+		}
+		else if (g_obj_token_texture          == token) {
+			ReadOBJVertexTexture();
+		}
+		else if (g_obj_token_normal           == token) {
+			ReadOBJVertexNormal();
+		}
+		else if (g_obj_token_face             == token) {
+			ReadOBJFace();
+		}
+		else if (g_obj_token_material_library == token) {
+			ReadOBJName(OBJRecordType::MaterialLibrary);
+		}
+		else if (g_obj_token_material_use     == token) {
+			ReadOBJName(OBJRecordType::MaterialUse);
+		}
+		else if (g_obj_token_group            == token) {
+			ReadOBJName(OBJRecordType::Group);
+		}
+		else if (g_obj_token_object           == token) {
+			ReadOBJName(OBJRecordType::Group);
+		}
+		else if (g_obj_token_smoothing_group  == token) {
+			// Silently ignore smoothing group declarations.
+			LineReader::Read< std::string_view >();
+		}
+		else {
+			Warning("{}: line {}: unsupported keyword token: {}.",
+					GetPath(), GetCurrentLineNumber(), token);
+			return;
+		}
+
+		ReadRemainingTokens();
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >::ReadOBJVertex() {
+		const Point3 read_vertex(LineReader::Read< F32, 3u >());
+		auto vertex = m_mesh_desc.InvertHandness() ?
+			InvertHandness(read_vertex) : read_vertex;
+
+		const auto index = m_offsets[0u] + m_nb_read_coordinates[0u]++;
+		m_vertex_coordinates[index] = std::move(vertex);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >::ReadOBJVertexTexture() {
+		const UV read_texture(LineReader::Read< F32, 2u >());
+		if (Contains< F32 >()) {
+			// Silently ignore 3D vertex texture coordinates.
+			LineReader::Read< F32 >();
+		}
+
+		auto texture = m_mesh_desc.InvertHandness() ?
+			InvertHandness(read_texture) : read_texture;
+
+		const auto index = m_offsets[1u] + m_nb_read_coordinates[1u]++;
+		m_vertex_texture_coordinates[index] = std::move(texture);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >::ReadOBJVertexNormal() {
+		const Normal3 read_normal(LineReader::Read< F32, 3u >());
+		auto normal = m_mesh_desc.InvertHandness() ?
+			InvertHandness(read_normal) : read_normal;
+
+		const auto index = m_offsets[2u] + m_nb_read_coordinates[2u]++;
+		m_vertex_normal_coordinates[index] = std::move(normal);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >::ReadOBJFace() {
+		U32 nb_vertices = 0u;
+		while (nb_vertices < 3u || ContainsTokens()) {
+			m_face_vertex_indices.push_back(ReadOBJVertexIndices());
+			++nb_vertices;
+		}
+
+		m_records.push_back({ OBJRecordType::Face, nb_vertices, {} });
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJChunkReader< VertexT, IndexT >::ReadOBJName(OBJRecordType type) {
+		const auto name = LineReader::Read< std::string_view >();
+		m_records.push_back({ type, 0u, name });
+	}
+
+	template< typename VertexT, typename IndexT >
+	[[nodiscard]]
+	inline const U32x3 OBJChunkReader< VertexT, IndexT >::ReadOBJVertexIndices() {
+		const U32x3 nb_coordinates = {
+			m_offsets[0u] + m_nb_read_coordinates[0u],
+			m_offsets[1u] + m_nb_read_coordinates[1u],
+			m_offsets[2u] + m_nb_read_coordinates[2u]
+		};
+
+		return ParseOBJVertexIndices(LineReader::Read< std::string_view >(),
+									 nb_coordinates,
+									 GetPath(), GetCurrentLineNumber());
+	}
+}
\ No newline at end of file
@@ -35,6 +35,9 @@ namespace mage::rendering::loader {
 					A reference to the model output.
 	 @param[in]		mesh_desc
 					A reference to the mesh descriptor.
+	 @param[in]		multithreaded
+					A flag indicating whether the OBJ file should be split in
+					chunks which are read on multiple threads.
 	 @throws		Exception
 					Failed to import the mesh from file.
 	 */
@@ -43,7 +46,8 @@ namespace mage::rendering::loader {
 							   ResourceManager& resource_manager,
 							   ModelOutput< VertexT, IndexT >& model_output,
 							   const MeshDescriptor< VertexT, IndexT >&
-							   mesh_desc = MeshDescriptor< VertexT, IndexT >());
+							   mesh_desc = MeshDescriptor< VertexT, IndexT >(),
+							   bool multithreaded = false);
 }
 
 //-----------------------------------------------------------------------------
@@ -18,9 +18,11 @@ namespace mage::rendering::loader {
 	void ImportOBJMeshFromFile(const std::filesystem::path& path,
 							   ResourceManager& resource_manager,
 							   ModelOutput< VertexT, IndexT >& model_output,
-							   const MeshDescriptor< VertexT, IndexT >& mesh_desc) {
+							   const MeshDescriptor< VertexT, IndexT >& mesh_desc,
+							   bool multithreaded) {
 
-		OBJReader< VertexT, IndexT > reader(resource_manager, model_output, mesh_desc);
+		OBJReader< VertexT, IndexT > reader(resource_manager, model_output,
+											mesh_desc, multithreaded);
 		reader.ReadFromFile(path);
 	}
 }
\ No newline at end of file
@@ -6,20 +6,12 @@
 #pragma region
 
 #include "io\line_reader.hpp"
+#include "loaders\obj\obj_vertex_mapping.hpp"
 #include "resource\model\model_output.hpp"
 #include "resource\mesh\mesh_descriptor.hpp"
 
 #pragma endregion
 
-//-----------------------------------------------------------------------------
-// System Includes
-//-----------------------------------------------------------------------------
-#pragma region
-
-#include <map>
-
-#pragma endregion
-
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -57,10 +49,14 @@ namespace mage::rendering::loader {
 						from file.
 		 @param[in]		mesh_desc
 						A reference to a mesh descriptor.
+		 @param[in]		multithreaded
+						A flag indicating whether the OBJ file should be split
+						in chunks which are read on multiple threads.
 		 */
 		explicit OBJReader(ResourceManager& resource_manager,
 						   ModelOutput< VertexT, IndexT >& model_output,
-						   const MeshDescriptor< VertexT, IndexT >& mesh_desc);
+						   const MeshDescriptor< VertexT, IndexT >& mesh_desc,
+						   bool multithreaded = false);
 
 		/**
 		 Constructs an OBJ reader from the given OBJ reader.
@@ -129,6 +125,41 @@ namespace mage::rendering::loader {
 		 */
 		virtual void Preprocess() override;
 
+		/**
+		 Processes the given input string of this OBJ reader.
+
+		 If this OBJ reader is multithreaded, the given input string is split
+		 at line boundaries into chunks which are read in parallel. The
+		 results are merged afterwards in order of appearance, resulting in
+		 the same model output as a single-threaded read.
+
+		 @param[in]		input
+						The input string.
+		 @throws		Exception
+						Failed to process the given input string.
+		 */
+		virtual void Process(std::string_view input) override;
+
+		/**
+		 Processes the given input string of this OBJ reader in parallel.
+
+		 @param[in]		input
+						The input string.
+		 @throws		Exception
+						Failed to process the given input string.
+		 */
+		void ProcessInParallel(std::string_view input);
+
+		/**
+		 Reserves capacity for the vertex coordinates, vertices and indices
+		 of the given input string of this OBJ reader. The records of the
+		 given input string are counted without being tokenized.
+
+		 @param[in]		input
+						The input string.
+		 */
+		void Reserve(std::string_view input);
+
 		/**
 		 Reads the current line of this OBJ reader.
 
@@ -227,6 +258,40 @@ namespace mage::rendering::loader {
 		 */
 		void ReadOBJFace();
 
+		/**
+		 Imports the materials of the given Material Library.
+
+		 @param[in]		mtl_name
+						The name of the Material Library.
+		 @throws		Exception
+						Failed to import the materials.
+		 */
+		void AddOBJMaterialLibrary(std::string_view mtl_name);
+
+		/**
+		 Starts using the given material.
+
+		 @param[in]		material
+						The name of the material.
+		 */
+		void AddOBJMaterialUse(std::string_view material);
+
+		/**
+		 Starts the given group.
+
+		 @param[in]		group
+						The name of the group.
+		 */
+		void AddOBJGroup(std::string_view group);
+
+		/**
+		 Adds a face with the given vertex indices.
+
+		 @param[in]		vertex_indices
+						The vertex indices of the vertices of the face.
+		 */
+		void AddOBJFace(gsl::span< const U32x3 > vertex_indices);
+
 		/**
 		 Reads a set of vertex position coordinates.
 
@@ -288,30 +353,6 @@ namespace mage::rendering::loader {
 		[[nodiscard]]
 		const VertexT ConstructVertex(const U32x3& vertex_indices);
 
-		/**
-		 A struct of @c U32x3 comparators for OBJ vertex indices.
-		 */
-		struct OBJComparator {
-
-		public:
-
-			/**
-			 Compares the two given @c U32x3 vectors against each other.
-
-			 @param[in]		lhs
-							A reference to the first vector.
-			 @param[in]		rhs
-							A reference to the second vector.
-			 @return		@c true if the @a lhs is smaller than @a rhs.
-							@c false otherwise.
-			 */
-			[[nodiscard]]
-			bool operator()(const U32x3& lhs, const U32x3& rhs) const noexcept {
-				return std::tie(lhs[0], lhs[1], lhs[2])
-					 < std::tie(rhs[0], rhs[1], rhs[2]);
-			}
-		};
-
 		/**
 		 Finalizes the current model part of this OBJ reader and prepare a new
 		 current model part.
@@ -350,7 +391,7 @@ namespace mage::rendering::loader {
 		 and the index of a vertex in the vertex buffer (@c m_model_output) of
 		 this OBJ reader.
 		 */
-		std::map< U32x3, IndexT, OBJComparator > m_mapping;
+		OBJVertexMapping< IndexT > m_mapping;
 
 		/**
 		 A reference to the resource manager of this OBJ reader.
@@ -367,6 +408,11 @@ namespace mage::rendering::loader {
 		 A reference to the mesh descriptor for this OBJ reader.
 		 */
 		const MeshDescriptor< VertexT, IndexT >& m_mesh_desc;
+
+		/**
+		 A flag indicating whether this OBJ reader reads on multiple threads.
+		 */
+		bool m_multithreaded;
 	};
 }
 
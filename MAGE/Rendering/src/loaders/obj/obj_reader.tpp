@@ -5,9 +5,21 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "loaders\obj\obj_chunk_reader.hpp"
 #include "loaders\obj\obj_tokens.hpp"
+#include "loaders\obj\obj_vertex_indices.hpp"
 #include "loaders\material_loader.hpp"
 #include "resource\mesh\vertex.hpp"
+#include "parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <future>
 
 #pragma endregion
 
@@ -20,7 +32,8 @@ namespace mage::rendering::loader {
 	OBJReader< VertexT, IndexT >
 		::OBJReader(ResourceManager& resource_manager,
 					ModelOutput< VertexT, IndexT >& model_output,
-			        const MeshDescriptor< VertexT, IndexT >& mesh_desc)
+			        const MeshDescriptor< VertexT, IndexT >& mesh_desc,
+					bool multithreaded)
 		: LineReader(),
 		m_model_part(),
 		m_vertex_coordinates(),
@@ -29,7 +42,8 @@ namespace mage::rendering::loader {
 		m_mapping(),
 		m_resource_manager(resource_manager),
 		m_model_output(model_output),
-		m_mesh_desc(mesh_desc) {}
+		m_mesh_desc(mesh_desc),
+		m_multithreaded(multithreaded) {}
 
 	template< typename VertexT, typename IndexT >
 	OBJReader< VertexT, IndexT >::OBJReader(OBJReader&& reader) noexcept = default;
@@ -64,6 +78,186 @@ namespace mage::rendering::loader {
 		m_model_output.NormalizeModelParts();
 	}
 
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::Process(std::string_view input) {
+		// The minimum number of bytes per chunk.
+		static constexpr std::size_t s_min_chunk_size = 1u << 20u;
+
+		if (m_multithreaded && 2u * s_min_chunk_size <= input.size()) {
+			ProcessInParallel(input);
+		}
+		else {
+			Reserve(input);
+			LineReader::Process(input);
+		}
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::Reserve(std::string_view input) {
+		std::size_t nb_faces = 0u;
+		U32x3 nb_coordinates(0u);
+
+		while (!input.empty()) {
+			const auto begin = input.find_first_not_of(" \t");
+			if (std::string_view::npos == begin) {
+				break;
+			}
+			input.remove_prefix(begin);
+
+			const auto end   = input.find_first_of(" \t\r\n");
+			const auto token = input.substr(0u, end);
+			if (g_obj_token_vertex        == token) {
+				++nb_coordinates[0u];
+			}
+			else if (g_obj_token_texture  == token) {
+				++nb_coordinates[1u];
+			}
+			else if (g_obj_token_normal   == token) {
+				++nb_coordinates[2u];
+			}
+			else if (g_obj_token_face     == token) {
+				++nb_faces;
+			}
+
+			const auto next = input.find('\n', token.size());
+			input.remove_prefix((std::string_view::npos == next)
+								? input.size() : next + 1u);
+		}
+
+		// Each face introduces roughly one new vertex on average.
+		m_mapping.Reserve(m_mapping.GetSize() + nb_faces);
+		m_model_output.m_vertex_buffer.reserve(
+			m_model_output.m_vertex_buffer.size() + nb_faces);
+		m_model_output.m_index_buffer.reserve(
+			m_model_output.m_index_buffer.size() + 3u * nb_faces);
+
+		m_vertex_coordinates.reserve(
+			m_vertex_coordinates.size() + nb_coordinates[0u]);
+		m_vertex_texture_coordinates.reserve(
+			m_vertex_texture_coordinates.size() + nb_coordinates[1u]);
+		m_vertex_normal_coordinates.reserve(
+			m_vertex_normal_coordinates.size() + nb_coordinates[2u]);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::ProcessInParallel(std::string_view input) {
+		using ChunkReader = OBJChunkReader< VertexT, IndexT >;
+
+		// Split the input at line boundaries.
+		const auto nb_cores = std::max(std::size_t(1u),
+			static_cast< std::size_t >(NumberOfSystemCores()));
+		const auto chunk_size = input.size() / nb_cores + 1u;
+
+		std::vector< std::string_view > chunks;
+		chunks.reserve(nb_cores);
+		while (!input.empty()) {
+			const auto end = input.find('\n', chunk_size);
+			const auto size = (std::string_view::npos == end)
+							? input.size() : end + 1u;
+			chunks.push_back(input.substr(0u, size));
+			input.remove_prefix(size);
+		}
+
+		std::vector< ChunkReader > readers;
+		readers.reserve(chunks.size());
+		for (std::size_t i = 0u; i < chunks.size(); ++i) {
+			readers.emplace_back(m_mesh_desc);
+		}
+
+		const auto for_each_chunk = [&chunks](auto&& action) {
+			std::vector< std::future< void > > futures;
+			futures.reserve(chunks.size());
+			for (std::size_t i = 0u; i < chunks.size(); ++i) {
+				futures.push_back(std::async(std::launch::async, action, i));
+			}
+
+			// Wait for all chunks before propagating the first exception.
+			for (auto& future : futures) {
+				future.wait();
+			}
+			for (auto& future : futures) {
+				future.get();
+			}
+		};
+
+		// Pass 1: count the lines and vertex coordinates of each chunk.
+		for_each_chunk([this, &chunks, &readers](std::size_t i) {
+			readers[i].Count(chunks[i], GetPath());
+		});
+
+		std::vector< U32 > line_numbers(chunks.size());
+		std::vector< U32x3 > offsets(chunks.size());
+		U32 line_number = GetCurrentLineNumber();
+		std::size_t nb_faces = 0u;
+		U32x3 nb_coordinates = {
+			static_cast< U32 >(m_vertex_coordinates.size()),
+			static_cast< U32 >(m_vertex_texture_coordinates.size()),
+			static_cast< U32 >(m_vertex_normal_coordinates.size())
+		};
+		for (std::size_t i = 0u; i < chunks.size(); ++i) {
+			line_numbers[i] = line_number;
+			offsets[i]      = nb_coordinates;
+
+			line_number       += readers[i].GetNumberOfLines();
+			nb_coordinates[0] += readers[i].GetNumberOfCoordinates()[0];
+			nb_coordinates[1] += readers[i].GetNumberOfCoordinates()[1];
+			nb_coordinates[2] += readers[i].GetNumberOfCoordinates()[2];
+			nb_faces          += readers[i].GetNumberOfFaces();
+		}
+
+		// Each face introduces roughly one new vertex on average.
+		m_mapping.Reserve(m_mapping.GetSize() + nb_faces);
+		m_model_output.m_vertex_buffer.reserve(
+			m_model_output.m_vertex_buffer.size() + nb_faces);
+		m_model_output.m_index_buffer.reserve(
+			m_model_output.m_index_buffer.size() + 3u * nb_faces);
+
+		m_vertex_coordinates.resize(nb_coordinates[0]);
+		m_vertex_texture_coordinates.resize(nb_coordinates[1]);
+		m_vertex_normal_coordinates.resize(nb_coordinates[2]);
+
+		// Pass 2: read the vertex coordinates and records of each chunk.
+		for_each_chunk([this, &chunks, &readers,
+						&line_numbers, &offsets](std::size_t i) {
+			readers[i].Read(chunks[i], GetPath(), line_numbers[i], offsets[i],
+							gsl::make_span(m_vertex_coordinates),
+							gsl::make_span(m_vertex_texture_coordinates),
+							gsl::make_span(m_vertex_normal_coordinates));
+		});
+
+		// Merge the records of all chunks in order of appearance.
+		for (const auto& reader : readers) {
+			const auto& face_vertex_indices = reader.GetFaceVertexIndices();
+			std::size_t face_vertex_index = 0u;
+
+			for (const auto& record : reader.GetRecords()) {
+				switch (record.m_type) {
+
+				case OBJRecordType::Face: {
+					const auto vertex_indices = gsl::make_span(
+						face_vertex_indices.data() + face_vertex_index,
+						record.m_nb_vertices);
+					AddOBJFace(vertex_indices);
+					face_vertex_index += record.m_nb_vertices;
+					break;
+				}
+				case OBJRecordType::MaterialLibrary: {
+					AddOBJMaterialLibrary(record.m_name);
+					break;
+				}
+				case OBJRecordType::MaterialUse: {
+					AddOBJMaterialUse(record.m_name);
+					break;
+				}
+				case OBJRecordType::Group: {
+					AddOBJGroup(record.m_name);
+					break;
+				}
+				}
+			}
+		}
+	}
+
 	template< typename VertexT, typename IndexT >
 	void OBJReader< VertexT, IndexT >::ReadLine() {
 		const auto token = Read< std::string_view >();
@@ -108,32 +302,18 @@ namespace mage::rendering::loader {
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJMaterialLibrary() {
-		const UTF8toUTF16 mtl_name(Read< std::string_view >());
-		auto mtl_path = GetPath();
-		mtl_path.replace_filename(std::wstring_view(mtl_name));
-
-		ImportMaterialFromFile(mtl_path,
-							   m_resource_manager,
-							   m_model_output.m_material_buffer);
+	inline void OBJReader< VertexT, IndexT >::ReadOBJMaterialLibrary() {
+		AddOBJMaterialLibrary(Read< std::string_view >());
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJMaterialUse() {
-		if (!m_model_part.HasDefaultMaterial()) {
-			FinalizeModelPart();
-		}
-
-		m_model_part.m_material = Read< std::string_view >();
+	inline void OBJReader< VertexT, IndexT >::ReadOBJMaterialUse() {
+		AddOBJMaterialUse(Read< std::string_view >());
 	}
 
 	template< typename VertexT, typename IndexT >
-	void OBJReader< VertexT, IndexT >::ReadOBJGroup() {
-		if (!m_model_part.HasDefaultChild()) {
-			FinalizeModelPart();
-		}
-
-		m_model_part.m_child = Read< std::string_view >();
+	inline void OBJReader< VertexT, IndexT >::ReadOBJGroup() {
+		AddOBJGroup(Read< std::string_view >());
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -176,31 +356,66 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	void OBJReader< VertexT, IndexT >::ReadOBJFace() {
-		MemoryBuffer< IndexT, 6u > indices;
-		while (indices.size() < 3u || ContainsTokens()) {
-			const auto indices3 = ReadOBJVertexIndices();
+		MemoryBuffer< U32x3, 6u > vertex_indices;
+		while (vertex_indices.size() < 3u || ContainsTokens()) {
+			vertex_indices.push_back(ReadOBJVertexIndices());
+		}
 
-			if (const auto it = m_mapping.find(indices3);
-				it != m_mapping.cend()) {
+		AddOBJFace(gsl::make_span(vertex_indices.data(),
+								  vertex_indices.size()));
+	}
 
-				// Add the index to the already existing vertex.
-				indices.push_back(it->second);
-			}
-			else {
-				// Create an index to a new vertex.
-				const auto index
-					= static_cast< IndexT >(m_model_output.m_vertex_buffer.size());
-				// Add the index to the new vertex.
-				indices.push_back(index);
-
-				// Create a new vertex.
-				auto vertex = ConstructVertex(indices3);
-				// Add the new vertex.
-				m_model_output.m_vertex_buffer.push_back(std::move(vertex));
-
-				// Add the new mapping.
-				m_mapping[indices3] = index;
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >
+		::AddOBJMaterialLibrary(std::string_view mtl_name) {
+
+		const UTF8toUTF16 mtl_wname(mtl_name);
+		auto mtl_path = GetPath();
+		mtl_path.replace_filename(std::wstring_view(mtl_wname));
+
+		ImportMaterialFromFile(mtl_path,
+							   m_resource_manager,
+							   m_model_output.m_material_buffer);
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >
+		::AddOBJMaterialUse(std::string_view material) {
+
+		if (!m_model_part.HasDefaultMaterial()) {
+			FinalizeModelPart();
+		}
+
+		m_model_part.m_material = material;
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >::AddOBJGroup(std::string_view group) {
+		if (!m_model_part.HasDefaultChild()) {
+			FinalizeModelPart();
+		}
+
+		m_model_part.m_child = group;
+	}
+
+	template< typename VertexT, typename IndexT >
+	void OBJReader< VertexT, IndexT >
+		::AddOBJFace(gsl::span< const U32x3 > vertex_indices) {
+
+		MemoryBuffer< IndexT, 6u > indices;
+		for (const auto& indices3 : vertex_indices) {
+			// Create an index to a new vertex.
+			const auto new_index
+				= static_cast< IndexT >(m_model_output.m_vertex_buffer.size());
+
+			const auto [index, inserted] = m_mapping.Insert(indices3, new_index);
+			if (inserted) {
+				// Create and add the new vertex.
+				m_model_output.m_vertex_buffer.push_back(ConstructVertex(indices3));
 			}
+
+			// Add the index to the new or already existing vertex.
+			indices.push_back(index);
 		}
 
 		if (m_mesh_desc.ClockwiseOrder()) {
@@ -252,58 +467,17 @@ namespace mage::rendering::loader {
 
 	template< typename VertexT, typename IndexT >
 	[[nodiscard]]
-	const U32x3 OBJReader< VertexT, IndexT >
+	inline const U32x3 OBJReader< VertexT, IndexT >
 		::ReadOBJVertexIndices() {
 
-		const auto token  = Read< std::string_view >();
-
-		const auto slash1 = token.find_first_of('/');
-		const bool flag1  = (std::string::npos != slash1);
-		const auto slash2 = token.find_first_of('/', slash1 + 1u);
-		const bool flag2  = (std::string::npos != slash2);
-		const bool flagd  = (slash1 + 1u == slash2);
-
-		static constexpr const_zstring s_token_names[] = {
-			"v",
-			"vt",
-			"vn"
-		};
-		const bool contains_token[] = {
-			true,
-			flag1 && !flagd,
-			flag2
-		};
-		const std::string_view tokens[] = {
-			// If offset std::string::npos + 1u == 0u then count is don't-care;
-			// all unsigned values avoid exception.
-			token.substr(0u,          slash1),
-			token.substr(slash1 + 1u, slash2       - slash1 - 1u),
-			token.substr(slash2 + 1u, token.size() - slash2 - 1u)
-		};
-
-		U32x3 indices;
-		const S32x3 sizes = {
-			static_cast< S32 >(m_vertex_coordinates.size()),
-			static_cast< S32 >(m_vertex_texture_coordinates.size()),
-			static_cast< S32 >(m_vertex_normal_coordinates.size())
+		const U32x3 nb_coordinates = {
+			static_cast< U32 >(m_vertex_coordinates.size()),
+			static_cast< U32 >(m_vertex_texture_coordinates.size()),
+			static_cast< U32 >(m_vertex_normal_coordinates.size())
 		};
 
-		for (std::size_t i = 0u; i < std::size(s_token_names); ++i) {
-			if (!contains_token[i]) {
-				continue;
-			}
-
-			if (const auto result = StringTo< S32 >(tokens[i]); bool(result)) {
-				const auto index = *result;
-				indices[i] = static_cast< U32 >((0 <= index) ? index : sizes[i] + index);
-			}
-			else {
-				throw Exception("{}: line {}: invalid {} index value found in {}.",
-								GetPath(), GetCurrentLineNumber(), s_token_names[i], token);
-			}
-		}
-
-		return indices;
+		return ParseOBJVertexIndices(Read< std::string_view >(), nb_coordinates,
+									 GetPath(), GetCurrentLineNumber());
 	}
 
 	template< typename VertexT, typename IndexT >
@@ -0,0 +1,96 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "exception\exception.hpp"
+#include "type\vector_types.hpp"
+#include "string\string_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+#include <string_view>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 Parses the given set of vertex indices of an OBJ file.
+
+	 @param[in]		token
+					The token containing the set of vertex indices.
+	 @param[in]		nb_coordinates
+					A reference to the number of vertex position, texture and
+					normal coordinates preceding the given token (i.e. the
+					coordinates relative indices refer to).
+	 @param[in]		path
+					A reference to the path of the OBJ file.
+	 @param[in]		line_number
+					The line number of the given token.
+	 @return		The (absolute) vertex indices represented by the given
+					token. A zero indicates the absence of a component.
+	 @throws		Exception
+					Failed to parse the vertex indices.
+	 */
+	[[nodiscard]]
+	inline const U32x3 ParseOBJVertexIndices(std::string_view token,
+											 const U32x3& nb_coordinates,
+											 const std::filesystem::path& path,
+											 U32 line_number) {
+
+		const auto slash1 = token.find_first_of('/');
+		const bool flag1  = (std::string::npos != slash1);
+		const auto slash2 = token.find_first_of('/', slash1 + 1u);
+		const bool flag2  = (std::string::npos != slash2);
+		const bool flagd  = (slash1 + 1u == slash2);
+
+		static constexpr const_zstring s_token_names[] = {
+			"v",
+			"vt",
+			"vn"
+		};
+		const bool contains_token[] = {
+			true,
+			flag1 && !flagd,
+			flag2
+		};
+		const std::string_view tokens[] = {
+			// If offset std::string::npos + 1u == 0u then count is don't-care;
+			// all unsigned values avoid exception.
+			token.substr(0u,          slash1),
+			token.substr(slash1 + 1u, slash2       - slash1 - 1u),
+			token.substr(slash2 + 1u, token.size() - slash2 - 1u)
+		};
+
+		U32x3 indices;
+		for (std::size_t i = 0u; i < std::size(s_token_names); ++i) {
+			if (!contains_token[i]) {
+				continue;
+			}
+
+			if (const auto result = StringTo< S32 >(tokens[i]); bool(result)) {
+				const auto index = *result;
+				const auto size  = static_cast< S32 >(nb_coordinates[i]);
+				indices[i] = static_cast< U32 >((0 <= index) ? index : size + index + 1);
+			}
+			else {
+				throw Exception("{}: line {}: invalid {} index value found in {}.",
+								path, line_number, s_token_names[i], token);
+			}
+		}
+
+		return indices;
+	}
+}
\ No newline at end of file
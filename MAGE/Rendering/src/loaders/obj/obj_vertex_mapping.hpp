@@ -0,0 +1,251 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	/**
+	 A class of OBJ vertex mappings between vertex position/texture/normal
+	 coordinates' indices and the index of a vertex in a vertex buffer.
+
+	 The mapping is implemented as an open-addressing hash table with linear
+	 probing. All entries are stored inline in a single flat array (i.e.
+	 without an allocation per entry).
+
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename IndexT >
+	class OBJVertexMapping {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an OBJ vertex mapping.
+		 */
+		OBJVertexMapping();
+
+		/**
+		 Constructs an OBJ vertex mapping from the given OBJ vertex mapping.
+
+		 @param[in]		mapping
+						A reference to the OBJ vertex mapping to copy.
+		 */
+		OBJVertexMapping(const OBJVertexMapping& mapping) = delete;
+
+		/**
+		 Constructs an OBJ vertex mapping by moving the given OBJ vertex
+		 mapping.
+
+		 @param[in]		mapping
+						A reference to the OBJ vertex mapping to move.
+		 */
+		OBJVertexMapping(OBJVertexMapping&& mapping) noexcept;
+
+		/**
+		 Destructs this OBJ vertex mapping.
+		 */
+		~OBJVertexMapping();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given OBJ vertex mapping to this OBJ vertex mapping.
+
+		 @param[in]		mapping
+						A reference to the OBJ vertex mapping to copy.
+		 @return		A reference to the copy of the given OBJ vertex
+						mapping (i.e. this OBJ vertex mapping).
+		 */
+		OBJVertexMapping& operator=(const OBJVertexMapping& mapping) = delete;
+
+		/**
+		 Moves the given OBJ vertex mapping to this OBJ vertex mapping.
+
+		 @param[in]		mapping
+						A reference to the OBJ vertex mapping to move.
+		 @return		A reference to the moved OBJ vertex mapping (i.e. this
+						OBJ vertex mapping).
+		 */
+		OBJVertexMapping& operator=(OBJVertexMapping&& mapping) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of entries of this OBJ vertex mapping.
+
+		 @return		The number of entries of this OBJ vertex mapping.
+		 */
+		[[nodiscard]]
+		std::size_t GetSize() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Returns the number of slots of this OBJ vertex mapping.
+
+		 @return		The number of slots of this OBJ vertex mapping.
+		 */
+		[[nodiscard]]
+		std::size_t GetCapacity() const noexcept {
+			return m_slots.size();
+		}
+
+		/**
+		 Reserves capacity for at least the given number of entries without
+		 rehashing.
+
+		 @param[in]		size
+						The number of entries.
+		 */
+		void Reserve(std::size_t size);
+
+		/**
+		 Inserts the given index for the given vertex indices if this OBJ
+		 vertex mapping contains no entry for the given vertex indices yet.
+
+		 @param[in]		vertex_indices
+						A reference to the vertex indices. The vertex indices
+						may not all be equal to the maximum @c U32 value.
+		 @param[in]		index
+						The index of the vertex in the vertex buffer.
+		 @return		A pair containing the index of the vertex in the vertex
+						buffer mapped to the given vertex indices, and a flag
+						indicating whether the given index is inserted.
+		 */
+		const std::pair< IndexT, bool > Insert(const U32x3& vertex_indices,
+											   IndexT index);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of slots of OBJ vertex mappings.
+		 */
+		struct Slot {
+
+		public:
+
+			/**
+			 The vertex indices of this slot.
+			 */
+			U32x3 m_vertex_indices;
+
+			/**
+			 The index of the vertex in the vertex buffer of this slot.
+			 */
+			IndexT m_index;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The vertex indices marking empty slots.
+		 */
+		static constexpr U32 s_empty = std::numeric_limits< U32 >::max();
+
+		/**
+		 The minimum number of slots of OBJ vertex mappings.
+		 */
+		static constexpr std::size_t s_min_capacity = 64u;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the given slot is empty.
+
+		 @param[in]		slot
+						A reference to the slot.
+		 @return		@c true if the given slot is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		static bool IsEmpty(const Slot& slot) noexcept {
+			return s_empty == slot.m_vertex_indices[0u]
+				&& s_empty == slot.m_vertex_indices[1u]
+				&& s_empty == slot.m_vertex_indices[2u];
+		}
+
+		/**
+		 Hashes the given vertex indices.
+
+		 @param[in]		vertex_indices
+						A reference to the vertex indices.
+		 @return		The hash of the given vertex indices.
+		 */
+		[[nodiscard]]
+		static std::size_t Hash(const U32x3& vertex_indices) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Rehashes all entries of this OBJ vertex mapping into the given number
+		 of slots.
+
+		 @pre			@a capacity is a power of two.
+		 @param[in]		capacity
+						The number of slots.
+		 */
+		void Rehash(std::size_t capacity);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A vector containing the slots of this OBJ vertex mapping. The number
+		 of slots is zero or a power of two.
+		 */
+		std::vector< Slot > m_slots;
+
+		/**
+		 The number of entries of this OBJ vertex mapping.
+		 */
+		std::size_t m_size;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "loaders\obj\obj_vertex_mapping.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering::loader {
+
+	template< typename IndexT >
+	OBJVertexMapping< IndexT >::OBJVertexMapping()
+		: m_slots(),
+		m_size(0u) {}
+
+	template< typename IndexT >
+	OBJVertexMapping< IndexT >
+		::OBJVertexMapping(OBJVertexMapping&& mapping) noexcept = default;
+
+	template< typename IndexT >
+	OBJVertexMapping< IndexT >::~OBJVertexMapping() = default;
+
+	template< typename IndexT >
+	OBJVertexMapping< IndexT >& OBJVertexMapping< IndexT >
+		::operator=(OBJVertexMapping&& mapping) noexcept = default;
+
+	template< typename IndexT >
+	[[nodiscard]]
+	inline std::size_t OBJVertexMapping< IndexT >
+		::Hash(const U32x3& vertex_indices) noexcept {
+
+		// Multiplicative hashing of the packed vertex indices.
+		const auto packed = (static_cast< U64 >(vertex_indices[0u]) << 32u)
+			              ^ (static_cast< U64 >(vertex_indices[1u]) << 16u)
+			              ^  static_cast< U64 >(vertex_indices[2u]);
+		const auto hash   = (packed ^ (packed >> 29u)) * 0x9E3779B97F4A7C15ull;
+		return static_cast< std::size_t >(hash ^ (hash >> 32u));
+	}
+
+	template< typename IndexT >
+	void OBJVertexMapping< IndexT >::Reserve(std::size_t size) {
+		// Keep the load factor below 3/4.
+		std::size_t capacity = s_min_capacity;
+		while (4u * size >= 3u * capacity) {
+			capacity *= 2u;
+		}
+
+		if (m_slots.size() < capacity) {
+			Rehash(capacity);
+		}
+	}
+
+	template< typename IndexT >
+	const std::pair< IndexT, bool > OBJVertexMapping< IndexT >
+		::Insert(const U32x3& vertex_indices, IndexT index) {
+
+		if (4u * (m_size + 1u) >= 3u * m_slots.size()) {
+			Rehash(std::max(s_min_capacity, 2u * m_slots.size()));
+		}
+
+		const auto mask = m_slots.size() - 1u;
+		for (auto i = Hash(vertex_indices) & mask; true; i = (i + 1u) & mask) {
+			auto& slot = m_slots[i];
+
+			if (IsEmpty(slot)) {
+				slot.m_vertex_indices = vertex_indices;
+				slot.m_index          = index;
+				++m_size;
+				return { index, true };
+			}
+
+			if (slot.m_vertex_indices == vertex_indices) {
+				return { slot.m_index, false };
+			}
+		}
+	}
+
+	template< typename IndexT >
+	void OBJVertexMapping< IndexT >::Rehash(std::size_t capacity) {
+		std::vector< Slot > slots(capacity, Slot{ U32x3(s_empty), IndexT() });
+		m_slots.swap(slots);
+
+		const auto mask = m_slots.size() - 1u;
+		for (const auto& old_slot : slots) {
+			if (IsEmpty(old_slot)) {
+				continue;
+			}
+
+			auto i = Hash(old_slot.m_vertex_indices) & mask;
+			while (!IsEmpty(m_slots[i])) {
+				i = (i + 1u) & mask;
+			}
+
+			m_slots[i] = old_slot;
+		}
+	}
+}
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "loaders\sprite_font_loader.hpp"
 #include "loaders\font\font_loader.hpp"
 #include "exception\exception.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -18,6 +19,7 @@ namespace mage::rendering::loader {
 		                          ID3D11Device& device,
 		                          SpriteFontOutput& output,
 		                          const SpriteFontDescriptor& desc) {
+		MAGE_PROFILE_ZONE("ImportSpriteFontFromFile");
 
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
@@ -8,6 +8,7 @@
 #include "directxtex\ScreenGrab.h"
 #include "directxtex\WICTextureLoader.h"
 #include "exception\exception.hpp"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -28,6 +29,7 @@ namespace mage::rendering::loader {
 	void ImportTextureFromFile(const std::filesystem::path& path,
 		                       ID3D11Device& device,
 		                       NotNull< ID3D11ShaderResourceView** > texture_srv) {
+		MAGE_PROFILE_ZONE("ImportTextureFromFile");
 
 		std::wstring extension(path.extension());
 		TransformToLowerCase(extension);
@@ -44,6 +46,27 @@ namespace mage::rendering::loader {
 		}
 	}
 
+	void ImportTextureFromMemory(const std::filesystem::path& path,
+								 gsl::span< const U8 > data,
+								 ID3D11Device& device,
+								 NotNull< ID3D11ShaderResourceView** > texture_srv) {
+		MAGE_PROFILE_ZONE("ImportTextureFromMemory");
+
+		std::wstring extension(path.extension());
+		TransformToLowerCase(extension);
+
+		if (L".dds" == extension) {
+			const HRESULT result = DirectX::CreateDDSTextureFromMemory(
+				&device, data.data(), data.size(), nullptr, texture_srv);
+			ThrowIfFailed(result, "Texture importing failed: {:08X}.", result);
+		}
+		else {
+			const HRESULT result = DirectX::CreateWICTextureFromMemory(
+				&device, data.data(), data.size(), nullptr, texture_srv);
+			ThrowIfFailed(result, "Texture importing failed: {:08X}.", result);
+		}
+	}
+
 	namespace {
 
 		/**
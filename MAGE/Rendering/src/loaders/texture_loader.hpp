@@ -40,6 +40,25 @@ namespace mage::rendering::loader {
 		                       ID3D11Device& device,
 		                       NotNull< ID3D11ShaderResourceView** > texture_srv);
 
+	/**
+	 Imports the texture from the given file data.
+
+	 @param[in]		path
+					A reference to the path of the file.
+	 @param[in]		data
+					The data of the file.
+	 @param[in,out]	device
+					A reference to the device.
+	 @param[out]	texture_srv
+					A pointer to a pointer to a shader resource view.
+	 @throws		Exception
+					Failed to import the texture from the given file data.
+	 */
+	void ImportTextureFromMemory(const std::filesystem::path& path,
+								 gsl::span< const U8 > data,
+								 ID3D11Device& device,
+								 NotNull< ID3D11ShaderResourceView** > texture_srv);
+
 	/**
 	 Exports the texture to the file associated with the given path.
 
@@ -0,0 +1,186 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\buffer_lock.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of instance buffers (i.e. dynamic vertex buffers containing
+	 per-instance data).
+
+	 @tparam		T
+					The data type.
+	 */
+	template< typename T >
+	class InstanceBuffer {
+
+	public:
+
+		/**
+		 Constructs an instance buffer.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		capacity
+						The initial capacity.
+		 @throws		Exception
+						Failed to setup this instance buffer.
+		 */
+		explicit InstanceBuffer(ID3D11Device& device, std::size_t capacity);
+
+		/**
+		 Constructs an instance buffer from the given instance buffer.
+
+		 @param[in]		buffer
+						A reference to the instance buffer to copy.
+		 */
+		InstanceBuffer(const InstanceBuffer& buffer) = delete;
+
+		/**
+		 Constructs an instance buffer by moving the given instance buffer.
+
+		 @param[in]		buffer
+						A reference to the instance buffer to move.
+		 */
+		InstanceBuffer(InstanceBuffer&& buffer) noexcept = default;
+
+		/**
+		 Destructs this instance buffer.
+		 */
+		~InstanceBuffer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given instance buffer to this instance buffer.
+
+		 @param[in]		buffer
+						A reference to the instance buffer to copy.
+		 @return		A reference to the copy of the given instance buffer
+						(i.e. this instance buffer).
+		 */
+		InstanceBuffer& operator=(const InstanceBuffer& buffer) = delete;
+
+		/**
+		 Moves the given instance buffer to this instance buffer.
+
+		 @param[in]		buffer
+						A reference to the instance buffer to move.
+		 @return		A reference to the moved instance buffer (i.e. this
+						instance buffer).
+		 */
+		InstanceBuffer& operator=(InstanceBuffer&& buffer) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the size of this instance buffer.
+
+		 @return		The size of this instance buffer.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept {
+			return m_size;
+		}
+
+		/**
+		 Returns the capacity of this instance buffer.
+
+		 @return		The capacity of this instance buffer.
+		 */
+		[[nodiscard]]
+		std::size_t capacity() const noexcept {
+			return m_capacity;
+		}
+
+		/**
+		 Updates the data of this instance buffer with the given data.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		data
+						A reference to a vector containing the data elements.
+	     @throws		Exception
+						Failed to update the data.
+		 */
+		void UpdateData(ID3D11DeviceContext& device_context,
+						const AlignedVector< T >& data);
+
+		/**
+		 Binds this instance buffer.
+
+		 @pre			@a slot <
+						@c D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT.
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		slot
+						The index into the device's zero-based array to set
+						the vertex buffer to (ranges from 0 to
+						@c D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT - 1).
+		 */
+		void Bind(ID3D11DeviceContext& device_context, U32 slot) const noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Sets up the resource buffer of this instance buffer.
+
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		capacity
+						The capacity.
+		 @throws		Exception
+						Failed to setup this instance buffer.
+		 */
+		void SetupInstanceBuffer(ID3D11Device& device, std::size_t capacity);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the buffer resource of this instance buffer.
+		 */
+		ComPtr< ID3D11Buffer > m_buffer;
+
+		/**
+		 The number of available slots for storing data elements in the current
+		 buffer resource of this instance buffer (i.e. the capacity).
+		 */
+		std::size_t m_capacity;
+
+		/**
+		 The number of used slots for storing data elements in the current buffer
+		 resource of this instance buffer (i.e. the size).
+		 */
+		std::size_t m_size;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\buffer\instance_buffer.tpp"
+
+#pragma endregion
\ No newline at end of file
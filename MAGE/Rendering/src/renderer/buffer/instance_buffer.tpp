@@ -0,0 +1,71 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\factory.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename T >
+	InstanceBuffer< T >
+		::InstanceBuffer(ID3D11Device& device, std::size_t capacity)
+		: m_buffer(),
+		m_capacity(0),
+		m_size(0) {
+
+		SetupInstanceBuffer(device, capacity);
+	}
+
+	template< typename T >
+	void InstanceBuffer< T >
+		::SetupInstanceBuffer(ID3D11Device& device, std::size_t capacity) {
+
+		const HRESULT result = CreateDynamicVertexBuffer< T >(
+			device, NotNull< ID3D11Buffer** >(m_buffer.ReleaseAndGetAddressOf()),
+			capacity);
+		ThrowIfFailed(result, "Instance buffer creation failed: {:08X}.", result);
+
+		m_capacity = capacity;
+	}
+
+	template< typename T >
+	void InstanceBuffer< T >
+		::UpdateData(ID3D11DeviceContext& device_context,
+			         const AlignedVector< T >& data) {
+
+		m_size = data.size();
+
+		if (0u == m_size) {
+			return;
+		}
+		if (m_capacity < m_size) {
+			ComPtr< ID3D11Device > device;
+			device_context.GetDevice(device.ReleaseAndGetAddressOf());
+			// Grow geometrically to avoid recreating the buffer every frame.
+			SetupInstanceBuffer(*device.Get(), std::max(m_size, 2u * m_capacity));
+		}
+
+		// Map the buffer.
+		D3D11_MAPPED_SUBRESOURCE mapped_buffer;
+		BufferLock lock(device_context, *m_buffer.Get(),
+						D3D11_MAP_WRITE_DISCARD, mapped_buffer);
+
+		memcpy(mapped_buffer.pData, data.data(), m_size * sizeof(T));
+	}
+
+	template< typename T >
+	inline void InstanceBuffer< T >
+		::Bind(ID3D11DeviceContext& device_context, U32 slot) const noexcept {
+
+		Pipeline::IA::BindVertexBuffer(device_context, slot, *m_buffer.Get(),
+									   static_cast< U32 >(sizeof(T)));
+	}
+}
\ No newline at end of file
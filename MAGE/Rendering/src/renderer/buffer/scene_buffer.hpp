@@ -533,6 +533,34 @@ namespace mage::rendering {
 
 	static_assert(224u == sizeof(ModelBuffer), "CPU/GPU struct mismatch");
 
+	/**
+	 A struct of model instance buffers.
+	 */
+	struct alignas(16) ModelInstanceBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Variables: Transforms
+		//---------------------------------------------------------------------
+
+		/**
+		 The (column-major packed, row-major matrix) object-to-world matrix of
+		 this model instance buffer.
+		 */
+		XMMATRIX m_object_to_world = {};
+
+		/**
+		 The (column-major packed, row-major matrix) object-to-world inverse
+		 transpose matrix (normal-to-world matrix) of this model instance
+		 buffer.
+		 */
+		XMMATRIX m_normal_to_world = {};
+	};
+
+	static_assert(128u == sizeof(ModelInstanceBuffer),
+				  "CPU/GPU struct mismatch");
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
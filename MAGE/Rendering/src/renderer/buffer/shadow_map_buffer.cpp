@@ -9,6 +9,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -26,6 +35,7 @@ namespace mage::rendering {
 		: m_format(format),
 		m_viewport(resolution),
 		m_rasterizer_state(),
+		m_texture(),
 		m_dsvs(),
 		m_srv() {
 
@@ -43,6 +53,31 @@ namespace mage::rendering {
 	ShadowMapBuffer& ShadowMapBuffer
 		::operator=(ShadowMapBuffer&& buffer) noexcept = default;
 
+	void ShadowMapBuffer::Reserve(ID3D11DeviceContext& device_context,
+		                          std::size_t nb_shadow_maps) {
+
+		const auto nb_available = GetNumberOfShadowMaps();
+		if (nb_shadow_maps <= nb_available) {
+			return;
+		}
+
+		ComPtr< ID3D11Device > device;
+		device_context.GetDevice(device.ReleaseAndGetAddressOf());
+
+		// Setup a larger resource, DSVs and SRV.
+		const auto texture = m_texture;
+		SetupShadowMapBuffer(*device.Get(), std::max(nb_shadow_maps, 2u * nb_available));
+
+		// Copy the existing shadow maps.
+		for (U32 i = 0u; i < static_cast< U32 >(nb_available); ++i) {
+			const auto subresource = D3D11CalcSubresource(0u, i, 1u);
+			device_context.CopySubresourceRegion(m_texture.Get(), subresource,
+												 0u, 0u, 0u,
+												 texture.Get(), subresource,
+												 nullptr);
+		}
+	}
+
 	void ShadowMapBuffer::SetupRasterizerState(ID3D11Device& device) {
 		const HRESULT result = CreateCullCounterClockwiseRasterizerState(
 			                       device,
@@ -103,12 +138,10 @@ namespace mage::rendering {
 		// CPU: no read + no write
 		texture_desc.Usage            = D3D11_USAGE_DEFAULT;
 
-		ComPtr< ID3D11Texture2D > texture;
-
 		// Create the texture.
 		{
 			const HRESULT result = device.CreateTexture2D(
-				&texture_desc, nullptr, texture.ReleaseAndGetAddressOf());
+				&texture_desc, nullptr, m_texture.ReleaseAndGetAddressOf());
 			ThrowIfFailed(result, "Texture 2D creation failed: {:08X}.", result);
 		}
 
@@ -128,7 +161,7 @@ namespace mage::rendering {
 				dsv_desc.Texture2DArray.FirstArraySlice = i;
 
 				const HRESULT result = device.CreateDepthStencilView(
-					texture.Get(), &dsv_desc, m_dsvs[i].ReleaseAndGetAddressOf());
+					m_texture.Get(), &dsv_desc, m_dsvs[i].ReleaseAndGetAddressOf());
 				ThrowIfFailed(result, "DSV creation failed: {:08X}.", result);
 			}
 		}
@@ -144,7 +177,7 @@ namespace mage::rendering {
 
 			// Create the SRV for all texture elements.
 			const HRESULT result = device.CreateShaderResourceView(
-				texture.Get(), &srv_desc, m_srv.ReleaseAndGetAddressOf());
+				m_texture.Get(), &srv_desc, m_srv.ReleaseAndGetAddressOf());
 			ThrowIfFailed(result, "SRV creation failed: {:08X}.", result);
 		}
 	}
@@ -163,6 +196,7 @@ namespace mage::rendering {
 		: m_format(format),
 		m_viewport(resolution),
 		m_rasterizer_state(),
+		m_texture(),
 		m_dsvs(),
 		m_srv() {
 
@@ -180,6 +214,31 @@ namespace mage::rendering {
 	ShadowCubeMapBuffer& ShadowCubeMapBuffer
 		::operator=(ShadowCubeMapBuffer&& buffer) noexcept = default;
 
+	void ShadowCubeMapBuffer::Reserve(ID3D11DeviceContext& device_context,
+		                              std::size_t nb_shadow_cube_maps) {
+
+		const auto nb_available = GetNumberOfShadowCubeMaps();
+		if (nb_shadow_cube_maps <= nb_available) {
+			return;
+		}
+
+		ComPtr< ID3D11Device > device;
+		device_context.GetDevice(device.ReleaseAndGetAddressOf());
+
+		// Setup a larger resource, DSVs and SRV.
+		const auto texture = m_texture;
+		SetupShadowCubeMapBuffer(*device.Get(), std::max(nb_shadow_cube_maps, 2u * nb_available));
+
+		// Copy the existing shadow cube maps (six faces each).
+		for (U32 i = 0u; i < 6u * static_cast< U32 >(nb_available); ++i) {
+			const auto subresource = D3D11CalcSubresource(0u, i, 1u);
+			device_context.CopySubresourceRegion(m_texture.Get(), subresource,
+												 0u, 0u, 0u,
+												 texture.Get(), subresource,
+												 nullptr);
+		}
+	}
+
 	void ShadowCubeMapBuffer::SetupRasterizerState(ID3D11Device& device) {
 		const HRESULT result = CreateCullCounterClockwiseRasterizerState(
 			                       device,
@@ -240,12 +299,10 @@ namespace mage::rendering {
 		// CPU: no read + no write
 		texture_desc.Usage            = D3D11_USAGE_DEFAULT;
 
-		ComPtr< ID3D11Texture2D > texture;
-
 		// Create the texture.
 		{
 			const HRESULT result = device.CreateTexture2D(
-				&texture_desc, nullptr, texture.ReleaseAndGetAddressOf());
+				&texture_desc, nullptr, m_texture.ReleaseAndGetAddressOf());
 			ThrowIfFailed(result, "Texture 2D creation failed: {:08X}.", result);
 		}
 
@@ -265,7 +322,7 @@ namespace mage::rendering {
 				dsv_desc.Texture2DArray.FirstArraySlice = i;
 
 				const HRESULT result = device.CreateDepthStencilView(
-					texture.Get(), &dsv_desc, m_dsvs[i].ReleaseAndGetAddressOf());
+					m_texture.Get(), &dsv_desc, m_dsvs[i].ReleaseAndGetAddressOf());
 				ThrowIfFailed(result, "DSV creation failed: {:08X}.", result);
 			}
 		}
@@ -281,7 +338,7 @@ namespace mage::rendering {
 
 			// Create the SRV for all texture elements.
 			const HRESULT result = device.CreateShaderResourceView(
-				texture.Get(), &srv_desc, m_srv.ReleaseAndGetAddressOf());
+				m_texture.Get(), &srv_desc, m_srv.ReleaseAndGetAddressOf());
 			ThrowIfFailed(result, "SRV creation failed: {:08X}.", result);
 		}
 	}
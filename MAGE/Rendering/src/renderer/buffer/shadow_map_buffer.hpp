@@ -82,6 +82,23 @@ namespace mage::rendering {
 			return size(m_dsvs);
 		}
 
+		/**
+		 Ensures this shadow map buffer contains at least the given number of
+		 shadow maps.
+
+		 The capacity grows geometrically and the content of the existing
+		 shadow maps is preserved.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		nb_shadow_maps
+						The number of shadow maps.
+		 @throws		Exception
+						Failed to setup the shadow map buffer.
+		 */
+		void Reserve(ID3D11DeviceContext& device_context,
+					 std::size_t nb_shadow_maps);
+
 		void Bind(ID3D11DeviceContext& device_context) const noexcept {
 			m_viewport.Bind(device_context);
 		}
@@ -94,6 +111,11 @@ namespace mage::rendering {
 				Pipeline::OM::ClearDepthOfDSV(device_context, dsv.Get());
 			}
 		}
+
+		void ClearDSV(ID3D11DeviceContext& device_context,
+					  std::size_t dsv_index) const noexcept {
+			Pipeline::OM::ClearDepthOfDSV(device_context, m_dsvs[dsv_index].Get());
+		}
 		void BindDSV(ID3D11DeviceContext& device_context,
 					 std::size_t dsv_index) const noexcept {
 
@@ -132,6 +154,7 @@ namespace mage::rendering {
 		Viewport m_viewport;
 		ComPtr< ID3D11RasterizerState > m_rasterizer_state;
 
+		ComPtr< ID3D11Texture2D > m_texture;
 		std::vector< ComPtr< ID3D11DepthStencilView > > m_dsvs;
 		ComPtr< ID3D11ShaderResourceView > m_srv;
 	};
@@ -181,6 +204,23 @@ namespace mage::rendering {
 			return size(m_dsvs) / 6u;
 		}
 
+		/**
+		 Ensures this shadow cube map buffer contains at least the given
+		 number of shadow cube maps.
+
+		 The capacity grows geometrically and the content of the existing
+		 shadow cube maps is preserved.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		nb_shadow_cube_maps
+						The number of shadow cube maps.
+		 @throws		Exception
+						Failed to setup the shadow cube map buffer.
+		 */
+		void Reserve(ID3D11DeviceContext& device_context,
+					 std::size_t nb_shadow_cube_maps);
+
 		void Bind(ID3D11DeviceContext& device_context) const noexcept {
 			m_viewport.Bind(device_context);
 		}
@@ -193,6 +233,11 @@ namespace mage::rendering {
 				Pipeline::OM::ClearDepthOfDSV(device_context, dsv.Get());
 			}
 		}
+
+		void ClearDSV(ID3D11DeviceContext& device_context,
+					  std::size_t dsv_index) const noexcept {
+			Pipeline::OM::ClearDepthOfDSV(device_context, m_dsvs[dsv_index].Get());
+		}
 		void BindDSV(ID3D11DeviceContext& device_context,
 					 std::size_t dsv_index) const noexcept {
 
@@ -231,6 +276,7 @@ namespace mage::rendering {
 		Viewport m_viewport;
 		ComPtr< ID3D11RasterizerState > m_rasterizer_state;
 
+		ComPtr< ID3D11Texture2D > m_texture;
 		std::vector< ComPtr< ID3D11DepthStencilView > > m_dsvs;
 		ComPtr< ID3D11ShaderResourceView > m_srv;
 	};
@@ -0,0 +1,33 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\instance_groups.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	InstanceGroups::InstanceGroups()
+		: m_groups() {}
+
+	InstanceGroups::InstanceGroups(const InstanceGroups& groups) = default;
+
+	InstanceGroups::InstanceGroups(InstanceGroups&& groups) noexcept = default;
+
+	InstanceGroups::~InstanceGroups() = default;
+
+	InstanceGroups& InstanceGroups
+		::operator=(const InstanceGroups& groups) = default;
+
+	InstanceGroups& InstanceGroups
+		::operator=(InstanceGroups&& groups) noexcept = default;
+
+	void InstanceGroups::Clear() noexcept {
+		m_groups.clear();
+	}
+}
\ No newline at end of file
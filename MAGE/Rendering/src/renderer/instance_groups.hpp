@@ -0,0 +1,176 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <gsl\span>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of instance groups.
+
+	 Instance groups partition a sequence of elements into runs of
+	 consecutive, mutually compatible elements. All elements of a group can be
+	 drawn as instances of a single instanced draw call. Since only
+	 consecutive elements are grouped, the sequence should be sorted such
+	 that compatible elements are adjacent (e.g., on a state key).
+
+	 Instance groups do not depend on any rendering API.
+	 */
+	class InstanceGroups {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of instance groups.
+		 */
+		struct Group {
+
+		public:
+
+			/**
+			 The index of the first element of this group.
+			 */
+			std::size_t m_start = 0u;
+
+			/**
+			 The number of elements (i.e. instances) of this group.
+			 */
+			std::size_t m_nb_instances = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs instance groups.
+		 */
+		InstanceGroups();
+
+		/**
+		 Constructs instance groups from the given instance groups.
+
+		 @param[in]		groups
+						A reference to the instance groups to copy.
+		 */
+		InstanceGroups(const InstanceGroups& groups);
+
+		/**
+		 Constructs instance groups by moving the given instance groups.
+
+		 @param[in]		groups
+						A reference to the instance groups to move.
+		 */
+		InstanceGroups(InstanceGroups&& groups) noexcept;
+
+		/**
+		 Destructs these instance groups.
+		 */
+		~InstanceGroups();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given instance groups to these instance groups.
+
+		 @param[in]		groups
+						A reference to the instance groups to copy.
+		 @return		A reference to the copy of the given instance groups
+						(i.e. these instance groups).
+		 */
+		InstanceGroups& operator=(const InstanceGroups& groups);
+
+		/**
+		 Moves the given instance groups to these instance groups.
+
+		 @param[in]		groups
+						A reference to the instance groups to move.
+		 @return		A reference to the moved instance groups (i.e. these
+						instance groups).
+		 */
+		InstanceGroups& operator=(InstanceGroups&& groups) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds these instance groups for the given elements.
+
+		 An element is added to the current group if it is compatible with
+		 the first element of that group, and starts a new group otherwise.
+
+		 @tparam		ElementT
+						The element type.
+		 @tparam		CompatibleT
+						The binary predicate type.
+		 @param[in]		elements
+						The elements.
+		 @param[in]		compatible
+						The binary predicate checking whether two elements
+						can be drawn as instances of the same draw call.
+		 */
+		template< typename ElementT, typename CompatibleT >
+		void Build(gsl::span< const ElementT > elements,
+				   CompatibleT&& compatible) {
+
+			m_groups.clear();
+
+			const auto nb_elements = static_cast< std::size_t >(elements.size());
+			for (std::size_t i = 0u; i < nb_elements; ++i) {
+				if (!m_groups.empty()) {
+					auto& group = m_groups.back();
+					if (compatible(elements[group.m_start], elements[i])) {
+						++group.m_nb_instances;
+						continue;
+					}
+				}
+
+				m_groups.push_back({ i, 1u });
+			}
+		}
+
+		/**
+		 Returns the groups of these instance groups.
+
+		 @return		A reference to a vector containing the groups of these
+						instance groups.
+		 */
+		[[nodiscard]]
+		const std::vector< Group >& GetGroups() const noexcept {
+			return m_groups;
+		}
+
+		/**
+		 Clears these instance groups.
+		 */
+		void Clear() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The groups of these instance groups.
+		 */
+		std::vector< Group > m_groups;
+	};
+}
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "renderer\pass\aa_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -31,6 +32,7 @@ namespace mage::rendering {
 
 	void AAPass::DispatchPreprocess(const U32x2& viewport_size,
 									AntiAliasing aa) {
+		MAGE_PROFILE_ZONE("AAPass::DispatchPreprocess");
 
 		// CS: Bind the compute shader.
 		switch (aa) {
@@ -56,6 +58,7 @@ namespace mage::rendering {
 
 	void AAPass::Dispatch(const U32x2& viewport_size,
 						  AntiAliasing aa) {
+		MAGE_PROFILE_ZONE("AAPass::Dispatch");
 
 		// CS: Bind the compute shader.
 		switch (aa) {
@@ -5,6 +5,7 @@
 
 #include "renderer\pass\deferred_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -16,13 +17,36 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 Returns the permutation index for the given shader configuration
+		 parameters.
+
+		 @param[in]		brdf
+						The BRDF.
+		 @param[in]		vct
+						@c true if voxel cone tracing should be enabled. @c
+						false otherwise.
+		 @return		The permutation index for the given shader
+						configuration parameters.
+		 */
+		[[nodiscard]]
+		inline std::size_t GetPermutationIndex(BRDF brdf, bool vct) noexcept {
+			return static_cast< std::size_t >(brdf) << 1u
+				 | static_cast< std::size_t >(vct);
+		}
+	}
+
 	DeferredPass::DeferredPass(ID3D11DeviceContext& device_context,
 							   StateManager& state_manager,
 							   ResourceManager& resource_manager)
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
-		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)) {}
+		m_msaa_vs(CreateNearFullscreenTriangleVS(resource_manager)),
+		m_msaa_ps(),
+		m_cs() {}
 
 	DeferredPass::DeferredPass(DeferredPass&& pass) noexcept = default;
 
@@ -54,10 +78,15 @@ namespace mage::rendering {
 	}
 
 	void DeferredPass::Render(BRDF brdf, bool vct) {
+		MAGE_PROFILE_ZONE("DeferredPass::Render");
+
 		// Binds the fixed state.
 		BindFixedState();
 
-		const auto ps = CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+		const auto& ps = m_msaa_ps.Get(GetPermutationIndex(brdf, vct),
+			[this, brdf, vct]() {
+				return CreateDeferredMSAAPS(m_resource_manager, brdf, vct);
+			});
 		// PS: Bind the pixel shader.
 		ps->BindShader(m_device_context);
 
@@ -67,8 +96,12 @@ namespace mage::rendering {
 
 	void DeferredPass::Dispatch(const U32x2& viewport_size,
 								BRDF brdf, bool vct) {
+		MAGE_PROFILE_ZONE("DeferredPass::Dispatch");
 
-		const auto cs = CreateDeferredCS(m_resource_manager, brdf, vct);
+		const auto& cs = m_cs.Get(GetPermutationIndex(brdf, vct),
+			[this, brdf, vct]() {
+				return CreateDeferredCS(m_resource_manager, brdf, vct);
+			});
 		// CS: Bind the compute shader.
 		cs->BindShader(m_device_context);
 
@@ -8,6 +8,7 @@
 #include "renderer\configuration.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\shader\shader_permutations.hpp"
 
 #pragma endregion
 
@@ -121,6 +122,16 @@ namespace mage::rendering {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of BRDFs.
+		 */
+		static constexpr std::size_t s_nb_brdfs
+			= static_cast< std::size_t >(BRDF::Frostbite) + 1u;
+
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
@@ -153,5 +164,16 @@ namespace mage::rendering {
 		 A pointer to the vertex shader of this deferred pass.
 		 */
 		VertexShaderPtr m_msaa_vs;
+
+		/**
+		 The (MSAA) pixel shader permutations (BRDF, VCT) of this deferred
+		 pass.
+		 */
+		ShaderPermutations< PixelShaderPtr, 2u * s_nb_brdfs > m_msaa_ps;
+
+		/**
+		 The compute shader permutations (BRDF, VCT) of this deferred pass.
+		 */
+		ShaderPermutations< ComputeShaderPtr, 2u * s_nb_brdfs > m_cs;
 	};
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "renderer\pass\depth_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -80,61 +81,14 @@ namespace mage::rendering {
 											 SLOT_CBUFFER_SECONDARY_CAMERA);
 	}
 
-	void XM_CALLCONV DepthPass::Render(const World& world,
+	void XM_CALLCONV DepthPass::Render(const RenderQueues& queues,
 									   FXMMATRIX world_to_camera,
 									   CXMMATRIX camera_to_projection) {
-		// Bind the projection data.
-		BindCamera(world_to_camera, camera_to_projection);
-
-		const auto world_to_projection = world_to_camera * camera_to_projection;
-
-		//---------------------------------------------------------------------
-		// All opaque models.
-		//---------------------------------------------------------------------
-
-		// Bind the shaders.
-		BindOpaqueShaders();
-
-		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| model.GetMaterial().IsTransparant()) {
-				return;
-			}
-
-			RenderOpaque(model, world_to_projection);
-		});
-
-		//---------------------------------------------------------------------
-		// All transparent models.
-		//---------------------------------------------------------------------
-
-		// Bind the shaders.
-		BindTransparentShaders();
-
-		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			RenderTransparent(model, world_to_projection);
-		});
-	}
+		MAGE_PROFILE_ZONE("DepthPass::Render");
 
-	void XM_CALLCONV DepthPass::RenderOccluders(const World& world,
-												FXMMATRIX world_to_camera,
-												CXMMATRIX camera_to_projection) {
 		// Bind the projection data.
 		BindCamera(world_to_camera, camera_to_projection);
 
-		const auto world_to_projection = world_to_camera * camera_to_projection;
-
 		//---------------------------------------------------------------------
 		// All opaque models.
 		//---------------------------------------------------------------------
@@ -143,14 +97,11 @@ namespace mage::rendering {
 		BindOpaqueShaders();
 
 		// Process the opaque models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
-				|| model.GetMaterial().IsTransparant()) {
-				return;
-			}
-
-			RenderOpaque(model, world_to_projection);
+		const Model* previous_opaque = nullptr;
+		queues.ForEach(RenderQueue::OpaqueOccluders,
+					   [this, &previous_opaque](const VisibleModel& model) {
+			RenderOpaque(*model.m_model, previous_opaque);
+			previous_opaque = model.m_model;
 		});
 
 		//---------------------------------------------------------------------
@@ -161,61 +112,42 @@ namespace mage::rendering {
 		BindTransparentShaders();
 
 		// Process the transparent models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !model.OccludesLight()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			RenderTransparent(model, world_to_projection);
+		const Model* previous_transparent = nullptr;
+		queues.ForEach(RenderQueue::TransparentOccluders,
+					   [this, &previous_transparent](const VisibleModel& model) {
+			RenderTransparent(*model.m_model, previous_transparent);
+			previous_transparent = model.m_model;
 		});
 	}
 
-	void XM_CALLCONV DepthPass::RenderOpaque(const Model& model,
-											 FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
-
+	void DepthPass::RenderOpaque(const Model& model,
+								 const Model* previous) const noexcept {
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
-		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
+		// Bind the mesh of the model (if not bound yet).
+		if (nullptr == previous || model.GetMesh() != previous->GetMesh()) {
+			model.BindMesh(m_device_context);
+		}
 		// Draw the model.
 		model.Draw(m_device_context);
 	}
 
-	void XM_CALLCONV DepthPass::RenderTransparent(const Model& model,
-												  FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
-
+	void DepthPass::RenderTransparent(const Model& model,
+									  const Model* previous) const noexcept {
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
-		// Bind the SRV of the model.
-		Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_BASE_COLOR,
-							  model.GetMaterial().GetBaseColorSRV());
-		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
+		// Bind the SRV of the model (if not bound yet).
+		const auto srv = model.GetMaterial().GetBaseColorSRV();
+		if (nullptr == previous
+			|| srv != previous->GetMaterial().GetBaseColorSRV()) {
+
+			Pipeline::PS::BindSRV(m_device_context, SLOT_SRV_BASE_COLOR, srv);
+		}
+		// Bind the mesh of the model (if not bound yet).
+		if (nullptr == previous || model.GetMesh() != previous->GetMesh()) {
+			model.BindMesh(m_device_context);
+		}
 		// Draw the model.
 		model.Draw(m_device_context);
 	}
@@ -7,7 +7,7 @@
 
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer\render_queues.hpp"
 
 #pragma endregion
 
@@ -102,10 +102,10 @@ namespace mage::rendering {
 		void BindFixedState() const noexcept;
 
 		/**
-		 Renders the world.
+		 Renders the given render queues.
 
-		 @param[in]		world
-						A reference to the world.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @param[in]		world_to_camera
 						The world-to-camera transformation matrix.
 		 @param[in]		camera_to_projection
@@ -113,26 +113,10 @@ namespace mage::rendering {
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
+		void XM_CALLCONV Render(const RenderQueues& queues,
 								FXMMATRIX world_to_camera,
 								CXMMATRIX camera_to_projection);
 
-		/**
-		 Renders the occluders of the world.
-
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_camera
-						The world-to-camera transformation matrix.
-		 @param[in]		camera_to_projection
-						The camera-to-projection transformation matrix.
-		 @throws		Exception
-						Failed to render the world.
-		 */
-		void XM_CALLCONV RenderOccluders(const World& world,
-										 FXMMATRIX world_to_camera,
-										 CXMMATRIX camera_to_projection);
-
 	private:
 
 		//---------------------------------------------------------------------
@@ -163,26 +147,30 @@ namespace mage::rendering {
 									CXMMATRIX camera_to_projection);
 
 		/**
-		 Renders the given opaque model.
+		 Renders the given opaque model. The state of the given model is only
+		 bound if it differs from that of the given previous model.
 
 		 @param[in]		model
 						A reference to the opaque model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		previous
+						A pointer to the previously rendered opaque model. If
+						@c nullptr, all state of the given model is bound.
 		 */
-		void XM_CALLCONV RenderOpaque(const Model& model,
-									  FXMMATRIX world_to_projection) const noexcept;
+		void RenderOpaque(const Model& model,
+						  const Model* previous) const noexcept;
 
 		/**
-		 Renders the given transparent model.
+		 Renders the given transparent model. The state of the given model is only
+		 bound if it differs from that of the given previous model.
 
 		 @param[in]		model
 						A reference to the transparent model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		previous
+						A pointer to the previously rendered transparent model. If
+						@c nullptr, all state of the given model is bound.
 		 */
-		void XM_CALLCONV RenderTransparent(const Model& model,
-										   FXMMATRIX world_to_projection) const noexcept;
+		void RenderTransparent(const Model& model,
+							   const Model* previous) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -6,6 +6,7 @@
 #include "renderer\pass\forward_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
 #include "resource\texture\texture_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -24,7 +25,16 @@ namespace mage::rendering {
 		: m_device_context(device_context),
 		m_state_manager(state_manager),
 		m_resource_manager(resource_manager),
-		m_vs(CreateTransformVS(resource_manager)),
+		m_vs(CreateTransformInstancedVS(resource_manager)),
+		m_solid_ps(CreateForwardSolidPS(resource_manager)),
+		m_emissive_ps(),
+		m_ps(),
+		m_gbuffer_ps(),
+		m_false_color_ps(),
+		m_models(),
+		m_groups(),
+		m_instances(),
+		m_instance_buffer(device, 64u),
 		m_uv(CreateReferenceTexture(resource_manager)),
 		m_color_buffer(device) {}
 
@@ -34,6 +44,44 @@ namespace mage::rendering {
 
 	ForwardPass& ForwardPass::operator=(ForwardPass&& pass) noexcept = default;
 
+	const PixelShaderPtr& ForwardPass::GetEmissivePS(bool transparency) {
+		return m_emissive_ps.Get(static_cast< std::size_t >(transparency),
+			[this, transparency]() {
+				return CreateForwardEmissivePS(m_resource_manager,
+											   transparency);
+			});
+	}
+
+	const PixelShaderPtr& ForwardPass::GetPS(BRDF brdf,
+											 bool transparency,
+											 bool vct,
+											 bool tsnm) {
+
+		const auto index = static_cast< std::size_t >(brdf)         << 3u
+			             | static_cast< std::size_t >(transparency) << 2u
+			             | static_cast< std::size_t >(vct)          << 1u
+			             | static_cast< std::size_t >(tsnm);
+
+		return m_ps.Get(index, [this, brdf, transparency, vct, tsnm]() {
+			return CreateForwardPS(m_resource_manager,
+								   brdf, transparency, vct, tsnm);
+		});
+	}
+
+	const PixelShaderPtr& ForwardPass::GetGBufferPS(bool tsnm) {
+		return m_gbuffer_ps.Get(static_cast< std::size_t >(tsnm),
+			[this, tsnm]() {
+				return CreateGBufferPS(m_resource_manager, tsnm);
+			});
+	}
+
+	const PixelShaderPtr& ForwardPass::GetFalseColorPS(FalseColor false_color) {
+		return m_false_color_ps.Get(static_cast< std::size_t >(false_color),
+			[this, false_color]() {
+				return CreateFalseColorPS(m_resource_manager, false_color);
+			});
+	}
+
 	void ForwardPass::BindFixedOpaqueState() const noexcept {
 		// VS: Bind the vertex shader.
 		m_vs->BindShader(m_device_context);
@@ -116,9 +164,10 @@ namespace mage::rendering {
 		m_color_buffer.Bind< Pipeline::PS >(m_device_context, SLOT_CBUFFER_COLOR);
 	}
 
-	void XM_CALLCONV ForwardPass::Render(const World& world,
-										 FXMMATRIX world_to_projection,
-										 BRDF brdf, bool vct) const {
+	void ForwardPass::Render(const RenderQueues& queues,
+							 BRDF brdf, bool vct) {
+		MAGE_PROFILE_ZONE("ForwardPass::Render");
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -128,81 +177,44 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
+			const auto& ps = GetEmissivePS(transparency);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::Emissive);
 
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::Opaque);
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::OpaqueTSNM);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderSolid(const World& world,
-											  FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderSolid(const RenderQueues& queues) {
+		MAGE_PROFILE_ZONE("ForwardPass::RenderSolid");
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -210,23 +222,17 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardSolidPS(m_resource_manager);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			m_solid_ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::All);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderGBuffer(const World& world,
-												FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderGBuffer(const RenderQueues& queues) {
+		MAGE_PROFILE_ZONE("ForwardPass::RenderGBuffer");
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -235,54 +241,29 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const auto& ps = GetGBufferPS(tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::Opaque);
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateGBufferPS(m_resource_manager, tsnm);
+			const auto& ps = GetGBufferPS(tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::OpaqueTSNM);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderEmissive(const World& world,
-												 FXMMATRIX world_to_projection) const {
+	void ForwardPass::RenderEmissive(const RenderQueues& queues) {
 		constexpr bool transparency = false;
 
 		// Bind the fixed opaque state.
@@ -292,31 +273,18 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
+			const auto& ps = GetEmissivePS(transparency);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::Emissive);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderTransparent(const World& world,
-													FXMMATRIX world_to_projection,
-													BRDF brdf,
-													bool vct) const {
+	void ForwardPass::RenderTransparent(const RenderQueues& queues,
+										BRDF brdf,
+										bool vct) {
 		// Bind the fixed transparent state.
 		BindFixedTransparentState();
 
@@ -326,85 +294,45 @@ namespace mage::rendering {
 		// All transparent emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateForwardEmissivePS(m_resource_manager,
-															  transparency);
+			const auto& ps = GetEmissivePS(transparency);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::TransparentEmissive);
 
 		//---------------------------------------------------------------------
 		// All transparent models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::Transparent);
 
 		//---------------------------------------------------------------------
 		// All transparent models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateForwardPS(m_resource_manager,
-													  brdf, transparency, vct, tsnm);
+			const auto& ps = GetPS(brdf, transparency, vct, tsnm);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| !material.IsTransparant()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_SHADOW_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::TransparentTSNM);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderFalseColor(const World& world,
-												   FXMMATRIX world_to_projection,
-												   FalseColor false_color) const {
+	void ForwardPass::RenderFalseColor(const RenderQueues& queues,
+									   FalseColor false_color) {
+		MAGE_PROFILE_ZONE("ForwardPass::RenderFalseColor");
+
 		// Bind the fixed opaque state.
 		BindFixedOpaqueState();
 
@@ -416,24 +344,18 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateFalseColorPS(m_resource_manager,
-														 false_color);
+			const auto& ps = GetFalseColorPS(false_color);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::All);
 	}
 
-	void XM_CALLCONV ForwardPass::RenderWireframe(const World& world,
-												  FXMMATRIX world_to_projection) {
+	void ForwardPass::RenderWireframe(const RenderQueues& queues) {
+		MAGE_PROFILE_ZONE("ForwardPass::RenderWireframe");
+
 		// Bind the fixed opaque state.
 		BindFixedWireframeState();
 
@@ -445,52 +367,82 @@ namespace mage::rendering {
 		// All models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateFalseColorPS(m_resource_manager,
-														 FalseColor::ConstantColor);
+			const auto& ps = GetFalseColorPS(FalseColor::ConstantColor);
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-			if (State::Active != model.GetState()) {
-				return;
-			}
+		RenderModels(queues, RenderQueue::All);
+	}
 
-			Render(model, world_to_projection);
+	void ForwardPass::RenderModels(const RenderQueues& queues,
+								   RenderQueue queue) {
+		// Collect the (sorted) models of the render queue.
+		m_models.clear();
+		queues.ForEach(queue, [this](const VisibleModel& model) {
+			m_models.push_back(model.m_model);
 		});
-	}
 
-	void XM_CALLCONV ForwardPass::Render(const Model& model,
-										 FXMMATRIX world_to_projection) const noexcept {
+		if (m_models.empty()) {
+			return;
+		}
 
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
+		// Group the consecutive models that can be drawn as instances of the
+		// same draw call.
+		m_groups.Build(gsl::span< const Model* const >(m_models),
+					   [](const Model* first, const Model* model) noexcept {
+			return model->CanInstance(*first);
+		});
 
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
+		// Update and bind the instance buffer.
+		m_instances.clear();
+		m_instances.reserve(m_models.size());
+		for (const auto model : m_models) {
+			m_instances.push_back(model->GetInstanceBuffer());
 		}
+		m_instance_buffer.UpdateData(m_device_context, m_instances);
+		// IA: Bind the instance buffer (input slot 1).
+		m_instance_buffer.Bind(m_device_context, 1u);
+
+		const Model* previous = nullptr;
+		for (const auto& group : m_groups.GetGroups()) {
+			const auto model = m_models[group.m_start];
+			Render(*model, previous, group.m_nb_instances, group.m_start);
+			previous = model;
+		}
+	}
 
-		const auto& material             = model.GetMaterial();
+	void ForwardPass::Render(const Model& model,
+							 const Model* previous,
+							 std::size_t nb_instances,
+							 std::size_t instance_start) const noexcept {
+		const auto& material = model.GetMaterial();
 
-		// Bind the constant buffer of the model.
+		// Bind the constant buffer of the model. The instances of the model
+		// only differ in their transforms, which are read from the instance
+		// buffer.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
-		// Bind the SRVs of the model.
-		static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
-		static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
-		ID3D11ShaderResourceView* const srvs[] = {
-			material.GetBaseColorSRV(),
-			material.GetMaterialSRV(),
-			material.GetNormalSRV()
-		};
-		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR,
-							   static_cast< U32 >(std::size(srvs)), srvs);
-		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
-		// Draw the model.
-		model.Draw(m_device_context);
+		// Bind the SRVs of the model (if not bound yet).
+		if (nullptr == previous
+			|| !material.HasSameSRVs(previous->GetMaterial())) {
+
+			static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
+			static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
+			ID3D11ShaderResourceView* const srvs[] = {
+				material.GetBaseColorSRV(),
+				material.GetMaterialSRV(),
+				material.GetNormalSRV()
+			};
+			Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR,
+								   static_cast< U32 >(std::size(srvs)), srvs);
+		}
+		// Bind the mesh of the model (if not bound yet).
+		if (nullptr == previous || model.GetMesh() != previous->GetMesh()) {
+			model.BindMesh(m_device_context);
+		}
+		// Draw the instances of the model.
+		model.DrawInstanced(m_device_context, nb_instances, instance_start);
 	}
 }
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include "renderer\configuration.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer\render_queues.hpp"
+#include "renderer\instance_groups.hpp"
+#include "renderer\buffer\instance_buffer.hpp"
+#include "resource\shader\shader_permutations.hpp"
 
 #pragma endregion
 
@@ -97,12 +100,10 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the given world.
+		 Renders the given render queues.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
@@ -111,56 +112,43 @@ namespace mage::rendering {
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
-								FXMMATRIX world_to_projection,
-								BRDF brdf, bool vct) const;
+		void Render(const RenderQueues& queues, BRDF brdf, bool vct);
 
 		/**
-		 Renders the given world as solid.
+		 Renders the given render queues as solid.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderSolid(const World& world,
-									 FXMMATRIX world_to_projection) const;
+		void RenderSolid(const RenderQueues& queues);
 
 		/**
-		 Renders the given world to a GBuffer.
+		 Renders the given render queues to a GBuffer.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderGBuffer(const World& world,
-									   FXMMATRIX world_to_projection) const;
+		void RenderGBuffer(const RenderQueues& queues);
 
 		/**
-		 Renders the emissive models of the given world.
+		 Renders the emissive models of the given render queues.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderEmissive(const World& world,
-										FXMMATRIX world_to_projection) const;
+		void RenderEmissive(const RenderQueues& queues);
 
 		/**
-		 Renders the transparent models of the given world.
+		 Renders the transparent models of the given render queues.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @param[in]		brdf
 						The BRDF.
 		 @param[in]		vct
@@ -169,45 +157,116 @@ namespace mage::rendering {
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderTransparent(const World& world,
-										   FXMMATRIX world_to_projection,
-										   BRDF brdf, bool vct) const;
+		void RenderTransparent(const RenderQueues& queues,
+							   BRDF brdf, bool vct);
 
 		/**
-		 Renders the given world as a false color.
+		 Renders the given render queues as a false color.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @param[in]		false_color
 						The false color.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color) const;
+		void RenderFalseColor(const RenderQueues& queues,
+							  FalseColor false_color);
 
 		/**
-		 Renders the given world as a wireframe.
+		 Renders the given render queues as a wireframe.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV RenderWireframe(const World& world,
-										 FXMMATRIX world_to_projection);
+		void RenderWireframe(const RenderQueues& queues);
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of BRDFs.
+		 */
+		static constexpr std::size_t s_nb_brdfs
+			= static_cast< std::size_t >(BRDF::Frostbite) + 1u;
+
+		/**
+		 The number of false colors.
+		 */
+		static constexpr std::size_t s_nb_false_colors
+			= static_cast< std::size_t >(FalseColor::UV) + 1u;
+
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Returns the emissive pixel shader of this forward pass for the given
+		 configuration.
+
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @return		A reference to the emissive pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		const PixelShaderPtr& GetEmissivePS(bool transparency);
+
+		/**
+		 Returns the pixel shader of this forward pass for the given
+		 configuration.
+
+		 @param[in]		brdf
+						The BRDF.
+		 @param[in]		transparency
+						@c true if transparency should be enabled. @c false
+						otherwise.
+		 @param[in]		vct
+						@c true if voxel cone tracing should be enabled. @c
+						false otherwise.
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		const PixelShaderPtr& GetPS(BRDF brdf,
+									bool transparency,
+									bool vct,
+									bool tsnm);
+
+		/**
+		 Returns the GBuffer pixel shader of this forward pass for the given
+		 configuration.
+
+		 @param[in]		tsnm
+						@c true if tangent space normal mapping should be
+						enabled. @c false otherwise.
+		 @return		A reference to the GBuffer pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		const PixelShaderPtr& GetGBufferPS(bool tsnm);
+
+		/**
+		 Returns the false color pixel shader of this forward pass for the
+		 given false color.
+
+		 @param[in]		false_color
+						The false color.
+		 @return		A reference to the false color pixel shader.
+		 @throws		Exception
+						Failed to create the pixel shader.
+		 */
+		const PixelShaderPtr& GetFalseColorPS(FalseColor false_color);
+
 		/**
 		 Binds the fixed opaque state of this forward pass.
 		 */
@@ -234,15 +293,39 @@ namespace mage::rendering {
 		void BindColor(const RGBA& color);
 
 		/**
-		 Renders the given model.
+		 Renders the models of the given render queue. Consecutive models
+		 that can be drawn as instances of the same draw call are drawn with
+		 a single instanced draw call.
+
+		 @param[in]		queues
+						A reference to the render queues.
+		 @param[in]		queue
+						The render queue.
+		 @throws		Exception
+						Failed to update the instance buffer.
+		 */
+		void RenderModels(const RenderQueues& queues, RenderQueue queue);
+
+		/**
+		 Renders instances of the given model. The shader resource views and
+		 mesh of the given model are only bound if they differ from those of
+		 the given previous model.
 
 		 @param[in]		model
 						A reference to the model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		previous
+						A pointer to the previously rendered model. If
+						@c nullptr, all state of the given model is bound.
+		 @param[in]		nb_instances
+						The number of instances.
+		 @param[in]		instance_start
+						The index of the first instance in the instance
+						buffer.
 		 */
-		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+		void Render(const Model& model,
+					const Model* previous,
+					std::size_t nb_instances,
+					std::size_t instance_start) const noexcept;
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -264,10 +347,60 @@ namespace mage::rendering {
 		std::reference_wrapper< ResourceManager > m_resource_manager;
 
 		/**
-		 A pointer to the vertex shader of this forward pass.
+		 A pointer to the (instanced) vertex shader of this forward pass.
 		 */
 		VertexShaderPtr m_vs;
 
+		/**
+		 A pointer to the solid pixel shader of this forward pass.
+		 */
+		PixelShaderPtr m_solid_ps;
+
+		/**
+		 The emissive pixel shader permutations (transparency) of this forward
+		 pass.
+		 */
+		ShaderPermutations< PixelShaderPtr, 2u > m_emissive_ps;
+
+		/**
+		 The pixel shader permutations (BRDF, transparency, VCT, TSNM) of
+		 this forward pass.
+		 */
+		ShaderPermutations< PixelShaderPtr, 8u * s_nb_brdfs > m_ps;
+
+		/**
+		 The GBuffer pixel shader permutations (TSNM) of this forward pass.
+		 */
+		ShaderPermutations< PixelShaderPtr, 2u > m_gbuffer_ps;
+
+		/**
+		 The false color pixel shader permutations of this forward pass.
+		 */
+		ShaderPermutations< PixelShaderPtr, s_nb_false_colors > m_false_color_ps;
+
+		/**
+		 A vector containing pointers to the models of the render queue
+		 currently rendered by this forward pass.
+		 */
+		std::vector< const Model* > m_models;
+
+		/**
+		 The instance groups of the models of the render queue currently
+		 rendered by this forward pass.
+		 */
+		InstanceGroups m_groups;
+
+		/**
+		 A vector containing the per-instance data of the models of the render
+		 queue currently rendered by this forward pass.
+		 */
+		AlignedVector< ModelInstanceBuffer > m_instances;
+
+		/**
+		 The instance buffer of this forward pass.
+		 */
+		InstanceBuffer< ModelInstanceBuffer > m_instance_buffer;
+
 		/**
 		 A pointer to the UV reference texture of this forward pass.
 		 */
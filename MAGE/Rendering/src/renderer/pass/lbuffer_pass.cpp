@@ -4,12 +4,22 @@
 #pragma region
 
 #include "renderer\pass\lbuffer_pass.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -33,6 +43,17 @@ namespace mage::rendering {
 		m_directional_light_cameras(),
 		m_omni_light_cameras(),
 		m_spot_light_cameras(),
+		m_light_aabbs(),
+		m_visible_lights(),
+		m_directional_light_casters(),
+		m_omni_light_casters(),
+		m_spot_light_casters(),
+		m_casters(),
+		m_caster_aabbs(),
+		m_visible_casters(),
+		m_directional_sm_cache(),
+		m_omni_sm_cache(6u),
+		m_spot_sm_cache(),
 		m_depth_pass(MakeUnique< DepthPass >(device,
 											 device_context,
 											 state_manager,
@@ -46,19 +67,23 @@ namespace mage::rendering {
 
 	void XM_CALLCONV LBufferPass
 		::Render(const World& world,
+				 const WorldBVH& world_bvh,
 				 FXMMATRIX world_to_projection) {
+		MAGE_PROFILE_ZONE("LBufferPass::Render");
 
-		// Process the lights.
-		ProcessDirectionalLights(world, world_to_projection);
-		ProcessOmniLights(world, world_to_projection);
-		ProcessSpotLights(world, world_to_projection);
+		const auto& models = world_bvh.GetModels();
+
+		// Process the lights (and cull their shadow casters).
+		ProcessDirectionalLights(world, models, world_to_projection);
+		ProcessOmniLights(world_bvh.GetOmniLights(), models, world_to_projection);
+		ProcessSpotLights(world_bvh.GetSpotLights(), models, world_to_projection);
 
 		// Unbind the shadow map SRVs.
 		UnbindShadowMaps();
 		// Setup the shadow maps.
 		SetupShadowMaps();
 		// Render the shadow maps.
-		RenderShadowMaps(world);
+		RenderShadowMaps();
 
 		// Process the lights' data.
 		ProcessLightsData(world);
@@ -144,6 +169,7 @@ namespace mage::rendering {
 
 	void XM_CALLCONV LBufferPass
 		::ProcessDirectionalLights(const World& world,
+								   const ComponentBVH< Model >& models,
 								   FXMMATRIX world_to_projection) {
 
 		AlignedVector< DirectionalLightBuffer > lights;
@@ -153,24 +179,31 @@ namespace mage::rendering {
 		sm_lights.reserve(m_sm_directional_lights.size());
 		m_directional_light_cameras.clear();
 
-		// Process the directional lights.
-		world.ForEach< DirectionalLight >([this, &lights, &sm_lights, world_to_projection]
-		(const DirectionalLight& light) {
+		// Collect the active directional lights.
+		std::vector< const DirectionalLight* > candidates;
+		m_light_aabbs.clear();
 
+		world.ForEach< DirectionalLight >([this, &candidates](const DirectionalLight& light) {
 			if (State::Active != light.GetState()) {
 				return;
 			}
 
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
+			const auto& transform      = light.GetOwner()->GetTransform();
+			const auto  light_to_world = transform.GetObjectToWorldMatrix();
 
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
-				return;
-			}
+			candidates.push_back(&light);
+			m_light_aabbs.push_back(light.GetAABB(), light_to_world);
+		});
 
-			const auto  neg_d               = -transform.GetWorldAxisZ();
+		// Cull the directional lights against the view frustum.
+		const BoundingFrustum frustum(world_to_projection);
+		m_light_aabbs.Cull(frustum, m_visible_lights);
+
+		// Process the visible directional lights.
+		const auto create_buffer = [](const DirectionalLight& light) {
+			const auto& transform = light.GetOwner()->GetTransform();
+
+			const auto neg_d                = -transform.GetWorldAxisZ();
 			const auto world_to_light       = transform.GetWorldToObjectMatrix();
 			const auto light_to_lprojection = light.GetLightToProjectionMatrix();
 			const auto world_to_lprojection = world_to_light * light_to_lprojection;
@@ -180,24 +213,46 @@ namespace mage::rendering {
 			buffer.m_neg_d_world = Direction3(XMStore< F32x3 >(neg_d));
 			buffer.m_E_ortho     = light.GetIrradianceSpectrum();
 			buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
+			return buffer;
+		};
+
+		std::vector< const DirectionalLight* > sm_candidates;
+		for (const auto index : m_visible_lights) {
+			const auto& light = *candidates[index];
 
 			if (light.UseShadows()) {
-				// Create a spotlight camera.
-				LightCameraInfo camera;
-				camera.world_to_light      = world_to_light;
-				camera.light_to_projection = light_to_lprojection;
+				sm_candidates.push_back(&light);
+				continue;
+			}
 
-				// Add directional light camera to the directional cameras.
-				m_directional_light_cameras.push_back(std::move(camera));
+			// Add directional light buffer to directional light buffers.
+			lights.push_back(create_buffer(light));
+		}
 
-				// Add directional light buffer to directional light buffers.
-				sm_lights.push_back(std::move(buffer));
-			}
-			else {
-				// Add directional light buffer to directional light buffers.
-				lights.push_back(std::move(buffer));
-			}
-		});
+		// Process the shadow mapped directional lights in the order of their
+		// shadow map slots.
+		m_directional_sm_cache.Arrange(sm_candidates);
+
+		for (const auto light : sm_candidates) {
+			const auto& transform = light->GetOwner()->GetTransform();
+
+			// Create a directional light camera.
+			LightCameraInfo camera;
+			camera.world_to_light      = transform.GetWorldToObjectMatrix();
+			camera.light_to_projection = light->GetLightToProjectionMatrix();
+
+			// Cull the shadow casters of the directional light camera.
+			auto& casters = GetCasters(m_directional_light_casters,
+									   m_directional_light_cameras.size());
+			casters.BuildOccluders(models,
+								   camera.world_to_light * camera.light_to_projection);
+
+			// Add directional light camera to the directional cameras.
+			m_directional_light_cameras.push_back(std::move(camera));
+
+			// Add directional light buffer to directional light buffers.
+			sm_lights.push_back(create_buffer(*light));
+		}
 
 		// Update the buffers for directional lights.
 		m_directional_lights.UpdateData(m_device_context, lights);
@@ -205,7 +260,8 @@ namespace mage::rendering {
 	}
 
 	void XM_CALLCONV LBufferPass
-		::ProcessOmniLights(const World& world,
+		::ProcessOmniLights(const ComponentBVH< OmniLight >& omni_lights,
+							const ComponentBVH< Model >& models,
 							FXMMATRIX world_to_projection) {
 
 		AlignedVector< OmniLightBuffer > lights;
@@ -215,72 +271,108 @@ namespace mage::rendering {
 		sm_lights.reserve(m_sm_omni_lights.size());
 		m_omni_light_cameras.clear();
 
-		// Process the omni lights.
-		world.ForEach< OmniLight >([this, &lights, &sm_lights, world_to_projection]
-		(const OmniLight& light) {
-
-			static const XMMATRIX rotations[6] = {
-				XMMatrixRotationY(-XM_PIDIV2), // Look: +x
-				XMMatrixRotationY(XM_PIDIV2),  // Look: -x
-				XMMatrixRotationX(XM_PIDIV2),  // Look: +y
-				XMMatrixRotationX(-XM_PIDIV2), // Look: -y
-				XMMatrixIdentity(),            // Look: +z
-				XMMatrixRotationY(XM_PI),      // Look: -z
-			};
+		// Cull the omni lights against the view frustum.
+		const BoundingFrustum frustum(world_to_projection);
 
-			if (State::Active != light.GetState()) {
-				return;
-			}
+		static const XMMATRIX rotations[6] = {
+			XMMatrixRotationY(-XM_PIDIV2), // Look: +x
+			XMMatrixRotationY(XM_PIDIV2),  // Look: -x
+			XMMatrixRotationX(XM_PIDIV2),  // Look: +y
+			XMMatrixRotationX(-XM_PIDIV2), // Look: -y
+			XMMatrixIdentity(),            // Look: +z
+			XMMatrixRotationY(XM_PI),      // Look: -z
+		};
 
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
+		// Process the visible omni lights.
+		std::vector< const OmniLight* > sm_candidates;
+		omni_lights.ForEach(frustum, [&lights, &sm_candidates]
+		(const OmniLight& light) {
 
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetBoundingSphere())) {
+			if (light.UseShadows()) {
+				sm_candidates.push_back(&light);
 				return;
 			}
 
+			const auto& transform = light.GetOwner()->GetTransform();
+
 			const auto p     = transform.GetWorldOrigin();
 			const auto range = light.GetWorldRange();
 
-			if (light.UseShadows()) {
-				// Create six omni light cameras.
-				const auto world_to_light       = transform.GetWorldToObjectMatrix();
-				const auto light_to_lprojection = light.GetLightToProjectionMatrix();
+			// Create an omni light buffer.
+			OmniLightBuffer buffer;
+			buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
+			buffer.m_inv_sqr_range = 1.0f / (range * range);
+			buffer.m_I             = light.GetIntensitySpectrum();
+
+			// Add omni light buffer to omni light buffers.
+			lights.push_back(std::move(buffer));
+		});
+
+		// Process the shadow mapped omni lights in the order of their shadow
+		// map slots.
+		m_omni_sm_cache.Arrange(sm_candidates);
+
+		for (const auto light : sm_candidates) {
+			const auto& transform = light->GetOwner()->GetTransform();
 
-				for (std::size_t i = 0u; i < std::size(rotations); ++i) {
-					LightCameraInfo camera;
-					camera.world_to_light      = world_to_light * rotations[i];
-					camera.light_to_projection = light_to_lprojection;
+			const auto p     = transform.GetWorldOrigin();
+			const auto range = light->GetWorldRange();
+
+			// Collect the shadow casters within the range of the omni light
+			// once for all six omni light cameras.
+			m_casters.clear();
+			m_caster_aabbs.clear();
 
-					// Add omni light camera to the omni light cameras.
-					m_omni_light_cameras.push_back(std::move(camera));
+			const BoundingSphere sphere(p, range);
+			models.ForEach(sphere, [this](const Model& model) {
+				if (!model.OccludesLight()) {
+					return;
 				}
 
-				// Create an omni light buffer.
-				ShadowMappedOmniLightBuffer buffer;
-				buffer.m_p_world           = Point3(XMStore< F32x3 >(p));
-				buffer.m_inv_sqr_range     = 1.0f / (range * range);
-				buffer.m_I                 = light.GetIntensitySpectrum();
-				buffer.m_world_to_light    = XMMatrixTranspose(world_to_light);
-				buffer.m_projection_values = XMStore< F32x2 >(GetNDCZConstructionValues(
-					                                          light_to_lprojection));
-
-				// Add omni light buffer to omni light buffers.
-				sm_lights.push_back(std::move(buffer));
-			}
-			else {
-				// Create an omni light buffer.
-				OmniLightBuffer buffer;
-				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
-				buffer.m_inv_sqr_range = 1.0f / (range * range);
-				buffer.m_I             = light.GetIntensitySpectrum();
-
-				// Add omni light buffer to omni light buffers.
-				lights.push_back(std::move(buffer));
+				const auto object_to_world
+					= model.GetOwner()->GetTransform().GetObjectToWorldMatrix();
+
+				m_casters.push_back(&model);
+				m_caster_aabbs.push_back(model.GetAABB(), object_to_world);
+			});
+
+			// Create six omni light cameras.
+			const auto world_to_light       = transform.GetWorldToObjectMatrix();
+			const auto light_to_lprojection = light->GetLightToProjectionMatrix();
+
+			for (std::size_t i = 0u; i < std::size(rotations); ++i) {
+				LightCameraInfo camera;
+				camera.world_to_light      = world_to_light * rotations[i];
+				camera.light_to_projection = light_to_lprojection;
+
+				// Cull the shadow casters of the omni light camera.
+				const auto world_to_lprojection
+					= camera.world_to_light * camera.light_to_projection;
+				auto& casters = GetCasters(m_omni_light_casters,
+										   m_omni_light_cameras.size());
+				m_caster_aabbs.Cull(BoundingFrustum(world_to_lprojection),
+									m_visible_casters);
+				for (const auto index : m_visible_casters) {
+					casters.PushOccluder(*m_casters[index], world_to_lprojection);
+				}
+				casters.Sort();
+
+				// Add omni light camera to the omni light cameras.
+				m_omni_light_cameras.push_back(std::move(camera));
 			}
-		});
+
+			// Create an omni light buffer.
+			ShadowMappedOmniLightBuffer buffer;
+			buffer.m_p_world           = Point3(XMStore< F32x3 >(p));
+			buffer.m_inv_sqr_range     = 1.0f / (range * range);
+			buffer.m_I                 = light->GetIntensitySpectrum();
+			buffer.m_world_to_light    = XMMatrixTranspose(world_to_light);
+			buffer.m_projection_values = XMStore< F32x2 >(GetNDCZConstructionValues(
+				                                          light_to_lprojection));
+
+			// Add omni light buffer to omni light buffers.
+			sm_lights.push_back(std::move(buffer));
+		}
 
 		// Update the buffers for omni lights.
 		m_omni_lights.UpdateData(m_device_context, lights);
@@ -288,7 +380,8 @@ namespace mage::rendering {
 	}
 
 	void XM_CALLCONV LBufferPass
-		::ProcessSpotLights(const World& world,
+		::ProcessSpotLights(const ComponentBVH< SpotLight >& spot_lights,
+							const ComponentBVH< Model >& models,
 							FXMMATRIX world_to_projection) {
 
 		AlignedVector< SpotLightBuffer > lights;
@@ -298,121 +391,162 @@ namespace mage::rendering {
 		sm_lights.reserve(m_sm_spot_lights.size());
 		m_spot_light_cameras.clear();
 
-		// Process the spotlights.
-		world.ForEach< SpotLight >([this, &lights, &sm_lights, world_to_projection]
+		// Cull the spotlights against the view frustum.
+		const BoundingFrustum frustum(world_to_projection);
+
+		// Process the visible spotlights.
+		std::vector< const SpotLight* > sm_candidates;
+		spot_lights.ForEach(frustum, [&lights, &sm_candidates]
 		(const SpotLight& light) {
 
-			if (State::Active != light.GetState()) {
+			if (light.UseShadows()) {
+				sm_candidates.push_back(&light);
 				return;
 			}
 
-			const auto& transform           = light.GetOwner()->GetTransform();
-			const auto  light_to_world      = transform.GetObjectToWorldMatrix();
-			const auto  light_to_projection = light_to_world * world_to_projection;
-
-			// Cull the light against the view frustum.
-			if (BoundingFrustum::Cull(light_to_projection, light.GetAABB())) {
-				return;
-			}
+			const auto& transform = light.GetOwner()->GetTransform();
 
 			const auto p     =  transform.GetWorldOrigin();
 			const auto neg_d = -transform.GetWorldAxisZ();
 			const auto range =  light.GetWorldRange();
 
-			if (light.UseShadows()) {
-				const auto world_to_light       = transform.GetWorldToObjectMatrix();
-				const auto light_to_lprojection = light.GetLightToProjectionMatrix();
-				const auto world_to_lprojection = world_to_light * light_to_lprojection;
-
-				// Create a spotlight camera.
-				LightCameraInfo camera;
-				camera.world_to_light          = world_to_light;
-				camera.light_to_projection     = light_to_lprojection;
-
-				// Add spotlight camera to the spotlight cameras.
-				m_spot_light_cameras.push_back(std::move(camera));
-
-				// Create a spotlight buffer.
-				ShadowMappedSpotLightBuffer buffer;
-				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
-				buffer.m_neg_d_world   = Direction3(XMStore< F32x3 >(neg_d));
-				buffer.m_inv_sqr_range = 1.0f / (range * range);
-				buffer.m_I             = light.GetIntensitySpectrum();
-				buffer.m_cos_umbra     = light.GetEndAngularCutoff();
-				buffer.m_cos_inv_range = 1.0f / light.GetRangeAngularCutoff();
-				buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
-
-				// Add spotlight buffer to spotlight buffers.
-				sm_lights.push_back(std::move(buffer));
-			}
-			else {
-				// Create an omni light buffer.
-				SpotLightBuffer buffer;
-				buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
-				buffer.m_neg_d_world   = Direction3(XMStore< F32x3 >(neg_d));
-				buffer.m_inv_sqr_range = 1.0f / (range * range);
-				buffer.m_I             = light.GetIntensitySpectrum();
-				buffer.m_cos_umbra     = light.GetEndAngularCutoff();
-				buffer.m_cos_inv_range = 1.0f / light.GetRangeAngularCutoff();
-
-				// Add spotlight buffer to spotlight buffers.
-				lights.push_back(std::move(buffer));
-			}
+			// Create a spotlight buffer.
+			SpotLightBuffer buffer;
+			buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
+			buffer.m_neg_d_world   = Direction3(XMStore< F32x3 >(neg_d));
+			buffer.m_inv_sqr_range = 1.0f / (range * range);
+			buffer.m_I             = light.GetIntensitySpectrum();
+			buffer.m_cos_umbra     = light.GetEndAngularCutoff();
+			buffer.m_cos_inv_range = 1.0f / light.GetRangeAngularCutoff();
+
+			// Add spotlight buffer to spotlight buffers.
+			lights.push_back(std::move(buffer));
 		});
 
+		// Process the shadow mapped spotlights in the order of their shadow
+		// map slots.
+		m_spot_sm_cache.Arrange(sm_candidates);
+
+		for (const auto light : sm_candidates) {
+			const auto& transform = light->GetOwner()->GetTransform();
+
+			const auto p     =  transform.GetWorldOrigin();
+			const auto neg_d = -transform.GetWorldAxisZ();
+			const auto range =  light->GetWorldRange();
+
+			const auto world_to_light       = transform.GetWorldToObjectMatrix();
+			const auto light_to_lprojection = light->GetLightToProjectionMatrix();
+			const auto world_to_lprojection = world_to_light * light_to_lprojection;
+
+			// Create a spotlight camera.
+			LightCameraInfo camera;
+			camera.world_to_light          = world_to_light;
+			camera.light_to_projection     = light_to_lprojection;
+
+			// Cull the shadow casters of the spotlight camera.
+			auto& casters = GetCasters(m_spot_light_casters,
+									   m_spot_light_cameras.size());
+			casters.BuildOccluders(models, world_to_lprojection);
+
+			// Add spotlight camera to the spotlight cameras.
+			m_spot_light_cameras.push_back(std::move(camera));
+
+			// Create a spotlight buffer.
+			ShadowMappedSpotLightBuffer buffer;
+			buffer.m_p_world       = Point3(XMStore< F32x3 >(p));
+			buffer.m_neg_d_world   = Direction3(XMStore< F32x3 >(neg_d));
+			buffer.m_inv_sqr_range = 1.0f / (range * range);
+			buffer.m_I             = light->GetIntensitySpectrum();
+			buffer.m_cos_umbra     = light->GetEndAngularCutoff();
+			buffer.m_cos_inv_range = 1.0f / light->GetRangeAngularCutoff();
+			buffer.m_world_to_projection = XMMatrixTranspose(world_to_lprojection);
+
+			// Add spotlight buffer to spotlight buffers.
+			sm_lights.push_back(std::move(buffer));
+		}
+
 		// Update the buffers for spotlights.
 		m_spot_lights.UpdateData(m_device_context, lights);
 		m_sm_spot_lights.UpdateData(m_device_context, sm_lights);
 	}
 
-	void LBufferPass::SetupShadowMaps() {
-		// Setup the shadow maps for the directional lights.
-		{
-			const auto nb_requested = m_sm_directional_lights.size();
-			const auto nb_available = m_directional_sms->GetNumberOfShadowMaps();
-
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_directional_sms = MakeUnique< ShadowMapBuffer >(*device.Get(),
-																  nb_requested);
-			}
-
-			m_directional_sms->ClearDSVs(m_device_context);
+	[[nodiscard]]
+	RenderQueues& LBufferPass::GetCasters(std::vector< RenderQueues >& casters,
+										  std::size_t index) {
+		if (casters.size() == index) {
+			casters.emplace_back();
 		}
 
+		auto& queues = casters[index];
+		queues.Clear();
+		return queues;
+	}
+
+	void LBufferPass::SetupShadowMaps() {
+		// Setup the shadow maps for the directional lights.
+		m_directional_sms->Reserve(m_device_context,
+								   m_sm_directional_lights.size());
 		// Setup the shadow maps for the omni lights.
-		{
-			const auto nb_requested = m_sm_omni_lights.size();
-			const auto nb_available = m_omni_sms->GetNumberOfShadowCubeMaps();
-
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_omni_sms = MakeUnique< ShadowCubeMapBuffer >(*device.Get(),
-															   nb_requested);
-			}
+		m_omni_sms->Reserve(m_device_context,
+							m_sm_omni_lights.size());
+		// Setup the shadow maps for the spotlights.
+		m_spot_sms->Reserve(m_device_context,
+							m_sm_spot_lights.size());
+	}
 
-			m_omni_sms->ClearDSVs(m_device_context);
-		}
+	[[nodiscard]]
+	U64 XM_CALLCONV LBufferPass::ComputeSignature(FXMMATRIX world_to_light,
+												  CXMMATRIX light_to_projection,
+												  const RenderQueues& casters) noexcept {
+		U64 signature = 0u;
 
-		// Setup the shadow maps for the spotlights.
-		{
-			const auto nb_requested = m_sm_spot_lights.size();
-			const auto nb_available = m_spot_sms->GetNumberOfShadowMaps();
-
-			if (nb_available < nb_requested) {
-				ComPtr< ID3D11Device > device;
-				m_device_context.get().GetDevice(device.ReleaseAndGetAddressOf());
-				m_spot_sms = MakeUnique< ShadowMapBuffer >(*device.Get(),
-														   nb_requested);
+		const auto combine_matrix = [&signature](const XMMATRIX& matrix) noexcept {
+			U64 words[sizeof(XMMATRIX) / sizeof(U64)];
+			std::memcpy(words, &matrix, sizeof(words));
+
+			for (const auto word : words) {
+				signature = ShadowMapCache::Combine(signature, word);
 			}
+		};
 
-			m_spot_sms->ClearDSVs(m_device_context);
+		// Combine the transformation matrices of the light camera.
+		combine_matrix(world_to_light);
+		combine_matrix(light_to_projection);
+
+		// Combine the identity, transform version, mesh and base color texture
+		// of the shadow casters.
+		for (const auto queue : { RenderQueue::OpaqueOccluders,
+								  RenderQueue::TransparentOccluders }) {
+
+			signature = ShadowMapCache::Combine(signature,
+												casters.GetNumberOfModels(queue));
+
+			casters.ForEach(queue, [&signature](const VisibleModel& model) {
+				const auto& transform = model.m_model->GetOwner()->GetTransform();
+				const auto  mesh      = model.m_model->GetMesh();
+				const auto  srv       = model.m_model->GetMaterial().GetBaseColorSRV();
+
+				signature = ShadowMapCache::Combine(signature,
+													model.m_model->GetGuid());
+				signature = ShadowMapCache::Combine(signature,
+													transform.GetVersion());
+				signature = ShadowMapCache::Combine(signature,
+													reinterpret_cast< U64 >(mesh));
+				signature = ShadowMapCache::Combine(signature,
+													model.m_model->GetStartIndex());
+				signature = ShadowMapCache::Combine(signature,
+													model.m_model->GetNumberOfIndices());
+				signature = ShadowMapCache::Combine(signature,
+													reinterpret_cast< U64 >(srv));
+			});
 		}
+
+		return signature;
 	}
 
-	void XM_CALLCONV LBufferPass::RenderShadowMaps(const World& world) {
+	void LBufferPass::RenderShadowMaps() {
+		MAGE_PROFILE_ZONE("LBufferPass::RenderShadowMaps");
+
 		// Bind the fixed state.
 		m_depth_pass->BindFixedState();
 
@@ -423,15 +557,30 @@ namespace mage::rendering {
 			// Bind the rasterizer state.
 			m_directional_sms->BindRasterizerState(m_device_context);
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_directional_light_cameras) {
-				// Bind the DSV.
-				m_directional_sms->BindDSV(m_device_context, i++);
+			for (std::size_t i = 0u; i < m_directional_light_cameras.size(); ++i) {
+				const auto& camera  = m_directional_light_cameras[i];
+				const auto& casters = m_directional_light_casters[i];
+
+				// Skip the shadow map if it is still valid.
+				const auto signature = ComputeSignature(camera.world_to_light,
+														camera.light_to_projection,
+														casters);
+				if (!m_directional_sm_cache.Update(i, signature)) {
+					continue;
+				}
+
+				// Clear and bind the DSV.
+				m_directional_sms->ClearDSV(m_device_context, i);
+				m_directional_sms->BindDSV(m_device_context, i);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
+				m_depth_pass->Render(casters,
+									 camera.world_to_light,
+									 camera.light_to_projection);
+
+				Pipeline::s_nb_shadow_casters += static_cast< U32 >(
+					casters.GetNumberOfModels(RenderQueue::OpaqueOccluders)
+					+ casters.GetNumberOfModels(RenderQueue::TransparentOccluders));
 			}
 		}
 
@@ -442,15 +591,30 @@ namespace mage::rendering {
 			// Bind the rasterizer state.
 			m_omni_sms->BindRasterizerState(m_device_context);
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_omni_light_cameras) {
-				// Bind the DSV.
-				m_omni_sms->BindDSV(m_device_context, i++);
+			for (std::size_t i = 0u; i < m_omni_light_cameras.size(); ++i) {
+				const auto& camera  = m_omni_light_cameras[i];
+				const auto& casters = m_omni_light_casters[i];
+
+				// Skip the shadow map if it is still valid.
+				const auto signature = ComputeSignature(camera.world_to_light,
+														camera.light_to_projection,
+														casters);
+				if (!m_omni_sm_cache.Update(i, signature)) {
+					continue;
+				}
+
+				// Clear and bind the DSV.
+				m_omni_sms->ClearDSV(m_device_context, i);
+				m_omni_sms->BindDSV(m_device_context, i);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
+				m_depth_pass->Render(casters,
+									 camera.world_to_light,
+									 camera.light_to_projection);
+
+				Pipeline::s_nb_shadow_casters += static_cast< U32 >(
+					casters.GetNumberOfModels(RenderQueue::OpaqueOccluders)
+					+ casters.GetNumberOfModels(RenderQueue::TransparentOccluders));
 			}
 		}
 
@@ -461,15 +625,30 @@ namespace mage::rendering {
 			// Bind the rasterizer state.
 			m_spot_sms->BindRasterizerState(m_device_context);
 
-			std::size_t i = 0u;
-			for (const auto& camera : m_spot_light_cameras) {
-				// Bind the DSV.
-				m_spot_sms->BindDSV(m_device_context, i++);
+			for (std::size_t i = 0u; i < m_spot_light_cameras.size(); ++i) {
+				const auto& camera  = m_spot_light_cameras[i];
+				const auto& casters = m_spot_light_casters[i];
+
+				// Skip the shadow map if it is still valid.
+				const auto signature = ComputeSignature(camera.world_to_light,
+														camera.light_to_projection,
+														casters);
+				if (!m_spot_sm_cache.Update(i, signature)) {
+					continue;
+				}
+
+				// Clear and bind the DSV.
+				m_spot_sms->ClearDSV(m_device_context, i);
+				m_spot_sms->BindDSV(m_device_context, i);
 
 				// Perform the depth pass.
-				m_depth_pass->RenderOccluders(world,
-											  camera.world_to_light,
-											  camera.light_to_projection);
+				m_depth_pass->Render(casters,
+									 camera.world_to_light,
+									 camera.light_to_projection);
+
+				Pipeline::s_nb_shadow_casters += static_cast< U32 >(
+					casters.GetNumberOfModels(RenderQueue::OpaqueOccluders)
+					+ casters.GetNumberOfModels(RenderQueue::TransparentOccluders));
 			}
 		}
 	}
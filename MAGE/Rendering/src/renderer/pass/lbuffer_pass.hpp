@@ -9,6 +9,9 @@
 #include "renderer\buffer\scene_buffer.hpp"
 #include "renderer\buffer\shadow_map_buffer.hpp"
 #include "renderer\pass\depth_pass.hpp"
+#include "renderer\shadow_map_cache.hpp"
+#include "renderer\world_bvh.hpp"
+#include "geometry\frustum_culling.hpp"
 
 #pragma endregion
 
@@ -57,6 +60,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		void XM_CALLCONV Render(const World& world,
+								const WorldBVH& world_bvh,
 			                    FXMMATRIX world_to_projection);
 
 	private:
@@ -71,15 +75,51 @@ namespace mage::rendering {
 		void ProcessLightsData(const World& world);
 
 		void XM_CALLCONV ProcessDirectionalLights(const World& world,
+												  const ComponentBVH< Model >& models,
 												  FXMMATRIX world_to_projection);
-		void XM_CALLCONV ProcessOmniLights(const World& world,
+		void XM_CALLCONV ProcessOmniLights(const ComponentBVH< OmniLight >& omni_lights,
+										   const ComponentBVH< Model >& models,
 										   FXMMATRIX world_to_projection);
-		void XM_CALLCONV ProcessSpotLights(const World& world,
+		void XM_CALLCONV ProcessSpotLights(const ComponentBVH< SpotLight >& spot_lights,
+										   const ComponentBVH< Model >& models,
 										   FXMMATRIX world_to_projection);
 
+		/**
+		 Returns the shadow caster render queues at the given index of the
+		 given shadow caster render queues, growing the latter if needed.
+
+		 @param[in,out]	casters
+						A reference to the vector of shadow caster render
+						queues.
+		 @param[in]		index
+						The index of the shadow caster render queues.
+		 @return		A reference to the (cleared) shadow caster render
+						queues at the given index.
+		 */
+		[[nodiscard]]
+		static RenderQueues& GetCasters(std::vector< RenderQueues >& casters,
+										std::size_t index);
+
 		void SetupShadowMaps();
 
-		void XM_CALLCONV RenderShadowMaps(const World& world);
+		/**
+		 Computes the signature of the shadow map of the given light camera
+		 and shadow casters.
+
+		 @param[in]		world_to_light
+						The world-to-light transformation matrix.
+		 @param[in]		light_to_projection
+						The light-to-projection transformation matrix.
+		 @param[in]		casters
+						A reference to the shadow caster render queues.
+		 @return		The signature of the shadow map.
+		 */
+		[[nodiscard]]
+		static U64 XM_CALLCONV ComputeSignature(FXMMATRIX world_to_light,
+												CXMMATRIX light_to_projection,
+												const RenderQueues& casters) noexcept;
+
+		void RenderShadowMaps();
 
 		//---------------------------------------------------------------------
 		// Member Variables
@@ -111,6 +151,32 @@ namespace mage::rendering {
 		AlignedVector< LightCameraInfo > m_omni_light_cameras;
 		AlignedVector< LightCameraInfo > m_spot_light_cameras;
 
+		AABBArray m_light_aabbs;
+		std::vector< U32 > m_visible_lights;
+
+		/**
+		 The shadow caster render queues of each light camera of this LBuffer
+		 pass.
+		 */
+		std::vector< RenderQueues > m_directional_light_casters;
+		std::vector< RenderQueues > m_omni_light_casters;
+		std::vector< RenderQueues > m_spot_light_casters;
+
+		/**
+		 The candidate shadow casters (i.e. the models within the range of
+		 the omni light being processed) of this LBuffer pass.
+		 */
+		std::vector< const Model* > m_casters;
+		AABBArray m_caster_aabbs;
+		std::vector< U32 > m_visible_casters;
+
+		/**
+		 The shadow map caches of this LBuffer pass.
+		 */
+		ShadowMapCache m_directional_sm_cache;
+		ShadowMapCache m_omni_sm_cache;
+		ShadowMapCache m_spot_sm_cache;
+
 		UniquePtr< DepthPass > m_depth_pass;
 	};
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 #include "renderer\pass\postprocess_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -32,6 +33,8 @@ namespace mage::rendering {
 		::operator=(PostProcessPass&& pass) noexcept = default;
 
 	void PostProcessPass::DispatchDOF(const U32x2& viewport_size) const noexcept {
+		MAGE_PROFILE_ZONE("PostProcessPass::DispatchDOF");
+
 		// CS: Bind the compute shader.
 		m_dof_cs->BindShader(m_device_context);
 
@@ -45,6 +48,7 @@ namespace mage::rendering {
 
 	void PostProcessPass::DispatchLDR(const U32x2& viewport_size,
 									  ToneMapping tone_mapping) const noexcept {
+		MAGE_PROFILE_ZONE("PostProcessPass::DispatchLDR");
 
 		// CS: Bind the compute shader.
 		const auto cs = CreateLowDynamicRangeCS(m_resource_manager,
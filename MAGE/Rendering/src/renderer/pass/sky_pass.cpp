@@ -5,6 +5,7 @@
 
 #include "renderer\pass\sky_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -61,6 +62,8 @@ namespace mage::rendering {
 	}
 
 	void SkyPass::Render(ID3D11ShaderResourceView* sky) const noexcept {
+		MAGE_PROFILE_ZONE("SkyPass::Render");
+
 		if (!sky) {
 			return;
 		}
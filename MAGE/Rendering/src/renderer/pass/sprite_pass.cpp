@@ -5,6 +5,7 @@
 
 #include "renderer\pass\sprite_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -55,6 +56,8 @@ namespace mage::rendering {
 	}
 
 	void SpritePass::Render(const World& world) {
+		MAGE_PROFILE_ZONE("SpritePass::Render");
+
 		// Bind the fixed state.
 		BindFixedState();
 
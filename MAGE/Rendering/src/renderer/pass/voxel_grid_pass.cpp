@@ -5,6 +5,7 @@
 
 #include "renderer\pass\voxel_grid_pass.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -63,6 +64,8 @@ namespace mage::rendering {
 	}
 
 	void VoxelGridPass::Render(std::size_t resolution) const noexcept {
+		MAGE_PROFILE_ZONE("VoxelGridPass::Render");
+
 		// Bind the fixed state.
 		BindFixedState();
 
@@ -6,6 +6,7 @@
 #include "renderer\pass\voxelization_pass.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\shader\shader_factory.hpp"
+#include "system\profiler.hpp"
 
 // Include HLSL bindings.
 #include "hlsl.hpp"
@@ -27,6 +28,8 @@ namespace mage::rendering {
 		m_rs(),
 		m_vs(CreateVoxelizationVS(resource_manager)),
 		m_gs(CreateVoxelizationGS(resource_manager)),
+		m_emissive_ps(CreateVoxelizationEmissivePS(resource_manager)),
+		m_ps(),
 		m_cs(CreateVoxelizationCS(resource_manager)),
 		m_voxel_grid(MakeUnique< VoxelGrid >(device, 1u)) {
 
@@ -94,13 +97,14 @@ namespace mage::rendering {
 								   BlendStateID::Opaque);
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const World& world,
-											  FXMMATRIX world_to_projection,
-											  std::size_t resolution) {
+	void VoxelizationPass::Render(const RenderQueues& queues,
+								  std::size_t resolution) {
+		MAGE_PROFILE_ZONE("VoxelizationPass::Render");
+
 		SetupVoxelGrid(resolution);
 
 		m_voxel_grid->BindBeginVoxelizationBuffer(m_device_context);
-		Render(world, world_to_projection);
+		Render(queues);
 		m_voxel_grid->BindEndVoxelizationBuffer(m_device_context);
 
 		m_voxel_grid->BindBeginVoxelizationTexture(m_device_context);
@@ -108,8 +112,7 @@ namespace mage::rendering {
 		m_voxel_grid->BindEndVoxelizationTexture(m_device_context);
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const World& world,
-											  FXMMATRIX world_to_projection) const {
+	void VoxelizationPass::Render(const RenderQueues& queues) {
 		// Bind the fixed opaque state.
 		BindFixedState();
 
@@ -119,107 +122,80 @@ namespace mage::rendering {
 		// All emissive models.
 		//---------------------------------------------------------------------
 		{
-			const PixelShaderPtr ps = CreateVoxelizationEmissivePS(m_resource_manager);
 			// PS: Bind the pixel shader.
-			ps->BindShader(m_device_context);
+			m_emissive_ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| !material.IsEmissive()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::Emissive);
 
 		//---------------------------------------------------------------------
 		// All models with no TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = false;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager,
-														   tsnm);
+			const auto& ps = m_ps.Get(static_cast< std::size_t >(tsnm),
+				[this, tsnm]() {
+					return CreateVoxelizationPS(m_resource_manager, tsnm);
+				});
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr != material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
-
-			Render(model, world_to_projection);
-		});
+		RenderModels(queues, RenderQueue::Opaque);
 
 		//---------------------------------------------------------------------
 		// All models with TSNM.
 		//---------------------------------------------------------------------
 		{
 			constexpr bool tsnm = true;
-			const PixelShaderPtr ps = CreateVoxelizationPS(m_resource_manager,
-														   tsnm);
+			const auto& ps = m_ps.Get(static_cast< std::size_t >(tsnm),
+				[this, tsnm]() {
+					return CreateVoxelizationPS(m_resource_manager, tsnm);
+				});
 			// PS: Bind the pixel shader.
 			ps->BindShader(m_device_context);
 		}
 
 		// Process the models.
-		world.ForEach< Model >([this, world_to_projection](const Model& model) {
-
-			const auto& material = model.GetMaterial();
-
-			if (State::Active != model.GetState()
-				|| material.IsEmissive()
-				|| nullptr == material.GetNormalSRV()
-				|| material.GetBaseColor()[3] < TRANSPARENCY_THRESHOLD) {
-				return;
-			}
+		RenderModels(queues, RenderQueue::OpaqueTSNM);
+	}
 
-			Render(model, world_to_projection);
+	void VoxelizationPass::RenderModels(const RenderQueues& queues,
+										RenderQueue queue) const noexcept {
+		const Model* previous = nullptr;
+		queues.ForEach(queue, [this, &previous](const VisibleModel& model) {
+			Render(*model.m_model, previous);
+			previous = model.m_model;
 		});
 	}
 
-	void XM_CALLCONV VoxelizationPass::Render(const Model& model,
-											  FXMMATRIX world_to_projection) const noexcept {
-
-		const auto& transform            = model.GetOwner()->GetTransform();
-		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
-		const auto  object_to_projection = object_to_world * world_to_projection;
-
-		// Apply view frustum culling.
-		if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
-			return;
-		}
-
-		const auto& material             = model.GetMaterial();
+	void VoxelizationPass::Render(const Model& model,
+								  const Model* previous) const noexcept {
+		const auto& material = model.GetMaterial();
 
 		// Bind the constant buffer of the model.
 		model.BindBuffer< Pipeline::VS >(m_device_context, SLOT_CBUFFER_MODEL);
 		model.BindBuffer< Pipeline::PS >(m_device_context, SLOT_CBUFFER_MODEL);
-		// Bind the SRVs of the model.
-		static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
-		static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
-		ID3D11ShaderResourceView* const srvs[] = {
-			material.GetBaseColorSRV(),
-			material.GetMaterialSRV(),
-			material.GetNormalSRV()
-		};
-		Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR,
-							   static_cast< U32 >(std::size(srvs)), srvs);
-		// Bind the mesh of the model.
-		model.BindMesh(m_device_context);
+		// Bind the SRVs of the model (if not bound yet).
+		if (nullptr == previous
+			|| !material.HasSameSRVs(previous->GetMaterial())) {
+
+			static_assert(SLOT_SRV_MATERIAL == SLOT_SRV_BASE_COLOR + 1);
+			static_assert(SLOT_SRV_NORMAL   == SLOT_SRV_BASE_COLOR + 2);
+			ID3D11ShaderResourceView* const srvs[] = {
+				material.GetBaseColorSRV(),
+				material.GetMaterialSRV(),
+				material.GetNormalSRV()
+			};
+			Pipeline::PS::BindSRVs(m_device_context, SLOT_SRV_BASE_COLOR,
+								   static_cast< U32 >(std::size(srvs)), srvs);
+		}
+		// Bind the mesh of the model (if not bound yet).
+		if (nullptr == previous || model.GetMesh() != previous->GetMesh()) {
+			model.BindMesh(m_device_context);
+		}
 		// Draw the model.
 		model.Draw(m_device_context);
 	}
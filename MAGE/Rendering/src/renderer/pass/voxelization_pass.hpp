@@ -8,7 +8,8 @@
 #include "renderer\buffer\voxel_grid.hpp"
 #include "renderer\state_manager.hpp"
 #include "resource\rendering_resource_manager.hpp"
-#include "scene\rendering_world.hpp"
+#include "renderer\render_queues.hpp"
+#include "resource\shader\shader_permutations.hpp"
 
 #pragma endregion
 
@@ -98,20 +99,17 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 
 		/**
-		 Renders the world.
+		 Renders the given render queues.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues (of the voxel
+						grid).
 		 @param[in]		resolution
 						The resolution of the regular voxel grid.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection,
-								std::size_t resolution);
+		void Render(const RenderQueues& queues, std::size_t resolution);
 
 	private:
 
@@ -137,28 +135,38 @@ namespace mage::rendering {
 		void BindFixedState() const noexcept;
 
 		/**
-		 Renders the given world.
+		 Renders the given render queues.
 
-		 @param[in]		world
-						A reference to the world.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		queues
+						A reference to the render queues.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void XM_CALLCONV Render(const World& world,
-			                    FXMMATRIX world_to_projection) const;
+		void Render(const RenderQueues& queues);
 
 		/**
-		 Renders the given model.
+		 Renders the models of the given render queue.
+
+		 @param[in]		queues
+						A reference to the render queues.
+		 @param[in]		queue
+						The render queue.
+		 */
+		void RenderModels(const RenderQueues& queues,
+						  RenderQueue queue) const noexcept;
+
+		/**
+		 Renders the given model. The shader resource views and mesh of the
+		 given model are only bound if they differ from those of the given
+		 previous model.
 
 		 @param[in]		model
 						A reference to the model.
-		 @param[in]		world_to_projection
-						The world-to-projection transformation matrix.
+		 @param[in]		previous
+						A pointer to the previously rendered model. If
+						@c nullptr, all state of the given model is bound.
 		 */
-		void XM_CALLCONV Render(const Model& model,
-								FXMMATRIX world_to_projection) const noexcept;
+		void Render(const Model& model, const Model* previous) const noexcept;
 
 		/**
 		 Dispatches this voxelization pass.
@@ -199,6 +207,16 @@ namespace mage::rendering {
 		 */
 		GeometryShaderPtr m_gs;
 
+		/**
+		 A pointer to the emissive pixel shader of this voxelization pass.
+		 */
+		PixelShaderPtr m_emissive_ps;
+
+		/**
+		 The pixel shader permutations (TSNM) of this voxelization pass.
+		 */
+		ShaderPermutations< PixelShaderPtr, 2u > m_ps;
+
 		/**
 		 A pointer to the compute shader of this voxelization pass.
 		 */
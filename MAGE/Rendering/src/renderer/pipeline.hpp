@@ -372,6 +372,7 @@ namespace mage::rendering {
 				                        U32 offset = 0u) noexcept {
 
 				device_context.IASetIndexBuffer(&buffer, format, offset);
+				OnBind();
 			}
 
 			static void BindVertexBuffer(ID3D11DeviceContext& device_context,
@@ -402,18 +403,21 @@ namespace mage::rendering {
 												  buffers,
 												  strides,
 												  offsets);
+				OnBind();
 			}
 
 			static void BindPrimitiveTopology(ID3D11DeviceContext& device_context,
 				                              D3D11_PRIMITIVE_TOPOLOGY topology) noexcept {
 
 				device_context.IASetPrimitiveTopology(topology);
+				OnBind();
 			}
 
 			static void BindInputLayout(ID3D11DeviceContext& device_context,
 				                        ID3D11InputLayout& input_layout) noexcept {
 
 				device_context.IASetInputLayout(&input_layout);
+				OnBind();
 			}
 		};
 
@@ -469,6 +473,7 @@ namespace mage::rendering {
 				device_context.VSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				OnBind();
 			}
 
 			/**
@@ -519,6 +524,7 @@ namespace mage::rendering {
 				                            ID3D11Buffer* const* buffers) noexcept {
 
 				device_context.VSSetConstantBuffers(slot, nb_buffers, buffers);
+				OnBind();
 			}
 
 			/**
@@ -570,6 +576,7 @@ namespace mage::rendering {
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
 				device_context.VSSetShaderResources(slot, nb_srvs, srvs);
+				OnBind();
 			}
 
 			/**
@@ -620,6 +627,7 @@ namespace mage::rendering {
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
 				device_context.VSSetSamplers(slot, nb_samplers, samplers);
+				OnBind();
 			}
 		};
 
@@ -675,6 +683,7 @@ namespace mage::rendering {
 				device_context.HSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				OnBind();
 			}
 
 			/**
@@ -725,6 +734,7 @@ namespace mage::rendering {
 				                            ID3D11Buffer* const* buffers) noexcept {
 
 				device_context.HSSetConstantBuffers(slot, nb_buffers, buffers);
+				OnBind();
 			}
 
 			/**
@@ -776,6 +786,7 @@ namespace mage::rendering {
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
 				device_context.HSSetShaderResources(slot, nb_srvs, srvs);
+				OnBind();
 			}
 
 			/**
@@ -826,6 +837,7 @@ namespace mage::rendering {
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
 				device_context.HSSetSamplers(slot, nb_samplers, samplers);
+				OnBind();
 			}
 		};
 
@@ -893,6 +905,7 @@ namespace mage::rendering {
 				device_context.DSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				OnBind();
 			}
 
 			/**
@@ -943,6 +956,7 @@ namespace mage::rendering {
 				                            ID3D11Buffer* const* buffers) noexcept {
 
 				device_context.DSSetConstantBuffers(slot, nb_buffers, buffers);
+				OnBind();
 			}
 
 			/**
@@ -994,6 +1008,7 @@ namespace mage::rendering {
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
 				device_context.DSSetShaderResources(slot, nb_srvs, srvs);
+				OnBind();
 			}
 
 			/**
@@ -1044,6 +1059,7 @@ namespace mage::rendering {
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
 				device_context.DSSetSamplers(slot, nb_samplers, samplers);
+				OnBind();
 			}
 		};
 
@@ -1099,6 +1115,7 @@ namespace mage::rendering {
 				device_context.GSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				OnBind();
 			}
 
 			/**
@@ -1149,6 +1166,7 @@ namespace mage::rendering {
 				                            ID3D11Buffer* const* buffers) noexcept {
 
 				device_context.GSSetConstantBuffers(slot, nb_buffers, buffers);
+				OnBind();
 			}
 
 			/**
@@ -1200,6 +1218,7 @@ namespace mage::rendering {
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
 				device_context.GSSetShaderResources(slot, nb_srvs, srvs);
+				OnBind();
 			}
 
 			/**
@@ -1250,6 +1269,7 @@ namespace mage::rendering {
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
 				device_context.GSSetSamplers(slot, nb_samplers, samplers);
+				OnBind();
 			}
 		};
 
@@ -1294,12 +1314,14 @@ namespace mage::rendering {
 				                              const D3D11_RECT* rectangles) noexcept {
 
 				device_context.RSSetScissorRects(nb_rectangles, rectangles);
+				OnBind();
 			}
 
 			static void BindState(ID3D11DeviceContext& device_context,
 				                  ID3D11RasterizerState* state) noexcept {
 
 				device_context.RSSetState(state);
+				OnBind();
 			}
 
 			static void GetBoundViewports(ID3D11DeviceContext& device_context,
@@ -1320,6 +1342,7 @@ namespace mage::rendering {
 				                      const D3D11_VIEWPORT* viewports) noexcept {
 
 				device_context.RSSetViewports(nb_viewports, viewports);
+				OnBind();
 			}
 		};
 
@@ -1375,6 +1398,7 @@ namespace mage::rendering {
 				device_context.PSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				OnBind();
 			}
 
 			/**
@@ -1425,6 +1449,7 @@ namespace mage::rendering {
 				                            ID3D11Buffer* const* buffers) noexcept {
 
 				device_context.PSSetConstantBuffers(slot, nb_buffers, buffers);
+				OnBind();
 			}
 
 			/**
@@ -1476,6 +1501,7 @@ namespace mage::rendering {
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
 				device_context.PSSetShaderResources(slot, nb_srvs, srvs);
+				OnBind();
 			}
 
 			/**
@@ -1526,6 +1552,7 @@ namespace mage::rendering {
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
 				device_context.PSSetSamplers(slot, nb_samplers, samplers);
+				OnBind();
 			}
 		};
 
@@ -1552,6 +1579,7 @@ namespace mage::rendering {
 				                              U32 stencil_ref = 0u) noexcept {
 
 				device_context.OMSetDepthStencilState(state, stencil_ref);
+				OnBind();
 			}
 
 			static void BindBlendState(ID3D11DeviceContext& device_context,
@@ -1567,6 +1595,7 @@ namespace mage::rendering {
 				                       U32 sample_mask = 0xffffffff) noexcept {
 
 				device_context.OMSetBlendState(state, blend_factor, sample_mask);
+				OnBind();
 			}
 
 			static void BindRTVAndDSV(ID3D11DeviceContext& device_context,
@@ -1587,6 +1616,7 @@ namespace mage::rendering {
 				                       ID3D11DepthStencilView* dsv) noexcept {
 
 				device_context.OMSetRenderTargets(nb_views, rtvs, dsv);
+				OnBind();
 			}
 
 			static void BindRTVAndDSVAndUAV(ID3D11DeviceContext& device_context,
@@ -1657,6 +1687,7 @@ namespace mage::rendering {
 
 				device_context.OMSetRenderTargetsAndUnorderedAccessViews(
 					nb_views, rtvs, dsv, uav_slot, nb_uavs, uavs, initial_counts);
+				OnBind();
 			}
 
 			static void ClearRTV(ID3D11DeviceContext& device_context,
@@ -1764,6 +1795,7 @@ namespace mage::rendering {
 				device_context.CSSetShader(shader,
 										   class_instances,
 										   nb_class_instances);
+				OnBind();
 			}
 
 			/**
@@ -1814,6 +1846,7 @@ namespace mage::rendering {
 				                            ID3D11Buffer* const* buffers) noexcept {
 
 				device_context.CSSetConstantBuffers(slot, nb_buffers, buffers);
+				OnBind();
 			}
 
 			/**
@@ -1865,6 +1898,7 @@ namespace mage::rendering {
 				                 ID3D11ShaderResourceView* const* srvs) noexcept {
 
 				device_context.CSSetShaderResources(slot, nb_srvs, srvs);
+				OnBind();
 			}
 
 			/**
@@ -1928,6 +1962,7 @@ namespace mage::rendering {
 														 nb_uavs,
 														 uavs,
 														 initial_counts);
+				OnBind();
 			}
 
 			/**
@@ -1978,6 +2013,7 @@ namespace mage::rendering {
 				                     ID3D11SamplerState* const* samplers) noexcept {
 
 				device_context.CSSetSamplers(slot, nb_samplers, samplers);
+				OnBind();
 			}
 		};
 
@@ -2000,6 +2036,16 @@ namespace mage::rendering {
 		 */
 		static U32 s_nb_draws;
 
+		/**
+		 The number of shadow casters rendered in all shadow maps
+		 */
+		static U32 s_nb_shadow_casters;
+
+		/**
+		 The number of state changes (i.e. bind calls)
+		 */
+		static U32 s_nb_binds;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -2009,6 +2055,10 @@ namespace mage::rendering {
 		static void OnDraw() noexcept {
 			++s_nb_draws;
 		}
+
+		static void OnBind() noexcept {
+			++s_nb_binds;
+		}
 	};
 
 	/**
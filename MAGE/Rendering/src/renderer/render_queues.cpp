@@ -0,0 +1,300 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\render_queues.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	namespace {
+
+		/**
+		 The number of bits of the hash of the shader resource views in the
+		 state key of a visible model.
+		 */
+		constexpr U64 g_srvs_bits = 20u;
+
+		/**
+		 The number of bits of the hash of the mesh in the state key of a
+		 visible model.
+		 */
+		constexpr U64 g_mesh_bits = 20u;
+
+		/**
+		 The number of bits of the quantized depth of a visible model.
+		 */
+		constexpr U64 g_depth_bits = 16u;
+
+		/**
+		 The minimum number of sort entries to use a radix sort instead of a
+		 comparison sort.
+		 */
+		constexpr std::size_t g_radix_sort_threshold = 256u;
+
+		/**
+		 Hashes the given pointer.
+
+		 @param[in]		ptr
+						The pointer.
+		 @param[in]		seed
+						The seed.
+		 @return		The hash of the given pointer. The most significant
+						bits are the best distributed.
+		 */
+		[[nodiscard]]
+		inline U64 Hash(const void* ptr, U64 seed) noexcept {
+			const auto value = static_cast< U64 >(
+				reinterpret_cast< std::uintptr_t >(ptr));
+			return (value ^ seed) * 0x9E3779B97F4A7C15ull;
+		}
+
+		/**
+		 Sorts the given sort entries on their keys. The sort is stable.
+
+		 @param[in,out]	entries
+						A reference to the vector containing the sort entries.
+		 @param[in,out]	buffer
+						A reference to a scratch vector.
+		 */
+		void RadixSort(std::vector< std::pair< U64, U32 > >& entries,
+					   std::vector< std::pair< U64, U32 > >& buffer) {
+
+			using std::begin;
+			using std::end;
+
+			if (entries.size() < g_radix_sort_threshold) {
+				std::stable_sort(begin(entries), end(entries),
+								 [](const auto& lhs, const auto& rhs) noexcept {
+									 return lhs.first < rhs.first;
+								 });
+				return;
+			}
+
+			buffer.resize(entries.size());
+
+			// Least significant digit first, one byte at a time.
+			for (U64 shift = 0u; shift < 64u; shift += 8u) {
+				std::size_t counts[256] = {};
+				for (const auto& entry : entries) {
+					++counts[(entry.first >> shift) & 0xFFu];
+				}
+
+				// Skip the digits shared by all keys.
+				if (entries.size() == counts[(entries[0].first >> shift) & 0xFFu]) {
+					continue;
+				}
+
+				std::size_t offset = 0u;
+				for (auto& count : counts) {
+					const auto next = offset + count;
+					count  = offset;
+					offset = next;
+				}
+
+				for (const auto& entry : entries) {
+					buffer[counts[(entry.first >> shift) & 0xFFu]++] = entry;
+				}
+
+				entries.swap(buffer);
+			}
+		}
+	}
+
+	RenderQueues::RenderQueues()
+		: m_models(),
+		m_queues{},
+		m_entries(),
+		m_buffer() {}
+
+	RenderQueues::RenderQueues(RenderQueues&& queues) noexcept = default;
+
+	RenderQueues::~RenderQueues() = default;
+
+	RenderQueues& RenderQueues::operator=(RenderQueues&& queues) noexcept = default;
+
+	void XM_CALLCONV RenderQueues::Build(const ComponentBVH< Model >& models,
+										 FXMMATRIX world_to_projection) {
+		Clear();
+
+		// Apply view frustum culling.
+		const BoundingFrustum frustum(world_to_projection);
+
+		models.ForEach(frustum, [this, world_to_projection](const Model& model) {
+			Enqueue(PushModel(model, world_to_projection));
+		});
+
+		Sort();
+	}
+
+	void XM_CALLCONV RenderQueues::BuildOccluders(const ComponentBVH< Model >& models,
+												  FXMMATRIX world_to_projection) {
+		Clear();
+
+		// Apply view frustum culling.
+		const BoundingFrustum frustum(world_to_projection);
+
+		models.ForEach(frustum, [this, world_to_projection](const Model& model) {
+			PushOccluder(model, world_to_projection);
+		});
+
+		Sort();
+	}
+
+	void RenderQueues::Clear() noexcept {
+		m_models.clear();
+		for (auto& queue : m_queues) {
+			queue.clear();
+		}
+	}
+
+	void XM_CALLCONV RenderQueues::PushOccluder(const Model& model,
+												FXMMATRIX world_to_projection) {
+		if (!model.OccludesLight()) {
+			return;
+		}
+
+		EnqueueOccluder(PushModel(model, world_to_projection));
+	}
+
+	void RenderQueues::Sort() {
+		for (std::size_t i = 0u; i < std::size(m_queues); ++i) {
+			auto& queue = m_queues[i];
+			if (queue.size() < 2u) {
+				continue;
+			}
+
+			const auto type = static_cast< RenderQueue >(i);
+			const auto back_to_front
+				=  RenderQueue::TransparentEmissive == type
+				|| RenderQueue::Transparent         == type
+				|| RenderQueue::TransparentTSNM     == type;
+
+			m_entries.clear();
+			for (const auto index : queue) {
+				const auto& model = m_models[index];
+				// Transparent: depth (back to front) . state
+				// Other:       state . depth (front to back)
+				const auto key = back_to_front
+					? (((U64(1u) << g_depth_bits) - 1u - model.m_depth)
+					   << (g_srvs_bits + g_mesh_bits)) | model.m_state
+					: (model.m_state << g_depth_bits) | model.m_depth;
+				m_entries.emplace_back(key, index);
+			}
+
+			RadixSort(m_entries, m_buffer);
+
+			for (std::size_t j = 0u; j < queue.size(); ++j) {
+				queue[j] = m_entries[j].second;
+			}
+		}
+	}
+
+	U32 XM_CALLCONV RenderQueues::PushModel(const Model& model,
+											FXMMATRIX world_to_projection) {
+
+		const auto& transform            = model.GetOwner()->GetTransform();
+		const auto  object_to_world      = transform.GetObjectToWorldMatrix();
+		const auto  object_to_projection = object_to_world * world_to_projection;
+
+		// Hash the shader resource views and the mesh.
+		const auto& material = model.GetMaterial();
+		const auto srvs = Hash(material.GetNormalSRV(),
+							   Hash(material.GetMaterialSRV(),
+									Hash(material.GetBaseColorSRV(), 0u)))
+			            >> (64u - g_srvs_bits);
+		const auto mesh = Hash(model.GetMesh(), 0u) >> (64u - g_mesh_bits);
+
+		// Quantize the depth of the origin of the model.
+		const auto origin = object_to_projection.r[3u];
+		const auto w      = XMVectorGetW(origin);
+		auto z = 0.0f;
+		if (0.0f < w) {
+			z = Saturate(XMVectorGetZ(origin) / w);
+			#ifndef DISABLE_INVERTED_Z_BUFFER
+			z = 1.0f - z;
+			#endif // DISABLE_INVERTED_Z_BUFFER
+		}
+		const auto depth = static_cast< U64 >(
+			z * static_cast< F32 >((U64(1u) << g_depth_bits) - 1u));
+
+		const auto index = static_cast< U32 >(m_models.size());
+		m_models.push_back({
+			object_to_projection,
+			&model,
+			(srvs << g_mesh_bits) | mesh,
+			depth
+		});
+		return index;
+	}
+
+	void RenderQueues::Enqueue(U32 index) {
+		const auto push = [this, index](RenderQueue queue) {
+			m_queues[static_cast< std::size_t >(queue)].push_back(index);
+		};
+
+		const auto& material = m_models[index].m_model->GetMaterial();
+		const auto  alpha    = material.GetBaseColor()[3];
+		const auto  emissive = material.IsEmissive();
+		const auto  tsnm     = (nullptr != material.GetNormalSRV());
+
+		push(RenderQueue::All);
+
+		if (TRANSPARENCY_THRESHOLD <= alpha) {
+			if (emissive) {
+				push(RenderQueue::Emissive);
+			}
+			else {
+				push(tsnm ? RenderQueue::OpaqueTSNM : RenderQueue::Opaque);
+			}
+		}
+
+		if (!material.IsTransparant()) {
+			push(RenderQueue::OpaqueOccluders);
+		}
+		else if (TRANSPARENCY_SHADOW_THRESHOLD <= alpha) {
+			if (emissive) {
+				push(RenderQueue::TransparentEmissive);
+			}
+			else {
+				push(tsnm ? RenderQueue::TransparentTSNM
+					      : RenderQueue::Transparent);
+			}
+
+			push(RenderQueue::TransparentOccluders);
+		}
+	}
+
+	void RenderQueues::EnqueueOccluder(U32 index) {
+		const auto push = [this, index](RenderQueue queue) {
+			m_queues[static_cast< std::size_t >(queue)].push_back(index);
+		};
+
+		const auto& material = m_models[index].m_model->GetMaterial();
+		const auto  alpha    = material.GetBaseColor()[3];
+
+		if (!material.IsTransparant()) {
+			push(RenderQueue::OpaqueOccluders);
+		}
+		else if (TRANSPARENCY_SHADOW_THRESHOLD <= alpha) {
+			push(RenderQueue::TransparentOccluders);
+		}
+	}
+}
\ No newline at end of file
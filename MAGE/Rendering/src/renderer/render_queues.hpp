@@ -0,0 +1,305 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\world_bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 An enumeration of the different render queues.
+
+	 This contains:
+	 @c All,
+	 @c Emissive,
+	 @c Opaque,
+	 @c OpaqueTSNM,
+	 @c TransparentEmissive,
+	 @c Transparent,
+	 @c TransparentTSNM,
+	 @c OpaqueOccluders and
+	 @c TransparentOccluders.
+	 */
+	enum class RenderQueue : U8 {
+		All = 0,
+		Emissive,
+		Opaque,
+		OpaqueTSNM,
+		TransparentEmissive,
+		Transparent,
+		TransparentTSNM,
+		OpaqueOccluders,
+		TransparentOccluders,
+		Count
+	};
+
+	/**
+	 A struct of visible models.
+	 */
+	struct VisibleModel {
+
+	public:
+
+		/**
+		 The object-to-projection transformation matrix of this visible
+		 model.
+		 */
+		XMMATRIX m_object_to_projection;
+
+		/**
+		 A pointer to the model of this visible model.
+		 */
+		const Model* m_model;
+
+		/**
+		 The state key of this visible model. Visible models with equal
+		 shader resource views and meshes have equal state keys.
+		 */
+		U64 m_state;
+
+		/**
+		 The quantized depth of this visible model (increasing from near to
+		 far).
+		 */
+		U64 m_depth;
+	};
+
+	/**
+	 A class of render queues.
+
+	 The render queues of a view are built in a single pass over the visible
+	 models of a world: the BVH of the models is queried once with the view
+	 frustum, and each visible model is bucketed into the render queues of
+	 the passes consuming it, together with its object-to-projection
+	 transformation matrix.
+
+	 Each render queue is sorted on a 64-bit key. The visible models of
+	 opaque render queues are grouped by shader resource views and mesh,
+	 and sorted front to back within each group, so that consecutive
+	 models can share bound state. The visible models of transparent
+	 render queues are sorted back to front.
+	 */
+	class RenderQueues {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs render queues.
+		 */
+		RenderQueues();
+
+		/**
+		 Constructs render queues from the given render queues.
+
+		 @param[in]		queues
+						A reference to the render queues to copy.
+		 */
+		RenderQueues(const RenderQueues& queues) = delete;
+
+		/**
+		 Constructs render queues by moving the given render queues.
+
+		 @param[in]		queues
+						A reference to the render queues to move.
+		 */
+		RenderQueues(RenderQueues&& queues) noexcept;
+
+		/**
+		 Destructs these render queues.
+		 */
+		~RenderQueues();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given render queues to these render queues.
+
+		 @param[in]		queues
+						A reference to the render queues to copy.
+		 @return		A reference to the copy of the given render queues
+						(i.e. these render queues).
+		 */
+		RenderQueues& operator=(const RenderQueues& queues) = delete;
+
+		/**
+		 Moves the given render queues to these render queues.
+
+		 @param[in]		queues
+						A reference to the render queues to move.
+		 @return		A reference to the moved render queues (i.e. these
+						render queues).
+		 */
+		RenderQueues& operator=(RenderQueues&& queues) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Builds these render queues for the given models and view.
+
+		 @param[in]		models
+						A reference to the component BVH of the models.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						view.
+		 */
+		void XM_CALLCONV Build(const ComponentBVH< Model >& models,
+							   FXMMATRIX world_to_projection);
+
+		/**
+		 Builds the occluder render queues of these render queues for the
+		 given models and view (e.g., a shadow map camera).
+
+		 @param[in]		models
+						A reference to the component BVH of the models.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						view.
+		 */
+		void XM_CALLCONV BuildOccluders(const ComponentBVH< Model >& models,
+										FXMMATRIX world_to_projection);
+
+		/**
+		 Clears these render queues.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 Pushes the given model into the occluder render queues of these
+		 render queues, if it occludes light.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						view.
+		 */
+		void XM_CALLCONV PushOccluder(const Model& model,
+									  FXMMATRIX world_to_projection);
+
+		/**
+		 Sorts these render queues.
+		 */
+		void Sort();
+
+		/**
+		 Returns the number of visible models in the given render queue.
+
+		 @param[in]		queue
+						The render queue.
+		 @return		The number of visible models in the given render
+						queue.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfModels(RenderQueue queue) const noexcept {
+			return m_queues[static_cast< std::size_t >(queue)].size();
+		}
+
+		/**
+		 Applies the given action to each visible model in the given render
+		 queue.
+
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(const VisibleModel&)@endcode.
+		 @param[in]		queue
+						The render queue.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename ActionT >
+		void ForEach(RenderQueue queue, ActionT&& action) const {
+			for (const auto index : m_queues[static_cast< std::size_t >(queue)]) {
+				action(m_models[index]);
+			}
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Pushes the visible model at the given index into the render queues
+		 of the passes consuming it.
+
+		 @param[in]		index
+						The index of the visible model.
+		 */
+		void Enqueue(U32 index);
+
+		/**
+		 Pushes the visible model at the given index into the occluder render
+		 queues.
+
+		 @param[in]		index
+						The index of the visible model.
+		 */
+		void EnqueueOccluder(U32 index);
+
+		/**
+		 Pushes a visible model for the given model and view.
+
+		 @param[in]		model
+						A reference to the model.
+		 @param[in]		world_to_projection
+						The world-to-projection transformation matrix of the
+						view.
+		 @return		The index of the visible model.
+		 */
+		U32 XM_CALLCONV PushModel(const Model& model,
+								  FXMMATRIX world_to_projection);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The visible models of these render queues.
+		 */
+		AlignedVector< VisibleModel > m_models;
+
+		/**
+		 The indices of the visible models of each render queue of these
+		 render queues.
+		 */
+		std::vector< U32 > m_queues[
+			static_cast< std::size_t >(RenderQueue::Count)];
+
+		/**
+		 The sort entries of these render queues.
+		 */
+		std::vector< std::pair< U64, U32 > > m_entries;
+
+		/**
+		 The sort buffer of these render queues.
+		 */
+		std::vector< std::pair< U64, U32 > > m_buffer;
+	};
+}
\ No newline at end of file
@@ -5,6 +5,8 @@
 
 #include "renderer\renderer.hpp"
 #include "renderer\output_manager.hpp"
+#include "renderer\render_queues.hpp"
+#include "renderer\world_bvh.hpp"
 #include "renderer\pass\aa_pass.hpp"
 #include "renderer\pass\back_buffer_pass.hpp"
 #include "renderer\pass\bounding_volume_pass.hpp"
@@ -18,6 +20,7 @@
 #include "renderer\pass\voxelization_pass.hpp"
 #include "renderer\pass\voxel_grid_pass.hpp"
 #include "renderer\buffer\scene_buffer.hpp"
+#include "system\profiler.hpp"
 #include "imgui_impl_dx11.h"
 
 // Include HLSL bindings.
@@ -129,10 +132,13 @@ namespace mage::rendering {
 						A reference to the world.
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void Render(const World& world, const GameTime& time);
+		void Render(const World& world, const GameTime& time,
+					JobSystem& job_system);
 
 	private:
 
@@ -142,7 +148,10 @@ namespace mage::rendering {
 
 		void InitializePasses();
 
-		void UpdateBuffers(const World& world, const GameTime& time);
+		void UpdateBuffers(const World& world, const GameTime& time,
+						   JobSystem& job_system);
+
+		void UpdateModelBuffers(const World& world, JobSystem& job_system);
 
 		void UpdateWorldBuffer(const GameTime& time);
 
@@ -160,10 +169,7 @@ namespace mage::rendering {
 									 const Camera& camera,
 									 FXMMATRIX world_to_projection);
 
-		void XM_CALLCONV RenderFalseColor(const World& world,
-										  const Camera& camera,
-										  FXMMATRIX world_to_projection,
-										  FalseColor false_color);
+		void RenderFalseColor(const Camera& camera, FalseColor false_color);
 
 		void XM_CALLCONV RenderVoxelGrid(const World& world,
 										 const Camera& camera,
@@ -216,6 +222,36 @@ namespace mage::rendering {
 		 */
 		ConstantBuffer< WorldBuffer > m_world_buffer;
 
+		/**
+		 The active models of the world being rendered by this renderer.
+		 */
+		std::vector< const Model* > m_models;
+
+		/**
+		 Flags indicating whether the buffer of the model at the same index
+		 in the active models of this renderer needs to be uploaded.
+		 */
+		std::vector< U8 > m_model_updates;
+
+		//---------------------------------------------------------------------
+		// Member Variables: Render Queues
+		//---------------------------------------------------------------------
+
+		/**
+		 The BVH of the world being rendered by this renderer.
+		 */
+		WorldBVH m_world_bvh;
+
+		/**
+		 The render queues of the camera being rendered by this renderer.
+		 */
+		RenderQueues m_camera_queues;
+
+		/**
+		 The render queues of the voxel grid of this renderer.
+		 */
+		RenderQueues m_voxel_queues;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Render Passes
 		//---------------------------------------------------------------------
@@ -295,6 +331,11 @@ namespace mage::rendering {
 													 swap_chain)),
 		m_state_manager(MakeUnique< StateManager >(device)),
 		m_world_buffer(device),
+		m_models(),
+		m_model_updates(),
+		m_world_bvh(),
+		m_camera_queues(),
+		m_voxel_queues(),
 		m_aa_pass(),
 		m_back_buffer_pass(),
 		m_bounding_volume_pass(),
@@ -377,9 +418,12 @@ namespace mage::rendering {
 		m_state_manager->BindPersistentState(m_device_context);
 	}
 
-	void Renderer::Impl::Render(const World& world, const GameTime& time) {
+	void Renderer::Impl::Render(const World& world, const GameTime& time,
+								JobSystem& job_system) {
+		MAGE_PROFILE_ZONE("Renderer::Impl::Render");
+
 		// Update the buffers.
-		UpdateBuffers(world, time);
+		UpdateBuffers(world, time, job_system);
 
 		// Bind the world buffer.
 		m_world_buffer.Bind< Pipeline >(m_device_context, SLOT_CBUFFER_WORLD);
@@ -421,10 +465,14 @@ namespace mage::rendering {
 	}
 
 	void Renderer::Impl::UpdateBuffers(const World& world,
-									   const GameTime& time) {
+									   const GameTime& time,
+									   JobSystem& job_system) {
 		// Update the world buffer.
 		UpdateWorldBuffer(time);
 
+		// Update the BVH of the world.
+		m_world_bvh.Update(world);
+
 		// Update the buffer of each camera.
 		world.ForEach< Camera >([this](const Camera& camera) {
 			if (State::Active == camera.GetState()) {
@@ -434,11 +482,46 @@ namespace mage::rendering {
 		});
 
 		// Update the buffer of each model.
+		UpdateModelBuffers(world, job_system);
+	}
+
+	void Renderer::Impl::UpdateModelBuffers(const World& world,
+											JobSystem& job_system) {
+		// Collect the active models. Transforms are evaluated lazily and
+		// share their cached matrices along the hierarchy, so they are
+		// brought up to date before packing in parallel.
+		m_models.clear();
 		world.ForEach< Model >([this](const Model& model) {
-			if (State::Active == model.GetState()) {
-				model.UpdateBuffer(m_device_context);
+			if (State::Active != model.GetState()) {
+				return;
 			}
+
+			const auto& transform = model.GetOwner()->GetTransform();
+			transform.GetObjectToWorldMatrix();
+			transform.GetWorldToObjectMatrix();
+
+			m_models.push_back(&model);
 		});
+
+		// Pack the buffer data of the models whose data changed.
+		m_model_updates.resize(m_models.size());
+		job_system.ParallelFor(0u, m_models.size(),
+							   [this](std::size_t begin, std::size_t end) noexcept {
+			for (auto i = begin; i < end; ++i) {
+				m_model_updates[i] = m_models[i]->PackBuffer();
+			}
+		}, 64u);
+
+		// Upload the changed buffers. Each model keeps its own constant buffer
+		// (bound per draw call by the passes) instead of sharing a single
+		// structured buffer updated with a single map: a static scene then
+		// uploads nothing at all, whereas a shared buffer would be mapped
+		// (and discarded) entirely as soon as a single model changes.
+		for (std::size_t i = 0u; i < m_models.size(); ++i) {
+			if (m_model_updates[i]) {
+				m_models[i]->UploadBuffer(m_device_context);
+			}
+		}
 	}
 
 	void Renderer::Impl::UpdateWorldBuffer(const GameTime& time) {
@@ -491,6 +574,8 @@ namespace mage::rendering {
 	}
 
 	void Renderer::Impl::Render(const World& world, const Camera& camera) {
+		MAGE_PROFILE_ZONE("Renderer::Impl::RenderCamera");
+
 		// Bind the camera to the pipeline.
 		camera.BindBuffer< Pipeline >(m_device_context,
 									  SLOT_CBUFFER_PRIMARY_CAMERA);
@@ -502,6 +587,9 @@ namespace mage::rendering {
 		const auto  camera_to_projection = camera.GetCameraToProjectionMatrix();
 		const auto  world_to_projection  = world_to_camera * camera_to_projection;
 
+		// Cull and bucket the models once for all passes of the camera.
+		m_camera_queues.Build(m_world_bvh.GetModels(), world_to_projection);
+
 		const auto  render_mode          = camera.GetSettings().GetRenderMode();
 
 		m_output_manager->BindBeginViewport(m_device_context);
@@ -532,88 +620,71 @@ namespace mage::rendering {
 		}
 
 		case RenderMode::FalseColor_BaseColor: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColor);
+			RenderFalseColor(camera, FalseColor::BaseColor);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorCoefficient);
+			RenderFalseColor(camera, FalseColor::BaseColorCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_BaseColorTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::BaseColorTexture);
+			RenderFalseColor(camera, FalseColor::BaseColorTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Material: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Material);
+			RenderFalseColor(camera, FalseColor::Material);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialCoefficient);
+			RenderFalseColor(camera, FalseColor::MaterialCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MaterialTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MaterialTexture);
+			RenderFalseColor(camera, FalseColor::MaterialTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Roughness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Roughness);
+			RenderFalseColor(camera, FalseColor::Roughness);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessCoefficient);
+			RenderFalseColor(camera, FalseColor::RoughnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_RoughnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::RoughnessTexture);
+			RenderFalseColor(camera, FalseColor::RoughnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_Metalness: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Metalness);
+			RenderFalseColor(camera, FalseColor::Metalness);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessCoefficient: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessCoefficient);
+			RenderFalseColor(camera, FalseColor::MetalnessCoefficient);
 			break;
 		}
 		case RenderMode::FalseColor_MetalnessTexture: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::MetalnessTexture);
+			RenderFalseColor(camera, FalseColor::MetalnessTexture);
 			break;
 		}
 		case RenderMode::FalseColor_ShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::ShadingNormal);
+			RenderFalseColor(camera, FalseColor::ShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_TSNMShadingNormal: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::TSNMShadingNormal);
+			RenderFalseColor(camera, FalseColor::TSNMShadingNormal);
 			break;
 		}
 		case RenderMode::FalseColor_Depth: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Depth);
+			RenderFalseColor(camera, FalseColor::Depth);
 			break;
 		}
 		case RenderMode::FalseColor_Distance: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::Distance);
+			RenderFalseColor(camera, FalseColor::Distance);
 			break;
 		}
 		case RenderMode::FalseColor_UV: {
-			RenderFalseColor(world, camera, world_to_projection,
-							 FalseColor::UV);
+			RenderFalseColor(camera, FalseColor::UV);
 			break;
 		}
 
@@ -633,7 +704,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		const auto& settings = camera.GetSettings();
 		if (settings.ContainsRenderLayer(RenderLayer::Wireframe)) {
-			m_forward_pass->RenderWireframe(world, world_to_projection);
+			m_forward_pass->RenderWireframe(m_camera_queues);
 		}
 		if (settings.ContainsRenderLayer(RenderLayer::AABB)) {
 			m_bounding_volume_pass->Render(world, world_to_projection);
@@ -666,16 +737,16 @@ namespace mage::rendering {
 				= VoxelizationSettings::GetWorldToVoxelMatrix();
 
 			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, m_world_bvh, world_to_projection);
 
 			const auto voxel_grid_resolution
 				= VoxelizationSettings::GetVoxelGridResolution();
 
-			m_voxelization_pass->Render(world, world_to_voxel,
-										voxel_grid_resolution);
+			m_voxel_queues.Build(m_world_bvh.GetModels(), world_to_voxel);
+			m_voxelization_pass->Render(m_voxel_queues, voxel_grid_resolution);
 		}
 		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, m_world_bvh, world_to_projection);
 		}
 
 		const Viewport viewport(camera.GetViewport(),
@@ -690,13 +761,14 @@ namespace mage::rendering {
 			const auto& transform            = camera.GetOwner()->GetTransform();
 			const auto  world_to_camera      = transform.GetWorldToObjectMatrix();
 			const auto  camera_to_projection = camera.GetCameraToProjectionMatrix();
-			m_depth_pass->Render(world, world_to_camera, camera_to_projection);
+			m_depth_pass->Render(m_camera_queues,
+								 world_to_camera, camera_to_projection);
 		}
 
 		//---------------------------------------------------------------------
 		// Forward: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->Render(world, world_to_projection,
+		m_forward_pass->Render(m_camera_queues,
 							   camera.GetSettings().GetBRDF(), vct);
 
 		//---------------------------------------------------------------------
@@ -707,7 +779,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
+		m_forward_pass->RenderTransparent(m_camera_queues,
 										  camera.GetSettings().GetBRDF(), vct);
 	}
 
@@ -725,16 +797,16 @@ namespace mage::rendering {
 				= VoxelizationSettings::GetWorldToVoxelMatrix();
 
 			// TODO: world_to_projection + world_to_voxel for culling
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, m_world_bvh, world_to_projection);
 
 			const auto voxel_grid_resolution
 				= VoxelizationSettings::GetVoxelGridResolution();
 
-			m_voxelization_pass->Render(world, world_to_voxel,
-										voxel_grid_resolution);
+			m_voxel_queues.Build(m_world_bvh.GetModels(), world_to_voxel);
+			m_voxelization_pass->Render(m_voxel_queues, voxel_grid_resolution);
 		}
 		else {
-			m_lbuffer_pass->Render(world, world_to_projection);
+			m_lbuffer_pass->Render(world, m_world_bvh, world_to_projection);
 		}
 
 		const Viewport viewport(camera.GetViewport(),
@@ -745,7 +817,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// GBuffer: opaque fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderGBuffer(world, world_to_projection);
+		m_forward_pass->RenderGBuffer(m_camera_queues);
 
 		m_output_manager->BindEndGBuffer(m_device_context);
 		m_output_manager->BindBeginDeferred(m_device_context);
@@ -767,7 +839,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: emissive fragments.
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderEmissive(world, world_to_projection);
+		m_forward_pass->RenderEmissive(m_camera_queues);
 
 		//---------------------------------------------------------------------
 		// Perform a sky pass.
@@ -777,7 +849,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward: transparent fragments
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderTransparent(world, world_to_projection,
+		m_forward_pass->RenderTransparent(m_camera_queues,
 										  camera.GetSettings().GetBRDF(), vct);
 	}
 
@@ -788,7 +860,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, m_world_bvh, world_to_projection);
 
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -798,13 +870,11 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderSolid(world, world_to_projection);
+		m_forward_pass->RenderSolid(m_camera_queues);
 	}
 
-	void XM_CALLCONV Renderer::Impl::RenderFalseColor(const World& world,
-													  const Camera& camera,
-													  FXMMATRIX world_to_projection,
-													  FalseColor false_color) {
+	void Renderer::Impl::RenderFalseColor(const Camera& camera,
+										  FalseColor false_color) {
 
 		const Viewport viewport(camera.GetViewport(),
 								m_display_configuration.get().GetAA());
@@ -814,7 +884,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// Forward
 		//---------------------------------------------------------------------
-		m_forward_pass->RenderFalseColor(world, world_to_projection, false_color);
+		m_forward_pass->RenderFalseColor(m_camera_queues, false_color);
 	}
 
 	void XM_CALLCONV Renderer::Impl::RenderVoxelGrid(const World& world,
@@ -824,7 +894,7 @@ namespace mage::rendering {
 		//---------------------------------------------------------------------
 		// LBuffer
 		//---------------------------------------------------------------------
-		m_lbuffer_pass->Render(world, world_to_projection);
+		m_lbuffer_pass->Render(world, m_world_bvh, world_to_projection);
 
 		//---------------------------------------------------------------------
 		// Voxelization
@@ -833,8 +903,8 @@ namespace mage::rendering {
 			= VoxelizationSettings::GetWorldToVoxelMatrix();
 		const auto voxel_grid_resolution
 			= VoxelizationSettings::GetVoxelGridResolution();
-		m_voxelization_pass->Render(world, world_to_voxel,
-									voxel_grid_resolution);
+		m_voxel_queues.Build(m_world_bvh.GetModels(), world_to_voxel);
+		m_voxelization_pass->Render(m_voxel_queues, voxel_grid_resolution);
 
 
 		const Viewport viewport(camera.GetViewport(),
@@ -947,8 +1017,9 @@ namespace mage::rendering {
 		m_impl->BindPersistentState();
 	}
 
-	void Renderer::Render(const World& world, const GameTime& time) {
-		m_impl->Render(world, time);
+	void Renderer::Render(const World& world, const GameTime& time,
+						  JobSystem& job_system) {
+		m_impl->Render(world, time, job_system);
 	}
 
 	#pragma endregion
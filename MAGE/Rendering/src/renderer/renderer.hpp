@@ -8,6 +8,7 @@
 #include "renderer\swap_chain.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
+#include "parallel\job_system.hpp"
 #include "system\game_timer.hpp"
 
 #pragma endregion
@@ -111,10 +112,13 @@ namespace mage::rendering {
 						A reference to the world.
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 @throws		Exception
 						Failed to render the world.
 		 */
-		void Render(const World& world, const GameTime& time);
+		void Render(const World& world, const GameTime& time,
+					JobSystem& job_system);
 
 	private:
 
@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\shadow_map_cache.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	ShadowMapCache::ShadowMapCache(std::size_t nb_shadow_maps_per_slot)
+		: m_nb_shadow_maps_per_slot(nb_shadow_maps_per_slot),
+		m_slots(),
+		m_entries(),
+		m_assigned_slots(),
+		m_taken_slots(),
+		m_guids(),
+		m_light_slots() {}
+
+	ShadowMapCache::ShadowMapCache(const ShadowMapCache& cache) = default;
+
+	ShadowMapCache::ShadowMapCache(ShadowMapCache&& cache) noexcept = default;
+
+	ShadowMapCache::~ShadowMapCache() = default;
+
+	ShadowMapCache& ShadowMapCache
+		::operator=(const ShadowMapCache& cache) = default;
+
+	ShadowMapCache& ShadowMapCache
+		::operator=(ShadowMapCache&& cache) noexcept = default;
+
+	void ShadowMapCache::Assign(const std::vector< U64 >& guids,
+								std::vector< std::size_t >& slots) {
+
+		const auto nb_slots = guids.size();
+
+		// Collect the slots in range.
+		m_assigned_slots.clear();
+		for (std::size_t i = 0u; i < std::min(nb_slots, m_slots.size()); ++i) {
+			if (m_slots[i].m_assigned) {
+				m_assigned_slots.emplace(m_slots[i].m_guid, i);
+			}
+		}
+
+		slots.assign(nb_slots, nb_slots);
+		m_taken_slots.assign(nb_slots, false);
+
+		// Keep the slots in range.
+		for (std::size_t i = 0u; i < nb_slots; ++i) {
+			const auto it = m_assigned_slots.find(guids[i]);
+			if (m_assigned_slots.cend() != it && !m_taken_slots[it->second]) {
+				slots[i] = it->second;
+				m_taken_slots[it->second] = true;
+			}
+		}
+
+		// Assign the remaining slots.
+		std::size_t free_slot = 0u;
+		for (auto& slot : slots) {
+			if (nb_slots != slot) {
+				continue;
+			}
+
+			while (m_taken_slots[free_slot]) {
+				++free_slot;
+			}
+			slot = free_slot;
+			m_taken_slots[free_slot] = true;
+		}
+
+		// Invalidate the shadow maps of the reassigned slots.
+		m_slots.resize(nb_slots);
+		m_entries.resize(nb_slots * m_nb_shadow_maps_per_slot);
+		for (std::size_t i = 0u; i < nb_slots; ++i) {
+			auto& slot = m_slots[slots[i]];
+			if (slot.m_assigned && guids[i] == slot.m_guid) {
+				continue;
+			}
+
+			slot.m_guid     = guids[i];
+			slot.m_assigned = true;
+
+			const auto first = slots[i] * m_nb_shadow_maps_per_slot;
+			for (std::size_t j = 0u; j < m_nb_shadow_maps_per_slot; ++j) {
+				m_entries[first + j].m_valid = false;
+			}
+		}
+	}
+
+	bool ShadowMapCache::Update(std::size_t index, U64 signature) {
+		if (m_entries.size() <= index) {
+			m_entries.resize(index + 1u);
+		}
+
+		auto& entry = m_entries[index];
+		if (entry.m_valid && signature == entry.m_signature) {
+			return false;
+		}
+
+		entry.m_signature = signature;
+		entry.m_valid     = true;
+		return true;
+	}
+
+	void ShadowMapCache::Invalidate() noexcept {
+		for (auto& entry : m_entries) {
+			entry.m_valid = false;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,273 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of shadow map caches.
+
+	 A shadow map cache assigns the shadow mapped lights to the slots of a
+	 shadow map buffer and keeps track of the signature of the content of each
+	 shadow map of these slots (i.e. one shadow map per slot for directional
+	 lights and spotlights, six shadow maps per slot for omni lights). A
+	 light keeps its slot across frames as long as this slot is in range, so
+	 lights entering or leaving the view do not invalidate the shadow maps of
+	 the other lights.
+
+	 The signature of a shadow map combines everything its content depends on
+	 (i.e. the transformation matrices of the light camera and the identity,
+	 transform version, mesh and base color texture of each shadow caster). A
+	 shadow map only needs to be re-rendered if its slot was assigned to
+	 another light or its signature changed since it was last rendered.
+
+	 Shadow map caches do not depend on any rendering API.
+	 */
+	class ShadowMapCache {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Combines the given signature with the given value.
+
+		 @param[in]		signature
+						The signature.
+		 @param[in]		value
+						The value.
+		 @return		The combination of the given signature with the given
+						value.
+		 */
+		[[nodiscard]]
+		static constexpr U64 Combine(U64 signature, U64 value) noexcept {
+			const auto hash = ((signature * 0xBF58476D1CE4E5B9ull) ^ value)
+				            * 0x94D049BB133111EBull;
+			return hash ^ (hash >> 31u);
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a shadow map cache.
+
+		 @param[in]		nb_shadow_maps_per_slot
+						The number of shadow maps per slot.
+		 */
+		explicit ShadowMapCache(std::size_t nb_shadow_maps_per_slot = 1u);
+
+		/**
+		 Constructs a shadow map cache from the given shadow map cache.
+
+		 @param[in]		cache
+						A reference to the shadow map cache to copy.
+		 */
+		ShadowMapCache(const ShadowMapCache& cache);
+
+		/**
+		 Constructs a shadow map cache by moving the given shadow map cache.
+
+		 @param[in]		cache
+						A reference to the shadow map cache to move.
+		 */
+		ShadowMapCache(ShadowMapCache&& cache) noexcept;
+
+		/**
+		 Destructs this shadow map cache.
+		 */
+		~ShadowMapCache();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shadow map cache to this shadow map cache.
+
+		 @param[in]		cache
+						A reference to the shadow map cache to copy.
+		 @return		A reference to the copy of the given shadow map cache
+						(i.e. this shadow map cache).
+		 */
+		ShadowMapCache& operator=(const ShadowMapCache& cache);
+
+		/**
+		 Moves the given shadow map cache to this shadow map cache.
+
+		 @param[in]		cache
+						A reference to the shadow map cache to move.
+		 @return		A reference to the moved shadow map cache (i.e. this
+						shadow map cache).
+		 */
+		ShadowMapCache& operator=(ShadowMapCache&& cache) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Assigns a slot to each of the given shadow mapped lights of this
+		 shadow map cache. The slots of the given lights are a permutation of
+		 [0, number of lights): a light keeps the slot it was last assigned if
+		 this slot is in range, the other lights get the remaining slots in
+		 increasing order.
+
+		 @param[in]		guids
+						A reference to a vector containing the guids of the
+						shadow mapped lights.
+		 @param[out]	slots
+						A reference to a vector containing the slot of each
+						shadow mapped light.
+		 */
+		void Assign(const std::vector< U64 >& guids,
+					std::vector< std::size_t >& slots);
+
+		/**
+		 Orders the given shadow mapped lights by the slots assigned by this
+		 shadow map cache.
+
+		 @tparam		LightT
+						The light type.
+		 @param[in,out]	lights
+						A reference to a vector containing pointers to the
+						shadow mapped lights.
+		 */
+		template< typename LightT >
+		void Arrange(std::vector< const LightT* >& lights) {
+			m_guids.clear();
+			for (const auto light : lights) {
+				m_guids.push_back(light->GetGuid());
+			}
+
+			Assign(m_guids, m_light_slots);
+
+			std::vector< const LightT* > arranged(lights.size());
+			for (std::size_t i = 0u; i < lights.size(); ++i) {
+				arranged[m_light_slots[i]] = lights[i];
+			}
+			lights = std::move(arranged);
+		}
+
+		/**
+		 Updates the signature of the shadow map at the given index of this
+		 shadow map cache.
+
+		 @param[in]		index
+						The index of the shadow map (i.e. the slot times the
+						number of shadow maps per slot plus the face).
+		 @param[in]		signature
+						The current signature of the shadow map.
+		 @return		@c true if the shadow map at the given index is
+						invalidated and needs to be re-rendered. @c false
+						otherwise.
+		 */
+		bool Update(std::size_t index, U64 signature);
+
+		/**
+		 Invalidates all shadow maps of this shadow map cache.
+		 */
+		void Invalidate() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of shadow map cache slots.
+		 */
+		struct Slot {
+
+		public:
+
+			/**
+			 The guid of the light of this slot.
+			 */
+			U64 m_guid = 0u;
+
+			/**
+			 A flag indicating whether this slot is assigned to a light.
+			 */
+			bool m_assigned = false;
+		};
+
+		/**
+		 A struct of shadow map cache entries.
+		 */
+		struct Entry {
+
+		public:
+
+			/**
+			 The signature of the shadow map of this entry.
+			 */
+			U64 m_signature = 0u;
+
+			/**
+			 A flag indicating whether the shadow map of this entry is valid.
+			 */
+			bool m_valid = false;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of shadow maps per slot of this shadow map cache.
+		 */
+		std::size_t m_nb_shadow_maps_per_slot;
+
+		/**
+		 The slots of this shadow map cache.
+		 */
+		std::vector< Slot > m_slots;
+
+		/**
+		 The entries (i.e. one per shadow map) of this shadow map cache.
+		 */
+		std::vector< Entry > m_entries;
+
+		/**
+		 The slot in range of each light of this shadow map cache while
+		 assigning slots.
+		 */
+		std::unordered_map< U64, std::size_t > m_assigned_slots;
+
+		/**
+		 Flags indicating which slots are taken while assigning slots.
+		 */
+		std::vector< bool > m_taken_slots;
+
+		/**
+		 The guids and slots of the lights being arranged.
+		 */
+		std::vector< U64 > m_guids;
+		std::vector< std::size_t > m_light_slots;
+	};
+}
\ No newline at end of file
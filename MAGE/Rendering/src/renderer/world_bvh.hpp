@@ -0,0 +1,346 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "scene\rendering_world.hpp"
+#include "geometry\bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	//-------------------------------------------------------------------------
+	// ComponentBVH
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of component BVHs.
+
+	 A component BVH is a BVH over the world-space AABBs of the active
+	 components of a given type of a world. Each update scans the components:
+	 if the set of active components changed, the BVH is rebuilt. Otherwise,
+	 only the world-space AABBs of the components whose transform or AABB
+	 changed are recomputed, and the BVH is refitted (or rebuilt, if
+	 refitting degraded the BVH too much).
+
+	 @tparam		ComponentT
+					The component type. It should define an equivalent of the
+					member method @code const AABB& GetAABB() const@endcode
+					returning its object-space AABB.
+	 */
+	template< typename ComponentT >
+	class ComponentBVH {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a component BVH.
+		 */
+		ComponentBVH() = default;
+
+		/**
+		 Constructs a component BVH from the given component BVH.
+
+		 @param[in]		bvh
+						A reference to the component BVH to copy.
+		 */
+		ComponentBVH(const ComponentBVH& bvh) = delete;
+
+		/**
+		 Constructs a component BVH by moving the given component BVH.
+
+		 @param[in]		bvh
+						A reference to the component BVH to move.
+		 */
+		ComponentBVH(ComponentBVH&& bvh) noexcept = default;
+
+		/**
+		 Destructs this component BVH.
+		 */
+		~ComponentBVH() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given component BVH to this component BVH.
+
+		 @param[in]		bvh
+						A reference to the component BVH to copy.
+		 @return		A reference to the copy of the given component BVH
+						(i.e. this component BVH).
+		 */
+		ComponentBVH& operator=(const ComponentBVH& bvh) = delete;
+
+		/**
+		 Moves the given component BVH to this component BVH.
+
+		 @param[in]		bvh
+						A reference to the component BVH to move.
+		 @return		A reference to the moved component BVH (i.e. this
+						component BVH).
+		 */
+		ComponentBVH& operator=(ComponentBVH&& bvh) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates this component BVH for the given world.
+
+		 @param[in]		world
+						A reference to the world.
+		 */
+		void Update(const World& world);
+
+		/**
+		 Applies the given action to each component of this component BVH
+		 whose world-space AABB is not culled by the given bounding frustum.
+
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(const ComponentT&)@endcode.
+		 @param[in]		frustum
+						A reference to the bounding frustum (expressed in
+						world space coordinates).
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ActionT >
+		void ForEach(const BoundingFrustum& frustum, ActionT&& action) const {
+			m_bvh.ForEach(frustum, [this, &action](U32 index) {
+				action(*m_entries[index].m_component);
+			});
+		}
+
+		/**
+		 Applies the given action to each component of this component BVH
+		 whose world-space AABB overlaps the given bounding sphere.
+
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(const ComponentT&)@endcode.
+		 @param[in]		sphere
+						A reference to the bounding sphere (expressed in world
+						space coordinates).
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ActionT >
+		void ForEach(const BoundingSphere& sphere, ActionT&& action) const {
+			m_bvh.ForEach(sphere, [this, &action](U32 index) {
+				action(*m_entries[index].m_component);
+			});
+		}
+
+		/**
+		 Applies the given action to each component of this component BVH
+		 whose world-space AABB is intersected by the given ray segment.
+
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(const ComponentT&)@endcode.
+		 @param[in]		origin
+						The origin of the ray (expressed in world space
+						coordinates).
+		 @param[in]		direction
+						The direction of the ray (expressed in world space
+						coordinates).
+		 @param[in]		max_distance
+						The maximum distance along the ray (expressed in units
+						of @a direction).
+		 @param[in]		action
+						A reference to the action.
+		 */
+		template< typename ActionT >
+		void XM_CALLCONV ForEach(FXMVECTOR origin,
+								 FXMVECTOR direction,
+								 F32 max_distance,
+								 ActionT&& action) const {
+			m_bvh.ForEach(origin, direction, max_distance,
+						  [this, &action](U32 index) {
+				action(*m_entries[index].m_component);
+			});
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of component BVH entries.
+		 */
+		struct Entry {
+
+		public:
+
+			/**
+			 The object-space AABB of the component of this entry.
+			 */
+			AABB m_aabb;
+
+			/**
+			 A pointer to the component of this entry.
+			 */
+			const ComponentT* m_component = nullptr;
+
+			/**
+			 The guid of the component of this entry.
+			 */
+			U64 m_guid = 0u;
+
+			/**
+			 A pointer to the transform of the component of this entry.
+			 */
+			const Transform* m_transform = nullptr;
+
+			/**
+			 The version of the transform of the component of this entry.
+			 */
+			U64 m_version = 0u;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum ratio of the SAH cost of a refitted BVH to its SAH cost
+		 at the time it was built. BVHs exceeding this ratio are rebuilt.
+		 */
+		static constexpr F32 s_max_cost_ratio = 1.5f;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The entries of this component BVH.
+		 */
+		AlignedVector< Entry > m_entries;
+
+		/**
+		 The world-space AABBs of the entries of this component BVH.
+		 */
+		AlignedVector< AABB > m_aabbs;
+
+		/**
+		 The BVH of this component BVH.
+		 */
+		BVH m_bvh;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// WorldBVH
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of world BVHs.
+
+	 A world BVH contains a component BVH for the models, omni lights and
+	 spotlights of a world (i.e. the components with a bounded extent).
+	 */
+	class WorldBVH {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Updates this world BVH for the given world.
+
+		 @param[in]		world
+						A reference to the world.
+		 */
+		void Update(const World& world) {
+			m_models.Update(world);
+			m_omni_lights.Update(world);
+			m_spot_lights.Update(world);
+		}
+
+		/**
+		 Returns the component BVH of the models of this world BVH.
+
+		 @return		A reference to the component BVH of the models of
+						this world BVH.
+		 */
+		[[nodiscard]]
+		const ComponentBVH< Model >& GetModels() const noexcept {
+			return m_models;
+		}
+
+		/**
+		 Returns the component BVH of the omni lights of this world BVH.
+
+		 @return		A reference to the component BVH of the omni lights
+						of this world BVH.
+		 */
+		[[nodiscard]]
+		const ComponentBVH< OmniLight >& GetOmniLights() const noexcept {
+			return m_omni_lights;
+		}
+
+		/**
+		 Returns the component BVH of the spotlights of this world BVH.
+
+		 @return		A reference to the component BVH of the spotlights of
+						this world BVH.
+		 */
+		[[nodiscard]]
+		const ComponentBVH< SpotLight >& GetSpotLights() const noexcept {
+			return m_spot_lights;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The component BVH of the models of this world BVH.
+		 */
+		ComponentBVH< Model > m_models;
+
+		/**
+		 The component BVH of the omni lights of this world BVH.
+		 */
+		ComponentBVH< OmniLight > m_omni_lights;
+
+		/**
+		 The component BVH of the spotlights of this world BVH.
+		 */
+		ComponentBVH< SpotLight > m_spot_lights;
+	};
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\world_bvh.tpp"
+
+#pragma endregion
\ No newline at end of file
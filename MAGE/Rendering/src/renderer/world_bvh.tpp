@@ -0,0 +1,71 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	template< typename ComponentT >
+	void ComponentBVH< ComponentT >::Update(const World& world) {
+		auto rebuild = false;
+		auto refit   = false;
+		std::size_t index = 0u;
+
+		world.ForEach< ComponentT >([this, &rebuild, &refit, &index]
+		(const ComponentT& component) {
+
+			if (State::Active != component.GetState()) {
+				return;
+			}
+
+			if (m_entries.size() == index) {
+				m_entries.emplace_back();
+				m_aabbs.emplace_back();
+			}
+
+			auto& entry = m_entries[index];
+			auto& aabb  = m_aabbs[index];
+			++index;
+
+			const auto& transform = component.GetOwner()->GetTransform();
+			const auto  version   = transform.GetVersion();
+			const auto  same      = (&component == entry.m_component
+								  && component.GetGuid() == entry.m_guid);
+
+			if (same && &transform == entry.m_transform
+				&& version == entry.m_version
+				&& component.GetAABB() == entry.m_aabb) {
+				return;
+			}
+
+			rebuild = rebuild || !same;
+			refit   = true;
+
+			entry.m_aabb      = component.GetAABB();
+			entry.m_component = &component;
+			entry.m_guid      = component.GetGuid();
+			entry.m_transform = &transform;
+			entry.m_version   = version;
+
+			aabb = AABB::Transform(entry.m_aabb,
+								   transform.GetObjectToWorldMatrix());
+		});
+
+		if (index < m_entries.size()) {
+			m_entries.resize(index);
+			m_aabbs.resize(index);
+			rebuild = true;
+		}
+
+		if (rebuild) {
+			m_bvh.Build(m_aabbs.data(), m_aabbs.size());
+		}
+		else if (refit) {
+			m_bvh.Refit(m_aabbs.data());
+
+			if (s_max_cost_ratio * m_bvh.GetBuildCost() < m_bvh.GetCost()) {
+				m_bvh.Build(m_aabbs.data(), m_aabbs.size());
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "renderer\renderer.hpp"
 #include "imgui_impl_dx11.h"
 #include "imgui_impl_win32.h"
+#include "system\profiler.hpp"
 
 #pragma endregion
 
@@ -16,6 +17,8 @@
 namespace mage::rendering {
 
 	U32 Pipeline::s_nb_draws = 0u;
+	U32 Pipeline::s_nb_shadow_casters = 0u;
+	U32 Pipeline::s_nb_binds = 0u;
 
 	//-------------------------------------------------------------------------
 	// Manager::Impl
@@ -169,10 +172,12 @@ namespace mage::rendering {
 
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 @throws		Exception
 						Failed to render the world of this rendering manager.
 		 */
-		void Render(const GameTime& time);
+		void Render(const GameTime& time, JobSystem& job_system);
 
 	private:
 
@@ -371,15 +376,21 @@ namespace mage::rendering {
 	}
 
 	void Manager::Impl::Update() {
+		m_resource_manager->Update();
+
 		ImGui_ImplDX11_NewFrame();
 		ImGui_ImplWin32_NewFrame();
 		ImGui::NewFrame();
 	}
 
-	void Manager::Impl::Render(const GameTime& time) {
+	void Manager::Impl::Render(const GameTime& time, JobSystem& job_system) {
+		MAGE_PROFILE_ZONE("rendering::Manager::Render");
+
 		m_swap_chain->Clear();
 		Pipeline::s_nb_draws = 0u;
-		m_renderer->Render(GetWorld(), time);
+		Pipeline::s_nb_shadow_casters = 0u;
+		Pipeline::s_nb_binds = 0u;
+		m_renderer->Render(GetWorld(), time, job_system);
 
 		m_swap_chain->Present();
 	}
@@ -435,8 +446,8 @@ namespace mage::rendering {
 		m_impl->Update();
 	}
 
-	void Manager::Render(const GameTime& time) {
-		m_impl->Render(time);
+	void Manager::Render(const GameTime& time, JobSystem& job_system) {
+		m_impl->Render(time, job_system);
 	}
 
 	#pragma endregion
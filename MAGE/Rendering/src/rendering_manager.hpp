@@ -8,6 +8,7 @@
 #include "renderer\swap_chain.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\rendering_world.hpp"
+#include "parallel\job_system.hpp"
 #include "system\game_timer.hpp"
 
 #pragma endregion
@@ -152,10 +153,12 @@ namespace mage::rendering {
 
 		 @param[in]		time
 						A reference to the game time.
+		 @param[in,out]	job_system
+						A reference to the job system.
 		 @throws		Exception
 						Failed to render the world of this rendering manager.
 		 */
-		void Render(const GameTime& time);
+		void Render(const GameTime& time, JobSystem& job_system);
 
 	private:
 
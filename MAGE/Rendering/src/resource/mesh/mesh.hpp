@@ -198,6 +198,35 @@ namespace mage::rendering {
 				                  static_cast< U32 >(start_index));
 		}
 
+		/**
+		 Draws instances of a submesh of this mesh.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		start_index
+						The start index.
+		 @param[in]		nb_indices
+						The number of indices.
+		 @param[in]		nb_instances
+						The number of instances.
+		 @param[in]		instance_start
+						The index of the first instance in the per-instance
+						vertex buffers.
+		 */
+		void DrawInstanced(ID3D11DeviceContext& device_context,
+						   std::size_t start_index,
+						   std::size_t nb_indices,
+						   std::size_t nb_instances,
+						   std::size_t instance_start) const noexcept {
+
+			Pipeline::DrawIndexedInstanced(device_context,
+				                           static_cast< U32 >(nb_indices),
+				                           static_cast< U32 >(nb_instances),
+				                           static_cast< U32 >(start_index),
+				                           0u,
+				                           static_cast< U32 >(instance_start));
+		}
+
 	protected:
 
 		//---------------------------------------------------------------------
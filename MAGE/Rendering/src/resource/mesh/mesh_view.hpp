@@ -0,0 +1,156 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\memory_mapped_file.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of read-only mesh views.
+
+	 The vertices and indices of a mesh view are not owned by the mesh view,
+	 but reside in place in a memory-mapped file. The memory-mapped file is
+	 kept alive for at least as long as the mesh view is alive.
+
+	 @tparam		VertexT
+					The vertex type.
+	 @tparam		IndexT
+					The index type.
+	 */
+	template< typename VertexT, typename IndexT >
+	class MeshView {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an empty mesh view.
+		 */
+		MeshView() noexcept
+			: m_file(),
+			m_vertices(),
+			m_indices() {}
+
+		/**
+		 Constructs a mesh view.
+
+		 @pre			The given vertices and indices reside in the given
+						memory-mapped file.
+		 @param[in]		file
+						A pointer to the memory-mapped file.
+		 @param[in]		vertices
+						The vertices.
+		 @param[in]		indices
+						The indices.
+		 */
+		explicit MeshView(SharedPtr< const MemoryMappedFile > file,
+						  gsl::span< const VertexT > vertices,
+						  gsl::span< const IndexT > indices) noexcept
+			: m_file(std::move(file)),
+			m_vertices(vertices),
+			m_indices(indices) {}
+
+		/**
+		 Constructs a mesh view from the given mesh view.
+
+		 @param[in]		mesh_view
+						A reference to the mesh view to copy.
+		 */
+		MeshView(const MeshView& mesh_view) noexcept = default;
+
+		/**
+		 Constructs a mesh view by moving the given mesh view.
+
+		 @param[in]		mesh_view
+						A reference to the mesh view to move.
+		 */
+		MeshView(MeshView&& mesh_view) noexcept = default;
+
+		/**
+		 Destructs this mesh view.
+		 */
+		~MeshView() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given mesh view to this mesh view.
+
+		 @param[in]		mesh_view
+						A reference to the mesh view to copy.
+		 @return		A reference to the copy of the given mesh view (i.e.
+						this mesh view).
+		 */
+		MeshView& operator=(const MeshView& mesh_view) noexcept = default;
+
+		/**
+		 Moves the given mesh view to this mesh view.
+
+		 @param[in]		mesh_view
+						A reference to the mesh view to move.
+		 @return		A reference to the moved mesh view (i.e. this mesh
+						view).
+		 */
+		MeshView& operator=(MeshView&& mesh_view) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the vertices of this mesh view.
+
+		 @return		The vertices of this mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const VertexT > GetVertices() const noexcept {
+			return m_vertices;
+		}
+
+		/**
+		 Returns the indices of this mesh view.
+
+		 @return		The indices of this mesh view.
+		 */
+		[[nodiscard]]
+		gsl::span< const IndexT > GetIndices() const noexcept {
+			return m_indices;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the memory-mapped file containing the vertices and
+		 indices of this mesh view.
+		 */
+		SharedPtr< const MemoryMappedFile > m_file;
+
+		/**
+		 The vertices of this mesh view.
+		 */
+		gsl::span< const VertexT > m_vertices;
+
+		/**
+		 The indices of this mesh view.
+		 */
+		gsl::span< const IndexT > m_indices;
+	};
+}
\ No newline at end of file
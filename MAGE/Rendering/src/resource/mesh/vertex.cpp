@@ -17,6 +17,9 @@ namespace mage::rendering {
 		constexpr const_zstring g_vertex_semantic_name_normal   = "NORMAL";
 		constexpr const_zstring g_vertex_semantic_name_position = "POSITION";
 		constexpr const_zstring g_vertex_semantic_name_texture  = "TEXCOORD";
+
+		constexpr const_zstring g_instance_semantic_name_object_to_world = "OBJECT_TO_WORLD";
+		constexpr const_zstring g_instance_semantic_name_normal_to_world = "NORMAL_TO_WORLD";
 	}
 
 	const D3D11_INPUT_ELEMENT_DESC VertexPosition::s_input_element_descs[] = {
@@ -50,6 +53,20 @@ namespace mage::rendering {
 		{ g_vertex_semantic_name_texture,  0u, DXGI_FORMAT_R32G32_FLOAT,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u }
 	};
 
+	const D3D11_INPUT_ELEMENT_DESC VertexPositionNormalTexture::s_instanced_input_element_descs[] = {
+		{ g_vertex_semantic_name_position, 0u, DXGI_FORMAT_R32G32B32_FLOAT,    0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
+		{ g_vertex_semantic_name_normal,   0u, DXGI_FORMAT_R32G32B32_FLOAT,    0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
+		{ g_vertex_semantic_name_texture,  0u, DXGI_FORMAT_R32G32_FLOAT,       0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
+		{ g_instance_semantic_name_object_to_world, 0u, DXGI_FORMAT_R32G32B32A32_FLOAT, 1u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+		{ g_instance_semantic_name_object_to_world, 1u, DXGI_FORMAT_R32G32B32A32_FLOAT, 1u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+		{ g_instance_semantic_name_object_to_world, 2u, DXGI_FORMAT_R32G32B32A32_FLOAT, 1u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+		{ g_instance_semantic_name_object_to_world, 3u, DXGI_FORMAT_R32G32B32A32_FLOAT, 1u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+		{ g_instance_semantic_name_normal_to_world, 0u, DXGI_FORMAT_R32G32B32A32_FLOAT, 1u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+		{ g_instance_semantic_name_normal_to_world, 1u, DXGI_FORMAT_R32G32B32A32_FLOAT, 1u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+		{ g_instance_semantic_name_normal_to_world, 2u, DXGI_FORMAT_R32G32B32A32_FLOAT, 1u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u },
+		{ g_instance_semantic_name_normal_to_world, 3u, DXGI_FORMAT_R32G32B32A32_FLOAT, 1u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1u }
+	};
+
 	const D3D11_INPUT_ELEMENT_DESC VertexPositionColorTexture::s_input_element_descs[] = {
 		{ g_vertex_semantic_name_position, 0u, DXGI_FORMAT_R32G32B32_FLOAT,    0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
 		{ g_vertex_semantic_name_color,    0u, DXGI_FORMAT_R32G32B32A32_FLOAT, 0u, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0u },
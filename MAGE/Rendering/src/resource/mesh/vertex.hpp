@@ -485,6 +485,13 @@ namespace mage::rendering {
 		 The input element descriptors of a vertex.
 		 */
 		static const D3D11_INPUT_ELEMENT_DESC s_input_element_descs[3u];
+
+		/**
+		 The input element descriptors of a vertex followed by the input
+		 element descriptors of the per-instance object-to-world and
+		 normal-to-world matrices (input slot 1).
+		 */
+		static const D3D11_INPUT_ELEMENT_DESC s_instanced_input_element_descs[11u];
 	};
 
 	static_assert(32u == sizeof(VertexPositionNormalTexture),
@@ -271,6 +271,23 @@ namespace mage::rendering {
 			m_normal_texture = std::move(normal_texture);
 		}
 
+		/**
+		 Checks whether this material has the same shader resource views as
+		 the given material (i.e. whether both materials can be rendered
+		 without rebinding textures).
+
+		 @param[in]		material
+						A reference to the material.
+		 @return		@c true if this material has the same shader resource
+						views as the given material. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasSameSRVs(const Material& material) const noexcept {
+			return m_base_color_texture == material.m_base_color_texture
+				&& m_material_texture   == material.m_material_texture
+				&& m_normal_texture     == material.m_normal_texture;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Opacity/Transparency
 		//---------------------------------------------------------------------
@@ -63,6 +63,27 @@ namespace mage::rendering {
 								 desc = MeshDescriptor< VertexT, IndexT >(),
 								 bool export_as_MDL = false);
 
+		/**
+		 Constructs a model descriptor from the given imported model.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		buffer
+						A reference to the model output to move.
+		 @throws		Exception
+						Failed to initialize the model descriptor.
+		 */
+		template< typename VertexT, typename IndexT >
+		explicit ModelDescriptor(ID3D11Device& device,
+								 std::wstring fname,
+								 ModelOutput< VertexT, IndexT >&& buffer);
+
 		/**
 		 Constructs a model descriptor from the given model descriptor.
 
@@ -168,6 +189,29 @@ namespace mage::rendering {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Initializes the mesh, materials and model parts of this model
+		 descriptor from the given imported model.
+
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in,out]	device
+						A reference to the device.
+		 @param[in]		buffer
+						A reference to the model output to move.
+		 @throws		Exception
+						Failed to create the mesh.
+		 */
+		template< typename VertexT, typename IndexT >
+		void InitializeModel(ID3D11Device& device,
+							 ModelOutput< VertexT, IndexT >&& buffer);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -26,6 +26,25 @@ namespace mage::rendering {
 			loader::ExportModelToFile(mdl_path, buffer);
 		}
 
+		InitializeModel(device, std::move(buffer));
+	}
+
+	template< typename VertexT, typename IndexT >
+	ModelDescriptor::ModelDescriptor(ID3D11Device& device,
+									 std::wstring fname,
+									 ModelOutput< VertexT, IndexT >&& buffer)
+		: Resource< ModelDescriptor >(std::move(fname)),
+		m_mesh(),
+		m_materials(),
+		m_model_parts() {
+
+		InitializeModel(device, std::move(buffer));
+	}
+
+	template< typename VertexT, typename IndexT >
+	void ModelDescriptor::InitializeModel(ID3D11Device& device,
+										  ModelOutput< VertexT, IndexT >&& buffer) {
+
 		m_mesh = MakeShared< StaticMesh< VertexT, IndexT > >(
 			               device,
 			               std::move(buffer.m_vertex_buffer),
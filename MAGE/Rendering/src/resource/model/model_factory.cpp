@@ -0,0 +1,71 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\model\model_factory.hpp"
+#include "resource\mesh\vertex.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_GUID_MODEL_PLACEHOLDER	L"mage_placeholder_model"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	ModelDescriptorPtr CreatePlaceholderModel(ResourceManager& resource_manager) {
+		// The normal and the two tangent axes of each face of the cube. The
+		// faces are clockwise when viewed from the outside.
+		static const F32x3 s_faces[6u][3u] = {
+			{ F32x3( 1.0f,  0.0f,  0.0f), F32x3( 0.0f,  0.0f,  1.0f), F32x3( 0.0f,  1.0f,  0.0f) },
+			{ F32x3(-1.0f,  0.0f,  0.0f), F32x3( 0.0f,  0.0f, -1.0f), F32x3( 0.0f,  1.0f,  0.0f) },
+			{ F32x3( 0.0f,  1.0f,  0.0f), F32x3( 1.0f,  0.0f,  0.0f), F32x3( 0.0f,  0.0f,  1.0f) },
+			{ F32x3( 0.0f, -1.0f,  0.0f), F32x3( 1.0f,  0.0f,  0.0f), F32x3( 0.0f,  0.0f, -1.0f) },
+			{ F32x3( 0.0f,  0.0f,  1.0f), F32x3(-1.0f,  0.0f,  0.0f), F32x3( 0.0f,  1.0f,  0.0f) },
+			{ F32x3( 0.0f,  0.0f, -1.0f), F32x3( 1.0f,  0.0f,  0.0f), F32x3( 0.0f,  1.0f,  0.0f) }
+		};
+		static const F32x2 s_corners[4u] = {
+			F32x2(-1.0f, -1.0f), F32x2(-1.0f,  1.0f),
+			F32x2( 1.0f,  1.0f), F32x2( 1.0f, -1.0f)
+		};
+
+		ModelOutput< VertexPositionNormalTexture, U32 > buffer;
+		for (const auto& face : s_faces) {
+			const auto n = XMLoad(face[0u]);
+			const auto u = XMLoad(face[1u]);
+			const auto v = XMLoad(face[2u]);
+			const auto first = static_cast< U32 >(buffer.m_vertex_buffer.size());
+
+			for (const auto& corner : s_corners) {
+				const auto p = 0.5f * (n + corner[0u] * u + corner[1u] * v);
+				buffer.m_vertex_buffer.push_back({
+					Point3(XMStore< F32x3 >(p)),
+					Normal3(face[0u]),
+					UV(0.5f + 0.5f * corner[0u], 0.5f - 0.5f * corner[1u])
+				});
+			}
+
+			for (const U32 index : { 0u, 1u, 2u, 0u, 2u, 3u }) {
+				buffer.m_index_buffer.push_back(first + index);
+			}
+		}
+
+		// A single model part with the default material.
+		ModelPart model_part;
+		model_part.m_nb_indices = static_cast< U32 >(buffer.m_index_buffer.size());
+		buffer.AddModelPart(std::move(model_part));
+		buffer.ComputeBoundingVolumes();
+
+		return resource_manager.GetOrCreate< ModelDescriptor >(
+			MAGE_GUID_MODEL_PLACEHOLDER, std::move(buffer));
+	}
+}
\ No newline at end of file
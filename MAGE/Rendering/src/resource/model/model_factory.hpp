@@ -0,0 +1,28 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\rendering_resource_manager.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 Creates a placeholder model descriptor (i.e. a unit cube with the default
+	 material).
+
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the model descriptor.
+	 @throws		Exception
+					Failed to create the model descriptor.
+	 */
+	ModelDescriptorPtr CreatePlaceholderModel(ResourceManager& resource_manager);
+}
\ No newline at end of file
@@ -4,6 +4,9 @@
 #pragma region
 
 #include "resource\rendering_resource_manager.hpp"
+#include "resource\texture\texture_factory.hpp"
+#include "loaders\texture_loader.hpp"
+#include "io\binary_reader.hpp"
 
 #pragma endregion
 
@@ -12,6 +15,14 @@
 //-----------------------------------------------------------------------------
 namespace mage::rendering {
 
+	namespace {
+
+		/**
+		 The time budget per update for creating streamed resources.
+		 */
+		constexpr TimeIntervalSeconds g_streaming_budget(0.002);
+	}
+
 	ResourceManager::ResourceManager(ID3D11Device& device)
 		: m_device(device),
 		m_model_descriptor_pool(),
@@ -22,9 +33,93 @@ namespace mage::rendering {
 		m_ps_pool(),
 		m_cs_pool(),
 		m_sprite_font_pool(),
-		m_texture_pool() {}
+		m_texture_pool(),
+		m_streaming_mutex(),
+		m_model_requests(),
+		m_placeholder_texture(),
+		m_streamer(MakeUnique< ResourceStreamer >()) {
 
-	ResourceManager::ResourceManager(ResourceManager&& manager) noexcept = default;
+		m_placeholder_texture = CreateWhiteTexture(*this);
+	}
 
 	ResourceManager::~ResourceManager() = default;
-}
+
+	void ResourceManager::Update() {
+		m_streamer->Update(g_streaming_budget);
+	}
+
+	std::vector< ResourceManager::ModelCallback >
+		ResourceManager::EndModelRequest(const std::wstring& fname) {
+
+		const std::lock_guard< std::mutex > lock(m_streaming_mutex);
+
+		const auto it = m_model_requests.find(fname);
+		auto callbacks = std::move(it->second.m_callbacks);
+		m_model_requests.erase(it);
+
+		return callbacks;
+	}
+
+	TexturePtr ResourceManager::StreamTexture(const std::wstring& fname) {
+		auto& pool = GetPool< Texture >();
+		const key_type< Texture > key(fname);
+
+		SharedPtr< const Texture > texture;
+		{
+			// Only the first request of a texture streams the texture.
+			const std::lock_guard< std::mutex > lock(m_streaming_mutex);
+
+			if (auto resource = pool.Get(key); resource) {
+				return resource;
+			}
+
+			texture = pool.GetOrCreate(key, key, *m_placeholder_texture);
+		}
+
+		if (texture->Get() != m_placeholder_texture->Get()) {
+			// The texture has been created synchronously in the meantime.
+			return texture;
+		}
+
+		// The resource pool creates non-const textures
+		// => const_cast is safe.
+		auto target = std::const_pointer_cast< Texture >(texture);
+
+		m_streamer->Load([this, target]() {
+			const auto path = target->GetPath();
+
+			// Read the texture file on this worker thread.
+			UniquePtr< U8[] > data;
+			std::size_t size = 0u;
+			try {
+				ReadBinaryFile(path, data, size);
+			}
+			catch (const std::exception& e) {
+				Warning("{}: texture streaming failed: {}", path, e.what());
+				return;
+			}
+
+			const SharedPtr< const U8[] > shared_data(std::move(data));
+
+			// Create the texture on the rendering thread.
+			m_streamer->Create([this, target, path, shared_data, size]() {
+				ComPtr< ID3D11ShaderResourceView > texture_srv;
+				try {
+					loader::ImportTextureFromMemory(
+						path, gsl::span< const U8 >(shared_data.get(), size),
+						m_device,
+						NotNull< ID3D11ShaderResourceView** >(
+							texture_srv.ReleaseAndGetAddressOf()));
+				}
+				catch (const std::exception& e) {
+					Warning("{}: texture streaming failed: {}", path, e.what());
+					return;
+				}
+
+				target->Set(std::move(texture_srv));
+			});
+		});
+
+		return texture;
+	}
+}
\ No newline at end of file
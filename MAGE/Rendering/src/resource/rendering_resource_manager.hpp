@@ -9,6 +9,19 @@
 #include "resource\model\model_descriptor.hpp"
 #include "resource\shader\shader.hpp"
 #include "resource\font\sprite_font.hpp"
+#include "resource\resource_streamer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <future>
+#include <unordered_map>
+#include <vector>
 
 #pragma endregion
 
@@ -141,7 +154,7 @@ namespace mage::rendering {
 		 @param[in]		manager
 						A reference to the resource manager to move.
 		 */
-		ResourceManager(ResourceManager&& manager) noexcept;
+		ResourceManager(ResourceManager&& manager) = delete;
 
 		/**
 		 Destructs this resource manager.
@@ -240,12 +253,34 @@ namespace mage::rendering {
 											 bool export_as_MDL = false);
 
 		/**
-		 Creates a vertex shader (if not existing).
+		 Creates a model descriptor (if not existing).
 
 		 @tparam		ResourceT
 						The resource type.
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
 		 @param[in]		guid
 						The globally unique identifier.
+		 @param[in]		buffer
+						A reference to the model output to move.
+		 @return		A pointer to the model descriptor.
+		 @throws		Exception
+						Failed to create the model descriptor.
+		 */
+		template< typename ResourceT, typename VertexT, typename IndexT >
+		typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+			ModelDescriptorPtr > GetOrCreate(const std::wstring& guid,
+											 ModelOutput< VertexT, IndexT >&& buffer);
+
+		/**
+		 Creates a vertex shader (if not existing).
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		guid
+						The hashed globally unique identifier.
 		 @param[in]		compiled_shader
 						A reference to the compiled vertex shader.
 		 @param[in]		input_element_descs
@@ -256,7 +291,7 @@ namespace mage::rendering {
 		 */
 		template< typename ResourceT >
 		typename std::enable_if_t< std::is_same_v< VertexShader, ResourceT >,
-			VertexShaderPtr > GetOrCreate(const std::wstring& guid,
+			VertexShaderPtr > GetOrCreate(HashedWStringView guid,
 										  const CompiledShader& compiled_shader,
 										  gsl::span< const D3D11_INPUT_ELEMENT_DESC >
 										  input_element_descs);
@@ -267,7 +302,7 @@ namespace mage::rendering {
 		 @tparam		ResourceT
 						The resource type.
 		 @param[in]		guid
-						The globally unique identifier.
+						The hashed globally unique identifier.
 		 @param[in]		compiled_shader
 						A reference to the compiled shader.
 		 @return		A pointer to the hull shader.
@@ -276,7 +311,7 @@ namespace mage::rendering {
 		 */
 		template< typename ResourceT >
 		typename std::enable_if_t< std::is_same_v< HullShader, ResourceT >,
-			HullShaderPtr > GetOrCreate(const std::wstring& guid,
+			HullShaderPtr > GetOrCreate(HashedWStringView guid,
 										const CompiledShader& compiled_shader);
 
 		/**
@@ -285,7 +320,7 @@ namespace mage::rendering {
 		 @tparam		ResourceT
 						The resource type.
 		 @param[in]		guid
-						The globally unique identifier.
+						The hashed globally unique identifier.
 		 @param[in]		compiled_shader
 						A reference to the compiled shader.
 		 @return		A pointer to the domain shader.
@@ -294,7 +329,7 @@ namespace mage::rendering {
 		 */
 		template< typename ResourceT >
 		typename std::enable_if_t< std::is_same_v< DomainShader, ResourceT >,
-			DomainShaderPtr > GetOrCreate(const std::wstring& guid,
+			DomainShaderPtr > GetOrCreate(HashedWStringView guid,
 										  const CompiledShader& compiled_shader);
 
 		/**
@@ -303,7 +338,7 @@ namespace mage::rendering {
 		 @tparam		ResourceT
 						The resource type.
 		 @param[in]		guid
-						The globally unique identifier.
+						The hashed globally unique identifier.
 		 @param[in]		compiled_shader
 						A reference to the compiled shader.
 		 @return		A pointer to the geometry shader.
@@ -312,7 +347,7 @@ namespace mage::rendering {
 		 */
 		template< typename ResourceT >
 		typename std::enable_if_t< std::is_same_v< GeometryShader, ResourceT >,
-			GeometryShaderPtr > GetOrCreate(const std::wstring& guid,
+			GeometryShaderPtr > GetOrCreate(HashedWStringView guid,
 											const CompiledShader& compiled_shader);
 
 		/**
@@ -321,7 +356,7 @@ namespace mage::rendering {
 		 @tparam		ResourceT
 						The resource type.
 		 @param[in]		guid
-						The globally unique identifier.
+						The hashed globally unique identifier.
 		 @param[in]		compiled_shader
 						A reference to the compiled shader.
 		 @return		A pointer to the pixel shader.
@@ -330,7 +365,7 @@ namespace mage::rendering {
 		 */
 		template< typename ResourceT >
 		typename std::enable_if_t< std::is_same_v< PixelShader, ResourceT >,
-			PixelShaderPtr > GetOrCreate(const std::wstring& guid,
+			PixelShaderPtr > GetOrCreate(HashedWStringView guid,
 										 const CompiledShader& compiled_shader);
 
 		/**
@@ -339,7 +374,7 @@ namespace mage::rendering {
 		 @tparam		ResourceT
 						The resource type.
 		 @param[in]		guid
-						The globally unique identifier.
+						The hashed globally unique identifier.
 		 @param[in]		compiled_shader
 						A reference to the compiled shader.
 		 @return		A pointer to the hull shader.
@@ -348,7 +383,7 @@ namespace mage::rendering {
 		 */
 		template< typename ResourceT >
 		typename std::enable_if_t< std::is_same_v< ComputeShader, ResourceT >,
-			ComputeShaderPtr > GetOrCreate(const std::wstring& guid,
+			ComputeShaderPtr > GetOrCreate(HashedWStringView guid,
 										   const CompiledShader& compiled_shader);
 
 		/**
@@ -373,6 +408,9 @@ namespace mage::rendering {
 		/**
 		 Creates a texture (if not existing).
 
+		 If called from a worker thread of the resource streamer (i.e. while
+		 streaming a model), the texture is created asynchronously.
+
 		 @tparam		ResourceT
 						The resource type.
 		 @param[in]		fname
@@ -406,8 +444,98 @@ namespace mage::rendering {
 									 const D3D11_TEXTURE2D_DESC& desc,
 									 const D3D11_SUBRESOURCE_DATA& initial_data);
 
+		/**
+		 Creates a model descriptor (if not existing) asynchronously.
+
+		 The model is imported on a worker thread. The mesh of the model is
+		 created on the rendering thread while updating this resource
+		 manager. The textures of the model are streamed as well. Requests
+		 of a model descriptor which is being streamed share the pending
+		 stream (i.e. the model is imported only once).
+
+		 @tparam		ResourceT
+						The resource type.
+		 @tparam		VertexT
+						The vertex type.
+		 @tparam		IndexT
+						The index type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		desc
+						A reference to the mesh descriptor.
+		 @param[in]		on_ready
+						The function to call on the rendering thread once the
+						model descriptor is created. The function is not
+						called if the model descriptor could not be created.
+		 @return		A future of the pointer to the model descriptor. The
+						future contains the exception if the model descriptor
+						could not be created.
+		 */
+		template< typename ResourceT, typename VertexT, typename IndexT >
+		typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+			std::shared_future< ModelDescriptorPtr > >
+			GetOrCreateAsync(const std::wstring& fname,
+							 const MeshDescriptor< VertexT, IndexT >&
+							 desc = MeshDescriptor< VertexT, IndexT >(),
+							 std::function< void(const ModelDescriptorPtr&) >
+							 on_ready = {});
+
+		/**
+		 Creates a texture (if not existing) asynchronously.
+
+		 The texture file is read on a worker thread. The texture is created
+		 on the rendering thread while updating this resource manager. Until
+		 then (or if the texture could not be created), the returned texture
+		 is a white placeholder texture.
+
+		 @tparam		ResourceT
+						The resource type.
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @return		A pointer to the texture.
+		 */
+		template< typename ResourceT >
+		typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
+			TexturePtr > GetOrCreateAsync(const std::wstring& fname);
+
+		/**
+		 Updates this resource manager.
+
+		 The pending resources are created within a fixed time budget.
+		 */
+		void Update();
+
 	private:
 
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The callback type of asynchronous model descriptor requests.
+		 */
+		using ModelCallback = std::function< void(const ModelDescriptorPtr&) >;
+
+		/**
+		 A struct of pending model descriptor requests (i.e. model
+		 descriptors which are being streamed).
+		 */
+		struct ModelRequest {
+
+		public:
+
+			/**
+			 The future of the pointer to the model descriptor of this model
+			 descriptor request.
+			 */
+			std::shared_future< ModelDescriptorPtr > m_future;
+
+			/**
+			 The callbacks of this model descriptor request.
+			 */
+			std::vector< ModelCallback > m_callbacks;
+		};
+
 		//---------------------------------------------------------------------
 		// Member Methods
 		//---------------------------------------------------------------------
@@ -438,6 +566,25 @@ namespace mage::rendering {
 		[[nodiscard]]
 		const typename pool_type< ResourceT >& GetPool() const noexcept;
 
+		/**
+		 Creates a texture (if not existing) asynchronously.
+
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @return		A pointer to the texture.
+		 */
+		TexturePtr StreamTexture(const std::wstring& fname);
+
+		/**
+		 Ends the pending model descriptor request corresponding to the given
+		 filename.
+
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @return		The callbacks of the model descriptor request.
+		 */
+		std::vector< ModelCallback > EndModelRequest(const std::wstring& fname);
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -491,6 +638,31 @@ namespace mage::rendering {
 		 The texture resource pool of this resource manager.
 		 */
 		typename pool_type< Texture > m_texture_pool;
+
+		/**
+		 The mutex for creating the streamed resources of this resource
+		 manager.
+		 */
+		std::mutex m_streaming_mutex;
+
+		/**
+		 A map containing the pending model descriptor requests of this
+		 resource manager.
+		 */
+		std::unordered_map< std::wstring, ModelRequest > m_model_requests;
+
+		/**
+		 A pointer to the placeholder texture of this resource manager.
+		 */
+		TexturePtr m_placeholder_texture;
+
+		/**
+		 A pointer to the resource streamer of this resource manager.
+
+		 The resource streamer is destructed first, since its pending tasks
+		 refer to this resource manager.
+		 */
+		UniquePtr< ResourceStreamer > m_streamer;
 	};
 }
 
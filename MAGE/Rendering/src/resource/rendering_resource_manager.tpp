@@ -1,5 +1,14 @@
 #pragma once
 
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging\logging.hpp"
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -131,73 +140,120 @@ namespace mage::rendering {
 												  desc, export_as_MDL);
 	}
 
+	template< typename ResourceT, typename VertexT, typename IndexT >
+	inline typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+		ModelDescriptorPtr >
+		ResourceManager::GetOrCreate(const std::wstring& guid,
+									 ModelOutput< VertexT, IndexT >&& buffer) {
+
+		return GetPool< ResourceT >().GetOrCreate(guid, m_device,
+												  key_type< ResourceT >(guid),
+												  std::move(buffer));
+	}
+
 	template< typename ResourceT >
 	inline typename std::enable_if_t< std::is_same_v< VertexShader, ResourceT >,
 		VertexShaderPtr >
-		ResourceManager::GetOrCreate(const std::wstring& guid,
+		ResourceManager::GetOrCreate(HashedWStringView guid,
 									 const CompiledShader& compiled_shader,
 									 gsl::span< const D3D11_INPUT_ELEMENT_DESC >
 									 input_element_descs) {
 
-		return GetPool< ResourceT >().GetOrCreate(guid, m_device,
-												  key_type< ResourceT >(guid),
-												  compiled_shader,
-												  input_element_descs);
+		auto& pool = GetPool< ResourceT >();
+		if (auto resource = pool.Get(guid.GetHash(), guid.GetView());
+			resource) {
+
+			return resource;
+		}
+
+		const key_type< ResourceT > key(guid.GetView());
+		return pool.GetOrCreate(key, m_device, key, compiled_shader,
+								input_element_descs);
 	}
 
 	template< typename ResourceT >
 	inline typename std::enable_if_t< std::is_same_v< HullShader, ResourceT >,
 		HullShaderPtr >
-		ResourceManager::GetOrCreate(const std::wstring& guid,
+		ResourceManager::GetOrCreate(HashedWStringView guid,
 									 const CompiledShader& compiled_shader) {
 
-		return GetPool< ResourceT >().GetOrCreate(guid, m_device,
-												  key_type< ResourceT >(guid),
-												  compiled_shader);
+		auto& pool = GetPool< ResourceT >();
+		if (auto resource = pool.Get(guid.GetHash(), guid.GetView());
+			resource) {
+
+			return resource;
+		}
+
+		const key_type< ResourceT > key(guid.GetView());
+		return pool.GetOrCreate(key, m_device, key, compiled_shader);
 	}
 
 	template< typename ResourceT >
 	inline typename std::enable_if_t< std::is_same_v< DomainShader, ResourceT >,
 		DomainShaderPtr >
-		ResourceManager::GetOrCreate(const std::wstring& guid,
+		ResourceManager::GetOrCreate(HashedWStringView guid,
 									 const CompiledShader& compiled_shader) {
 
-		return GetPool< ResourceT >().GetOrCreate(guid, m_device,
-												  key_type< ResourceT >(guid),
-												  compiled_shader);
+		auto& pool = GetPool< ResourceT >();
+		if (auto resource = pool.Get(guid.GetHash(), guid.GetView());
+			resource) {
+
+			return resource;
+		}
+
+		const key_type< ResourceT > key(guid.GetView());
+		return pool.GetOrCreate(key, m_device, key, compiled_shader);
 	}
 
 	template< typename ResourceT >
 	inline typename std::enable_if_t< std::is_same_v< GeometryShader, ResourceT >,
 		GeometryShaderPtr >
-		ResourceManager::GetOrCreate(const std::wstring& guid,
+		ResourceManager::GetOrCreate(HashedWStringView guid,
 									 const CompiledShader& compiled_shader) {
 
-		return GetPool< ResourceT >().GetOrCreate(guid, m_device,
-												  key_type< ResourceT >(guid),
-												  compiled_shader);
+		auto& pool = GetPool< ResourceT >();
+		if (auto resource = pool.Get(guid.GetHash(), guid.GetView());
+			resource) {
+
+			return resource;
+		}
+
+		const key_type< ResourceT > key(guid.GetView());
+		return pool.GetOrCreate(key, m_device, key, compiled_shader);
 	}
 
 	template< typename ResourceT >
 	inline typename std::enable_if_t< std::is_same_v< PixelShader, ResourceT >,
 		PixelShaderPtr >
-		ResourceManager::GetOrCreate(const std::wstring& guid,
+		ResourceManager::GetOrCreate(HashedWStringView guid,
 									 const CompiledShader& compiled_shader) {
 
-		return GetPool< ResourceT >().GetOrCreate(guid, m_device,
-												  key_type< ResourceT >(guid),
-												  compiled_shader);
+		auto& pool = GetPool< ResourceT >();
+		if (auto resource = pool.Get(guid.GetHash(), guid.GetView());
+			resource) {
+
+			return resource;
+		}
+
+		const key_type< ResourceT > key(guid.GetView());
+		return pool.GetOrCreate(key, m_device, key, compiled_shader);
 	}
 
 	template< typename ResourceT >
 	inline typename std::enable_if_t< std::is_same_v< ComputeShader, ResourceT >,
 		ComputeShaderPtr >
-		ResourceManager::GetOrCreate(const std::wstring& guid,
+		ResourceManager::GetOrCreate(HashedWStringView guid,
 									 const CompiledShader& compiled_shader) {
 
-		return GetPool< ResourceT >().GetOrCreate(guid, m_device,
-												  key_type< ResourceT >(guid),
-												  compiled_shader);
+		auto& pool = GetPool< ResourceT >();
+		if (auto resource = pool.Get(guid.GetHash(), guid.GetView());
+			resource) {
+
+			return resource;
+		}
+
+		const key_type< ResourceT > key(guid.GetView());
+		return pool.GetOrCreate(key, m_device, key, compiled_shader);
 	}
 
 	template< typename ResourceT >
@@ -216,6 +272,11 @@ namespace mage::rendering {
 		TexturePtr >
 		ResourceManager::GetOrCreate(const std::wstring& fname) {
 
+		if (ResourceStreamer::IsWorkerThread()) {
+			// The textures of streamed models are streamed as well.
+			return GetOrCreateAsync< ResourceT >(fname);
+		}
+
 		return GetPool< ResourceT >().GetOrCreate(fname, m_device,
 												  key_type< ResourceT >(fname));
 	}
@@ -232,5 +293,104 @@ namespace mage::rendering {
 												  desc, initial_data);
 	}
 
+	template< typename ResourceT, typename VertexT, typename IndexT >
+	typename std::enable_if_t< std::is_same_v< ModelDescriptor, ResourceT >,
+		std::shared_future< ModelDescriptorPtr > >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname,
+										  const MeshDescriptor< VertexT, IndexT >& desc,
+										  std::function< void(const ModelDescriptorPtr&) >
+										  on_ready) {
+
+		auto& pool = GetPool< ResourceT >();
+		const key_type< ResourceT > key(fname);
+
+		auto promise = MakeShared< std::promise< ModelDescriptorPtr > >();
+		std::shared_future< ModelDescriptorPtr > future(promise->get_future());
+		{
+			// Only the first request of a model descriptor streams the model
+			// descriptor.
+			const std::lock_guard< std::mutex > lock(m_streaming_mutex);
+
+			if (auto model = pool.Get(key); model) {
+				promise->set_value(model);
+				if (on_ready) {
+					m_streamer->Create([on_ready, model]() {
+						on_ready(model);
+					});
+				}
+
+				return future;
+			}
+
+			if (const auto it = m_model_requests.find(fname);
+				m_model_requests.cend() != it) {
+
+				if (on_ready) {
+					it->second.m_callbacks.push_back(std::move(on_ready));
+				}
+
+				return it->second.m_future;
+			}
+
+			auto& request = m_model_requests[fname];
+			request.m_future = future;
+			if (on_ready) {
+				request.m_callbacks.push_back(std::move(on_ready));
+			}
+		}
+
+		m_streamer->Load([this, fname, desc, promise]() {
+			const std::filesystem::path path(fname);
+
+			// Import the model on this worker thread.
+			auto buffer = MakeShared< ModelOutput< VertexT, IndexT > >();
+			try {
+				loader::ImportModelFromFile(path, *this, *buffer, desc);
+			}
+			catch (const std::exception& e) {
+				Warning("{}: model streaming failed: {}", path, e.what());
+				// The callbacks are not called.
+				EndModelRequest(fname);
+				promise->set_exception(std::current_exception());
+				return;
+			}
+
+			// Create the mesh on the rendering thread.
+			m_streamer->Create([this, fname, path, buffer, promise]() {
+				ModelDescriptorPtr model;
+				try {
+					model = GetPool< ResourceT >().GetOrCreate(
+						fname, m_device, key_type< ResourceT >(fname),
+						std::move(*buffer));
+				}
+				catch (const std::exception& e) {
+					Warning("{}: model streaming failed: {}", path, e.what());
+					// The callbacks are not called.
+					EndModelRequest(fname);
+					promise->set_exception(std::current_exception());
+					return;
+				}
+
+				// The model descriptor is contained in the resource pool
+				// before the request ends: subsequent requests find either.
+				const auto callbacks = EndModelRequest(fname);
+				promise->set_value(model);
+				for (const auto& callback : callbacks) {
+					callback(model);
+				}
+			});
+		});
+
+		return future;
+	}
+
+	template< typename ResourceT >
+	inline typename std::enable_if_t< std::is_same_v< Texture, ResourceT >,
+		TexturePtr >
+		ResourceManager::GetOrCreateAsync(const std::wstring& fname) {
+
+		return StreamTexture(fname);
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
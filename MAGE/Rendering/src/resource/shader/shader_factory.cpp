@@ -24,6 +24,7 @@
 
 // Transform
 #include "transform\transform_VS.hpp"
+#include "transform\transform_instanced_VS.hpp"
 
 #pragma endregion
 
@@ -32,7 +33,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#define MAGE_SHADER_GUID(buffer) L#buffer
+#define MAGE_SHADER_GUID(buffer) MAGE_HASHED_STRING(L#buffer)
 #define MAGE_SHADER_ARGS(buffer) MAGE_SHADER_GUID(buffer), \
 								 BufferCompiledShader(buffer)
 
@@ -119,5 +120,12 @@ namespace mage::rendering {
 						gsl::make_span(Vertex::s_input_element_descs));
 	}
 
+	VertexShaderPtr CreateTransformInstancedVS(ResourceManager& resource_manager) {
+		using Vertex = VertexPositionNormalTexture;
+		return CreateVS(resource_manager,
+						MAGE_SHADER_ARGS(g_transform_instanced_VS),
+						gsl::make_span(Vertex::s_instanced_input_element_descs));
+	}
+
 	#pragma endregion
 }
\ No newline at end of file
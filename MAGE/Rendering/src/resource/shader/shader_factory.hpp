@@ -570,6 +570,17 @@ namespace mage::rendering {
 	 */
 	VertexShaderPtr CreateTransformVS(ResourceManager& resource_manager);
 
+	/**
+	 Creates an instanced transform vertex shader.
+
+	 @param[in,out]	resource_manager
+					A reference to the resource manager.
+	 @return		A pointer to the instanced transform vertex shader.
+	 @throws		Exception
+					Failed to create the vertex shader.
+	 */
+	VertexShaderPtr CreateTransformInstancedVS(ResourceManager& resource_manager);
+
 	#pragma endregion
 
 	//-------------------------------------------------------------------------
@@ -21,7 +21,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#define MAGE_SHADER_GUID(buffer) L#buffer
+#define MAGE_SHADER_GUID(buffer) MAGE_HASHED_STRING(L#buffer)
 #define MAGE_SHADER_ARGS(buffer) MAGE_SHADER_GUID(buffer), \
 								 BufferCompiledShader(buffer)
 
@@ -0,0 +1,153 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <array>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::rendering {
+
+	/**
+	 A class of shader permutations.
+
+	 Shader permutations cache the shaders of a family of shader permutations
+	 in a dense array indexed by the permutation index. Each shader is
+	 created (through the resource manager) the first time its permutation
+	 is requested. All later requests are a single array load instead of a
+	 resource pool lookup.
+
+	 Shader permutations are not thread-safe and should only be accessed
+	 from the rendering thread.
+
+	 @tparam		ShaderPtrT
+					The shader pointer type.
+	 @tparam		N
+					The number of permutations.
+	 */
+	template< typename ShaderPtrT, std::size_t N >
+	class ShaderPermutations {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of permutations of shader permutations.
+		 */
+		static constexpr std::size_t s_nb_permutations = N;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs shader permutations.
+		 */
+		ShaderPermutations() = default;
+
+		/**
+		 Constructs shader permutations from the given shader permutations.
+
+		 @param[in]		permutations
+						A reference to the shader permutations to copy.
+		 */
+		ShaderPermutations(const ShaderPermutations& permutations) = default;
+
+		/**
+		 Constructs shader permutations by moving the given shader
+		 permutations.
+
+		 @param[in]		permutations
+						A reference to the shader permutations to move.
+		 */
+		ShaderPermutations(ShaderPermutations&& permutations) noexcept = default;
+
+		/**
+		 Destructs these shader permutations.
+		 */
+		~ShaderPermutations() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given shader permutations to these shader permutations.
+
+		 @param[in]		permutations
+						A reference to the shader permutations to copy.
+		 @return		A reference to the copy of the given shader
+						permutations (i.e. these shader permutations).
+		 */
+		ShaderPermutations& operator=(
+			const ShaderPermutations& permutations) = default;
+
+		/**
+		 Moves the given shader permutations to these shader permutations.
+
+		 @param[in]		permutations
+						A reference to the shader permutations to move.
+		 @return		A reference to the moved shader permutations (i.e.
+						these shader permutations).
+		 */
+		ShaderPermutations& operator=(
+			ShaderPermutations&& permutations) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shader of the given permutation of these shader
+		 permutations.
+
+		 @pre			@a index is smaller than @c s_nb_permutations.
+		 @tparam		FactoryT
+						The shader factory type.
+		 @param[in]		index
+						The permutation index.
+		 @param[in]		factory
+						The factory creating the shader of the given
+						permutation (if not cached yet).
+		 @return		A reference to the shader of the given permutation.
+		 @throws		Exception
+						Failed to create the shader.
+		 */
+		template< typename FactoryT >
+		const ShaderPtrT& Get(std::size_t index, FactoryT&& factory) {
+			auto& shader = m_shaders[index];
+			if (nullptr == shader) {
+				shader = factory();
+			}
+
+			return shader;
+		}
+
+		/**
+		 Clears these shader permutations.
+		 */
+		void Clear() noexcept {
+			m_shaders.fill(nullptr);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The (cached) shaders of these shader permutations.
+		 */
+		std::array< ShaderPtrT, N > m_shaders;
+	};
+}
\ No newline at end of file
@@ -80,6 +80,10 @@ namespace mage::rendering {
 		}
 	}
 
+	Texture::Texture(std::wstring fname, const Texture& placeholder)
+		: Resource< Texture >(std::move(fname)),
+		m_texture_srv(placeholder.m_texture_srv) {}
+
 	Texture::Texture(Texture&& texture) noexcept = default;
 
 	Texture::~Texture() = default;
@@ -92,6 +92,17 @@ namespace mage::rendering {
 			             const D3D11_TEXTURE2D_DESC& desc,
 			             const D3D11_SUBRESOURCE_DATA& initial_data);
 
+		/**
+		 Constructs a texture sharing the shader resource view of the given
+		 placeholder texture.
+
+		 @param[in]		fname
+						The filename (the globally unique identifier).
+		 @param[in]		placeholder
+						A reference to the placeholder texture.
+		 */
+		explicit Texture(std::wstring fname, const Texture& placeholder);
+
 		/**
 		 Constructs a texture from the given texture.
 
@@ -150,6 +161,16 @@ namespace mage::rendering {
 			return m_texture_srv.Get();
 		}
 
+		/**
+		 Sets the shader resource view of this texture.
+
+		 @param[in]		texture_srv
+						A pointer to the shader resource view.
+		 */
+		void Set(ComPtr< ID3D11ShaderResourceView > texture_srv) noexcept {
+			m_texture_srv = std::move(texture_srv);
+		}
+
 		/**
 		 Binds this texture.
 
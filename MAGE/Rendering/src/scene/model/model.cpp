@@ -8,6 +8,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+
+#pragma endregion
+
 //-----------------------------------------------------------------------------
 // Engine Definitions
 //-----------------------------------------------------------------------------
@@ -16,6 +25,9 @@ namespace mage::rendering {
 	Model::Model(ID3D11Device& device)
 		: Component(),
 		m_buffer(device),
+		m_buffer_data(),
+		m_packed_texture_transform(),
+		m_packed_transform_version(0u),
 		m_aabb(),
 		m_sphere(),
 		m_mesh(),
@@ -47,24 +59,97 @@ namespace mage::rendering {
 	void Model::UpdateBuffer(ID3D11DeviceContext& device_context) const {
 		Assert(HasOwner());
 
-		const auto& transform         = GetOwner()->GetTransform();
-		const auto  object_to_world   = transform.GetObjectToWorldMatrix();
-		const auto  world_to_object   = transform.GetWorldToObjectMatrix();
-		const auto  texture_transform = m_texture_transform.GetTransformMatrix();
+		// Bring the transform of the owner up to date.
+		const auto& transform = GetOwner()->GetTransform();
+		transform.GetObjectToWorldMatrix();
+		transform.GetWorldToObjectMatrix();
+
+		if (PackBuffer()) {
+			UploadBuffer(device_context);
+		}
+	}
+
+	bool Model::PackBuffer() const noexcept {
+		Assert(HasOwner());
+
+		const auto& transform = GetOwner()->GetTransform();
+		const auto  repack    = (0u == m_packed_transform_version);
+		auto changed = false;
 
-		ModelBuffer buffer;
 		// Transforms
-		buffer.m_object_to_world      = XMMatrixTranspose(object_to_world);
-		buffer.m_normal_to_world      = world_to_object;
-		buffer.m_texture_transform    = XMMatrixTranspose(texture_transform);
+		// The transform is resolved (which is not thread-safe) before packing.
+		// Transform versions are unique across transforms and never zero, so
+		// a changed owner or transform is detected as well.
+		const auto version = transform.GetResolvedVersion();
+		if (version != m_packed_transform_version) {
+
+			const auto object_to_world = transform.GetResolvedObjectToWorldMatrix();
+			const auto world_to_object = transform.GetResolvedWorldToObjectMatrix();
+
+			m_buffer_data.m_object_to_world = XMMatrixTranspose(object_to_world);
+			m_buffer_data.m_normal_to_world = world_to_object;
+
+			m_packed_transform_version = version;
+			changed = true;
+		}
+
+		// Texture transform
+		if (repack || 0 != std::memcmp(&m_texture_transform,
+									   &m_packed_texture_transform,
+									   sizeof(TextureTransform2D))) {
+
+			const auto texture_transform = m_texture_transform.GetTransformMatrix();
+
+			m_buffer_data.m_texture_transform = XMMatrixTranspose(texture_transform);
+
+			m_packed_texture_transform = m_texture_transform;
+			changed = true;
+		}
+
 		// Material
-		buffer.m_base_color           = m_material.IsEmissive()
-			                          ? m_material.GetRadianceSpectrum()
-			                          : m_material.GetBaseColor();
-		buffer.m_roughness            = m_material.GetRoughness();
-		buffer.m_metalness            = m_material.GetMetalness();
+		const RGBA base_color = m_material.IsEmissive()
+			                  ? RGBA(m_material.GetRadianceSpectrum())
+			                  : m_material.GetBaseColor();
+		const auto roughness  = m_material.GetRoughness();
+		const auto metalness  = m_material.GetMetalness();
+
+		if (repack
+			|| 0 != std::memcmp(&base_color, &m_buffer_data.m_base_color,
+								sizeof(RGBA))
+			|| roughness != m_buffer_data.m_roughness
+			|| metalness != m_buffer_data.m_metalness) {
 
+			m_buffer_data.m_base_color = base_color;
+			m_buffer_data.m_roughness  = roughness;
+			m_buffer_data.m_metalness  = metalness;
+			changed = true;
+		}
+
+		return changed;
+	}
+
+	void Model::UploadBuffer(ID3D11DeviceContext& device_context) const {
 		// Update the model buffer.
-		m_buffer.UpdateData(device_context, buffer);
+		m_buffer.UpdateData(device_context, m_buffer_data);
+	}
+
+	bool Model::CanInstance(const Model& model) const noexcept {
+		if (m_mesh != model.m_mesh
+			|| m_start_index != model.m_start_index
+			|| m_nb_indices  != model.m_nb_indices
+			|| !m_material.HasSameSRVs(model.m_material)) {
+			return false;
+		}
+
+		const auto& lhs = m_buffer_data;
+		const auto& rhs = model.m_buffer_data;
+		return 0 == std::memcmp(&lhs.m_texture_transform,
+								&rhs.m_texture_transform,
+								sizeof(XMMATRIX))
+			&& 0 == std::memcmp(&lhs.m_base_color,
+								&rhs.m_base_color,
+								sizeof(RGBA))
+			&& lhs.m_roughness == rhs.m_roughness
+			&& lhs.m_metalness == rhs.m_metalness;
 	}
 }
\ No newline at end of file
@@ -15,6 +15,15 @@
 
 #pragma endregion
 
+//-----------------------------------------------------------------------------
+// Engine Declarations
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	// Forward declaration.
+	class Transform;
+}
+
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -151,6 +160,16 @@ namespace mage::rendering {
 			return m_nb_indices;
 		}
 
+		/**
+		 Returns the mesh of this model.
+
+		 @return		A pointer to the mesh of this model.
+		 */
+		[[nodiscard]]
+		const Mesh* GetMesh() const noexcept {
+			return m_mesh.get();
+		}
+
 		/**
 		 Binds the mesh of this model.
 
@@ -185,6 +204,25 @@ namespace mage::rendering {
 			m_mesh->Draw(device_context, m_start_index, m_nb_indices);
 		}
 
+		/**
+		 Draws instances of this model.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 @param[in]		nb_instances
+						The number of instances.
+		 @param[in]		instance_start
+						The index of the first instance in the per-instance
+						vertex buffers.
+		 */
+		void DrawInstanced(ID3D11DeviceContext& device_context,
+						   std::size_t nb_instances,
+						   std::size_t instance_start) const noexcept {
+
+			m_mesh->DrawInstanced(device_context, m_start_index, m_nb_indices,
+								  nb_instances, instance_start);
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Appearance
 		//---------------------------------------------------------------------
@@ -283,11 +321,40 @@ namespace mage::rendering {
 		/**
 		 Updates the buffer of this model.
 
+		 The buffer is only uploaded if its content changed.
+
 		 @param[in,out]	device_context
 						A reference to the device context.
 		 */
 		void UpdateBuffer(ID3D11DeviceContext& device_context) const;
 
+		/**
+		 Packs the buffer data of this model on the CPU.
+
+		 Only the parts of the buffer data whose inputs changed since the
+		 last packing are recomputed: the transforms are tracked by the
+		 version of the transform of the owner of this model, the texture
+		 transform and material are compared against their packed values.
+
+		 @pre			This model has an owner.
+		 @pre			The object-to-world and world-to-object matrices of
+						the transform of the owner of this model are up to
+						date (which makes packing the buffer data of different
+						models thread-safe).
+		 @return		@c true if the buffer data of this model changed and
+						needs to be uploaded. @c false otherwise.
+		 */
+		bool PackBuffer() const noexcept;
+
+		/**
+		 Uploads the packed buffer data of this model to the buffer of this
+		 model.
+
+		 @param[in,out]	device_context
+						A reference to the device context.
+		 */
+		void UploadBuffer(ID3D11DeviceContext& device_context) const;
+
 		/**
 		 Binds the buffer of this model to the given pipeline stage.
 
@@ -307,6 +374,38 @@ namespace mage::rendering {
 			m_buffer.Bind< PipelineStageT >(device_context, slot);
 		}
 
+		/**
+		 Returns the per-instance buffer data of this model (i.e. the packed
+		 transforms of this model).
+
+		 @pre			The buffer data of this model is packed.
+		 @return		The per-instance buffer data of this model.
+		 */
+		[[nodiscard]]
+		ModelInstanceBuffer GetInstanceBuffer() const noexcept {
+			return { m_buffer_data.m_object_to_world,
+				     m_buffer_data.m_normal_to_world };
+		}
+
+		/**
+		 Checks whether this model can be drawn as an instance of the same
+		 instanced draw call as the given model.
+
+		 Two models can be drawn as instances of the same draw call if they
+		 share the same mesh range, shader resource views and packed buffer
+		 data apart from the transforms.
+
+		 @pre			The buffer data of this model and of the given model
+						is packed.
+		 @param[in]		model
+						A reference to the model.
+		 @return		@c true if this model can be drawn as an instance of
+						the same instanced draw call as the given model.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool CanInstance(const Model& model) const noexcept;
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -318,6 +417,24 @@ namespace mage::rendering {
 		 */
 		mutable ConstantBuffer< ModelBuffer > m_buffer;
 
+		/**
+		 The packed buffer data of this model.
+		 */
+		mutable ModelBuffer m_buffer_data;
+
+		/**
+		 The texture transform of this model at the time the buffer data of
+		 this model was packed.
+		 */
+		mutable TextureTransform2D m_packed_texture_transform;
+
+		/**
+		 The version of the transform of the owner of this model at the time
+		 the buffer data of this model was packed (or zero if the buffer data
+		 of this model has not been packed yet).
+		 */
+		mutable U64 m_packed_transform_version;
+
 		//---------------------------------------------------------------------
 		// Member Variables: Geometry
 		//---------------------------------------------------------------------
@@ -34,6 +34,18 @@ namespace mage::rendering {
 
 	World& World::operator=(World&& world) noexcept = default;
 
+	void World::RemoveTerminated() {
+		RemoveTerminatedElements(m_perspective_cameras);
+		RemoveTerminatedElements(m_orthographic_cameras);
+		RemoveTerminatedElements(m_ambient_lights);
+		RemoveTerminatedElements(m_directional_lights);
+		RemoveTerminatedElements(m_omni_lights);
+		RemoveTerminatedElements(m_spot_lights);
+		RemoveTerminatedElements(m_models);
+		RemoveTerminatedElements(m_sprite_images);
+		RemoveTerminatedElements(m_sprite_texts);
+	}
+
 	void World::Clear() noexcept {
 		m_perspective_cameras.clear();
 		m_orthographic_cameras.clear();
@@ -5,6 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "collection\proxy_vector.hpp"
 #include "display\display_configuration.hpp"
 #include "resource\rendering_resource_manager.hpp"
 #include "scene\node.hpp"
@@ -111,6 +112,12 @@ namespace mage::rendering {
 		template< typename ComponentT, typename ActionT >
 		void ForEach(ActionT&& action) const;
 
+		/**
+		 Removes the terminated components of this world. The slots of the
+		 removed components are reused by subsequently created components.
+		 */
+		void RemoveTerminated();
+
 		/**
 		 Clears this world.
 		 */
@@ -144,47 +151,47 @@ namespace mage::rendering {
 		/**
 		 A vector containing the perspective cameras of this world.
 		 */
-		AlignedVector< PerspectiveCamera > m_perspective_cameras;
+		ProxyVector< PerspectiveCamera > m_perspective_cameras;
 
 		/**
 		 A vector containing the orthographic cameras of this world.
 		 */
-		AlignedVector< OrthographicCamera > m_orthographic_cameras;
+		ProxyVector< OrthographicCamera > m_orthographic_cameras;
 
 		/**
 		 A vector containing the ambient lights of this world.
 		 */
-		AlignedVector< AmbientLight > m_ambient_lights;
+		ProxyVector< AmbientLight > m_ambient_lights;
 
 		/**
 		 A vector containing the directional lights of this world.
 		 */
-		AlignedVector< DirectionalLight > m_directional_lights;
+		ProxyVector< DirectionalLight > m_directional_lights;
 
 		/**
 		 A vector containing the omni lights of this world.
 		 */
-		AlignedVector< OmniLight > m_omni_lights;
+		ProxyVector< OmniLight > m_omni_lights;
 
 		/**
 		 A vector containing the spot lights of this world.
 		 */
-		AlignedVector< SpotLight > m_spot_lights;
+		ProxyVector< SpotLight > m_spot_lights;
 
 		/**
 		 A vector containing the models of this world.
 		 */
-		AlignedVector< Model > m_models;
+		ProxyVector< Model > m_models;
 
 		/**
 		 A vector containing the sprite images of this world.
 		 */
-		AlignedVector< SpriteImage > m_sprite_images;
+		ProxyVector< SpriteImage > m_sprite_images;
 
 		/**
 		 A vector containing the sprite texts of this world.
 		 */
-		AlignedVector< SpriteText > m_sprite_texts;
+		ProxyVector< SpriteText > m_sprite_texts;
 	};
 }
 
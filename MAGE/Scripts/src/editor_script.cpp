@@ -995,6 +995,12 @@ namespace mage::script {
 				node.SetState(active ? State::Active : State::Passive);
 			}
 
+			ImGui::SameLine();
+
+			if (ImGui::Button("Remove")) {
+				node.SetState(State::Terminated);
+			}
+
 			ImGui::Separator();
 
 			//-----------------------------------------------------------------
@@ -4,6 +4,8 @@
 #pragma region
 
 #include "stats_script.hpp"
+#include "system\profiler.hpp"
+#include "system\system_time.hpp"
 #include "system\system_usage.hpp"
 #include "exception\exception.hpp"
 
@@ -23,7 +25,8 @@ namespace mage::script {
 		m_fps(0u),
 		m_spf(0.0f),
 		m_cpu(0.0f),
-		m_ram(0u) {}
+		m_ram(0u),
+		m_zones() {}
 
 	StatsScript::StatsScript(const StatsScript& script) noexcept = default;
 
@@ -49,6 +52,13 @@ namespace mage::script {
 	void StatsScript::Update([[maybe_unused]] Engine& engine) {
 		static constexpr auto s_resource_fetch_period = 1.0;
 
+		const auto& keyboard = engine.GetInputManager().GetKeyboard();
+		if (keyboard.IsActivated(DIK_F5)) {
+			const auto fname = L"trace-" + GetLocalSystemDateAndTimeAsString()
+				             + L".json";
+			Profiler::Get().ExportTrace(fname);
+		}
+
 		++m_accumulated_nb_frames;
 		const auto wall_clock_time  = engine.GetTime().GetWallClockTotalDeltaTime();
 		const auto wall_clock_delta = wall_clock_time - m_prev_wall_clock_time;
@@ -61,6 +71,7 @@ namespace mage::script {
 			m_spf = 1000.0 * wall_clock_delta.count() / m_accumulated_nb_frames;
 			m_cpu =  100.0 * core_clock_delta.count() / wall_clock_delta.count();
 			m_ram = GetVirtualMemoryUsage() >> 20u;
+			UpdateZones();
 
 			m_accumulated_nb_frames = 0u;
 			m_prev_wall_clock_time  = wall_clock_time;
@@ -71,7 +82,30 @@ namespace mage::script {
 
 		m_text->SetText(L"FPS: ");
 		m_text->AppendText({ std::to_wstring(m_fps), std::move(color) });
-		m_text->AppendText(Format(L"\nSPF: {:.2f}ms\nCPU: {:.1f}%\nRAM: {}MB\nDCs: {}",
-								  m_spf, m_cpu, m_ram, rendering::Pipeline::s_nb_draws));
+		m_text->AppendText(Format(L"\nSPF: {:.2f}ms\nCPU: {:.1f}%\nRAM: {}MB\nDCs: {}\nSCs: {}\nBCs: {}",
+								  m_spf, m_cpu, m_ram, rendering::Pipeline::s_nb_draws,
+								  rendering::Pipeline::s_nb_shadow_casters,
+								  rendering::Pipeline::s_nb_binds));
+		m_text->AppendText(m_zones);
+	}
+
+	void StatsScript::UpdateZones() {
+		auto& profiler = Profiler::Get();
+
+		m_zones.clear();
+		for (const auto& stats : profiler.GetZoneStats()) {
+			if (0u == stats.m_nb_frames) {
+				continue;
+			}
+
+			m_zones.append(L"\n");
+			m_zones.append(2u * stats.m_depth, L' ');
+			// The zone names are ASCII string literals.
+			m_zones.append(stats.m_name.cbegin(), stats.m_name.cend());
+			m_zones.append(Format(L": {:.2f}/{:.2f}/{:.2f}ms",
+								  stats.m_min, stats.GetAverage(), stats.m_max));
+		}
+
+		profiler.ResetZoneStats();
 	}
 }
\ No newline at end of file
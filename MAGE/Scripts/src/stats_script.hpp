@@ -45,6 +45,12 @@ namespace mage::script {
 
 	private:
 
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		void UpdateZones();
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -58,5 +64,6 @@ namespace mage::script {
 		F64 m_spf;
 		F64 m_cpu;
 		U64 m_ram;
+		std::wstring m_zones;
 	};
 }
\ No newline at end of file
@@ -57,6 +57,25 @@ struct VSInputPositionNormalTexture {
 	float2 tex   : TEXCOORD0;
 };
 
+/**
+ A vertex shader input struct of vertices having a position, a normal and a
+ pair of texture coordinates, and of instances having an object-to-world and a
+ normal-to-world matrix (column-major packed).
+ */
+struct VSInputPositionNormalTextureInstance {
+	float3 p     : POSITION0;
+	float3 n     : NORMAL0;
+	float2 tex   : TEXCOORD0;
+	float4 object_to_world0 : OBJECT_TO_WORLD0;
+	float4 object_to_world1 : OBJECT_TO_WORLD1;
+	float4 object_to_world2 : OBJECT_TO_WORLD2;
+	float4 object_to_world3 : OBJECT_TO_WORLD3;
+	float4 normal_to_world0 : NORMAL_TO_WORLD0;
+	float4 normal_to_world1 : NORMAL_TO_WORLD1;
+	float4 normal_to_world2 : NORMAL_TO_WORLD2;
+	float4 normal_to_world3 : NORMAL_TO_WORLD3;
+};
+
 /**
  A vertex shader input struct of vertices having a position, a color and a
  pair of texture coordinates.
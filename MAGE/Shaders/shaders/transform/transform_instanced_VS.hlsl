@@ -0,0 +1,32 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#include "forward\forward_input.hlsli"
+#include "transform\transform.hlsli"
+
+//-----------------------------------------------------------------------------
+// Vertex Shader
+//-----------------------------------------------------------------------------
+PSInputPositionNormalTexture VS(VSInputPositionNormalTextureInstance input) {
+	// The per-instance matrices are column-major packed.
+	const float4x4 object_to_world = transpose(float4x4(input.object_to_world0,
+														input.object_to_world1,
+														input.object_to_world2,
+														input.object_to_world3));
+	const float4x4 normal_to_world = transpose(float4x4(input.normal_to_world0,
+														input.normal_to_world1,
+														input.normal_to_world2,
+														input.normal_to_world3));
+
+	VSInputPositionNormalTexture vertex;
+	vertex.p   = input.p;
+	vertex.n   = input.n;
+	vertex.tex = input.tex;
+
+	return Transform(vertex,
+					 object_to_world,
+					 g_world_to_camera,
+					 g_camera_to_projection,
+					 (float3x3)normal_to_world,
+					 g_texture_transform);
+}
\ No newline at end of file
@@ -0,0 +1,271 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "collection\proxy_vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		struct Base {
+
+		public:
+
+			explicit Base(U32 value = 0u) noexcept
+				: m_value(value) {}
+
+			virtual ~Base() = default;
+
+			U32 m_value;
+		};
+
+		struct Derived : public Base {
+
+		public:
+
+			explicit Derived(U32 value = 0u) noexcept
+				: Base(value), m_extra(2u * value) {}
+
+			U32 m_extra;
+		};
+
+		/**
+		 A class of proxy pointers resolving through a type-erased getter
+		 (i.e. the previous ProxyPtr implementation).
+		 */
+		template< typename T >
+		class FunctionProxyPtr {
+
+		public:
+
+			FunctionProxyPtr() = default;
+
+			explicit FunctionProxyPtr(std::function< T*() > getter)
+				: m_getter(std::move(getter)) {}
+
+			[[nodiscard]]
+			T* operator->() const {
+				return m_getter();
+			}
+
+			[[nodiscard]]
+			explicit operator bool() const {
+				return m_getter && nullptr != m_getter();
+			}
+
+		private:
+
+			std::function< T*() > m_getter;
+		};
+
+		/**
+		 Sums the values of all ancestors of all given nodes.
+		 */
+		template< typename NodesT >
+		[[nodiscard]]
+		F32 Traverse(const NodesT& nodes) {
+			F32 sum = 0.0f;
+			for (const auto& node : nodes) {
+				for (auto parent = node.m_parent; parent;
+					 parent = parent->m_parent) {
+					sum += parent->m_value;
+				}
+			}
+			return sum;
+		}
+
+		/**
+		 The number of nodes of the traversal benchmark. Node i is a child of
+		 node (i - 1) / 4, resulting in a hierarchy of depth 9.
+		 */
+		constexpr U32 g_nb_nodes = 100000u;
+	}
+
+	MAGE_TEST(ProxyVectorSurvivesReallocation) {
+		ProxyVector< Base > v;
+		const auto first = v.emplace_back(1u);
+		for (U32 i = 2u; i <= 1000u; ++i) {
+			v.emplace_back(i);
+		}
+
+		MAGE_CHECK(first);
+		MAGE_CHECK(1u == first->m_value);
+		MAGE_CHECK(&v[0] == first.Get());
+	}
+
+	MAGE_TEST(ProxyVectorEraseInvalidatesAndReuses) {
+		ProxyVector< Base > v;
+		std::vector< ProxyPtr< Base > > ptrs;
+		for (U32 i = 0u; i < 8u; ++i) {
+			ptrs.push_back(v.emplace_back(i));
+		}
+
+		v.erase_if([](const Base& element) noexcept {
+			return 0u == element.m_value % 2u;
+		});
+
+		for (U32 i = 0u; i < 8u; ++i) {
+			MAGE_CHECK(bool(ptrs[i]) == (1u == i % 2u));
+		}
+		MAGE_CHECK(4u == v.size());
+		for (U32 i = 1u; i < 8u; i += 2u) {
+			MAGE_CHECK(i == ptrs[i]->m_value);
+		}
+
+		// The new element reuses a slot of an erased element.
+		const auto ptr = v.emplace(100u);
+		MAGE_CHECK(100u == ptr->m_value);
+		for (U32 i = 0u; i < 8u; i += 2u) {
+			MAGE_CHECK(nullptr == ptrs[i]);
+		}
+	}
+
+	MAGE_TEST(ProxyVectorClearRecyclesSlots) {
+		ProxyVector< Base > v;
+		ProxyPtr< Base > stale;
+		for (U32 cycle = 0u; cycle < 100u; ++cycle) {
+			for (U32 i = 0u; i < 16u; ++i) {
+				v.emplace_back(i);
+			}
+			const auto ptr = v.emplace_back(cycle);
+			MAGE_CHECK(cycle == ptr->m_value);
+			MAGE_CHECK(nullptr == stale);
+
+			v.clear();
+			MAGE_CHECK(nullptr == ptr);
+			stale = ptr;
+		}
+
+		const auto ptr = v.emplace_back(0u);
+		MAGE_CHECK(ptr);
+		MAGE_CHECK(nullptr == stale);
+		MAGE_CHECK(1u == v.size());
+	}
+
+	MAGE_TEST(ProxyVectorMove) {
+		ProxyVector< Base > v;
+		const auto ptr = v.emplace_back(1u);
+
+		ProxyVector< Base > w(std::move(v));
+		MAGE_CHECK(1u == ptr->m_value);
+		MAGE_CHECK(&w[0] == ptr.Get());
+
+		ProxyVector< Base > x;
+		const auto old_ptr = x.emplace_back(2u);
+		x = std::move(w);
+		MAGE_CHECK(1u == ptr->m_value);
+		MAGE_CHECK(&x[0] == ptr.Get());
+		// The slots of the previous elements are handed over, not destructed.
+		MAGE_CHECK(nullptr == old_ptr);
+
+		// Moved-from proxy vectors remain usable.
+		v = std::move(w);
+		MAGE_CHECK(v.empty());
+		MAGE_CHECK(v.emplace_back(3u));
+		MAGE_CHECK(1u == ptr->m_value);
+	}
+
+	MAGE_TEST(ProxyPtrCasts) {
+		ProxyVector< UniquePtr< Base > > v;
+		const auto base    = v.emplace_back(MakeUnique< Derived >(3u));
+		const auto other   = v.emplace_back(MakeUnique< Base >(4u));
+
+		const auto derived = dynamic_pointer_cast< Derived >(base);
+		MAGE_CHECK(derived);
+		MAGE_CHECK(6u == derived->m_extra);
+		MAGE_CHECK(derived == base);
+		MAGE_CHECK(nullptr == dynamic_pointer_cast< Derived >(other));
+
+		const ProxyPtr< Base > upcast = derived;
+		MAGE_CHECK(3u == upcast->m_value);
+
+		// The casts share the slot (and generation) of the original pointer.
+		v.clear();
+		MAGE_CHECK(nullptr == derived);
+		MAGE_CHECK(nullptr == upcast);
+	}
+
+	MAGE_BENCHMARK(ProxyPtrTraversal) {
+		// Raw pointers.
+		{
+			struct RawNode {
+				const RawNode* m_parent;
+				F32 m_value;
+			};
+
+			std::vector< RawNode > nodes(g_nb_nodes);
+			for (U32 i = 0u; i < g_nb_nodes; ++i) {
+				nodes[i] = { (0u == i) ? nullptr : &nodes[(i - 1u) / 4u], 1.0f };
+			}
+
+			ReportMeasurement("raw pointer (100k nodes)", Measure(20u,
+				[&nodes]() {
+					DoNotOptimize(Traverse(nodes));
+				}));
+		}
+
+		// Proxy pointers resolving through a std::function.
+		{
+			struct FunctionNode {
+				FunctionProxyPtr< FunctionNode > m_parent;
+				F32 m_value;
+			};
+
+			AlignedVector< FunctionNode > nodes(g_nb_nodes);
+			for (U32 i = 0u; i < g_nb_nodes; ++i) {
+				if (0u != i) {
+					const auto index = (i - 1u) / 4u;
+					nodes[i].m_parent = FunctionProxyPtr< FunctionNode >(
+						[&nodes, index]() noexcept {
+							return &nodes[index];
+						});
+				}
+				nodes[i].m_value = 1.0f;
+			}
+
+			ReportMeasurement("std::function proxy pointer (100k nodes)",
+				Measure(20u, [&nodes]() {
+					DoNotOptimize(Traverse(nodes));
+				}));
+		}
+
+		// Generational proxy pointers.
+		{
+			struct ProxyNode {
+				ProxyPtr< ProxyNode > m_parent;
+				F32 m_value;
+			};
+
+			ProxyVector< ProxyNode > nodes;
+			std::vector< ProxyPtr< ProxyNode > > ptrs;
+			ptrs.reserve(g_nb_nodes);
+			for (U32 i = 0u; i < g_nb_nodes; ++i) {
+				const auto parent = (0u == i) ? ProxyPtr< ProxyNode >()
+											  : ptrs[(i - 1u) / 4u];
+				ptrs.push_back(nodes.emplace_back(ProxyNode{ parent, 1.0f }));
+			}
+
+			ReportMeasurement("generational proxy pointer (100k nodes)",
+				Measure(20u, [&nodes]() {
+					DoNotOptimize(Traverse(nodes));
+				}));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "ecs\ecs.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A struct of components of 16 bytes.
+		 */
+		struct TestComponent {
+
+		public:
+
+			explicit TestComponent(F32 value = 0.0f) noexcept
+				: m_value{ value, value, value, value } {}
+
+			F32 m_value[4];
+		};
+
+		/**
+		 A class of component managers mapping entities to component indices
+		 with a hash map (i.e. the previous ComponentManager implementation).
+		 */
+		class HashComponentManager {
+
+		public:
+
+			[[nodiscard]]
+			bool Contains(Entity entity) const noexcept {
+				return m_mapping.find(entity) != m_mapping.cend();
+			}
+
+			[[nodiscard]]
+			TestComponent* Get(Entity entity) noexcept {
+				const auto it = m_mapping.find(entity);
+				return (it != m_mapping.cend()) ? &m_components[it->second]
+												: nullptr;
+			}
+
+			TestComponent& emplace_back(Entity entity, F32 value) {
+				if (const auto it = m_mapping.find(entity);
+					it != m_mapping.cend()) {
+
+					return m_components[it->second];
+				}
+
+				m_mapping.emplace(entity, m_components.size());
+				m_entities.push_back(entity);
+				return m_components.emplace_back(value);
+			}
+
+			void erase(Entity entity) {
+				const auto it = m_mapping.find(entity);
+				if (it == m_mapping.cend()) {
+					return;
+				}
+
+				const auto index = it->second;
+				const auto last  = m_components.size() - 1u;
+				if (index != last) {
+					m_components[index] = m_components[last];
+					m_entities[index]   = m_entities[last];
+					m_mapping[m_entities[index]] = index;
+				}
+
+				m_mapping.erase(entity);
+				m_components.pop_back();
+				m_entities.pop_back();
+			}
+
+			[[nodiscard]]
+			std::size_t size() const noexcept {
+				return m_components.size();
+			}
+
+		private:
+
+			AlignedVector< TestComponent > m_components;
+			AlignedVector< Entity > m_entities;
+			std::unordered_map< Entity, std::size_t > m_mapping;
+		};
+
+		/**
+		 Returns the given number of distinct entities (with ids spread over
+		 four times the given number) in random order.
+		 */
+		[[nodiscard]]
+		const std::vector< Entity > CreateEntities(std::size_t nb_entities) {
+			std::vector< Entity > entities;
+			entities.reserve(nb_entities);
+			for (std::size_t i = 0u; i < nb_entities; ++i) {
+				entities.emplace_back(static_cast< U32 >(4u * i + i % 3u));
+			}
+
+			std::mt19937 generator(7u);
+			std::shuffle(entities.begin(), entities.end(), generator);
+			return entities;
+		}
+
+		/**
+		 Inserts, looks up and erases the given entities.
+		 */
+		template< typename ManagerT >
+		[[nodiscard]]
+		F32 InsertLookupErase(ManagerT& manager,
+							  const std::vector< Entity >& entities) {
+			for (const auto entity : entities) {
+				manager.emplace_back(entity, static_cast< F32 >(entity.GetID()));
+			}
+
+			F32 sum = 0.0f;
+			for (const auto entity : entities) {
+				sum += manager.Get(entity)->m_value[0];
+			}
+
+			for (std::size_t i = 0u; i < entities.size(); i += 2u) {
+				manager.erase(entities[i]);
+			}
+			return sum;
+		}
+	}
+
+	MAGE_TEST(ComponentManagerMatchesHashComponentManager) {
+		const auto entities = CreateEntities(10000u);
+
+		ComponentManager< TestComponent > manager;
+		HashComponentManager expected;
+		for (const auto entity : entities) {
+			manager.emplace_back(entity, static_cast< F32 >(entity.GetID()));
+			expected.emplace_back(entity, static_cast< F32 >(entity.GetID()));
+		}
+		// Emplacing an existing entity does not add a component.
+		manager.emplace_back(entities.front(), -1.0f);
+		MAGE_CHECK(entities.size() == manager.size());
+
+		for (std::size_t i = 0u; i < entities.size(); i += 3u) {
+			manager.erase(entities[i]);
+			expected.erase(entities[i]);
+		}
+		MAGE_CHECK(expected.size() == manager.size());
+
+		for (const auto entity : entities) {
+			MAGE_CHECK(expected.Contains(entity) == manager.Contains(entity));
+			if (const auto component = manager.Get(entity); component) {
+				MAGE_CHECK(expected.Get(entity)->m_value[0]
+						   == component->m_value[0]);
+			}
+		}
+
+		// The dense arrays stay consistent with the sparse mapping.
+		const auto& dense_entities = manager.GetEntities();
+		for (std::size_t i = 0u; i < manager.size(); ++i) {
+			MAGE_CHECK(&manager[i] == manager.Get(dense_entities[i]));
+		}
+
+		MAGE_CHECK(!manager.Contains(Entity(100000000u)));
+		MAGE_CHECK(nullptr == manager.Get(Entity(100000000u)));
+	}
+
+	MAGE_BENCHMARK(ComponentManagerInsertLookupErase) {
+		for (const std::size_t nb_entities : { 10000u, 100000u, 1000000u }) {
+			const auto entities = CreateEntities(nb_entities);
+			const auto label    = std::to_string(nb_entities / 1000u) + "k";
+			const std::size_t nb_iterations = 10000000u / nb_entities;
+
+			ReportMeasurement("sparse set (" + label + " entities)",
+				Measure(nb_iterations, [&entities]() {
+					ComponentManager< TestComponent > manager;
+					DoNotOptimize(InsertLookupErase(manager, entities));
+				}));
+
+			ReportMeasurement("hash map (" + label + " entities)",
+				Measure(nb_iterations, [&entities]() {
+					HashComponentManager manager;
+					DoNotOptimize(InsertLookupErase(manager, entities));
+				}));
+		}
+	}
+}
\ No newline at end of file
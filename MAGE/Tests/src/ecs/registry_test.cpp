@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "ecs\registry.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A struct of transform components.
+		 */
+		struct TestTransform {
+
+		public:
+
+			F32 m_translation[3];
+			F32 m_rotation;
+			F32 m_scale;
+			F32 m_world[12];
+		};
+
+		/**
+		 A struct of velocity components.
+		 */
+		struct TestVelocity {
+
+		public:
+
+			F32 m_linear[3];
+			F32 m_angular;
+		};
+
+		using TestRegistry = Registry< TestTransform, TestVelocity >;
+
+		/**
+		 Creates the given number of entities with a transform. All entities
+		 but every fourth one have a velocity as well.
+		 */
+		void CreateEntities(TestRegistry& registry, std::size_t nb_entities) {
+			registry.GetComponents< TestTransform >().reserve(nb_entities);
+			registry.GetComponents< TestVelocity >().reserve(nb_entities);
+
+			for (std::size_t i = 0u; i < nb_entities; ++i) {
+				const auto entity = registry.CreateEntity();
+				const auto f      = static_cast< F32 >(i);
+				registry.AddComponent< TestTransform >(entity,
+					TestTransform{ { f, 0.0f, -f }, 0.0f, 1.0f, {} });
+				if (0u != i % 4u) {
+					registry.AddComponent< TestVelocity >(entity,
+						TestVelocity{ { 1.0f, 2.0f, 3.0f }, 0.5f });
+				}
+			}
+		}
+
+		/**
+		 Integrates the given velocity and updates the world matrix of the
+		 given transform.
+		 */
+		void Update(Entity, TestTransform& transform,
+					const TestVelocity& velocity) noexcept {
+
+			static constexpr F32 s_delta_time = 1.0f / 60.0f;
+
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				transform.m_translation[i] += s_delta_time * velocity.m_linear[i];
+			}
+			transform.m_rotation += s_delta_time * velocity.m_angular;
+
+			const auto c = transform.m_scale * std::cos(transform.m_rotation);
+			const auto s = transform.m_scale * std::sin(transform.m_rotation);
+			F32 (&m)[12] = transform.m_world;
+			m[0] =    c; m[1] =  0.0f; m[2]  =   -s; m[3]  = transform.m_translation[0];
+			m[4] = 0.0f; m[5] = transform.m_scale;
+			                           m[6]  = 0.0f; m[7]  = transform.m_translation[1];
+			m[8] =    s; m[9] =  0.0f; m[10] =    c; m[11] = transform.m_translation[2];
+		}
+
+		/**
+		 Sums the translations of all transforms of the given registry.
+		 */
+		[[nodiscard]]
+		F32 Sum(const TestRegistry& registry) noexcept {
+			F32 sum = 0.0f;
+			for (const auto& transform
+				 : registry.GetComponents< TestTransform >()) {
+				sum += transform.m_world[3] + transform.m_world[11];
+			}
+			return sum;
+		}
+	}
+
+	MAGE_TEST(RegistryViewVisitsEntitiesWithAllComponents) {
+		TestRegistry registry;
+		CreateEntities(registry, 1000u);
+
+		std::size_t nb_visited = 0u;
+		registry.ForEach< TestTransform, TestVelocity >(
+			[&nb_visited](Entity entity, TestTransform&, TestVelocity&) {
+				MAGE_CHECK(0u != entity.GetID() % 4u);
+				++nb_visited;
+			});
+		MAGE_CHECK(750u == nb_visited);
+
+		registry.DestroyEntity(Entity(1u));
+		MAGE_CHECK(!registry.HasComponents< TestTransform >(Entity(1u)));
+		MAGE_CHECK((registry.HasComponents< TestTransform, TestVelocity >(Entity(2u))));
+		MAGE_CHECK(!(registry.HasComponents< TestTransform, TestVelocity >(Entity(4u))));
+	}
+
+	MAGE_TEST(RegistryParallelForEachMatchesForEach) {
+		JobSystem job_system(4u);
+
+		TestRegistry sequential;
+		TestRegistry parallel;
+		CreateEntities(sequential, 10000u);
+		CreateEntities(parallel,   10000u);
+
+		sequential.ForEach< TestTransform, TestVelocity >(Update);
+		parallel.ParallelForEach< TestTransform, TestVelocity >(job_system,
+																 Update, 64u);
+
+		const auto& expected = sequential.GetComponents< TestTransform >();
+		const auto& actual   = parallel.GetComponents< TestTransform >();
+		MAGE_CHECK(expected.size() == actual.size());
+		for (std::size_t i = 0u; i < expected.size(); ++i) {
+			for (std::size_t j = 0u; j < 12u; ++j) {
+				MAGE_CHECK(expected[i].m_world[j] == actual[i].m_world[j]);
+			}
+		}
+	}
+
+	MAGE_BENCHMARK(RegistryTransformUpdate) {
+		TestRegistry registry;
+		CreateEntities(registry, 1000000u);
+
+		ReportMeasurement("ForEach (1M entities, 750k updated)",
+			Measure(10u, [&registry]() {
+				registry.ForEach< TestTransform, TestVelocity >(Update);
+				DoNotOptimize(Sum(registry));
+			}));
+
+		for (const std::size_t nb_workers : { 1u, 3u, 7u }) {
+			JobSystem job_system(nb_workers);
+			const auto label = "ParallelForEach, "
+							 + std::to_string(nb_workers + 1u) + " threads";
+			ReportMeasurement(label, Measure(10u, [&registry, &job_system]() {
+				registry.ParallelForEach< TestTransform, TestVelocity >(
+					job_system, Update);
+				DoNotOptimize(Sum(registry));
+			}));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,293 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "geometry\bvh.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 Returns the given number of random AABBs in [-100, 100]^3.
+		 */
+		[[nodiscard]]
+		const std::vector< AABB > CreateAABBs(std::size_t nb_aabbs,
+											  U32 seed) {
+			std::mt19937 generator(seed);
+			std::uniform_real_distribution< F32 > position(-100.0f, 100.0f);
+			std::uniform_real_distribution< F32 > extent(0.1f, 5.0f);
+
+			std::vector< AABB > aabbs;
+			aabbs.reserve(nb_aabbs);
+			for (std::size_t i = 0u; i < nb_aabbs; ++i) {
+				const Point3 c(position(generator),
+							   position(generator),
+							   position(generator));
+				const Point3 r(extent(generator),
+							   extent(generator),
+							   extent(generator));
+				aabbs.emplace_back(Point3(c[0] - r[0], c[1] - r[1], c[2] - r[2]),
+								   Point3(c[0] + r[0], c[1] + r[1], c[2] + r[2]));
+			}
+
+			return aabbs;
+		}
+
+		/**
+		 Returns the unit cubes of an 8x8x8 grid with integer coordinates in
+		 [0, 8]^3.
+		 */
+		[[nodiscard]]
+		const std::vector< AABB > CreateGrid() {
+			std::vector< AABB > aabbs;
+			for (U32 i = 0u; i < 512u; ++i) {
+				const auto x = static_cast< F32 >(i % 8u);
+				const auto y = static_cast< F32 >(i / 8u % 8u);
+				const auto z = static_cast< F32 >(i / 64u);
+				aabbs.emplace_back(Point3(x, y, z),
+								   Point3(x + 1.0f, y + 1.0f, z + 1.0f));
+			}
+
+			return aabbs;
+		}
+
+		/**
+		 Checks whether the given ray segment intersects the given AABB, one
+		 axis at a time.
+		 */
+		[[nodiscard]]
+		bool Intersects(const AABB& aabb,
+						const F32x3& origin,
+						const F32x3& direction,
+						F32 max_distance) noexcept {
+
+			const auto p_min = XMStore< F32x3 >(aabb.MinPoint());
+			const auto p_max = XMStore< F32x3 >(aabb.MaxPoint());
+
+			auto t_enter = 0.0f;
+			auto t_exit  = max_distance;
+			for (std::size_t i = 0u; i < 3u; ++i) {
+				if (0.0f == direction[i]) {
+					if (origin[i] < p_min[i] || p_max[i] < origin[i]) {
+						return false;
+					}
+					continue;
+				}
+
+				const auto inv_d = 1.0f / direction[i];
+				const auto t1 = (p_min[i] - origin[i]) * inv_d;
+				const auto t2 = (p_max[i] - origin[i]) * inv_d;
+				t_enter = std::max(t_enter, std::min(t1, t2));
+				t_exit  = std::min(t_exit,  std::max(t1, t2));
+			}
+
+			return t_enter <= t_exit;
+		}
+
+		/**
+		 Returns the (increasing) indices of the primitives of the given BVH
+		 intersected by the given ray segment.
+		 */
+		[[nodiscard]]
+		const std::vector< U32 > Raycast(const BVH& bvh,
+										 const F32x3& origin,
+										 const F32x3& direction,
+										 F32 max_distance) {
+			std::vector< U32 > indices;
+			bvh.ForEach(XMLoad(origin), XMLoad(direction), max_distance,
+						[&indices](U32 index) {
+							indices.push_back(index);
+						});
+			std::sort(indices.begin(), indices.end());
+			return indices;
+		}
+
+		/**
+		 Returns the (increasing) indices of the given AABBs satisfying the
+		 given predicate.
+		 */
+		template< typename PredicateT >
+		[[nodiscard]]
+		const std::vector< U32 > Filter(const std::vector< AABB >& aabbs,
+										PredicateT&& predicate) {
+			std::vector< U32 > indices;
+			for (std::size_t i = 0u; i < aabbs.size(); ++i) {
+				if (predicate(aabbs[i])) {
+					indices.push_back(static_cast< U32 >(i));
+				}
+			}
+			return indices;
+		}
+	}
+
+	MAGE_TEST(BVHFrustumCullingMatchesBruteForce) {
+		auto aabbs = CreateAABBs(5000u, 3u);
+
+		BVH bvh;
+		bvh.Build(aabbs.data(), aabbs.size());
+		MAGE_CHECK(aabbs.size() == bvh.GetNumberOfPrimitives());
+
+		const auto check = [&bvh, &aabbs]() {
+			for (U32 view = 0u; view < 8u; ++view) {
+				const auto world_to_projection
+					= XMMatrixRotationRollPitchYaw(0.3f * view, 0.8f * view, 0.0f)
+					* XMMatrixPerspectiveFovLH(XM_PIDIV2, 1.0f, 0.1f, 80.0f);
+				const BoundingFrustum frustum(world_to_projection);
+
+				std::vector< U32 > actual;
+				bvh.ForEach(frustum, [&actual](U32 index) {
+					actual.push_back(index);
+				});
+				std::sort(actual.begin(), actual.end());
+
+				const auto expected = Filter(aabbs, [&frustum](const AABB& aabb) {
+					return frustum.Overlaps(aabb);
+				});
+				MAGE_CHECK(!expected.empty());
+				MAGE_CHECK(expected == actual);
+			}
+		};
+
+		check();
+
+		// Refitting preserves the results.
+		const auto offset = XMVectorSet(7.0f, -3.0f, 11.0f, 0.0f);
+		for (std::size_t i = 0u; i < aabbs.size(); i += 3u) {
+			aabbs[i] = AABB(aabbs[i].MinPoint() + offset,
+							aabbs[i].MaxPoint() + offset);
+		}
+		bvh.Refit(aabbs.data());
+		check();
+	}
+
+	MAGE_TEST(BVHSphereQueryMatchesBruteForce) {
+		const auto aabbs = CreateAABBs(5000u, 5u);
+
+		BVH bvh;
+		bvh.Build(aabbs.data(), aabbs.size());
+
+		std::mt19937 generator(7u);
+		std::uniform_real_distribution< F32 > position(-100.0f, 100.0f);
+		std::uniform_real_distribution< F32 > radius(0.0f, 30.0f);
+		for (U32 i = 0u; i < 64u; ++i) {
+			const BoundingSphere sphere(Point3(position(generator),
+											   position(generator),
+											   position(generator)),
+										radius(generator));
+
+			std::vector< U32 > actual;
+			bvh.ForEach(sphere, [&actual](U32 index) {
+				actual.push_back(index);
+			});
+			std::sort(actual.begin(), actual.end());
+
+			const auto expected = Filter(aabbs, [&sphere](const AABB& aabb) {
+				const auto d = XMVectorMax(
+					XMVectorMax(aabb.MinPoint() - sphere.Centroid(),
+								sphere.Centroid() - aabb.MaxPoint()),
+					XMVectorZero());
+				return XMVectorGetX(XMVector3LengthSq(d))
+					<= sphere.Radius() * sphere.Radius();
+			});
+			MAGE_CHECK(expected == actual);
+		}
+	}
+
+	MAGE_TEST(BVHRaycastMatchesBruteForce) {
+		const auto aabbs = CreateAABBs(5000u, 9u);
+
+		BVH bvh;
+		bvh.Build(aabbs.data(), aabbs.size());
+
+		std::mt19937 generator(13u);
+		std::uniform_real_distribution< F32 > position(-120.0f, 120.0f);
+		std::uniform_real_distribution< F32 > direction(-1.0f, 1.0f);
+		std::uniform_real_distribution< F32 > distance(1.0f, 400.0f);
+		for (U32 i = 0u; i < 256u; ++i) {
+			const F32x3 o(position(generator),
+						  position(generator),
+						  position(generator));
+			F32x3 d(direction(generator),
+					direction(generator),
+					direction(generator));
+			// Zero direction components.
+			if (0u == i % 4u) {
+				d[i % 3u] = 0.0f;
+			}
+			const auto max_distance = distance(generator);
+
+			const auto expected = Filter(aabbs,
+				[&o, &d, max_distance](const AABB& aabb) {
+					return Intersects(aabb, o, d, max_distance);
+				});
+			MAGE_CHECK(expected == Raycast(bvh, o, d, max_distance));
+		}
+	}
+
+	MAGE_TEST(BVHRaycastAlongSlabBoundaries) {
+		const auto aabbs = CreateGrid();
+
+		BVH bvh;
+		bvh.Build(aabbs.data(), aabbs.size());
+
+		// Along the x axis, on the boundaries of two y and two z slabs: the
+		// direction vanishes and the origin lies on the boundaries, i.e.
+		// (0 * inf) for a naive slab test.
+		{
+			const auto indices = Raycast(bvh, F32x3(-1.0f, 2.0f, 3.0f),
+										 F32x3(1.0f, 0.0f, 0.0f), 100.0f);
+			MAGE_CHECK(32u == indices.size());
+			for (const auto index : indices) {
+				const auto y = index / 8u % 8u;
+				const auto z = index / 64u;
+				MAGE_CHECK(1u == y || 2u == y);
+				MAGE_CHECK(2u == z || 3u == z);
+			}
+		}
+
+		// Along the negative z axis, on the outer boundary of the grid.
+		{
+			const auto indices = Raycast(bvh, F32x3(2.5f, 8.0f, 9.0f),
+										 F32x3(0.0f, 0.0f, -1.0f), 100.0f);
+			MAGE_CHECK(8u == indices.size());
+			for (const auto index : indices) {
+				MAGE_CHECK(2u == index % 8u);
+				MAGE_CHECK(7u == index / 8u % 8u);
+			}
+		}
+
+		// The ray segment ends on the boundary of the third slab.
+		MAGE_CHECK(3u == Raycast(bvh, F32x3(-1.0f, 0.5f, 0.5f),
+								 F32x3(1.0f, 0.0f, 0.0f), 3.0f).size());
+
+		// The ray segment starts beyond the grid.
+		MAGE_CHECK(Raycast(bvh, F32x3(9.0f, 0.5f, 0.5f),
+						   F32x3(1.0f, 0.0f, 0.0f), 100.0f).empty());
+
+		// A zero direction degenerates to a point query.
+		{
+			const auto indices = Raycast(bvh, F32x3(2.0f, 3.0f, 4.0f),
+										 F32x3(0.0f, 0.0f, 0.0f), 100.0f);
+			MAGE_CHECK(8u == indices.size());
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,271 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "collection\vector.hpp"
+#include "geometry\frustum_culling.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 Returns the world-to-projection transformation matrix of a camera
+		 at the origin looking along the z axis.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetWorldToProjectionMatrix() noexcept {
+			return XMMatrixPerspectiveFovLH(XM_PI / 3.0f, 16.0f / 9.0f,
+											0.1f, 150.0f);
+		}
+
+		/**
+		 Returns the given number of random AABBs in [-100, 100]^3.
+		 */
+		[[nodiscard]]
+		const std::vector< AABB > CreateAABBs(std::size_t nb_aabbs) {
+			std::mt19937 generator(11u);
+			std::uniform_real_distribution< F32 > position(-100.0f, 100.0f);
+			std::uniform_real_distribution< F32 > extent(0.1f, 3.0f);
+
+			std::vector< AABB > aabbs;
+			aabbs.reserve(nb_aabbs);
+			for (std::size_t i = 0u; i < nb_aabbs; ++i) {
+				const Point3 c(position(generator),
+							   position(generator),
+							   position(generator));
+				const Point3 r(extent(generator),
+							   extent(generator),
+							   extent(generator));
+				aabbs.emplace_back(Point3(c[0] - r[0], c[1] - r[1], c[2] - r[2]),
+								   Point3(c[0] + r[0], c[1] + r[1], c[2] + r[2]));
+			}
+
+			return aabbs;
+		}
+
+		/**
+		 Returns the signed distance between the given point and the nearest
+		 plane of the given bounding frustum which the point is outside.
+		 Returns the distance to the nearest plane if the point is inside.
+		 */
+		[[nodiscard]]
+		F32 XM_CALLCONV GetPlaneDistance(const BoundingFrustum& frustum,
+										 FXMVECTOR point) noexcept {
+			auto distance = std::numeric_limits< F32 >::infinity();
+			for (std::size_t i = 0u; i < 6u; ++i) {
+				const auto plane  = frustum.GetPlane(i);
+				const auto length = XMVectorGetX(XMVector3Length(plane));
+				distance = std::min(distance,
+					XMVectorGetX(XMPlaneDotCoord(plane, point)) / length);
+			}
+			return distance;
+		}
+
+		/**
+		 Checks whether the given culling results only differ for bounding
+		 volumes touching a plane (i.e. for which the rounding errors of the
+		 per-object and batch tests may differ).
+		 */
+		template< typename IsTouchingT >
+		[[nodiscard]]
+		bool Matches(const std::vector< U32 >& expected,
+					 const std::vector< U32 >& actual,
+					 IsTouchingT&& is_touching) {
+
+			std::vector< U32 > differences;
+			std::set_symmetric_difference(expected.cbegin(), expected.cend(),
+										  actual.cbegin(),   actual.cend(),
+										  std::back_inserter(differences));
+
+			return std::all_of(differences.cbegin(), differences.cend(),
+							   is_touching);
+		}
+	}
+
+	MAGE_TEST(AABBArrayCullMatchesBoundingFrustum) {
+		const auto aabbs = CreateAABBs(10003u);
+		const BoundingFrustum frustum(GetWorldToProjectionMatrix());
+
+		AABBArray array;
+		array.reserve(aabbs.size());
+		for (const auto& aabb : aabbs) {
+			array.push_back(aabb);
+		}
+
+		std::vector< U32 > expected;
+		for (std::size_t i = 0u; i < aabbs.size(); ++i) {
+			if (frustum.Overlaps(aabbs[i])) {
+				expected.push_back(static_cast< U32 >(i));
+			}
+		}
+
+		std::vector< U32 > actual;
+		array.Cull(frustum, actual);
+
+		MAGE_CHECK(!expected.empty());
+		MAGE_CHECK(expected.size() < aabbs.size());
+		MAGE_CHECK(std::is_sorted(actual.cbegin(), actual.cend()));
+		MAGE_CHECK(Matches(expected, actual, [&aabbs, &frustum](U32 index) {
+			const auto& aabb = aabbs[index];
+			// The maximum point along the normal of the nearest plane
+			// touches this plane.
+			for (std::size_t i = 0u; i < 6u; ++i) {
+				const auto p = aabb.MaxPointAlongNormal(frustum.GetPlane(i));
+				if (std::abs(GetPlaneDistance(frustum, p)) < 1e-3f) {
+					return true;
+				}
+			}
+			return false;
+		}));
+
+		// Transformed AABBs.
+		const auto object_to_world = XMMatrixTranslation(0.0f, 0.0f, 50.0f);
+		AABBArray transformed;
+		for (const auto& aabb : aabbs) {
+			transformed.push_back(aabb, object_to_world);
+		}
+		transformed.Cull(frustum, actual);
+		MAGE_CHECK(expected.size() < actual.size());
+	}
+
+	MAGE_TEST(BoundingSphereArrayCullMatchesBoundingFrustum) {
+		const auto aabbs = CreateAABBs(10003u);
+		const BoundingFrustum frustum(GetWorldToProjectionMatrix());
+
+		BoundingSphereArray array;
+		std::vector< BoundingSphere > spheres;
+		for (const auto& aabb : aabbs) {
+			spheres.emplace_back(aabb);
+			array.push_back(spheres.back());
+		}
+
+		std::vector< U32 > expected;
+		for (std::size_t i = 0u; i < spheres.size(); ++i) {
+			if (frustum.Overlaps(spheres[i])) {
+				expected.push_back(static_cast< U32 >(i));
+			}
+		}
+
+		std::vector< U32 > actual;
+		array.Cull(frustum, actual);
+
+		MAGE_CHECK(!expected.empty());
+		MAGE_CHECK(expected.size() < spheres.size());
+		MAGE_CHECK(std::is_sorted(actual.cbegin(), actual.cend()));
+		MAGE_CHECK(Matches(expected, actual, [&spheres, &frustum](U32 index) {
+			const auto& sphere = spheres[index];
+			// The sphere touches a plane.
+			for (std::size_t i = 0u; i < 6u; ++i) {
+				const auto plane  = frustum.GetPlane(i);
+				const auto length = XMVectorGetX(XMVector3Length(plane));
+				const auto distance
+					= XMVectorGetX(XMPlaneDotCoord(plane, sphere.Centroid()))
+					/ length + sphere.Radius() / length;
+				if (std::abs(distance) < 1e-3f) {
+					return true;
+				}
+			}
+			return false;
+		}));
+
+		// Empty arrays.
+		BoundingSphereArray empty;
+		empty.Cull(frustum, actual);
+		MAGE_CHECK(actual.empty());
+	}
+
+	MAGE_BENCHMARK(FrustumCulling) {
+		const auto world_to_projection = GetWorldToProjectionMatrix();
+		const BoundingFrustum frustum(world_to_projection);
+
+		for (const std::size_t nb_objects : { 1000u, 10000u, 100000u, 1000000u }) {
+			const auto aabbs = CreateAABBs(nb_objects);
+			const auto label = std::to_string(nb_objects / 1000u) + "k";
+			const std::size_t nb_iterations
+				= std::max< std::size_t >(10u, 10000000u / nb_objects);
+			const auto throughput = [nb_objects](F64 milliseconds) {
+				return static_cast< F64 >(nb_objects) / (1.0e6 * milliseconds);
+			};
+
+			// One matrix multiply and one clip-space test per object (i.e.
+			// BoundingFrustum::Cull per model per pass).
+			AlignedVector< XMMATRIX > transforms;
+			std::vector< AABB > local_aabbs;
+			for (const auto& aabb : aabbs) {
+				transforms.push_back(XMMatrixTranslationFromVector(aabb.Centroid()));
+				local_aabbs.emplace_back(aabb.MinPoint() - aabb.Centroid(),
+										 aabb.MaxPoint() - aabb.Centroid());
+			}
+			ReportValue("BoundingFrustum::Cull (" + label + " AABBs)",
+				throughput(Measure(nb_iterations,
+					[&transforms, &local_aabbs, world_to_projection]() {
+						U32 nb_visible = 0u;
+						for (std::size_t i = 0u; i < local_aabbs.size(); ++i) {
+							const auto object_to_projection
+								= transforms[i] * world_to_projection;
+							nb_visible += BoundingFrustum::Cull(
+								object_to_projection, local_aabbs[i]) ? 0u : 1u;
+						}
+						DoNotOptimize(nb_visible);
+					})),
+				"objects/ns");
+
+			// One world-space test per object.
+			ReportValue("BoundingFrustum::Overlaps (" + label + " AABBs)",
+				throughput(Measure(nb_iterations, [&aabbs, &frustum]() {
+					U32 nb_visible = 0u;
+					for (const auto& aabb : aabbs) {
+						nb_visible += frustum.Overlaps(aabb) ? 1u : 0u;
+					}
+					DoNotOptimize(nb_visible);
+				})),
+				"objects/ns");
+
+			AABBArray aabb_array;
+			BoundingSphereArray sphere_array;
+			for (const auto& aabb : aabbs) {
+				aabb_array.push_back(aabb);
+				sphere_array.push_back(BoundingSphere(aabb));
+			}
+			std::vector< U32 > indices;
+
+			ReportValue("AABBArray::Cull (" + label + " AABBs)",
+				throughput(Measure(nb_iterations,
+					[&aabb_array, &frustum, &indices]() {
+						aabb_array.Cull(frustum, indices);
+						DoNotOptimize(indices.size());
+					})),
+				"objects/ns");
+
+			ReportValue("BoundingSphereArray::Cull (" + label + " spheres)",
+				throughput(Measure(nb_iterations,
+					[&sphere_array, &frustum, &indices]() {
+						sphere_array.Cull(frustum, indices);
+						DoNotOptimize(indices.size());
+					})),
+				"objects/ns");
+		}
+	}
+}
\ No newline at end of file
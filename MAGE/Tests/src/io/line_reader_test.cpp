@@ -0,0 +1,165 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "io\line_reader.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A class of line readers collecting all tokens per line.
+		 */
+		class TokenReader : public LineReader {
+
+		public:
+
+			using LineReader::ReadFromMemory;
+
+			std::vector< std::vector< std::string > > m_lines;
+
+		private:
+
+			void ReadLine() override {
+				auto& tokens = m_lines.emplace_back();
+				while (ContainsTokens()) {
+					tokens.push_back(Read< std::string >());
+				}
+			}
+		};
+
+		/**
+		 A class of line readers counting all tokens without copying them.
+		 */
+		class TokenCounter : public LineReader {
+
+		public:
+
+			using LineReader::ReadFromMemory;
+
+			std::size_t m_nb_tokens = 0u;
+
+			std::size_t m_nb_token_chars = 0u;
+
+		private:
+
+			void ReadLine() override {
+				while (ContainsTokens()) {
+					const auto token = Read< std::string_view >();
+					++m_nb_tokens;
+					m_nb_token_chars += token.size();
+				}
+			}
+		};
+
+		[[nodiscard]]
+		const std::vector< std::vector< std::string > >
+			TokenizeWithScanner(const std::string& input) {
+
+			TokenReader reader;
+			reader.ReadFromMemory(std::string_view(input));
+			return std::move(reader.m_lines);
+		}
+
+		[[nodiscard]]
+		const std::vector< std::vector< std::string > >
+			TokenizeWithRegex(const std::string& input) {
+
+			TokenReader reader;
+			reader.ReadFromMemory(input, LineReader::s_default_regex);
+			return std::move(reader.m_lines);
+		}
+
+		[[nodiscard]]
+		const std::string CreateOBJInput(std::size_t nb_lines) {
+			std::string input;
+			for (std::size_t i = 0u; i < nb_lines; ++i) {
+				switch (i % 3u) {
+				case 0u:
+					input += "v 0.125 -1.5 3.25\n";
+					break;
+				case 1u:
+					input += "vt 0.5 0.75\n";
+					break;
+				default:
+					input += "f 1/1/1 2/2/2 3/3/3\n";
+					break;
+				}
+			}
+			return input;
+		}
+	}
+
+	MAGE_TEST(LineReaderScannerMatchesDefaultRegex) {
+		const char* inputs[] = {
+			"v 1 2 3",
+			"  \"a b\" c",
+			"\"\" x",
+			"\"abc def",
+			"abc\"def ghi\"",
+			"\"abc\"def",
+			"x\t\"y\"\"z\" \r",
+			"",
+			"\"a\" \"b c\" \"d",
+			"a\n\nb c\n  \n\"d e\"\n",
+			"trailing\r\nline\r\n",
+		};
+
+		for (const auto input : inputs) {
+			MAGE_CHECK(TokenizeWithRegex(input) == TokenizeWithScanner(input));
+		}
+	}
+
+	MAGE_TEST(LineReaderScannerStripsQuotes) {
+		const auto lines = TokenizeWithScanner("usemtl \"my material\" x\n");
+		MAGE_CHECK(1u == lines.size());
+		MAGE_CHECK(3u == lines[0].size());
+		MAGE_CHECK("my material" == lines[0][1]);
+	}
+
+	MAGE_BENCHMARK(LineReaderTokenize) {
+		const auto input = CreateOBJInput(300000u);
+		const auto nb_megabytes = static_cast< F64 >(input.size()) / 1000000.0;
+
+		// The token views are counted, not copied: only the scanning of the
+		// input is measured.
+		const auto scanner_milliseconds = Measure(5u, [&input]() {
+			TokenCounter counter;
+			counter.ReadFromMemory(std::string_view(input));
+			DoNotOptimize(counter.m_nb_tokens);
+			DoNotOptimize(counter.m_nb_token_chars);
+		});
+		const auto regex_milliseconds = Measure(1u, [&input]() {
+			TokenCounter counter;
+			counter.ReadFromMemory(input, LineReader::s_default_regex);
+			DoNotOptimize(counter.m_nb_tokens);
+			DoNotOptimize(counter.m_nb_token_chars);
+		});
+
+		ReportMeasurement("scanner (300k lines)", scanner_milliseconds);
+		ReportValue("scanner (300k lines)",
+					1000.0 * nb_megabytes / scanner_milliseconds, "MB/s");
+		ReportMeasurement("std::regex (300k lines)", regex_milliseconds);
+		ReportValue("std::regex (300k lines)",
+					1000.0 * nb_megabytes / regex_milliseconds, "MB/s");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,402 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "loaders\msh\msh_loader.hpp"
+#include "system\system_usage.hpp"
+#include "type\atomic_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		using namespace rendering;
+		using namespace rendering::loader;
+
+		/**
+		 A struct of vertices with a position, normal and texture coordinates
+		 (i.e. the layout of VertexPositionNormalTexture).
+		 */
+		struct TestVertex {
+
+		public:
+
+			[[nodiscard]]
+			static constexpr bool HasPosition() noexcept {
+				return true;
+			}
+
+			[[nodiscard]]
+			static constexpr bool HasNormal() noexcept {
+				return true;
+			}
+
+			[[nodiscard]]
+			static constexpr bool HasTexture() noexcept {
+				return true;
+			}
+
+			[[nodiscard]]
+			static constexpr bool HasColor() noexcept {
+				return false;
+			}
+
+			F32x3 m_p;
+			F32x3 m_n;
+			F32x2 m_tex;
+		};
+
+		/**
+		 A class of temporary MSH files.
+		 */
+		class TemporaryMSHFile {
+
+		public:
+
+			TemporaryMSHFile(std::size_t nb_vertices, std::size_t nb_indices)
+				: m_path(std::filesystem::temp_directory_path()
+						 / "mage_msh_loader_test.msh"),
+				m_vertices(nb_vertices),
+				m_indices(nb_indices) {
+
+				for (std::size_t i = 0u; i < nb_vertices; ++i) {
+					const auto f = static_cast< F32 >(i);
+					m_vertices[i] = { F32x3(f, -f, 0.5f * f),
+									  F32x3(0.0f, 1.0f, 0.0f),
+									  F32x2(0.25f * f, 0.75f) };
+				}
+				for (std::size_t i = 0u; i < nb_indices; ++i) {
+					m_indices[i] = static_cast< U32 >((7u * i) % nb_vertices);
+				}
+
+				ExportMSHMeshToFile(m_path, m_vertices, m_indices);
+			}
+
+			TemporaryMSHFile(const TemporaryMSHFile& file) = delete;
+
+			TemporaryMSHFile(TemporaryMSHFile&& file) = delete;
+
+			~TemporaryMSHFile() {
+				std::error_code error;
+				std::filesystem::remove(m_path, error);
+			}
+
+			TemporaryMSHFile& operator=(const TemporaryMSHFile& file) = delete;
+
+			TemporaryMSHFile& operator=(TemporaryMSHFile&& file) = delete;
+
+			std::filesystem::path m_path;
+			std::vector< TestVertex > m_vertices;
+			std::vector< U32 > m_indices;
+		};
+
+		[[nodiscard]]
+		bool operator==(const TestVertex& lhs, const TestVertex& rhs) noexcept {
+			return lhs.m_p   == rhs.m_p
+				&& lhs.m_n   == rhs.m_n
+				&& lhs.m_tex == rhs.m_tex;
+		}
+
+		/**
+		 Returns the bytes of the file associated with the given path.
+		 */
+		[[nodiscard]]
+		const std::string ReadBytes(const std::filesystem::path& path) {
+			std::ifstream file(path, std::ios::binary);
+			return std::string(std::istreambuf_iterator< char >(file),
+							   std::istreambuf_iterator< char >());
+		}
+
+		/**
+		 Writes the given bytes to the file associated with the given path.
+		 */
+		void WriteBytes(const std::filesystem::path& path,
+						const std::string& bytes) {
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(bytes.data(), static_cast< std::streamsize >(bytes.size()));
+		}
+
+		/**
+		 Returns the bytes of the MSH v1 file of the given mesh (i.e. the
+		 output of the MSH writer before MSH v2: the magic token, the number
+		 of vertices and indices, and the vertices and indices as written by
+		 the big endian binary writer).
+		 */
+		[[nodiscard]]
+		const std::string CreateMSHv1(const std::vector< TestVertex >& vertices,
+									  const std::vector< U32 >& indices) {
+			std::string bytes(g_msh_token_magic);
+			const auto append = [&bytes](const void* data, std::size_t size) {
+				bytes.append(static_cast< const char* >(data), size);
+			};
+
+			const auto nb_vertices = static_cast< U32 >(vertices.size());
+			const auto nb_indices  = static_cast< U32 >(indices.size());
+			append(&nb_vertices, sizeof(nb_vertices));
+			append(&nb_indices,  sizeof(nb_indices));
+			append(vertices.data(), sizeof(TestVertex) * vertices.size());
+			append(indices.data(),  sizeof(U32) * indices.size());
+
+			return bytes;
+		}
+
+		/**
+		 Overwrites the given bytes with the given value at the given offset.
+		 */
+		template< typename T >
+		void Patch(std::string& bytes, std::size_t offset, T value) noexcept {
+			std::memcpy(bytes.data() + offset, &value, sizeof(T));
+		}
+
+		/**
+		 Imports the mesh from the given MSH file the way the MSH loader did
+		 before memory mapping: the file is read into an intermediate buffer
+		 before the vertices and indices are copied into the given vectors.
+		 */
+		void ImportMSHMeshFromFileBuffered(const std::filesystem::path& path,
+										   std::vector< TestVertex >& vertices,
+										   std::vector< U32 >& indices) {
+			UniquePtr< U8[] > data;
+			std::size_t size = 0u;
+			ReadBinaryFile(path, data, size);
+
+			MSHReader< TestVertex, U32 > reader;
+			reader.ReadFromMemory(gsl::make_span(data.get(), size), path);
+
+			const auto read_vertices = reader.GetVertices();
+			vertices.assign(read_vertices.cbegin(), read_vertices.cend());
+			const auto read_indices  = reader.GetIndices();
+			indices.assign(read_indices.cbegin(), read_indices.cend());
+		}
+
+		/**
+		 Applies the given action while sampling the working set (i.e. the
+		 resident memory, including mapped file pages) of this process on
+		 another thread.
+
+		 @return		The peak increase of the working set (in MiB) while
+						applying the given action.
+		 */
+		template< typename ActionT >
+		[[nodiscard]]
+		F64 SamplePeakWorkingSet(ActionT&& action) {
+			const auto begin = GetPhysicalMemoryUsage();
+			U64 peak = begin;
+			AtomicBool done = false;
+
+			std::thread sampler([&peak, &done]() {
+				while (!done.load(std::memory_order_acquire)) {
+					peak = std::max(peak, GetPhysicalMemoryUsage());
+					std::this_thread::sleep_for(std::chrono::microseconds(100));
+				}
+			});
+
+			action();
+
+			done.store(true, std::memory_order_release);
+			sampler.join();
+
+			return static_cast< F64 >(peak - begin) / 1048576.0;
+		}
+
+		/**
+		 Touches all vertices and indices of the given mesh.
+		 */
+		template< typename VerticesT, typename IndicesT >
+		[[nodiscard]]
+		F32 Touch(const VerticesT& vertices, const IndicesT& indices) noexcept {
+			F32 sum = 0.0f;
+			for (const auto& vertex : vertices) {
+				sum += vertex.m_p[0];
+			}
+			for (const auto index : indices) {
+				sum += static_cast< F32 >(index);
+			}
+			return sum;
+		}
+	}
+
+	MAGE_TEST(MSHImportMatchesExport) {
+		const TemporaryMSHFile file(1000u, 3000u);
+
+		std::vector< TestVertex > vertices;
+		std::vector< U32 > indices;
+		ImportMSHMeshFromFile(file.m_path, vertices, indices);
+		MAGE_CHECK(file.m_vertices == vertices);
+		MAGE_CHECK(file.m_indices  == indices);
+
+		MeshView< TestVertex, U32 > mesh_view;
+		ImportMSHMeshFromFile(file.m_path, mesh_view);
+		const auto view_vertices = mesh_view.GetVertices();
+		const auto view_indices  = mesh_view.GetIndices();
+		MAGE_CHECK(std::equal(view_vertices.cbegin(), view_vertices.cend(),
+							  file.m_vertices.cbegin(), file.m_vertices.cend()));
+		MAGE_CHECK(std::equal(view_indices.cbegin(), view_indices.cend(),
+							  file.m_indices.cbegin(), file.m_indices.cend()));
+	}
+
+	MAGE_TEST(MSHImportRejectsIndexTypeMismatch) {
+		const TemporaryMSHFile file(16u, 48u);
+
+		std::vector< TestVertex > vertices;
+		std::vector< U16 > indices;
+		MAGE_CHECK_THROWS(ImportMSHMeshFromFile(file.m_path, vertices, indices));
+	}
+
+	MAGE_TEST(MSHImportReadsV1) {
+		const TemporaryMSHFile file(100u, 300u);
+		WriteBytes(file.m_path, CreateMSHv1(file.m_vertices, file.m_indices));
+
+		std::vector< TestVertex > vertices;
+		std::vector< U32 > indices;
+		ImportMSHMeshFromFile(file.m_path, vertices, indices);
+		MAGE_CHECK(file.m_vertices == vertices);
+		MAGE_CHECK(file.m_indices  == indices);
+
+		MeshView< TestVertex, U32 > mesh_view;
+		ImportMSHMeshFromFile(file.m_path, mesh_view);
+		const auto view_vertices = mesh_view.GetVertices();
+		const auto view_indices  = mesh_view.GetIndices();
+		MAGE_CHECK(std::equal(view_vertices.cbegin(), view_vertices.cend(),
+							  file.m_vertices.cbegin(), file.m_vertices.cend()));
+		MAGE_CHECK(std::equal(view_indices.cbegin(), view_indices.cend(),
+							  file.m_indices.cbegin(), file.m_indices.cend()));
+	}
+
+	MAGE_TEST(MSHConvertV1ToV2) {
+		const TemporaryMSHFile file(100u, 300u);
+		const auto v2 = ReadBytes(file.m_path);
+		WriteBytes(file.m_path, CreateMSHv1(file.m_vertices, file.m_indices));
+
+		// Converting results in the exported MSH v2 file.
+		ConvertMSHMeshFile< TestVertex, U32 >(file.m_path);
+		const auto converted = ReadBytes(file.m_path);
+		MAGE_CHECK(0u == converted.compare(0u, 8u, g_msh_v2_token_magic));
+		MAGE_CHECK(v2 == converted);
+
+		// Converting an MSH v2 file preserves it.
+		ConvertMSHMeshFile< TestVertex, U32 >(file.m_path);
+		MAGE_CHECK(v2 == ReadBytes(file.m_path));
+
+		std::vector< TestVertex > vertices;
+		std::vector< U32 > indices;
+		ImportMSHMeshFromFile(file.m_path, vertices, indices);
+		MAGE_CHECK(file.m_vertices == vertices);
+		MAGE_CHECK(file.m_indices  == indices);
+	}
+
+	MAGE_TEST(MSHImportRejectsInvalidChunkTables) {
+		// The offsets of the MSH v2 layout.
+		static constexpr std::size_t s_nb_chunks_offset = 8u + 20u;
+		static constexpr std::size_t s_chunks_offset    = 8u + sizeof(MSHHeader);
+		static constexpr std::size_t s_offset_offset    = s_chunks_offset + 8u;
+		static constexpr std::size_t s_size_offset      = s_chunks_offset + 16u;
+
+		const TemporaryMSHFile file(16u, 48u);
+		const auto bytes = ReadBytes(file.m_path);
+		U64 vertices_offset;
+		std::memcpy(&vertices_offset, bytes.data() + s_offset_offset, sizeof(U64));
+		MAGE_CHECK(0u == vertices_offset % g_msh_v2_alignment);
+
+		const auto import = [&file](const std::string& invalid_bytes) {
+			WriteBytes(file.m_path, invalid_bytes);
+			std::vector< TestVertex > vertices;
+			std::vector< U32 > indices;
+			ImportMSHMeshFromFile(file.m_path, vertices, indices);
+		};
+
+		// Truncated chunk table.
+		MAGE_CHECK_THROWS(import(bytes.substr(0u, s_chunks_offset + 40u)));
+		// Truncated chunk payload.
+		MAGE_CHECK_THROWS(import(bytes.substr(0u, bytes.size() - 4u)));
+
+		// Chunk table exceeding the file.
+		auto invalid_bytes = bytes;
+		Patch< U32 >(invalid_bytes, s_nb_chunks_offset, 0xFFFFFFFFu);
+		MAGE_CHECK_THROWS(import(invalid_bytes));
+
+		// Misaligned chunk payload.
+		invalid_bytes = bytes;
+		Patch< U64 >(invalid_bytes, s_offset_offset, vertices_offset + 4u);
+		MAGE_CHECK_THROWS(import(invalid_bytes));
+
+		// Chunk payloads exceeding the file.
+		invalid_bytes = bytes;
+		Patch< U64 >(invalid_bytes, s_offset_offset, 0xFFFFFFFFFFFFFFC0ull);
+		MAGE_CHECK_THROWS(import(invalid_bytes));
+
+		invalid_bytes = bytes;
+		Patch< U64 >(invalid_bytes, s_size_offset, 0xFFFFFFFFFFFFFFE0ull);
+		MAGE_CHECK_THROWS(import(invalid_bytes));
+
+		// The original file is still valid.
+		import(bytes);
+	}
+
+	MAGE_BENCHMARK(MSHImport) {
+		// 2M vertices (64 MiB) and 6M indices (24 MiB).
+		const TemporaryMSHFile file(2000000u, 6000000u);
+
+		// The peak working set of loading a mesh, sampled during the load
+		// (the working set is released after each load).
+		F64 buffered_mib = 0.0;
+		F64 copied_mib   = 0.0;
+		F64 view_mib     = 0.0;
+
+		ReportMeasurement("buffered (read, parse, copy)", Measure(5u,
+			[&file, &buffered_mib]() {
+				buffered_mib = std::max(buffered_mib, SamplePeakWorkingSet([&file]() {
+					std::vector< TestVertex > vertices;
+					std::vector< U32 > indices;
+					ImportMSHMeshFromFileBuffered(file.m_path, vertices, indices);
+					DoNotOptimize(Touch(vertices, indices));
+				}));
+			}));
+
+		ReportMeasurement("memory-mapped (copy into vectors)", Measure(5u,
+			[&file, &copied_mib]() {
+				copied_mib = std::max(copied_mib, SamplePeakWorkingSet([&file]() {
+					std::vector< TestVertex > vertices;
+					std::vector< U32 > indices;
+					ImportMSHMeshFromFile(file.m_path, vertices, indices);
+					DoNotOptimize(Touch(vertices, indices));
+				}));
+			}));
+
+		ReportMeasurement("memory-mapped (mesh view)", Measure(5u,
+			[&file, &view_mib]() {
+				view_mib = std::max(view_mib, SamplePeakWorkingSet([&file]() {
+					MeshView< TestVertex, U32 > mesh_view;
+					ImportMSHMeshFromFile(file.m_path, mesh_view);
+					DoNotOptimize(Touch(mesh_view.GetVertices(),
+										mesh_view.GetIndices()));
+				}));
+			}));
+
+		// The working set includes the mapped file pages of the mesh view.
+		ReportValue("buffered peak working set increase",      buffered_mib, "MiB");
+		ReportValue("memory-mapped peak working set increase", copied_mib,   "MiB");
+		ReportValue("mesh view peak working set increase",     view_mib,     "MiB");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,165 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer\test_device.hpp"
+#include "loaders\obj\obj_reader.hpp"
+#include "resource\rendering_resource_manager.hpp"
+#include "resource\mesh\vertex.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+	using namespace rendering::loader;
+
+	namespace {
+
+		using TestModelOutput = ModelOutput< VertexPositionNormalTexture, U32 >;
+
+		/**
+		 Returns the contents of an OBJ file with the given number of groups
+		 of the given number of quads. Each group switches materials halfway,
+		 and the faces mix absolute and relative (negative) indices, quads and
+		 triangles, and faces with and without texture coordinates. Some faces
+		 refer to vertices of the preceding group.
+		 */
+		[[nodiscard]]
+		const std::string CreateOBJInput(std::size_t nb_groups,
+										 std::size_t nb_quads) {
+			std::string input = "# synthetic OBJ file\n";
+			std::size_t nb_vertices = 0u;
+			std::size_t nb_normals  = 0u;
+
+			for (std::size_t g = 0u; g < nb_groups; ++g) {
+				input += "g group_" + std::to_string(g) + "\n";
+				input += "usemtl material_" + std::to_string(g % 3u) + "\n";
+				input += "s 1\n";
+
+				for (std::size_t q = 0u; q < nb_quads; ++q) {
+					if (nb_quads / 2u == q) {
+						input += "usemtl material_" + std::to_string(g % 3u)
+							   + "_b\n";
+					}
+
+					const auto x = static_cast< F64 >(q) * 0.125;
+					const auto y = static_cast< F64 >(g) * 0.25;
+					input += "v " + std::to_string(x)        + " " + std::to_string(y)        + " 0.5\n";
+					input += "v " + std::to_string(x + 0.1)  + " " + std::to_string(y)        + " 0.5\n";
+					input += "v " + std::to_string(x + 0.1)  + " " + std::to_string(y + 0.2)  + " -0.5\n";
+					input += "v " + std::to_string(x)        + " " + std::to_string(y + 0.2)  + " -0.5\n";
+					input += "vt 0.0 " + std::to_string(x) + "\n";
+					input += "vt 1.0 " + std::to_string(x) + "\n";
+					input += "vt 1.0 " + std::to_string(y) + " 0.0\n";
+					input += "vt 0.0 " + std::to_string(y) + "\n";
+					input += "vn 0.0 0.0 " + std::string((q % 2u) ? "1.0" : "-1.0") + "\n";
+					nb_vertices += 4u;
+					nb_normals  += 1u;
+
+					// A quad with relative indices.
+					input += "f -4/-4/-1 -3/-3/-1 -2/-2/-1 -1/-1/-1\n";
+
+					// A triangle with absolute indices.
+					const auto v = std::to_string(nb_vertices - 3u);
+					const auto n = std::to_string(nb_normals);
+					input += "f " + v + "/" + v + "/" + n + " "
+						   + std::to_string(nb_vertices - 1u) + "/"
+						   + std::to_string(nb_vertices - 1u) + "/" + n + " "
+						   + std::to_string(nb_vertices) + "/"
+						   + std::to_string(nb_vertices) + "/" + n + "\n";
+
+					// A triangle without texture coordinates, referring to
+					// vertices of the preceding quads.
+					if (8u <= nb_vertices) {
+						input += "f -8//-1 -5//-1 -1//-1\n";
+					}
+				}
+			}
+
+			return input;
+		}
+
+		/**
+		 Reads the given OBJ input.
+		 */
+		void Read(ResourceManager& resource_manager,
+				  const std::string& input,
+				  TestModelOutput& model_output,
+				  bool multithreaded) {
+
+			const MeshDescriptor< VertexPositionNormalTexture, U32 > desc(true, true);
+			OBJReader< VertexPositionNormalTexture, U32 >
+				reader(resource_manager, model_output, desc, multithreaded);
+			reader.ReadFromMemory(std::string_view(input));
+		}
+	}
+
+	MAGE_TEST(OBJVertexIndicesParseAbsoluteAndRelativeIndices) {
+		const U32x3 nb_coordinates = { 10u, 20u, 30u };
+		const auto parse = [&nb_coordinates](std::string_view token) {
+			return ParseOBJVertexIndices(token, nb_coordinates, L"test.obj", 1u);
+		};
+
+		MAGE_CHECK(U32x3(1u, 2u, 3u)    == parse("1/2/3"));
+		MAGE_CHECK(U32x3(1u, 0u, 3u)    == parse("1//3"));
+		MAGE_CHECK(U32x3(1u, 2u, 0u)    == parse("1/2"));
+		MAGE_CHECK(U32x3(4u, 0u, 0u)    == parse("4"));
+		MAGE_CHECK(U32x3(10u, 20u, 30u) == parse("-1/-1/-1"));
+		MAGE_CHECK(U32x3(1u, 0u, 29u)   == parse("-10//-2"));
+		MAGE_CHECK_THROWS(parse("x/1/1"));
+		MAGE_CHECK_THROWS(parse("1/x"));
+	}
+
+	MAGE_TEST(OBJReaderParallelMatchesSerial) {
+		// Large enough to be split in chunks.
+		const auto input = CreateOBJInput(40u, 400u);
+		MAGE_CHECK((4u << 20u) <= input.size());
+
+		const auto device = CreateTestDevice();
+		ResourceManager resource_manager(*device.Get());
+
+		TestModelOutput serial;
+		TestModelOutput parallel;
+		Read(resource_manager, input, serial,   false);
+		Read(resource_manager, input, parallel, true);
+
+		MAGE_CHECK(!serial.m_vertex_buffer.empty());
+		MAGE_CHECK(serial.m_vertex_buffer.size() == parallel.m_vertex_buffer.size());
+		MAGE_CHECK(0 == std::memcmp(serial.m_vertex_buffer.data(),
+									parallel.m_vertex_buffer.data(),
+									serial.m_vertex_buffer.size()
+									* sizeof(VertexPositionNormalTexture)));
+		MAGE_CHECK(serial.m_index_buffer == parallel.m_index_buffer);
+
+		// The group and material boundaries delimit the same model parts.
+		MAGE_CHECK(serial.m_model_parts.size() == parallel.m_model_parts.size());
+		MAGE_CHECK(2u * 40u <= serial.m_model_parts.size());
+		for (std::size_t i = 0u; i < serial.m_model_parts.size()
+			 && i < parallel.m_model_parts.size(); ++i) {
+
+			const auto& expected = serial.m_model_parts[i];
+			const auto& actual   = parallel.m_model_parts[i];
+			MAGE_CHECK(expected.m_child       == actual.m_child);
+			MAGE_CHECK(expected.m_parent      == actual.m_parent);
+			MAGE_CHECK(expected.m_material    == actual.m_material);
+			MAGE_CHECK(expected.m_start_index == actual.m_start_index);
+			MAGE_CHECK(expected.m_nb_indices  == actual.m_nb_indices);
+		}
+	}
+}
\ No newline at end of file
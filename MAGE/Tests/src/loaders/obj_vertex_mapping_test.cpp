@@ -0,0 +1,207 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "loaders\obj\obj_vertex_mapping.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <map>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		using rendering::loader::OBJVertexMapping;
+
+		/**
+		 The number of allocated bytes of all counting allocators.
+		 */
+		std::size_t g_nb_allocated_bytes = 0u;
+
+		/**
+		 A class of allocators counting the number of allocated bytes.
+		 */
+		template< typename T >
+		struct CountingAllocator {
+
+		public:
+
+			using value_type = T;
+
+			CountingAllocator() noexcept = default;
+
+			template< typename U >
+			CountingAllocator(const CountingAllocator< U >&) noexcept {}
+
+			[[nodiscard]]
+			T* allocate(std::size_t count) {
+				g_nb_allocated_bytes += count * sizeof(T);
+				return std::allocator< T >().allocate(count);
+			}
+
+			void deallocate(T* ptr, std::size_t count) noexcept {
+				g_nb_allocated_bytes -= count * sizeof(T);
+				std::allocator< T >().deallocate(ptr, count);
+			}
+
+			template< typename U >
+			[[nodiscard]]
+			bool operator==(const CountingAllocator< U >&) const noexcept {
+				return true;
+			}
+
+			template< typename U >
+			[[nodiscard]]
+			bool operator!=(const CountingAllocator< U >&) const noexcept {
+				return false;
+			}
+		};
+
+		/**
+		 A struct of lexicographical comparators of vertex indices (i.e. the
+		 comparator of the previous tree-based OBJ vertex mapping).
+		 */
+		struct VertexIndicesComparator {
+
+		public:
+
+			[[nodiscard]]
+			bool operator()(const U32x3& lhs, const U32x3& rhs) const noexcept {
+				return (lhs[0] == rhs[0]) ? ((lhs[1] == rhs[1]) ? (lhs[2] < rhs[2])
+																 : (lhs[1] < rhs[1]))
+										  : (lhs[0] < rhs[0]);
+			}
+		};
+
+		using TreeMapping = std::map< U32x3, U32, VertexIndicesComparator,
+			CountingAllocator< std::pair< const U32x3, U32 > > >;
+
+		/**
+		 Creates the face corners of a triangulated grid of the given
+		 resolution. Each interior vertex is referenced by six corners.
+		 */
+		[[nodiscard]]
+		const std::vector< U32x3 > CreateGridCorners(U32 resolution) {
+			const auto index = [resolution](U32 x, U32 y) {
+				const auto v = y * resolution + x;
+				return U32x3(v + 1u, v % 1024u + 1u, v + 1u);
+			};
+
+			std::vector< U32x3 > corners;
+			corners.reserve(6u * resolution * resolution);
+			for (U32 y = 0u; y + 1u < resolution; ++y) {
+				for (U32 x = 0u; x + 1u < resolution; ++x) {
+					corners.push_back(index(x,      y));
+					corners.push_back(index(x + 1u, y));
+					corners.push_back(index(x,      y + 1u));
+					corners.push_back(index(x + 1u, y));
+					corners.push_back(index(x + 1u, y + 1u));
+					corners.push_back(index(x,      y + 1u));
+				}
+			}
+			return corners;
+		}
+
+		[[nodiscard]]
+		std::size_t InsertAll(OBJVertexMapping< U32 >& mapping,
+							  const std::vector< U32x3 >& corners) {
+			U32 nb_vertices = 0u;
+			for (const auto& corner : corners) {
+				if (mapping.Insert(corner, nb_vertices).second) {
+					++nb_vertices;
+				}
+			}
+			return nb_vertices;
+		}
+
+		[[nodiscard]]
+		std::size_t InsertAll(TreeMapping& mapping,
+							  const std::vector< U32x3 >& corners) {
+			U32 nb_vertices = 0u;
+			for (const auto& corner : corners) {
+				if (mapping.try_emplace(corner, nb_vertices).second) {
+					++nb_vertices;
+				}
+			}
+			return nb_vertices;
+		}
+	}
+
+	MAGE_TEST(OBJVertexMappingMatchesTreeMapping) {
+		const auto corners = CreateGridCorners(64u);
+
+		OBJVertexMapping< U32 > mapping;
+		TreeMapping expected;
+		U32 nb_vertices = 0u;
+		for (const auto& corner : corners) {
+			const auto [index, inserted] = mapping.Insert(corner, nb_vertices);
+			const auto it = expected.try_emplace(corner, nb_vertices);
+
+			MAGE_CHECK(it.second == inserted);
+			MAGE_CHECK(it.first->second == index);
+			if (inserted) {
+				++nb_vertices;
+			}
+		}
+
+		MAGE_CHECK(expected.size() == mapping.GetSize());
+		MAGE_CHECK(64u * 64u == mapping.GetSize());
+	}
+
+	MAGE_TEST(OBJVertexMappingReserveAvoidsRehashing) {
+		const auto corners = CreateGridCorners(64u);
+
+		OBJVertexMapping< U32 > mapping;
+		mapping.Reserve(64u * 64u);
+		const auto capacity = mapping.GetCapacity();
+
+		MAGE_CHECK(64u * 64u == InsertAll(mapping, corners));
+		MAGE_CHECK(capacity == mapping.GetCapacity());
+	}
+
+	MAGE_BENCHMARK(OBJVertexMappingInsert) {
+		static constexpr U32 s_resolution = 1024u;
+		const auto corners    = CreateGridCorners(s_resolution);
+		const auto nb_corners = static_cast< F64 >(corners.size());
+
+		std::size_t flat_bytes = 0u;
+		const auto flat_ms = Measure(5u, [&corners, &flat_bytes]() {
+			OBJVertexMapping< U32 > mapping;
+			mapping.Reserve(s_resolution * s_resolution);
+			DoNotOptimize(InsertAll(mapping, corners));
+			flat_bytes = mapping.GetCapacity()
+					   * (sizeof(U32x3) + sizeof(U32));
+		});
+
+		std::size_t tree_bytes = 0u;
+		const auto tree_ms = Measure(5u, [&corners, &tree_bytes]() {
+			TreeMapping mapping;
+			DoNotOptimize(InsertAll(mapping, corners));
+			tree_bytes = g_nb_allocated_bytes;
+		});
+
+		ReportMeasurement("flat hash table (6M corners)", flat_ms);
+		ReportValue("flat hash table lookups", nb_corners / flat_ms / 1000.0,
+					"M/s");
+		ReportValue("flat hash table memory",
+					static_cast< F64 >(flat_bytes) / 1048576.0, "MiB");
+		ReportMeasurement("std::map (6M corners)", tree_ms);
+		ReportValue("std::map lookups", nb_corners / tree_ms / 1000.0,
+					"M/s");
+		ReportValue("std::map memory",
+					static_cast< F64 >(tree_bytes) / 1048576.0, "MiB");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,236 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "logging\logging.hpp"
+#include "string\format.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 Returns the path of the log file of the tests.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path GetLogPath() {
+			return std::filesystem::temp_directory_path() / L"mage_async_logger_test.log";
+		}
+
+		/**
+		 Writes the given number of distinct log records on each of the given
+		 number of threads with the given write action.
+
+		 @return		The time in milliseconds until all threads wrote
+						their log records.
+		 */
+		template< typename WriteT >
+		[[nodiscard]]
+		F64 Write(std::size_t nb_threads,
+				  std::size_t nb_records,
+				  WriteT&& write) {
+
+			const auto begin = std::chrono::high_resolution_clock::now();
+
+			std::vector< std::thread > threads;
+			for (std::size_t t = 0u; t < nb_threads; ++t) {
+				threads.emplace_back([&write, t, nb_records]() {
+					for (std::size_t i = 0u; i < nb_records; ++i) {
+						write(Format("thread {} record {}\n", t, i));
+					}
+				});
+			}
+			for (auto& thread : threads) {
+				thread.join();
+			}
+
+			const auto end = std::chrono::high_resolution_clock::now();
+			return std::chrono::duration< F64, std::milli >(end - begin).count();
+		}
+
+		/**
+		 Returns the lines of the log file of the tests.
+		 */
+		[[nodiscard]]
+		const std::vector< std::string > ReadLines() {
+			std::vector< std::string > lines;
+			{
+				std::ifstream file(GetLogPath());
+				std::string line;
+				while (std::getline(file, line)) {
+					lines.push_back(std::move(line));
+				}
+			}
+			std::filesystem::remove(GetLogPath());
+
+			return lines;
+		}
+	}
+
+	MAGE_TEST(AsyncLoggerPreservesPerThreadOrder) {
+		static constexpr std::size_t s_nb_threads = 4u;
+		static constexpr std::size_t s_nb_records = 5000u;
+
+		auto& logger = AsyncLogger::Get();
+		logger.Start(GetLogPath(), false);
+		MAGE_CHECK(logger.IsRunning());
+		DoNotOptimize(Write(s_nb_threads, s_nb_records,
+							[&logger](std::string text) {
+								logger.Write(std::move(text));
+							}));
+		// All pending log records are written before returning.
+		logger.Stop();
+		MAGE_CHECK(!logger.IsRunning());
+
+		std::vector< std::size_t > next(s_nb_threads, 0u);
+		std::size_t nb_lines = 0u;
+		{
+			std::ifstream file(GetLogPath());
+			std::string word;
+			std::size_t t, i;
+			while (file >> word >> t >> word >> i) {
+				MAGE_CHECK(t < s_nb_threads);
+				MAGE_CHECK(next[t] == i);
+				next[t] = i + 1u;
+				++nb_lines;
+			}
+		}
+		std::filesystem::remove(GetLogPath());
+
+		MAGE_CHECK(s_nb_threads * s_nb_records == nb_lines);
+	}
+
+	MAGE_TEST(AsyncLoggerRateLimitsPerFormatString) {
+		auto& logger = AsyncLogger::Get();
+		logger.SetRateLimit(10u, std::chrono::minutes(1));
+		logger.Start(GetLogPath(), false);
+
+		// Warnings differing only in their line number (e.g. LineReader).
+		for (U32 i = 1u; i <= 1000u; ++i) {
+			Warning("{}: line {}: unused token: {}.", "test.obj", i, "x");
+			if (0u == i % 200u) {
+				Warning("{}: line {}: unsupported keyword token: {}.",
+						"test.obj", i, "y");
+			}
+		}
+		logger.Stop();
+
+		const auto lines = ReadLines();
+		MAGE_CHECK(17u == lines.size());
+		if (17u != lines.size()) {
+			return;
+		}
+
+		std::vector< std::string > expected;
+		for (U32 i = 1u; i <= 10u; ++i) {
+			expected.push_back(
+				Format("Warning: test.obj: line {}: unused token: x.", i));
+		}
+		for (U32 i = 200u; i <= 1000u; i += 200u) {
+			expected.push_back(
+				Format("Warning: test.obj: line {}: unsupported keyword token: y.", i));
+		}
+
+		for (std::size_t i = 0u; i < expected.size(); ++i) {
+			MAGE_CHECK(lines[i] == expected[i]);
+		}
+		MAGE_CHECK(lines[15]
+			== "Suppressed 990 similar messages, the last of which was:");
+		MAGE_CHECK(lines[16]
+			== "Warning: test.obj: line 1000: unused token: x.");
+
+		logger.SetRateLimit(10u, std::chrono::seconds(1));
+	}
+
+	MAGE_TEST(AsyncLoggerRateLimitWindowExpires) {
+		auto& logger = AsyncLogger::Get();
+		logger.SetRateLimit(2u, std::chrono::milliseconds(200));
+		logger.Start(GetLogPath(), false);
+
+		for (U32 i = 1u; i <= 5u; ++i) {
+			Warning("{}: line {}: unused token: {}.", "test.obj", i, "x");
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(400));
+		Warning("{}: line {}: unused token: {}.", "test.obj", 6u, "x");
+		logger.Stop();
+
+		const std::vector< std::string > expected = {
+			"Warning: test.obj: line 1: unused token: x.",
+			"Warning: test.obj: line 2: unused token: x.",
+			"Suppressed 3 similar messages, the last of which was:",
+			"Warning: test.obj: line 5: unused token: x.",
+			"Warning: test.obj: line 6: unused token: x."
+		};
+		MAGE_CHECK(expected == ReadLines());
+
+		logger.SetRateLimit(10u, std::chrono::seconds(1));
+	}
+
+	MAGE_BENCHMARK(AsyncLoggerThroughput) {
+		static constexpr std::size_t s_nb_records = 20000u;
+
+		for (const std::size_t nb_threads : { 1u, 2u, 4u, 8u, 16u }) {
+			const auto label  = " (" + std::to_string(nb_threads) + " threads)";
+			const auto nb_all = static_cast< F64 >(nb_threads * s_nb_records);
+
+			// Synchronous writes (i.e. the logging replaced by the
+			// asynchronous logger).
+			{
+				std::FILE* file;
+				const errno_t result = _wfopen_s(&file, GetLogPath().c_str(), L"w");
+				MAGE_CHECK(0 == result);
+				UniqueFileStream file_stream(file);
+
+				const auto milliseconds = Write(nb_threads, s_nb_records,
+					[file](const std::string& text) {
+						std::fputs(text.c_str(), file);
+					});
+				ReportValue("synchronous" + label, nb_all / milliseconds,
+							"records/ms");
+			}
+
+			// Asynchronous writes.
+			{
+				auto& logger = AsyncLogger::Get();
+				logger.Start(GetLogPath(), false);
+
+				const auto begin = std::chrono::high_resolution_clock::now();
+				const auto milliseconds = Write(nb_threads, s_nb_records,
+					[&logger](std::string text) {
+						logger.Write(std::move(text));
+					});
+				logger.Flush();
+				const auto end = std::chrono::high_resolution_clock::now();
+				logger.Stop();
+
+				ReportValue("asynchronous, written" + label, nb_all / milliseconds,
+							"records/ms");
+				ReportValue("asynchronous, flushed" + label, nb_all
+					/ std::chrono::duration< F64, std::milli >(end - begin).count(),
+					"records/ms");
+			}
+		}
+
+		std::filesystem::remove(GetLogPath());
+	}
+}
\ No newline at end of file
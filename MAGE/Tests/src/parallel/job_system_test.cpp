@@ -0,0 +1,203 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 Returns the sum of the integers in [begin, end).
+		 */
+		[[nodiscard]]
+		constexpr U64 Sum(std::size_t begin, std::size_t end) noexcept {
+			return (end - begin) * (begin + end - 1u) / 2u;
+		}
+
+		/**
+		 Computes a value of the scaling benchmark for the given element.
+		 */
+		[[nodiscard]]
+		F64 Compute(std::size_t i) noexcept {
+			const auto x = static_cast< F64 >(i);
+			return std::sqrt(x) * std::sin(x) + std::cos(0.5 * x);
+		}
+	}
+
+	MAGE_TEST(JobSystemParallelForCoversRange) {
+		JobSystem job_system(3u);
+
+		for (const std::size_t grain_size : { 0u, 1u, 7u, 1000u, 100000u }) {
+			AtomicU64 sum = 0u;
+			job_system.ParallelFor(3u, 10003u,
+				[&sum](std::size_t begin, std::size_t end) {
+					sum += Sum(begin, end);
+				}, grain_size);
+			MAGE_CHECK(Sum(3u, 10003u) == sum);
+		}
+
+		// Empty ranges.
+		job_system.ParallelFor(5u, 5u, [](std::size_t, std::size_t) {
+			MAGE_CHECK(false);
+		});
+	}
+
+	MAGE_TEST(JobSystemWaitRethrowsJobExceptions) {
+		JobSystem job_system(3u);
+
+		JobCounter counter;
+		AtomicU32 nb_executed = 0u;
+		for (U32 i = 0u; i < 64u; ++i) {
+			job_system.Execute([&nb_executed, i]() {
+				++nb_executed;
+				if (0u == i % 16u) {
+					throw std::runtime_error("job failure");
+				}
+			}, &counter);
+		}
+
+		bool thrown = false;
+		try {
+			job_system.Wait(counter);
+		}
+		catch (const std::runtime_error&) {
+			thrown = true;
+		}
+		MAGE_CHECK(thrown);
+		MAGE_CHECK(64u == nb_executed);
+		MAGE_CHECK(counter.IsDone());
+
+		// The exception is rethrown only once.
+		job_system.Execute([]() noexcept {}, &counter);
+		job_system.Wait(counter);
+	}
+
+	MAGE_TEST(JobSystemParallelForPropagatesExceptions) {
+		JobSystem job_system(3u);
+
+		// The calling thread and the jobs throw.
+		for (const std::size_t failing : { 0u, 500u, 999u }) {
+			AtomicU32 nb_processed = 0u;
+			bool thrown = false;
+			try {
+				job_system.ParallelFor(0u, 1000u,
+					[&nb_processed, failing](std::size_t begin, std::size_t end) {
+						++nb_processed;
+						if (begin <= failing && failing < end) {
+							throw std::out_of_range(std::to_string(failing));
+						}
+					}, 10u);
+			}
+			catch (const std::out_of_range& e) {
+				thrown = (std::to_string(failing) == e.what());
+			}
+
+			MAGE_CHECK(thrown);
+			// All subranges are processed before ParallelFor returns.
+			MAGE_CHECK(100u == nb_processed);
+		}
+	}
+
+	MAGE_TEST(JobSystemStress) {
+		JobSystem job_system(3u);
+
+		// Threads not participating in the job system submit jobs, which
+		// submit nested jobs in turn.
+		static constexpr std::size_t s_nb_threads = 4u;
+		static constexpr std::size_t s_nb_jobs    = 256u;
+		AtomicU64 sum = 0u;
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < s_nb_threads; ++t) {
+			threads.emplace_back([&job_system, &sum]() {
+				JobCounter counter;
+				for (std::size_t j = 0u; j < s_nb_jobs; ++j) {
+					job_system.Execute([&job_system, &sum]() {
+						job_system.ParallelFor(0u, 100u,
+							[&sum](std::size_t begin, std::size_t end) {
+								sum += Sum(begin, end);
+							}, 8u);
+					}, &counter);
+				}
+				job_system.Wait(counter);
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		MAGE_CHECK(s_nb_threads * s_nb_jobs * Sum(0u, 100u) == sum);
+	}
+
+	MAGE_TEST(JobSystemMultipleInstances) {
+		JobSystem first(2u);
+		AtomicU64 sum = 0u;
+		{
+			// The constructing thread participates in both job systems.
+			JobSystem second(2u);
+			first.ParallelFor(0u, 64u,
+				[&second, &sum](std::size_t begin, std::size_t end) {
+					for (auto i = begin; i < end; ++i) {
+						second.ParallelFor(0u, 100u,
+							[&sum](std::size_t first, std::size_t last) {
+								sum += Sum(first, last);
+							}, 10u);
+					}
+				}, 4u);
+		}
+		MAGE_CHECK(64u * Sum(0u, 100u) == sum);
+
+		// The first job system outlives the second one.
+		sum = 0u;
+		first.ParallelFor(0u, 1000u, [&sum](std::size_t begin, std::size_t end) {
+			sum += Sum(begin, end);
+		}, 10u);
+		MAGE_CHECK(Sum(0u, 1000u) == sum);
+	}
+
+	MAGE_BENCHMARK(JobSystemParallelForScaling) {
+		static constexpr std::size_t s_nb_elements = 1u << 22u;
+		std::vector< F64 > values(s_nb_elements);
+
+		ReportMeasurement("serial (4M elements)", Measure(5u, [&values]() {
+			for (std::size_t i = 0u; i < s_nb_elements; ++i) {
+				values[i] = Compute(i);
+			}
+			DoNotOptimize(values.back());
+		}));
+
+		for (const std::size_t nb_workers : { 1u, 3u, 7u }) {
+			JobSystem job_system(nb_workers);
+			const auto label = "ParallelFor, "
+							 + std::to_string(nb_workers + 1u) + " threads";
+			ReportMeasurement(label, Measure(5u, [&values, &job_system]() {
+				job_system.ParallelFor(0u, s_nb_elements,
+					[&values](std::size_t begin, std::size_t end) {
+						for (auto i = begin; i < end; ++i) {
+							values[i] = Compute(i);
+						}
+					});
+				DoNotOptimize(values.back());
+			}));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,174 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer\test_world.hpp"
+#include "renderer\instance_groups.hpp"
+#include "renderer\render_queues.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <set>
+#include <utility>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Returns the (start, number of instances) pairs of the given
+		 instance groups.
+		 */
+		[[nodiscard]]
+		const std::vector< std::pair< std::size_t, std::size_t > >
+			GetGroups(const InstanceGroups& groups) {
+
+			std::vector< std::pair< std::size_t, std::size_t > > pairs;
+			for (const auto& group : groups.GetGroups()) {
+				pairs.emplace_back(group.m_start, group.m_nb_instances);
+			}
+			return pairs;
+		}
+
+		/**
+		 Returns the visible models of the opaque render queue of the given
+		 synthetic world, with their buffer data packed (i.e. the models of
+		 ForwardPass::RenderModels).
+		 */
+		[[nodiscard]]
+		const std::vector< const Model* > GetOpaqueModels(const TestWorld& world) {
+			const auto world_to_view
+				= XMMatrixRotationRollPitchYaw(XM_PIDIV4, 0.0f, 0.0f)
+				* XMMatrixTranslation(0.0f, 0.0f, 200.0f);
+			const auto view_to_projection
+				= XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f,
+										   0.1f, 1000.0f);
+			const auto world_to_projection = world_to_view * view_to_projection;
+
+			RenderQueues queues;
+			queues.Build(world.GetModels(), world_to_projection);
+
+			const auto device_context = GetImmediateContext(world.GetDevice());
+			std::vector< const Model* > models;
+			queues.ForEach(RenderQueue::Opaque,
+				[&device_context, &models](const VisibleModel& model) {
+					model.m_model->UpdateBuffer(*device_context.Get());
+					models.push_back(model.m_model);
+				});
+			return models;
+		}
+
+		/**
+		 Groups the given models (i.e. the grouping of
+		 ForwardPass::RenderModels).
+		 */
+		void Build(InstanceGroups& groups,
+				   const std::vector< const Model* >& models) {
+			groups.Build(gsl::span< const Model* const >(models),
+						 [](const Model* first, const Model* model) noexcept {
+				return model->CanInstance(*first);
+			});
+		}
+	}
+
+	MAGE_TEST(InstanceGroupsGroupConsecutiveElements) {
+		const auto equal = [](int lhs, int rhs) noexcept {
+			return lhs == rhs;
+		};
+
+		InstanceGroups groups;
+
+		// Only consecutive elements are grouped.
+		const std::vector< int > elements = { 1, 1, 2, 2, 2, 1, 3 };
+		groups.Build(gsl::span< const int >(elements), equal);
+		MAGE_CHECK((std::vector< std::pair< std::size_t, std::size_t > >{
+			{ 0u, 2u }, { 2u, 3u }, { 5u, 1u }, { 6u, 1u } } == GetGroups(groups)));
+
+		// Elements are compared against the first element of their group.
+		const std::vector< int > ramp = { 0, 1, 2, 3, 4 };
+		groups.Build(gsl::span< const int >(ramp), [](int first, int element) noexcept {
+			return element - first <= 1;
+		});
+		MAGE_CHECK((std::vector< std::pair< std::size_t, std::size_t > >{
+			{ 0u, 2u }, { 2u, 2u }, { 4u, 1u } } == GetGroups(groups)));
+
+		// Building replaces the previous groups.
+		const std::vector< int > same(100u, 7);
+		groups.Build(gsl::span< const int >(same), equal);
+		MAGE_CHECK((std::vector< std::pair< std::size_t, std::size_t > >{
+			{ 0u, 100u } } == GetGroups(groups)));
+
+		groups.Build(gsl::span< const int >(), equal);
+		MAGE_CHECK(groups.GetGroups().empty());
+
+		groups.Build(gsl::span< const int >(same), equal);
+		groups.Clear();
+		MAGE_CHECK(groups.GetGroups().empty());
+	}
+
+	MAGE_TEST(InstanceGroupsGroupModels) {
+		TestWorld world(4096u);
+		const auto models = GetOpaqueModels(world);
+		MAGE_CHECK(!models.empty());
+
+		InstanceGroups groups;
+		Build(groups, models);
+
+		// The groups partition the models.
+		std::size_t nb_instances = 0u;
+		for (const auto& group : groups.GetGroups()) {
+			MAGE_CHECK(nb_instances == group.m_start);
+			nb_instances += group.m_nb_instances;
+		}
+		MAGE_CHECK(models.size() == nb_instances);
+
+		// The sorted opaque models only differ in their mesh and transform:
+		// one group per mesh.
+		std::set< const Mesh* > meshes;
+		for (const auto model : models) {
+			meshes.insert(model->GetMesh());
+		}
+		MAGE_CHECK(meshes.size() == groups.GetGroups().size());
+		for (const auto& group : groups.GetGroups()) {
+			const auto first = models[group.m_start];
+			for (std::size_t i = 1u; i < group.m_nb_instances; ++i) {
+				MAGE_CHECK(first->GetMesh() == models[group.m_start + i]->GetMesh());
+			}
+		}
+
+		// A model with a different material splits its group.
+		const auto& group = groups.GetGroups().front();
+		MAGE_CHECK(3u <= group.m_nb_instances);
+		const auto index = group.m_start + group.m_nb_instances / 2u;
+		world.GetWorld().ForEach< Model >([target = models[index]](Model& model) {
+			if (&model == target) {
+				model.GetMaterial().SetRoughness(0.25f);
+			}
+		});
+		const auto device_context = GetImmediateContext(world.GetDevice());
+		models[index]->UpdateBuffer(*device_context.Get());
+
+		const auto nb_groups = groups.GetGroups().size();
+		Build(groups, models);
+		MAGE_CHECK(nb_groups + 2u == groups.GetGroups().size());
+		MAGE_CHECK(index == groups.GetGroups()[1u].m_start);
+		MAGE_CHECK(1u == groups.GetGroups()[1u].m_nb_instances);
+		MAGE_CHECK(!models[index + 1u]->CanInstance(*models[index]));
+		MAGE_CHECK(models[index + 1u]->CanInstance(*models[index - 1u]));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer\test_world.hpp"
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Returns the models of the given synthetic world.
+		 */
+		[[nodiscard]]
+		const std::vector< Model* > GetModels(TestWorld& world) {
+			std::vector< Model* > models;
+			world.GetWorld().ForEach< Model >([&models](Model& model) {
+				models.push_back(&model);
+			});
+			return models;
+		}
+
+		/**
+		 Brings the transform of the owner of the given model up to date
+		 (i.e. the serial part of Renderer::UpdateModelBuffers).
+		 */
+		void Resolve(const Model& model) noexcept {
+			const auto& transform = model.GetOwner()->GetTransform();
+			transform.GetObjectToWorldMatrix();
+			transform.GetWorldToObjectMatrix();
+		}
+
+		/**
+		 Packs the buffer data of the given model.
+		 */
+		[[nodiscard]]
+		bool Pack(const Model& model) noexcept {
+			Resolve(model);
+			return model.PackBuffer();
+		}
+
+		/**
+		 Checks whether the packed object-to-world matrix of the given model
+		 matches the object-to-world matrix of the transform of its owner.
+		 */
+		[[nodiscard]]
+		bool IsPacked(const Model& model) noexcept {
+			const auto expected = XMMatrixTranspose(
+				model.GetOwner()->GetTransform().GetObjectToWorldMatrix());
+			const auto actual   = model.GetInstanceBuffer().m_object_to_world;
+			return 0 == std::memcmp(&expected, &actual, sizeof(XMMATRIX));
+		}
+	}
+
+	MAGE_TEST(ModelBufferOnlyRepacksChangedModels) {
+		TestWorld world(16u);
+		const auto models = GetModels(world);
+		MAGE_CHECK(16u == models.size());
+
+		// A static model is packed once.
+		for (const auto model : models) {
+			MAGE_CHECK(Pack(*model));
+			MAGE_CHECK(!Pack(*model));
+			MAGE_CHECK(IsPacked(*model));
+		}
+
+		auto& model = *models[1];
+
+		// Transform
+		model.GetOwner()->GetTransform().AddTranslationY(1.0f);
+		MAGE_CHECK(Pack(model));
+		MAGE_CHECK(IsPacked(model));
+		MAGE_CHECK(!Pack(model));
+
+		// Material
+		model.GetMaterial().SetRoughness(0.25f);
+		MAGE_CHECK(Pack(model));
+		MAGE_CHECK(!Pack(model));
+		model.GetMaterial().GetBaseColor()[0] = 0.5f;
+		MAGE_CHECK(Pack(model));
+		MAGE_CHECK(!Pack(model));
+
+		// Texture transform
+		model.GetTextureTransform().AddRotation(0.5f);
+		MAGE_CHECK(Pack(model));
+		MAGE_CHECK(!Pack(model));
+
+		// The other models are unaffected.
+		for (const auto other : models) {
+			MAGE_CHECK(&model == other || !Pack(*other));
+		}
+	}
+
+	MAGE_TEST(ModelBufferTracksTransformsAcrossRelocations) {
+		TestWorld world(16u);
+
+		// Transforms with the same history have different versions.
+		const auto node1 = world.CreateNode();
+		const auto node2 = world.CreateNode();
+		MAGE_CHECK(node1->GetTransform().GetVersion()
+				   != node2->GetTransform().GetVersion());
+
+		const auto model1 = world.GetWorld().Create< Model >();
+		const auto model2 = world.GetWorld().Create< Model >();
+		node1->Add(model1);
+		node2->Add(model2);
+		node2->GetTransform().SetTranslationX(1.0f);
+		MAGE_CHECK(Pack(*model1));
+		MAGE_CHECK(Pack(*model2));
+
+		// Relocate the nodes and models.
+		for (std::size_t i = 0u; i < 1000u; ++i) {
+			world.CreateNode();
+			world.GetWorld().Create< Model >();
+		}
+
+		// The relocated transforms are unchanged.
+		MAGE_CHECK(!Pack(*model1));
+		MAGE_CHECK(!Pack(*model2));
+		MAGE_CHECK(IsPacked(*model1));
+		MAGE_CHECK(IsPacked(*model2));
+
+		// The relocated transforms are still tracked.
+		node1->GetTransform().SetTranslationX(2.0f);
+		MAGE_CHECK(Pack(*model1));
+		MAGE_CHECK(!Pack(*model2));
+		MAGE_CHECK(IsPacked(*model1));
+	}
+
+	MAGE_BENCHMARK(ModelBufferPacking) {
+		TestWorld world(20000u);
+		const auto models = GetModels(world);
+
+		// All models are animated each frame. The transforms are brought up
+		// to date serially in each measurement.
+		const auto animate = [&models]() {
+			for (const auto model : models) {
+				model->GetOwner()->GetTransform().AddRotationY(0.01f);
+				Resolve(*model);
+			}
+		};
+
+		ReportMeasurement("animation only (20k models)",
+			Measure(20u, animate));
+
+		ReportMeasurement("animation and serial packing (20k models)",
+			Measure(20u, [&models, &animate]() {
+				animate();
+				for (const auto model : models) {
+					DoNotOptimize(model->PackBuffer());
+				}
+			}));
+
+		std::vector< U8 > updates(models.size());
+		for (const std::size_t nb_workers : { 1u, 3u, 7u }) {
+			JobSystem job_system(nb_workers);
+
+			const auto label = "animation and parallel packing (20k models, "
+							 + std::to_string(nb_workers + 1u) + " threads)";
+			ReportMeasurement(label,
+				Measure(20u, [&models, &animate, &updates, &job_system]() {
+					animate();
+					job_system.ParallelFor(0u, models.size(),
+						[&models, &updates](std::size_t begin,
+											std::size_t end) noexcept {
+						for (auto i = begin; i < end; ++i) {
+							updates[i] = models[i]->PackBuffer();
+						}
+					}, 64u);
+					DoNotOptimize(updates.back());
+				}));
+		}
+	}
+}
\ No newline at end of file
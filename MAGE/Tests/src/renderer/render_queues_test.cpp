@@ -0,0 +1,361 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer\test_world.hpp"
+#include "renderer\render_queues.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <set>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 Returns the world-to-projection transformation matrix of a camera
+		 looking at the center of the synthetic worlds from above.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetWorldToProjectionMatrix() noexcept {
+			const auto world_to_view
+				= XMMatrixRotationRollPitchYaw(XM_PIDIV4, 0.0f, 0.0f)
+				* XMMatrixTranslation(0.0f, 0.0f, 200.0f);
+			const auto view_to_projection
+				= XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f,
+										   0.1f, 1000.0f);
+			return world_to_view * view_to_projection;
+		}
+
+		/**
+		 Checks whether the given model is visible, i.e. whether its
+		 world-space AABB is not culled by the given bounding frustum.
+		 */
+		[[nodiscard]]
+		bool IsVisible(const Model& model,
+					   const BoundingFrustum& frustum) noexcept {
+			const auto& transform = model.GetOwner()->GetTransform();
+			return frustum.Overlaps(
+				AABB::Transform(model.GetAABB(),
+								transform.GetObjectToWorldMatrix()));
+		}
+
+		/**
+		 Checks whether the given model belongs to the given render queue,
+		 assuming it is visible.
+		 */
+		[[nodiscard]]
+		bool Belongs(const Model& model, RenderQueue queue) noexcept {
+			const auto& material = model.GetMaterial();
+			const auto  alpha    = material.GetBaseColor()[3];
+			const auto  emissive = material.IsEmissive();
+			const auto  tsnm     = (nullptr != material.GetNormalSRV());
+			const auto  opaque   = (TRANSPARENCY_THRESHOLD <= alpha);
+			const auto  shadow   = (material.IsTransparant()
+								 && TRANSPARENCY_SHADOW_THRESHOLD <= alpha);
+
+			switch (queue) {
+			case RenderQueue::All:
+				return true;
+			case RenderQueue::Emissive:
+				return opaque && emissive;
+			case RenderQueue::Opaque:
+				return opaque && !emissive && !tsnm;
+			case RenderQueue::OpaqueTSNM:
+				return opaque && !emissive && tsnm;
+			case RenderQueue::TransparentEmissive:
+				return shadow && emissive;
+			case RenderQueue::Transparent:
+				return shadow && !emissive && !tsnm;
+			case RenderQueue::TransparentTSNM:
+				return shadow && !emissive && tsnm;
+			case RenderQueue::OpaqueOccluders:
+				return !material.IsTransparant();
+			case RenderQueue::TransparentOccluders:
+				return shadow;
+			default:
+				return false;
+			}
+		}
+
+		/**
+		 Sweeps the given world once per pass (i.e. the approach replaced by
+		 the render queues): each sweep checks the state and the material of
+		 each model, computes its object-to-projection transformation matrix
+		 and culls it.
+		 */
+		[[nodiscard]]
+		std::size_t XM_CALLCONV SweepPerPass(const World& world,
+											 FXMMATRIX world_to_projection) {
+
+			std::size_t nb_visible = 0u;
+			for (auto i = static_cast< std::size_t >(RenderQueue::Emissive);
+				 i < static_cast< std::size_t >(RenderQueue::Count); ++i) {
+
+				const auto queue = static_cast< RenderQueue >(i);
+				world.ForEach< Model >([world_to_projection, queue, &nb_visible]
+				(const Model& model) {
+
+					if (State::Active != model.GetState()
+						|| !Belongs(model, queue)) {
+						return;
+					}
+
+					const auto& transform = model.GetOwner()->GetTransform();
+					const auto object_to_projection
+						= transform.GetObjectToWorldMatrix() * world_to_projection;
+
+					if (BoundingFrustum::Cull(object_to_projection,
+											  model.GetAABB())) {
+						return;
+					}
+
+					DoNotOptimize(object_to_projection);
+					++nb_visible;
+				});
+			}
+
+			return nb_visible;
+		}
+
+		/**
+		 Submits the given model, binding only the state that differs from
+		 the given previously submitted model (i.e. the submission of the
+		 forward pass). If no previous model is given, all state is bound
+		 (i.e. the submission replaced by the sorted render queues).
+		 */
+		void Submit(ID3D11DeviceContext& device_context,
+					const Model& model,
+					const Model* previous = nullptr) {
+
+			const auto& material = model.GetMaterial();
+
+			model.BindBuffer< Pipeline::VS >(device_context, SLOT_CBUFFER_MODEL);
+			model.BindBuffer< Pipeline::PS >(device_context, SLOT_CBUFFER_MODEL);
+			if (nullptr == previous
+				|| !material.HasSameSRVs(previous->GetMaterial())) {
+
+				ID3D11ShaderResourceView* const srvs[] = {
+					material.GetBaseColorSRV(),
+					material.GetMaterialSRV(),
+					material.GetNormalSRV()
+				};
+				Pipeline::PS::BindSRVs(device_context, SLOT_SRV_BASE_COLOR,
+									   static_cast< U32 >(std::size(srvs)), srvs);
+			}
+			if (nullptr == previous || model.GetMesh() != previous->GetMesh()) {
+				model.BindMesh(device_context);
+			}
+			model.Draw(device_context);
+		}
+
+		/**
+		 Counts the state changes of submitting the visible models of the
+		 given world in world order, binding all state per model.
+		 */
+		[[nodiscard]]
+		U32 XM_CALLCONV CountUnsortedBinds(ID3D11DeviceContext& device_context,
+										   const World& world,
+										   FXMMATRIX world_to_projection) {
+			Pipeline::s_nb_binds = 0u;
+			world.ForEach< Model >([&device_context, world_to_projection]
+			(const Model& model) {
+				if (State::Active != model.GetState()
+					|| !Belongs(model, RenderQueue::Opaque)) {
+					return;
+				}
+
+				const auto& transform = model.GetOwner()->GetTransform();
+				if (BoundingFrustum::Cull(transform.GetObjectToWorldMatrix()
+										  * world_to_projection,
+										  model.GetAABB())) {
+					return;
+				}
+
+				Submit(device_context, model);
+			});
+			return Pipeline::s_nb_binds;
+		}
+
+		/**
+		 Counts the state changes of submitting the given sorted render
+		 queues, binding only the state that changes between models.
+		 */
+		[[nodiscard]]
+		U32 CountSortedBinds(ID3D11DeviceContext& device_context,
+							 const RenderQueues& queues) {
+			Pipeline::s_nb_binds = 0u;
+			const Model* previous = nullptr;
+			queues.ForEach(RenderQueue::Opaque,
+				[&device_context, &previous](const VisibleModel& model) {
+					Submit(device_context, *model.m_model, previous);
+					previous = model.m_model;
+				});
+			return Pipeline::s_nb_binds;
+		}
+	}
+
+	MAGE_TEST(RenderQueuesBucketVisibleModels) {
+		const TestWorld world(4096u);
+		const auto world_to_projection = GetWorldToProjectionMatrix();
+		const BoundingFrustum frustum(world_to_projection);
+
+		RenderQueues queues;
+		queues.Build(world.GetModels(), world_to_projection);
+
+		// Some, but not all, models are visible.
+		const auto nb_visible = queues.GetNumberOfModels(RenderQueue::All);
+		MAGE_CHECK(0u < nb_visible);
+		MAGE_CHECK(nb_visible < world.GetWorld().GetNumberOf< Model >());
+
+		for (std::size_t i = 0u;
+			 i < static_cast< std::size_t >(RenderQueue::Count); ++i) {
+
+			const auto queue = static_cast< RenderQueue >(i);
+
+			std::vector< const Model* > expected;
+			world.GetWorld().ForEach< Model >(
+				[&frustum, &expected, queue](const Model& model) {
+					if (IsVisible(model, frustum) && Belongs(model, queue)) {
+						expected.push_back(&model);
+					}
+				});
+
+			std::vector< const Model* > actual;
+			queues.ForEach(queue, [&actual](const VisibleModel& model) {
+				actual.push_back(model.m_model);
+			});
+
+			std::sort(expected.begin(), expected.end());
+			std::sort(actual.begin(), actual.end());
+			MAGE_CHECK(expected == actual);
+		}
+	}
+
+	MAGE_TEST(RenderQueuesSortVisibleModels) {
+		const TestWorld world(4096u);
+		const auto world_to_projection = GetWorldToProjectionMatrix();
+
+		RenderQueues queues;
+		queues.Build(world.GetModels(), world_to_projection);
+
+		// Opaque queues: grouped by state, front to back within each group.
+		queues.ForEach(RenderQueue::Opaque,
+			[previous = static_cast< const VisibleModel* >(nullptr)]
+			(const VisibleModel& model) mutable {
+				if (previous) {
+					MAGE_CHECK(previous->m_state <= model.m_state);
+					if (previous->m_state == model.m_state) {
+						MAGE_CHECK(previous->m_depth <= model.m_depth);
+					}
+				}
+				previous = &model;
+			});
+
+		// Transparent queues: back to front.
+		queues.ForEach(RenderQueue::Transparent,
+			[previous = static_cast< const VisibleModel* >(nullptr)]
+			(const VisibleModel& model) mutable {
+				if (previous) {
+					MAGE_CHECK(previous->m_depth >= model.m_depth);
+				}
+				previous = &model;
+			});
+
+		// The precomputed matrices match the transforms.
+		queues.ForEach(RenderQueue::All,
+			[world_to_projection](const VisibleModel& model) {
+				const auto& transform
+					= model.m_model->GetOwner()->GetTransform();
+				const auto expected
+					= transform.GetObjectToWorldMatrix() * world_to_projection;
+				for (U32 i = 0u; i < 4u; ++i) {
+					MAGE_CHECK(XMVector4Equal(expected.r[i],
+											  model.m_object_to_projection.r[i]));
+				}
+			});
+	}
+
+	MAGE_TEST(RenderQueuesReduceStateChanges) {
+		const TestWorld world(4096u);
+		const auto world_to_projection = GetWorldToProjectionMatrix();
+		const auto device_context = GetImmediateContext(world.GetDevice());
+
+		RenderQueues queues;
+		queues.Build(world.GetModels(), world_to_projection);
+		MAGE_CHECK(0u < queues.GetNumberOfModels(RenderQueue::Opaque));
+
+		const auto nb_draws = Pipeline::s_nb_draws;
+		const auto nb_unsorted_binds = CountUnsortedBinds(
+			*device_context.Get(), world.GetWorld(), world_to_projection);
+		const auto nb_unsorted_draws = Pipeline::s_nb_draws - nb_draws;
+		const auto nb_sorted_binds = CountSortedBinds(*device_context.Get(),
+													  queues);
+		const auto nb_sorted_draws = Pipeline::s_nb_draws - nb_draws
+								   - nb_unsorted_draws;
+
+		std::set< const Mesh* > meshes;
+		queues.ForEach(RenderQueue::Opaque, [&meshes](const VisibleModel& model) {
+			meshes.insert(model.m_model->GetMesh());
+		});
+
+		// The same models are drawn with fewer state changes: the model
+		// buffers are bound once per model, the (untextured) material once
+		// and the meshes once each.
+		MAGE_CHECK(queues.GetNumberOfModels(RenderQueue::Opaque) == nb_unsorted_draws);
+		MAGE_CHECK(nb_unsorted_draws == nb_sorted_draws);
+		MAGE_CHECK(6u * nb_unsorted_draws == nb_unsorted_binds);
+		MAGE_CHECK(2u * nb_sorted_draws + 1u + 3u * meshes.size() == nb_sorted_binds);
+	}
+
+	MAGE_BENCHMARK(RenderQueuesBuild) {
+		const TestWorld world(20000u);
+		const auto world_to_projection = GetWorldToProjectionMatrix();
+
+		ReportMeasurement("world sweep per pass (20k models, 8 passes)",
+			Measure(20u, [&world, world_to_projection]() {
+				DoNotOptimize(SweepPerPass(world.GetWorld(),
+										   world_to_projection));
+			}));
+
+		RenderQueues queues;
+		ReportMeasurement("render queues (20k models)",
+			Measure(20u, [&world, &queues, world_to_projection]() {
+				queues.Build(world.GetModels(), world_to_projection);
+				DoNotOptimize(queues.GetNumberOfModels(RenderQueue::All));
+			}));
+		ReportValue("visible",
+					static_cast< F64 >(queues.GetNumberOfModels(RenderQueue::All)),
+					"models");
+
+		// The state changes of the opaque queue.
+		const auto device_context = GetImmediateContext(world.GetDevice());
+		ReportValue("opaque queue binds in world order",
+			static_cast< F64 >(CountUnsortedBinds(*device_context.Get(),
+												  world.GetWorld(),
+												  world_to_projection)),
+			"binds");
+		ReportValue("opaque queue binds in sorted order",
+			static_cast< F64 >(CountSortedBinds(*device_context.Get(), queues)),
+			"binds");
+	}
+}
\ No newline at end of file
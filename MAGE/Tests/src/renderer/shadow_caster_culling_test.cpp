@@ -0,0 +1,331 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer\test_world.hpp"
+#include "renderer\render_queues.hpp"
+#include "collection\vector.hpp"
+#include "geometry\frustum_culling.hpp"
+
+// Include HLSL bindings.
+#include "hlsl.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 The number of omni light cameras per omni light.
+		 */
+		constexpr std::size_t g_nb_faces = 6u;
+
+		/**
+		 A class of synthetic worlds containing a grid of unit cubes and a
+		 4x4 grid of shadow mapped omni lights above them.
+		 */
+		class TestLitWorld : public TestWorld {
+
+		public:
+
+			TestLitWorld(std::size_t nb_models, F32 range)
+				: TestWorld(nb_models),
+				m_lights() {
+
+				for (std::size_t i = 0u; i < 16u; ++i) {
+					const auto node = CreateNode();
+					// Avoid casters touching the planes of the light cameras.
+					node->GetTransform().SetTranslation(
+						66.7f * static_cast< F32 >(i % 4u) - 98.7f,
+						2.1f,
+						66.7f * static_cast< F32 >(i / 4u) - 99.3f);
+
+					const auto light = GetWorld().Create< OmniLight >();
+					light->SetRange(range);
+					light->EnableShadows();
+					node->Add(light);
+
+					m_lights.push_back(light);
+				}
+			}
+
+			[[nodiscard]]
+			const std::vector< ProxyPtr< OmniLight > >&
+				GetLights() const noexcept {
+
+				return m_lights;
+			}
+
+		private:
+
+			std::vector< ProxyPtr< OmniLight > > m_lights;
+		};
+
+		/**
+		 Returns the world-to-projection transformation matrices of the
+		 omni light cameras of the given omni light (i.e. the cube faces of
+		 LBufferPass::ProcessOmniLights).
+		 */
+		[[nodiscard]]
+		const AlignedVector< XMMATRIX >
+			GetWorldToProjectionMatrices(const OmniLight& light) {
+
+			static const XMMATRIX rotations[g_nb_faces] = {
+				XMMatrixRotationY(-XM_PIDIV2), // Look: +x
+				XMMatrixRotationY(XM_PIDIV2),  // Look: -x
+				XMMatrixRotationX(XM_PIDIV2),  // Look: +y
+				XMMatrixRotationX(-XM_PIDIV2), // Look: -y
+				XMMatrixIdentity(),            // Look: +z
+				XMMatrixRotationY(XM_PI),      // Look: -z
+			};
+
+			const auto& transform            = light.GetOwner()->GetTransform();
+			const auto  world_to_light       = transform.GetWorldToObjectMatrix();
+			const auto  light_to_lprojection = light.GetLightToProjectionMatrix();
+
+			AlignedVector< XMMATRIX > matrices;
+			for (const auto& rotation : rotations) {
+				matrices.push_back((world_to_light * rotation)
+								   * light_to_lprojection);
+			}
+			return matrices;
+		}
+
+		/**
+		 Returns the bounding sphere of the range of the given omni light.
+		 */
+		[[nodiscard]]
+		const BoundingSphere GetBoundingSphere(const OmniLight& light) noexcept {
+			const auto& transform = light.GetOwner()->GetTransform();
+			return BoundingSphere(transform.GetWorldOrigin(),
+								  light.GetWorldRange());
+		}
+
+		/**
+		 Sweeps the given world for the given omni light camera (i.e. the
+		 approach replaced by the per-light caster culling): one sweep for
+		 the opaque and one sweep for the transparent shadow casters, each
+		 computing the object-to-projection transformation matrix of each
+		 model and culling it.
+		 */
+		void XM_CALLCONV SweepPerLightCamera(const World& world,
+											 FXMMATRIX world_to_projection,
+											 std::vector< const Model* >& casters,
+											 std::size_t& nb_visits) {
+			casters.clear();
+
+			const auto sweep = [world_to_projection, &casters, &nb_visits]
+			(const Model& model, bool transparent) {
+				++nb_visits;
+
+				const auto& material = model.GetMaterial();
+				if (State::Active != model.GetState()
+					|| !model.OccludesLight()
+					|| transparent != material.IsTransparant()
+					|| (transparent && material.GetBaseColor()[3]
+						< TRANSPARENCY_SHADOW_THRESHOLD)) {
+					return;
+				}
+
+				const auto& transform = model.GetOwner()->GetTransform();
+				const auto object_to_projection
+					= transform.GetObjectToWorldMatrix() * world_to_projection;
+				if (BoundingFrustum::Cull(object_to_projection, model.GetAABB())) {
+					return;
+				}
+
+				casters.push_back(&model);
+			};
+
+			world.ForEach< Model >([&sweep](const Model& model) {
+				sweep(model, false);
+			});
+			world.ForEach< Model >([&sweep](const Model& model) {
+				sweep(model, true);
+			});
+		}
+
+		/**
+		 A class of per-light shadow caster cullers (i.e. the approach of
+		 LBufferPass::ProcessOmniLights).
+		 */
+		class CasterCuller {
+
+		public:
+
+			/**
+			 Culls the shadow casters of the omni light cameras of the given
+			 omni light. The BVH of the given models is queried once with
+			 the range of the omni light, and the resulting candidates are
+			 batch-culled against each omni light camera.
+			 */
+			void Cull(const ComponentBVH< Model >& models,
+					  const OmniLight& light,
+					  std::size_t& nb_visits) {
+
+				m_casters.clear();
+				m_caster_aabbs.clear();
+
+				models.ForEach(GetBoundingSphere(light),
+					[this, &nb_visits](const Model& model) {
+						++nb_visits;
+
+						if (!model.OccludesLight()) {
+							return;
+						}
+
+						const auto& transform = model.GetOwner()->GetTransform();
+						m_casters.push_back(&model);
+						m_caster_aabbs.push_back(model.GetAABB(),
+												 transform.GetObjectToWorldMatrix());
+					});
+
+				const auto matrices = GetWorldToProjectionMatrices(light);
+				for (std::size_t i = 0u; i < g_nb_faces; ++i) {
+					nb_visits += m_casters.size();
+
+					auto& queues = m_queues[i];
+					queues.Clear();
+					m_caster_aabbs.Cull(BoundingFrustum(matrices[i]),
+										m_visible_casters);
+					for (const auto index : m_visible_casters) {
+						queues.PushOccluder(*m_casters[index], matrices[i]);
+					}
+					queues.Sort();
+				}
+			}
+
+			/**
+			 Returns the (sorted) shadow casters of the given omni light
+			 camera of the last culled omni light.
+			 */
+			[[nodiscard]]
+			const std::vector< const Model* > GetCasters(std::size_t face) const {
+				std::vector< const Model* > casters;
+				const auto push = [&casters](const VisibleModel& model) {
+					casters.push_back(model.m_model);
+				};
+				m_queues[face].ForEach(RenderQueue::OpaqueOccluders, push);
+				m_queues[face].ForEach(RenderQueue::TransparentOccluders, push);
+				std::sort(casters.begin(), casters.end());
+				return casters;
+			}
+
+		private:
+
+			std::vector< const Model* > m_casters;
+			AABBArray m_caster_aabbs;
+			std::vector< U32 > m_visible_casters;
+			RenderQueues m_queues[g_nb_faces];
+		};
+
+		/**
+		 Checks whether the given model is within the range of the given
+		 omni light, i.e. whether its world-space AABB overlaps the given
+		 bounding sphere.
+		 */
+		[[nodiscard]]
+		bool IsInRange(const Model& model,
+					   const BoundingSphere& sphere) noexcept {
+			const auto& transform = model.GetOwner()->GetTransform();
+			const auto aabb = AABB::Transform(model.GetAABB(),
+											  transform.GetObjectToWorldMatrix());
+			const auto d = XMVectorMax(
+				XMVectorMax(aabb.MinPoint() - sphere.Centroid(),
+							sphere.Centroid() - aabb.MaxPoint()),
+				XMVectorZero());
+			return XMVectorGetX(XMVector3LengthSq(d))
+				<= sphere.Radius() * sphere.Radius();
+		}
+	}
+
+	MAGE_TEST(ShadowCasterCullingMatchesWorldSweep) {
+		const TestLitWorld world(4096u, 20.0f);
+
+		CasterCuller culler;
+		std::vector< const Model* > expected;
+		std::size_t nb_sweep_visits = 0u;
+		std::size_t nb_cull_visits  = 0u;
+		std::size_t nb_casters      = 0u;
+
+		for (const auto& light : world.GetLights()) {
+			culler.Cull(world.GetModels(), *light, nb_cull_visits);
+
+			const auto sphere   = GetBoundingSphere(*light);
+			const auto matrices = GetWorldToProjectionMatrices(*light);
+			for (std::size_t i = 0u; i < g_nb_faces; ++i) {
+				SweepPerLightCamera(world.GetWorld(), matrices[i],
+									expected, nb_sweep_visits);
+
+				// The world sweep also returns the models beyond the range
+				// of the omni light (i.e. in the corners of the cube faces),
+				// which cannot cast shadows on lit surfaces.
+				expected.erase(std::remove_if(expected.begin(), expected.end(),
+					[&sphere](const Model* model) {
+						return !IsInRange(*model, sphere);
+					}), expected.end());
+				std::sort(expected.begin(), expected.end());
+
+				MAGE_CHECK(expected == culler.GetCasters(i));
+				nb_casters += expected.size();
+			}
+		}
+
+		MAGE_CHECK(0u < nb_casters);
+		MAGE_CHECK(nb_cull_visits < nb_sweep_visits);
+	}
+
+	MAGE_BENCHMARK(ShadowCasterCulling) {
+		const TestLitWorld world(20000u, 20.0f);
+
+		std::vector< const Model* > casters;
+		std::size_t nb_sweep_visits = 0u;
+		ReportMeasurement("world sweep per light camera (20k models, 96 cameras)",
+			Measure(10u, [&world, &casters, &nb_sweep_visits]() {
+				nb_sweep_visits = 0u;
+				for (const auto& light : world.GetLights()) {
+					for (const auto& world_to_projection
+						 : GetWorldToProjectionMatrices(*light)) {
+						SweepPerLightCamera(world.GetWorld(), world_to_projection,
+											casters, nb_sweep_visits);
+						DoNotOptimize(casters.size());
+					}
+				}
+			}));
+		ReportValue("world sweep per light camera",
+					static_cast< F64 >(nb_sweep_visits), "model visits");
+
+		CasterCuller culler;
+		std::size_t nb_cull_visits = 0u;
+		ReportMeasurement("per-light caster culling (20k models, 96 cameras)",
+			Measure(10u, [&world, &culler, &nb_cull_visits]() {
+				nb_cull_visits = 0u;
+				for (const auto& light : world.GetLights()) {
+					culler.Cull(world.GetModels(), *light, nb_cull_visits);
+				}
+				DoNotOptimize(nb_cull_visits);
+			}));
+		ReportValue("per-light caster culling",
+					static_cast< F64 >(nb_cull_visits), "model visits");
+		ReportValue("model visits removed",
+					static_cast< F64 >(nb_sweep_visits - nb_cull_visits),
+					"model visits");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer\shadow_map_cache.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 A class of lights with a guid.
+		 */
+		class TestLight {
+
+		public:
+
+			explicit TestLight(U64 guid) noexcept
+				: m_guid(guid) {}
+
+			[[nodiscard]]
+			U64 GetGuid() const noexcept {
+				return m_guid;
+			}
+
+		private:
+
+			U64 m_guid;
+		};
+
+		/**
+		 Returns the slots assigned by the given shadow map cache to the
+		 lights with the given guids.
+		 */
+		[[nodiscard]]
+		const std::vector< std::size_t > Assign(ShadowMapCache& cache,
+												const std::vector< U64 >& guids) {
+			std::vector< std::size_t > slots;
+			cache.Assign(guids, slots);
+			return slots;
+		}
+	}
+
+	MAGE_TEST(ShadowMapCacheTracksSignatures) {
+		ShadowMapCache cache;
+		MAGE_CHECK((std::vector< std::size_t >{ 0u, 1u } == Assign(cache, { 7u, 9u })));
+
+		// Shadow maps are rendered once per signature.
+		MAGE_CHECK(cache.Update(0u, 100u));
+		MAGE_CHECK(cache.Update(1u, 200u));
+		MAGE_CHECK(!cache.Update(0u, 100u));
+		MAGE_CHECK(!cache.Update(1u, 200u));
+		MAGE_CHECK(cache.Update(1u, 201u));
+		MAGE_CHECK(!cache.Update(1u, 201u));
+
+		// Invalidation re-renders all shadow maps.
+		cache.Invalidate();
+		MAGE_CHECK(cache.Update(0u, 100u));
+		MAGE_CHECK(cache.Update(1u, 201u));
+
+		// Signatures depend on the order of the combined values.
+		const auto a = ShadowMapCache::Combine(ShadowMapCache::Combine(0u, 1u), 2u);
+		const auto b = ShadowMapCache::Combine(ShadowMapCache::Combine(0u, 2u), 1u);
+		MAGE_CHECK(a != b);
+	}
+
+	MAGE_TEST(ShadowMapCacheKeepsSlotsOfLights) {
+		ShadowMapCache cache;
+		MAGE_CHECK((std::vector< std::size_t >{ 0u, 1u, 2u }
+					== Assign(cache, { 10u, 20u, 30u })));
+		for (std::size_t i = 0u; i < 3u; ++i) {
+			MAGE_CHECK(cache.Update(i, 1u));
+		}
+
+		// A light entering the view (in front of the others in processing
+		// order) does not move the other lights.
+		MAGE_CHECK((std::vector< std::size_t >{ 3u, 0u, 1u, 2u }
+					== Assign(cache, { 40u, 10u, 20u, 30u })));
+		MAGE_CHECK(!cache.Update(0u, 1u));
+		MAGE_CHECK(!cache.Update(1u, 1u));
+		MAGE_CHECK(!cache.Update(2u, 1u));
+		MAGE_CHECK(cache.Update(3u, 1u));
+
+		// A light leaving the view only moves the lights whose slot is out of
+		// range.
+		MAGE_CHECK((std::vector< std::size_t >{ 0u, 2u, 1u }
+					== Assign(cache, { 10u, 30u, 40u })));
+		MAGE_CHECK(!cache.Update(0u, 1u));
+		MAGE_CHECK(cache.Update(1u, 1u));
+		MAGE_CHECK(!cache.Update(2u, 1u));
+
+		// The slots are reused by other lights.
+		MAGE_CHECK((std::vector< std::size_t >{ 1u, 0u }
+					== Assign(cache, { 50u, 10u })));
+		MAGE_CHECK(!cache.Update(0u, 1u));
+		MAGE_CHECK(cache.Update(1u, 1u));
+
+		// No lights.
+		MAGE_CHECK(Assign(cache, {}).empty());
+		MAGE_CHECK((std::vector< std::size_t >{ 0u } == Assign(cache, { 30u })));
+		MAGE_CHECK(cache.Update(0u, 1u));
+	}
+
+	MAGE_TEST(ShadowMapCacheInvalidatesAllFacesOfSlots) {
+		// One slot per omni light, six shadow maps per slot.
+		ShadowMapCache cache(6u);
+		MAGE_CHECK((std::vector< std::size_t >{ 0u, 1u } == Assign(cache, { 1u, 2u })));
+		for (std::size_t i = 0u; i < 12u; ++i) {
+			MAGE_CHECK(cache.Update(i, i));
+		}
+
+		// A moving shadow caster only invalidates the faces it is rendered
+		// into.
+		MAGE_CHECK((std::vector< std::size_t >{ 0u, 1u } == Assign(cache, { 1u, 2u })));
+		for (std::size_t i = 0u; i < 12u; ++i) {
+			MAGE_CHECK((7u == i) == cache.Update(i, (7u == i) ? 0u : i));
+		}
+
+		// Replacing a light invalidates all faces of its slot.
+		MAGE_CHECK((std::vector< std::size_t >{ 0u, 1u } == Assign(cache, { 1u, 3u })));
+		for (std::size_t i = 0u; i < 12u; ++i) {
+			MAGE_CHECK((6u <= i) == cache.Update(i, (7u == i) ? 0u : i));
+		}
+	}
+
+	MAGE_TEST(ShadowMapCacheArrangesLightsBySlot) {
+		const TestLight a(1u), b(2u), c(3u);
+		ShadowMapCache cache;
+
+		std::vector< const TestLight* > lights = { &a, &b, &c };
+		cache.Arrange(lights);
+		MAGE_CHECK((std::vector< const TestLight* >{ &a, &b, &c } == lights));
+
+		// The processing order changes, the slots do not.
+		lights = { &c, &a, &b };
+		cache.Arrange(lights);
+		MAGE_CHECK((std::vector< const TestLight* >{ &a, &b, &c } == lights));
+
+		// The first light leaves the view.
+		lights = { &c, &b };
+		cache.Arrange(lights);
+		MAGE_CHECK((std::vector< const TestLight* >{ &c, &b } == lights));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "direct3d11.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 Creates a device without an adapter. The device creates resources, but
+	 does not render anything.
+
+	 @return		A pointer to the device.
+	 @throws		Exception
+					Failed to create the device.
+	 */
+	[[nodiscard]]
+	inline ComPtr< ID3D11Device > CreateTestDevice() {
+		ComPtr< ID3D11Device > device;
+		const HRESULT result = D3D11CreateDevice(nullptr,
+												 D3D_DRIVER_TYPE_NULL,
+												 nullptr,
+												 0u,
+												 nullptr,
+												 0u,
+												 D3D11_SDK_VERSION,
+												 device.GetAddressOf(),
+												 nullptr,
+												 nullptr);
+		ThrowIfFailed(result, "ID3D11Device creation failed: {:08X}.", result);
+
+		return device;
+	}
+
+	/**
+	 Returns the immediate context of the given device.
+
+	 @param[in]		device
+					A reference to the device.
+	 @return		A pointer to the immediate context of the given device.
+	 */
+	[[nodiscard]]
+	inline ComPtr< ID3D11DeviceContext > GetImmediateContext(ID3D11Device& device) {
+		ComPtr< ID3D11DeviceContext > device_context;
+		device.GetImmediateContext(device_context.GetAddressOf());
+
+		return device_context;
+	}
+}
\ No newline at end of file
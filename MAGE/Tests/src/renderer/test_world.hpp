@@ -0,0 +1,154 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "renderer\test_device.hpp"
+#include "renderer\world_bvh.hpp"
+#include "resource\mesh\static_mesh.hpp"
+#include "resource\mesh\vertex.hpp"
+#include "scene\node.hpp"
+#include "scene\scene_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	/**
+	 A class of meshes containing a single (degenerate) triangle.
+	 */
+	class TestMesh
+		: public rendering::StaticMesh< rendering::VertexPosition, U32 > {
+
+	public:
+
+		explicit TestMesh(ID3D11Device& device)
+			: StaticMesh(device,
+						 std::vector< rendering::VertexPosition >(3u),
+						 std::vector< U32 >{ 0u, 1u, 2u }) {}
+	};
+
+	/**
+	 A class of synthetic worlds containing a grid of unit cubes, a quarter of
+	 which are transparent and an eighth of which are emissive. The cubes are
+	 centered at y = 0 and are 4 units apart along the x and z axes.
+	 */
+	class TestWorld {
+
+	public:
+
+		explicit TestWorld(std::size_t nb_models)
+			: m_device(CreateTestDevice()),
+			m_display_configuration(ComPtr< rendering::DXGIAdapter >(),
+									ComPtr< rendering::DXGIOutput >(),
+									DXGI_MODE_DESC{}),
+			m_resource_manager(*m_device.Get()),
+			m_world(*m_device.Get(), m_display_configuration,
+					m_resource_manager),
+			m_models(),
+			m_nodes(),
+			m_meshes() {
+
+			using namespace rendering;
+
+			for (std::size_t i = 0u; i < s_nb_meshes; ++i) {
+				m_meshes.push_back(MakeShared< TestMesh >(*m_device.Get()));
+			}
+
+			// A square grid in the xz plane.
+			std::size_t side = 1u;
+			while (side * side < nb_models) {
+				++side;
+			}
+
+			const AABB aabb(Point3(-0.5f, -0.5f, -0.5f),
+							Point3( 0.5f,  0.5f,  0.5f));
+			const BoundingSphere sphere(Point3(), 0.87f);
+
+			for (std::size_t i = 0u; i < nb_models; ++i) {
+				const auto node = CreateNode();
+				node->GetTransform().SetTranslation(
+					4.0f * static_cast< F32 >(i % side) - 2.0f * side,
+					0.0f,
+					4.0f * static_cast< F32 >(i / side) - 2.0f * side);
+
+				const auto model = m_world.Create< Model >();
+				model->SetMesh(m_meshes[i % s_nb_meshes], 0u, 36u,
+							   aabb, sphere);
+				auto& material = model->GetMaterial();
+				if (0u == i % 4u) {
+					material.GetBaseColor()[3] = 0.5f;
+					material.SetTransparent();
+				}
+				if (0u == i % 8u || 3u == i % 8u) {
+					material.SetRadiance(1.0f);
+				}
+				node->Add(model);
+			}
+
+			m_models.Update(m_world);
+		}
+
+		/**
+		 Creates a node in this synthetic world.
+
+		 @return		A pointer to the node.
+		 */
+		ProxyPtr< Node > CreateNode() {
+			const auto node = AddElement(m_nodes);
+			node->Set(node);
+			return node;
+		}
+
+		[[nodiscard]]
+		rendering::World& GetWorld() noexcept {
+			return m_world;
+		}
+
+		[[nodiscard]]
+		const rendering::World& GetWorld() const noexcept {
+			return m_world;
+		}
+
+		[[nodiscard]]
+		const rendering::ComponentBVH< rendering::Model >&
+			GetModels() const noexcept {
+
+			return m_models;
+		}
+
+		[[nodiscard]]
+		ID3D11Device& GetDevice() const noexcept {
+			return *m_device.Get();
+		}
+
+	private:
+
+		/**
+		 The number of meshes of synthetic worlds.
+		 */
+		static constexpr std::size_t s_nb_meshes = 16u;
+
+		ComPtr< ID3D11Device > m_device;
+		rendering::DisplayConfiguration m_display_configuration;
+		rendering::ResourceManager m_resource_manager;
+		rendering::World m_world;
+		rendering::ComponentBVH< rendering::Model > m_models;
+		ProxyVector< Node > m_nodes;
+		std::vector< SharedPtr< const rendering::Mesh > > m_meshes;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "resource\resource_pool.hpp"
+#include "type\atomic_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A class of values counting their alive instances.
+		 */
+		class TestValue {
+
+		public:
+
+			TestValue() noexcept {
+				++s_nb_alive;
+			}
+
+			TestValue(const TestValue& value) = delete;
+
+			~TestValue() {
+				--s_nb_alive;
+			}
+
+			TestValue& operator=(const TestValue& value) = delete;
+
+			/**
+			 The number of alive test values.
+			 */
+			static inline AtomicU64 s_nb_alive = 0u;
+		};
+
+		/**
+		 A class of resources counting their alive instances.
+		 */
+		class TestResource {
+
+		public:
+
+			explicit TestResource(std::string name)
+				: m_name(std::move(name)) {}
+
+			[[nodiscard]]
+			const std::string& GetName() const noexcept {
+				return m_name;
+			}
+
+		private:
+
+			std::string m_name;
+			TestValue m_value;
+		};
+
+		/**
+		 Returns the name of the resource with the given index.
+		 */
+		[[nodiscard]]
+		const std::string GetName(std::size_t index) {
+			return "resource_" + std::to_string(index);
+		}
+
+		/**
+		 Creates and releases resources of the given pool with the given
+		 number of keys on the given number of threads.
+
+		 @return		The number of created or found resources whose name
+						does not match their key.
+		 */
+		[[nodiscard]]
+		std::size_t Churn(ResourcePool< std::string, TestResource >& pool,
+						  std::size_t nb_threads,
+						  std::size_t nb_iterations,
+						  std::size_t nb_keys) {
+
+			AtomicU64 nb_mismatches = 0u;
+			std::vector< std::thread > threads;
+			for (std::size_t t = 0u; t < nb_threads; ++t) {
+				threads.emplace_back([&pool, &nb_mismatches,
+									  t, nb_iterations, nb_keys]() {
+					std::mt19937 generator(static_cast< U32 >(t));
+					std::uniform_int_distribution< std::size_t > key(0u, nb_keys - 1u);
+					for (std::size_t i = 0u; i < nb_iterations; ++i) {
+						const auto name     = GetName(key(generator));
+						const auto resource = pool.GetOrCreate(name, name);
+						if (resource->GetName() != name) {
+							++nb_mismatches;
+						}
+					}
+				});
+			}
+			for (auto& thread : threads) {
+				thread.join();
+			}
+
+			return nb_mismatches;
+		}
+	}
+
+	MAGE_TEST(ConcurrentResourceMapReclaimsErasedEntries) {
+		ConcurrentResourceMap< std::string, SharedPtr< TestValue > > map;
+		const std::string key = "key";
+		const auto hash = HashResourceKey(key);
+
+		// Erasing and reinserting the same key does not accumulate entries.
+		for (std::size_t i = 0u; i < 10000u; ++i) {
+			const std::scoped_lock lock(map.GetMutex(hash));
+			map.Insert(hash, key, MakeShared< TestValue >());
+			map.Erase(hash, key);
+		}
+		MAGE_CHECK(map.empty());
+		MAGE_CHECK(0u == TestValue::s_nb_alive);
+
+		// Entries that can be reached by a reader are not reclaimed.
+		{
+			const std::scoped_lock lock(map.GetMutex(hash));
+			map.Insert(hash, key, MakeShared< TestValue >());
+		}
+		{
+			const auto guard = map.Read(hash);
+			const auto entry = map.Find(hash, key);
+			MAGE_CHECK(nullptr != entry);
+			{
+				const std::scoped_lock lock(map.GetMutex(hash));
+				map.Erase(hash, key);
+				map.Insert(hash, key, MakeShared< TestValue >());
+				map.Erase(hash, key);
+			}
+			MAGE_CHECK(nullptr == map.Find(hash, key));
+			MAGE_CHECK(key == entry->m_key);
+			MAGE_CHECK(2u == TestValue::s_nb_alive);
+		}
+
+		// The next writer reclaims them.
+		{
+			const std::scoped_lock lock(map.GetMutex(hash));
+			map.Insert(hash, key, MakeShared< TestValue >());
+		}
+		MAGE_CHECK(1u == TestValue::s_nb_alive);
+
+		// Growing retires and reclaims tables, the live entries are kept.
+		for (std::size_t i = 0u; i < 1000u; ++i) {
+			const auto name = GetName(i);
+			const auto name_hash = HashResourceKey(name);
+			const std::scoped_lock lock(map.GetMutex(name_hash));
+			map.Insert(name_hash, name, MakeShared< TestValue >());
+		}
+		MAGE_CHECK(1001u == map.size());
+		MAGE_CHECK(1001u == TestValue::s_nb_alive);
+		for (std::size_t i = 0u; i < 1000u; ++i) {
+			const auto name = GetName(i);
+			const auto name_hash = HashResourceKey(name);
+			const auto guard = map.Read(name_hash);
+			MAGE_CHECK(nullptr != map.Find(name_hash, name));
+		}
+
+		map.Clear();
+		MAGE_CHECK(map.empty());
+		MAGE_CHECK(0u == TestValue::s_nb_alive);
+	}
+
+	MAGE_TEST(ResourcePoolRecreatesExpiredResources) {
+		ResourcePool< std::string, TestResource > pool;
+		const std::string name = "resource";
+
+		for (std::size_t i = 0u; i < 10000u; ++i) {
+			const auto resource = pool.GetOrCreate(name, name);
+			MAGE_CHECK(pool.Contains(name));
+			MAGE_CHECK(resource == pool.Get(name));
+			MAGE_CHECK(1u == pool.size());
+		}
+		MAGE_CHECK(!pool.Contains(name));
+		MAGE_CHECK(pool.empty());
+		MAGE_CHECK(0u == TestValue::s_nb_alive);
+	}
+
+	MAGE_TEST(ResourcePoolIsThreadSafe) {
+		ResourcePool< std::string, TestResource > pool;
+
+		// Resources expire and are recreated concurrently.
+		MAGE_CHECK(0u == Churn(pool, 4u, 20000u, 64u));
+		MAGE_CHECK(pool.empty());
+		MAGE_CHECK(0u == TestValue::s_nb_alive);
+
+		// Live resources are shared.
+		std::vector< SharedPtr< TestResource > > resources;
+		for (std::size_t i = 0u; i < 64u; ++i) {
+			resources.push_back(pool.GetOrCreate(GetName(i), GetName(i)));
+		}
+		MAGE_CHECK(0u == Churn(pool, 4u, 20000u, 64u));
+		MAGE_CHECK(64u == pool.size());
+		MAGE_CHECK(64u == TestValue::s_nb_alive);
+		for (std::size_t i = 0u; i < 64u; ++i) {
+			MAGE_CHECK(resources[i] == pool.Get(GetName(i)));
+		}
+	}
+
+	MAGE_BENCHMARK(ResourcePoolContention) {
+		static constexpr std::size_t s_nb_iterations = 100000u;
+		static constexpr std::size_t s_nb_keys       = 1024u;
+
+		for (const std::size_t nb_threads : { 1u, 2u, 4u, 8u }) {
+			const auto label = " (" + std::to_string(nb_threads) + " threads)";
+
+			// Lookups of live resources.
+			{
+				ResourcePool< std::string, TestResource > pool;
+				std::vector< SharedPtr< TestResource > > resources;
+				for (std::size_t i = 0u; i < s_nb_keys; ++i) {
+					resources.push_back(pool.GetOrCreate(GetName(i), GetName(i)));
+				}
+
+				const auto milliseconds = Measure(1u, [&pool, nb_threads]() {
+					DoNotOptimize(Churn(pool, nb_threads, s_nb_iterations, s_nb_keys));
+				});
+				ReportValue("GetOrCreate of live resources" + label,
+					static_cast< F64 >(nb_threads * s_nb_iterations) / milliseconds,
+					"lookups/ms");
+			}
+
+			// Expiring and recreating resources.
+			{
+				ResourcePool< std::string, TestResource > pool;
+
+				const auto milliseconds = Measure(1u, [&pool, nb_threads]() {
+					DoNotOptimize(Churn(pool, nb_threads, s_nb_iterations, s_nb_keys));
+				});
+				ReportValue("GetOrCreate of expiring resources" + label,
+					static_cast< F64 >(nb_threads * s_nb_iterations) / milliseconds,
+					"lookups/ms");
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,362 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "renderer\test_device.hpp"
+#include "resource\rendering_resource_manager.hpp"
+#include "resource\model\model_factory.hpp"
+#include "resource\texture\texture_factory.hpp"
+#include "type\atomic_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	using namespace rendering;
+
+	namespace {
+
+		/**
+		 A class of temporary files.
+		 */
+		class TemporaryFile {
+
+		public:
+
+			TemporaryFile(const std::wstring& name, const std::string& data)
+				: m_path(std::filesystem::temp_directory_path() / name) {
+
+				std::ofstream file(m_path, std::ios::binary);
+				file.write(data.data(), static_cast< std::streamsize >(data.size()));
+			}
+
+			TemporaryFile(const TemporaryFile& file) = delete;
+
+			TemporaryFile(TemporaryFile&& file) = delete;
+
+			~TemporaryFile() {
+				std::error_code error;
+				std::filesystem::remove(m_path, error);
+			}
+
+			TemporaryFile& operator=(const TemporaryFile& file) = delete;
+
+			TemporaryFile& operator=(TemporaryFile&& file) = delete;
+
+			[[nodiscard]]
+			const std::wstring GetPath() const {
+				return m_path.wstring();
+			}
+
+		private:
+
+			std::filesystem::path m_path;
+		};
+
+		/**
+		 Returns the contents of an OBJ file containing a single triangle.
+		 */
+		[[nodiscard]]
+		const std::string GetTriangleOBJ() {
+			return "v 0 0 0\nv 1 0 0\nv 0 1 0\nvt 0 0\nvn 0 0 1\n"
+				   "f 1/1/1 2/1/1 3/1/1\n";
+		}
+
+		/**
+		 Returns the contents of a DDS file containing a single (opaque
+		 white) R8G8B8A8 texel.
+		 */
+		[[nodiscard]]
+		const std::string GetTexelDDS() {
+			std::string data(128u + 4u, '\0');
+			const auto set = [&data](std::size_t offset, U32 value) {
+				for (std::size_t i = 0u; i < 4u; ++i) {
+					data[offset + i] = static_cast< char >((value >> (8u * i)) & 0xFFu);
+				}
+			};
+
+			set(  0u, 0x20534444u); // "DDS "
+			set(  4u, 124u);        // header size
+			set(  8u, 0x100Fu);     // caps, height, width, pitch, pixel format
+			set( 12u, 1u);          // height
+			set( 16u, 1u);          // width
+			set( 20u, 4u);          // pitch
+			set( 76u, 32u);         // pixel format size
+			set( 80u, 0x41u);       // RGB, alpha pixels
+			set( 88u, 32u);         // bits per pixel
+			set( 92u, 0x000000FFu); // red mask
+			set( 96u, 0x0000FF00u); // green mask
+			set(100u, 0x00FF0000u); // blue mask
+			set(104u, 0xFF000000u); // alpha mask
+			set(108u, 0x1000u);     // texture
+			set(128u, 0xFFFFFFFFu); // texel
+
+			return data;
+		}
+
+		/**
+		 Checks whether the given future is ready.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		bool IsReady(const std::shared_future< T >& future) {
+			return std::future_status::ready
+				== future.wait_for(std::chrono::seconds(0));
+		}
+
+		/**
+		 Updates the given resource manager until the given predicate is
+		 satisfied (or a time out of 10 seconds expires).
+
+		 @return		@c true if the given predicate is satisfied.
+						@c false otherwise.
+		 */
+		template< typename PredicateT >
+		[[nodiscard]]
+		bool UpdateUntil(ResourceManager& resource_manager,
+						 PredicateT&& predicate) {
+
+			const auto end = std::chrono::steady_clock::now()
+				           + std::chrono::seconds(10);
+			while (!predicate()) {
+				if (end < std::chrono::steady_clock::now()) {
+					return false;
+				}
+
+				resource_manager.Update();
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			return true;
+		}
+	}
+
+	MAGE_TEST(ResourceStreamerExecutesLoadingAndCreationTasks) {
+		static constexpr std::size_t s_nb_tasks = 100u;
+
+		ResourceStreamer streamer;
+		MAGE_CHECK(!ResourceStreamer::IsWorkerThread());
+		MAGE_CHECK(!streamer.HasPendingTasks());
+
+		// Loading tasks are executed on the worker threads, the creation
+		// tasks they submit on the thread updating the resource streamer.
+		const auto thread = std::this_thread::get_id();
+		AtomicU64 nb_worker_loads = 0u;
+		std::size_t nb_creates = 0u;
+		std::size_t nb_thread_creates = 0u;
+		for (std::size_t i = 0u; i < s_nb_tasks; ++i) {
+			streamer.Load([&]() {
+				if (ResourceStreamer::IsWorkerThread()) {
+					++nb_worker_loads;
+				}
+
+				streamer.Create([&]() {
+					++nb_creates;
+					if (std::this_thread::get_id() == thread) {
+						++nb_thread_creates;
+					}
+				});
+			});
+		}
+
+		const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+		while (streamer.HasPendingTasks()
+			   && std::chrono::steady_clock::now() < end) {
+			streamer.Update(TimeIntervalSeconds(1.0));
+			std::this_thread::yield();
+		}
+
+		MAGE_CHECK(!streamer.HasPendingTasks());
+		MAGE_CHECK(s_nb_tasks == nb_worker_loads);
+		MAGE_CHECK(s_nb_tasks == nb_creates);
+		MAGE_CHECK(s_nb_tasks == nb_thread_creates);
+	}
+
+	MAGE_TEST(ResourceStreamerCreatesWithinBudget) {
+		static constexpr std::size_t s_nb_tasks = 10u;
+
+		ResourceStreamer streamer(0u);
+		std::vector< std::size_t > created;
+		for (std::size_t i = 0u; i < s_nb_tasks; ++i) {
+			streamer.Create([&created, i]() {
+				created.push_back(i);
+			});
+		}
+		MAGE_CHECK(streamer.HasPendingTasks());
+
+		// At least one creation task is executed per update.
+		streamer.Update(TimeIntervalSeconds::zero());
+		MAGE_CHECK(1u == created.size());
+		streamer.Update(TimeIntervalSeconds::zero());
+		MAGE_CHECK(2u == created.size());
+
+		// Creation tasks are executed in order of submission.
+		streamer.Update(TimeIntervalSeconds(1.0));
+		MAGE_CHECK(s_nb_tasks == created.size());
+		for (std::size_t i = 0u; i < created.size(); ++i) {
+			MAGE_CHECK(i == created[i]);
+		}
+		MAGE_CHECK(!streamer.HasPendingTasks());
+
+		// Updating without creation tasks executes nothing.
+		streamer.Update(TimeIntervalSeconds::zero());
+		MAGE_CHECK(s_nb_tasks == created.size());
+	}
+
+	MAGE_TEST(ResourceStreamerDiscardsPendingTasks) {
+		AtomicU64 nb_loads = 0u;
+		std::size_t nb_creates = 0u;
+		{
+			ResourceStreamer streamer(1u);
+			for (std::size_t i = 0u; i < 4u; ++i) {
+				streamer.Load([&nb_loads]() {
+					std::this_thread::sleep_for(std::chrono::milliseconds(20));
+					++nb_loads;
+				});
+				streamer.Create([&nb_creates]() {
+					++nb_creates;
+				});
+			}
+		}
+
+		// The started loading task is finished, the others are discarded.
+		MAGE_CHECK(nb_loads <= 1u);
+		MAGE_CHECK(0u == nb_creates);
+	}
+
+	MAGE_TEST(ResourceManagerStreamsModels) {
+		const TemporaryFile file(L"mage_resource_streamer_test.obj",
+								 GetTriangleOBJ());
+		const auto device = CreateTestDevice();
+		ResourceManager resource_manager(*device.Get());
+		const MeshDescriptor< VertexPositionNormalTexture > desc(true, true);
+
+		// Requests of a model which is being streamed share the stream.
+		std::vector< ModelDescriptorPtr > models;
+		const auto on_ready = [&models](const ModelDescriptorPtr& model) {
+			models.push_back(model);
+		};
+		const auto future1 = resource_manager.GetOrCreateAsync< ModelDescriptor >(
+			file.GetPath(), desc, on_ready);
+		const auto future2 = resource_manager.GetOrCreateAsync< ModelDescriptor >(
+			file.GetPath(), desc, on_ready);
+		MAGE_CHECK(models.empty());
+
+		MAGE_CHECK(UpdateUntil(resource_manager, [&future1]() {
+			return IsReady(future1);
+		}));
+		MAGE_CHECK(IsReady(future2));
+		MAGE_CHECK(2u == models.size());
+		MAGE_CHECK(nullptr != future1.get());
+		MAGE_CHECK(future1.get() == future2.get());
+		MAGE_CHECK(models.front() == future1.get());
+		MAGE_CHECK(models.back()  == future1.get());
+		MAGE_CHECK(nullptr != future1.get()->GetMesh());
+		MAGE_CHECK(resource_manager.Contains< ModelDescriptor >(file.GetPath()));
+
+		std::size_t nb_model_parts = 0u;
+		future1.get()->ForEachModelPart([&nb_model_parts](const ModelPart&) {
+			++nb_model_parts;
+		});
+		MAGE_CHECK(0u != nb_model_parts);
+
+		// Requests of a created model are ready at once, their callbacks are
+		// called while updating.
+		const auto future3 = resource_manager.GetOrCreateAsync< ModelDescriptor >(
+			file.GetPath(), desc, on_ready);
+		MAGE_CHECK(IsReady(future3));
+		MAGE_CHECK(future1.get() == future3.get());
+		MAGE_CHECK(2u == models.size());
+		resource_manager.Update();
+		MAGE_CHECK(3u == models.size());
+		MAGE_CHECK(models.back() == future1.get());
+	}
+
+	MAGE_TEST(ResourceManagerReportsFailedModels) {
+		const auto path = (std::filesystem::temp_directory_path()
+						   / L"mage_resource_streamer_test_missing.obj").wstring();
+		const auto device = CreateTestDevice();
+		ResourceManager resource_manager(*device.Get());
+		const MeshDescriptor< VertexPositionNormalTexture > desc(true, true);
+
+		std::size_t nb_callbacks = 0u;
+		const auto on_ready = [&nb_callbacks](const ModelDescriptorPtr&) {
+			++nb_callbacks;
+		};
+
+		// Failed requests end: subsequent requests stream again.
+		for (std::size_t i = 0u; i < 2u; ++i) {
+			const auto future1 = resource_manager.GetOrCreateAsync< ModelDescriptor >(
+				path, desc, on_ready);
+			const auto future2 = resource_manager.GetOrCreateAsync< ModelDescriptor >(
+				path, desc, on_ready);
+
+			MAGE_CHECK(UpdateUntil(resource_manager, [&future1, &future2]() {
+				return IsReady(future1) && IsReady(future2);
+			}));
+			MAGE_CHECK_THROWS(future1.get());
+			MAGE_CHECK_THROWS(future2.get());
+		}
+
+		resource_manager.Update();
+		MAGE_CHECK(0u == nb_callbacks);
+		MAGE_CHECK(!resource_manager.Contains< ModelDescriptor >(path));
+	}
+
+	MAGE_TEST(ResourceManagerStreamsTextures) {
+		const TemporaryFile file(L"mage_resource_streamer_test.dds",
+								 GetTexelDDS());
+		const auto device = CreateTestDevice();
+		ResourceManager resource_manager(*device.Get());
+		const auto placeholder = CreateWhiteTexture(resource_manager);
+
+		// The texture shares the placeholder until it is created.
+		const auto texture = resource_manager.GetOrCreateAsync< Texture >(
+			file.GetPath());
+		MAGE_CHECK(nullptr != texture);
+		MAGE_CHECK(texture == resource_manager.GetOrCreateAsync< Texture >(
+			file.GetPath()));
+		MAGE_CHECK(UpdateUntil(resource_manager, [&texture, &placeholder]() {
+			return texture->Get() != placeholder->Get();
+		}));
+		MAGE_CHECK(nullptr != texture->Get());
+		MAGE_CHECK(texture == resource_manager.GetOrCreateAsync< Texture >(
+			file.GetPath()));
+	}
+	MAGE_TEST(ResourceManagerCreatesPlaceholderModels) {
+		const auto device = CreateTestDevice();
+		ResourceManager resource_manager(*device.Get());
+
+		// The placeholder model is shared and has the default material.
+		const auto model = CreatePlaceholderModel(resource_manager);
+		MAGE_CHECK(nullptr != model);
+		MAGE_CHECK(nullptr != model->GetMesh());
+		MAGE_CHECK(model == CreatePlaceholderModel(resource_manager));
+
+		std::size_t nb_model_parts = 0u;
+		model->ForEachModelPart([&nb_model_parts](const ModelPart& model_part) {
+			MAGE_CHECK(model_part.HasDefaultMaterial());
+			MAGE_CHECK(36u == model_part.m_nb_indices);
+			++nb_model_parts;
+		});
+		MAGE_CHECK(1u == nb_model_parts);
+	}
+}
\ No newline at end of file
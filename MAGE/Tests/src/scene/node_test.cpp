@@ -0,0 +1,183 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "scene\node.hpp"
+#include "scene\scene_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A class of components without any behavior.
+		 */
+		class TestComponent : public Component {};
+
+		/**
+		 A struct of scenes containing nodes with one component each.
+		 */
+		struct TestScene {
+
+		public:
+
+			ProxyPtr< Node > Create() {
+				const auto node = AddElement(m_nodes);
+				node->Set(node);
+				node->Add(AddElement(m_components));
+				return node;
+			}
+
+			void RemoveTerminated() {
+				RemoveTerminatedElements(m_components);
+				RemoveTerminatedElements(m_nodes);
+			}
+
+			ProxyVector< Node > m_nodes;
+			ProxyVector< TestComponent > m_components;
+		};
+
+		/**
+		 The number of nodes of the churn benchmark.
+		 */
+		constexpr U32 g_nb_nodes = 10000u;
+
+		/**
+		 The number of frames of the churn benchmark.
+		 */
+		constexpr U32 g_nb_frames = 1000u;
+
+		/**
+		 The number of frames of the churn benchmark between two frames
+		 terminating (and recreating) nodes.
+		 */
+		constexpr U32 g_churn_period = 100u;
+
+		/**
+		 The number of nodes of the churn benchmark terminated (and recreated)
+		 per churn frame.
+		 */
+		constexpr U32 g_nb_churned_nodes = 16u;
+
+		/**
+		 Simulates the frames of the churn benchmark.
+		 */
+		template< typename RemoveTerminatedT >
+		void Churn(TestScene& scene,
+				   std::vector< ProxyPtr< Node > >& nodes,
+				   RemoveTerminatedT&& remove_terminated) {
+
+			for (U32 frame = 0u; frame < g_nb_frames; ++frame) {
+				if (0u == frame % g_churn_period) {
+					for (U32 i = 0u; i < g_nb_churned_nodes; ++i) {
+						auto& node = nodes[(frame + 97u * i) % g_nb_nodes];
+						node->SetState(State::Terminated);
+						node = scene.Create();
+					}
+				}
+
+				remove_terminated(scene);
+			}
+		}
+	}
+
+	MAGE_TEST(NodeTerminationTerminatesDescendantsAndComponents) {
+		TestScene scene;
+		const auto root       = scene.Create();
+		const auto child      = scene.Create();
+		const auto grandchild = scene.Create();
+		root->AddChild(child);
+		child->AddChild(grandchild);
+
+		const auto component = child->Get< TestComponent >();
+		const auto version   = Component::GetTerminationVersion();
+		child->SetState(State::Terminated);
+
+		MAGE_CHECK(version != Component::GetTerminationVersion());
+		MAGE_CHECK(State::Active     == root->GetState());
+		MAGE_CHECK(State::Terminated == child->GetState());
+		MAGE_CHECK(State::Terminated == grandchild->GetState());
+		MAGE_CHECK(State::Terminated == component->GetState());
+		MAGE_CHECK(0u == root->GetNumberOfChilds());
+		MAGE_CHECK(!child->HasParent());
+		MAGE_CHECK(!grandchild->HasParent());
+
+		// Terminated nodes and components cannot be revived.
+		child->SetState(State::Active);
+		component->SetState(State::Active);
+		MAGE_CHECK(State::Terminated == child->GetState());
+		MAGE_CHECK(State::Terminated == component->GetState());
+
+		scene.RemoveTerminated();
+		MAGE_CHECK(1u == scene.m_nodes.size());
+		MAGE_CHECK(1u == scene.m_components.size());
+		MAGE_CHECK(nullptr == child);
+		MAGE_CHECK(nullptr == component);
+	}
+
+	MAGE_TEST(ComponentTerminationRemovesComponentFromOwner) {
+		TestScene scene;
+		const auto node      = scene.Create();
+		const auto component = node->Get< TestComponent >();
+		const auto version   = Component::GetTerminationVersion();
+
+		component->SetState(State::Terminated);
+		MAGE_CHECK(version != Component::GetTerminationVersion());
+		MAGE_CHECK(State::Active == node->GetState());
+		MAGE_CHECK(!node->Contains< TestComponent >());
+
+		// Deactivating a node does not terminate anything.
+		const auto other = scene.Create();
+		const auto other_version = Component::GetTerminationVersion();
+		other->SetState(State::Passive);
+		MAGE_CHECK(other_version == Component::GetTerminationVersion());
+		MAGE_CHECK(State::Passive == other->Get< TestComponent >()->GetState());
+	}
+
+	MAGE_BENCHMARK(SceneChurn) {
+		// Sweeps every frame.
+		{
+			TestScene scene;
+			std::vector< ProxyPtr< Node > > nodes;
+			for (U32 i = 0u; i < g_nb_nodes; ++i) {
+				nodes.push_back(scene.Create());
+			}
+
+			ReportMeasurement("sweep every frame (10k nodes, 1000 frames)",
+				Measure(5u, [&scene, &nodes]() {
+					Churn(scene, nodes, [](TestScene& scene) {
+						scene.RemoveTerminated();
+					});
+				}));
+		}
+
+		// Sweeps only after terminations.
+		{
+			TestScene scene;
+			std::vector< ProxyPtr< Node > > nodes;
+			for (U32 i = 0u; i < g_nb_nodes; ++i) {
+				nodes.push_back(scene.Create());
+			}
+
+			auto termination_version = Component::GetTerminationVersion();
+			ReportMeasurement("sweep after terminations (10k nodes, 1000 frames)",
+				Measure(5u, [&scene, &nodes, &termination_version]() {
+					Churn(scene, nodes,
+						[&termination_version](TestScene& scene) {
+							const auto version = Component::GetTerminationVersion();
+							if (version != termination_version) {
+								termination_version = version;
+								scene.RemoveTerminated();
+							}
+						});
+				}));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,198 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "scene\node.hpp"
+#include "scene\scene_utils.hpp"
+#include "scene\transform_hierarchy.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cmath>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 The number of child nodes per node of the synthetic hierarchies.
+		 */
+		constexpr std::size_t g_nb_childs = 4u;
+
+		/**
+		 A struct of synthetic hierarchies: complete trees of nodes with
+		 translated, rotated and (non-uniformly) scaled transforms.
+		 */
+		struct TestHierarchy {
+
+		public:
+
+			explicit TestHierarchy(std::size_t nb_nodes) {
+				for (std::size_t i = 0u; i < nb_nodes; ++i) {
+					const auto node = AddElement(m_nodes);
+					node->Set(node);
+
+					auto& transform = node->GetTransform();
+					const auto x = static_cast< F32 >(i);
+					transform.SetTranslation(0.1f * std::fmod(x, 7.0f),
+											 0.2f * std::fmod(x, 5.0f),
+											 0.3f * std::fmod(x, 3.0f));
+					transform.SetRotation(0.01f * x, 0.02f * x, 0.03f * x);
+					if (0u == i % 16u) {
+						transform.SetScale(1.0f, 1.5f, 0.5f);
+					}
+
+					m_handles.push_back(node);
+					if (0u != i) {
+						m_handles[(i - 1u) / g_nb_childs]->AddChild(node);
+					}
+				}
+			}
+
+			/**
+			 Animates every given number of nodes.
+			 */
+			void Animate(std::size_t period) {
+				for (std::size_t i = 0u; i < m_handles.size(); i += period) {
+					m_handles[i]->GetTransform().AddRotationY(0.01f);
+				}
+			}
+
+			ProxyVector< Node > m_nodes;
+			std::vector< ProxyPtr< Node > > m_handles;
+		};
+
+		/**
+		 Returns the object-to-world matrix of the transform of the given
+		 node, composed along the path to the root without any caching.
+		 */
+		[[nodiscard]]
+		const XMMATRIX XM_CALLCONV GetExpectedObjectToWorldMatrix(const Node& node) {
+			auto object_to_world = node.GetTransform().GetObjectToParentMatrix();
+			for (auto parent = node.GetParent(); nullptr != parent;
+				 parent = parent->GetParent()) {
+
+				object_to_world *= parent->GetTransform().GetObjectToParentMatrix();
+			}
+			return object_to_world;
+		}
+
+		/**
+		 Checks whether the given matrices are approximately equal.
+		 */
+		[[nodiscard]]
+		bool XM_CALLCONV Equals(FXMMATRIX lhs, CXMMATRIX rhs) noexcept {
+			const auto epsilon = XMVectorReplicate(1e-3f);
+			for (U32 i = 0u; i < 4u; ++i) {
+				if (!XMVector4NearEqual(lhs.r[i], rhs.r[i], epsilon)) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/**
+		 Checks whether the resolved matrices of the transforms of the given
+		 hierarchy match the composed matrices.
+		 */
+		[[nodiscard]]
+		bool IsUpToDate(const TestHierarchy& hierarchy) {
+			for (const auto& node : hierarchy.m_nodes) {
+				const auto& transform = node.GetTransform();
+				const auto expected = GetExpectedObjectToWorldMatrix(node);
+				if (!Equals(expected, transform.GetResolvedObjectToWorldMatrix())) {
+					return false;
+				}
+				if (!Equals(XMMatrixIdentity(),
+							expected * transform.GetResolvedWorldToObjectMatrix())) {
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	MAGE_TEST(TransformHierarchyUpdatesAllTransforms) {
+		TestHierarchy hierarchy(5000u);
+		JobSystem job_system(3u);
+		TransformHierarchy transforms;
+
+		transforms.Update(hierarchy.m_nodes, job_system);
+		MAGE_CHECK(IsUpToDate(hierarchy));
+
+		// Changed transforms propagate to their descendants.
+		hierarchy.Animate(7u);
+		transforms.Update(hierarchy.m_nodes, job_system);
+		MAGE_CHECK(IsUpToDate(hierarchy));
+
+		// Graph changes rebuild the hierarchy.
+		auto& handles = hierarchy.m_handles;
+		handles[1]->RemoveChild(handles[5]);
+		handles[2]->AddChild(handles[5]);
+		handles[3]->AddChild(handles[1]);
+		transforms.Update(hierarchy.m_nodes, job_system);
+		MAGE_CHECK(IsUpToDate(hierarchy));
+		MAGE_CHECK(handles[3] == handles[1]->GetParent());
+
+		// The versions of the moved subtrees change.
+		const auto version = handles[1]->GetTransform().GetResolvedVersion();
+		handles[3]->GetTransform().AddTranslationY(1.0f);
+		transforms.Update(hierarchy.m_nodes, job_system);
+		MAGE_CHECK(version != handles[1]->GetTransform().GetResolvedVersion());
+		MAGE_CHECK(IsUpToDate(hierarchy));
+	}
+
+	MAGE_BENCHMARK(TransformHierarchyUpdate) {
+		TestHierarchy hierarchy(100000u);
+
+		// Lazy evaluation of each transform (i.e. each model querying its
+		// object-to-world matrix).
+		ReportMeasurement("lazy evaluation (100k nodes, 1% animated)",
+			Measure(20u, [&hierarchy]() {
+				hierarchy.Animate(100u);
+				for (const auto& node : hierarchy.m_nodes) {
+					DoNotOptimize(node.GetTransform().GetObjectToWorldMatrix());
+				}
+			}));
+
+		for (const std::size_t nb_workers : { 0u, 1u, 3u, 7u }) {
+			JobSystem job_system(nb_workers);
+			TransformHierarchy transforms;
+			transforms.Update(hierarchy.m_nodes, job_system);
+
+			const auto label = "TransformHierarchy::Update (100k nodes, 1% animated, "
+							 + std::to_string(nb_workers + 1u) + " threads)";
+			ReportMeasurement(label,
+				Measure(20u, [&hierarchy, &transforms, &job_system]() {
+					hierarchy.Animate(100u);
+					transforms.Update(hierarchy.m_nodes, job_system);
+					DoNotOptimize(hierarchy.m_handles.back()->GetTransform()
+								  .GetResolvedObjectToWorldMatrix());
+				}));
+		}
+
+		// Rebuilding the flattened arrays.
+		{
+			JobSystem job_system(0u);
+			TransformHierarchy transforms;
+			ReportMeasurement("TransformHierarchy::Update after a graph change (100k nodes)",
+				Measure(20u, [&hierarchy, &transforms, &job_system]() {
+					transforms.Clear();
+					transforms.Update(hierarchy.m_nodes, job_system);
+				}));
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,415 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "system\profiler.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cctype>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A class of (syntax-only) JSON validators.
+		 */
+		class JSONValidator {
+
+		public:
+
+			explicit JSONValidator(std::string_view json) noexcept
+				: m_json(json),
+				m_pos(0u) {}
+
+			/**
+			 Checks whether the JSON text of this validator is well-formed.
+			 */
+			[[nodiscard]]
+			bool IsValid() noexcept {
+				if (!ReadValue()) {
+					return false;
+				}
+				SkipWhitespace();
+				return m_json.size() == m_pos;
+			}
+
+		private:
+
+			[[nodiscard]]
+			bool HasNext() const noexcept {
+				return m_pos < m_json.size();
+			}
+
+			[[nodiscard]]
+			char Peek() const noexcept {
+				return HasNext() ? m_json[m_pos] : '\0';
+			}
+
+			[[nodiscard]]
+			bool Read(char c) noexcept {
+				SkipWhitespace();
+				if (c != Peek()) {
+					return false;
+				}
+				++m_pos;
+				return true;
+			}
+
+			void SkipWhitespace() noexcept {
+				while (HasNext() && (' '  == Peek() || '\t' == Peek()
+								  || '\n' == Peek() || '\r' == Peek())) {
+					++m_pos;
+				}
+			}
+
+			[[nodiscard]]
+			bool ReadDigits() noexcept {
+				const auto begin = m_pos;
+				while ('0' <= Peek() && '9' >= Peek()) {
+					++m_pos;
+				}
+				return begin != m_pos;
+			}
+
+			[[nodiscard]]
+			bool ReadValue() noexcept {
+				SkipWhitespace();
+				switch (Peek()) {
+
+				case '{': {
+					return ReadObject();
+				}
+
+				case '[': {
+					return ReadArray();
+				}
+
+				case '"': {
+					return ReadString();
+				}
+
+				case 't': {
+					return ReadLiteral("true");
+				}
+
+				case 'f': {
+					return ReadLiteral("false");
+				}
+
+				case 'n': {
+					return ReadLiteral("null");
+				}
+
+				default: {
+					return ReadNumber();
+				}
+
+				}
+			}
+
+			[[nodiscard]]
+			bool ReadObject() noexcept {
+				if (!Read('{')) {
+					return false;
+				}
+				if (Read('}')) {
+					return true;
+				}
+				do {
+					SkipWhitespace();
+					if (!ReadString() || !Read(':') || !ReadValue()) {
+						return false;
+					}
+				} while (Read(','));
+				return Read('}');
+			}
+
+			[[nodiscard]]
+			bool ReadArray() noexcept {
+				if (!Read('[')) {
+					return false;
+				}
+				if (Read(']')) {
+					return true;
+				}
+				do {
+					if (!ReadValue()) {
+						return false;
+					}
+				} while (Read(','));
+				return Read(']');
+			}
+
+			[[nodiscard]]
+			bool ReadString() noexcept {
+				if ('"' != Peek()) {
+					return false;
+				}
+				++m_pos;
+
+				while (HasNext()) {
+					const auto c = m_json[m_pos++];
+					if ('"' == c) {
+						return true;
+					}
+					if (0x20u > static_cast< unsigned char >(c)) {
+						// Unescaped control character
+						return false;
+					}
+					if ('\\' != c) {
+						continue;
+					}
+
+					static constexpr std::string_view s_escapes = "\"\\/bfnrt";
+
+					const auto escaped = Peek();
+					++m_pos;
+					if ('u' == escaped) {
+						for (std::size_t i = 0u; i < 4u; ++i) {
+							if (!std::isxdigit(static_cast< unsigned char >(Peek()))) {
+								return false;
+							}
+							++m_pos;
+						}
+					}
+					else if (s_escapes.npos == s_escapes.find(escaped)) {
+						return false;
+					}
+				}
+
+				return false;
+			}
+
+			[[nodiscard]]
+			bool ReadNumber() noexcept {
+				if ('-' == Peek()) {
+					++m_pos;
+				}
+				if (!ReadDigits()) {
+					return false;
+				}
+				if ('.' == Peek()) {
+					++m_pos;
+					if (!ReadDigits()) {
+						return false;
+					}
+				}
+				if ('e' == Peek() || 'E' == Peek()) {
+					++m_pos;
+					if ('+' == Peek() || '-' == Peek()) {
+						++m_pos;
+					}
+					return ReadDigits();
+				}
+				return true;
+			}
+
+			[[nodiscard]]
+			bool ReadLiteral(std::string_view literal) noexcept {
+				if (m_json.substr(m_pos, literal.size()) != literal) {
+					return false;
+				}
+				m_pos += literal.size();
+				return true;
+			}
+
+			std::string_view m_json;
+
+			std::size_t m_pos;
+		};
+
+		/**
+		 Records a profile zone with the given (static) name, begin time
+		 stamp and duration in milliseconds on the calling thread.
+		 */
+		void Record(const char* name,
+					ProfileEvent::TimeStamp begin,
+					U32 duration) noexcept {
+
+			auto& profiler = Profiler::Get();
+
+			ProfileEvent event{ name };
+			event.m_depth = profiler.BeginZone();
+			event.m_begin = begin;
+			event.m_end   = begin + std::chrono::milliseconds(duration);
+			profiler.EndZone(event);
+		}
+
+		/**
+		 Returns the statistics of the profile zone with the given name (or
+		 empty statistics if the profile zone never occurred).
+		 */
+		[[nodiscard]]
+		const ProfileZoneStats GetZoneStats(std::string_view name) noexcept {
+			for (const auto& stats : Profiler::Get().GetZoneStats()) {
+				if (name == stats.m_name) {
+					return stats;
+				}
+			}
+			return {};
+		}
+
+		/**
+		 Returns the path of the trace file of the tests.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path GetTracePath() {
+			return std::filesystem::temp_directory_path() / L"mage_profiler_test.json";
+		}
+
+		/**
+		 Exports and returns the trace of the profiler.
+		 */
+		[[nodiscard]]
+		const std::string ExportTrace() {
+			Profiler::Get().ExportTrace(GetTracePath());
+
+			std::string trace;
+			{
+				std::ifstream file(GetTracePath());
+				trace.assign(std::istreambuf_iterator< char >(file),
+							 std::istreambuf_iterator< char >());
+			}
+			std::filesystem::remove(GetTracePath());
+
+			return trace;
+		}
+	}
+
+	MAGE_TEST(ProfilerZoneStatsSpanFrames) {
+		auto& profiler = Profiler::Get();
+		const auto now = std::chrono::high_resolution_clock::now();
+
+		// Frame 1: A (2 ms) and two occurrences of B (1 ms each).
+		Record("ProfilerTestA", now, 2u);
+		Record("ProfilerTestB", now, 1u);
+		Record("ProfilerTestB", now, 1u);
+		profiler.EndFrame();
+
+		// Frame 2: A (4 ms) without B.
+		Record("ProfilerTestA", now, 4u);
+		profiler.EndFrame();
+
+		// Frame 3: A (3 ms) and B (5 ms).
+		Record("ProfilerTestA", now, 3u);
+		Record("ProfilerTestB", now, 5u);
+		profiler.EndFrame();
+
+		const auto a = GetZoneStats("ProfilerTestA");
+		MAGE_CHECK(3u  == a.m_nb_frames);
+		MAGE_CHECK(2.0 == a.m_min);
+		MAGE_CHECK(4.0 == a.m_max);
+		MAGE_CHECK(3.0 == a.GetAverage());
+
+		// Frames without B do not contribute to its statistics.
+		const auto b = GetZoneStats("ProfilerTestB");
+		MAGE_CHECK(2u  == b.m_nb_frames);
+		MAGE_CHECK(2.0 == b.m_min);
+		MAGE_CHECK(5.0 == b.m_max);
+		MAGE_CHECK(3.5 == b.GetAverage());
+
+		// Frames without any zone do not contribute either.
+		profiler.EndFrame();
+		MAGE_CHECK(3u == GetZoneStats("ProfilerTestA").m_nb_frames);
+
+		profiler.ResetZoneStats();
+		MAGE_CHECK(0u  == GetZoneStats("ProfilerTestA").m_nb_frames);
+		MAGE_CHECK(0.0 == GetZoneStats("ProfilerTestA").GetAverage());
+
+		Record("ProfilerTestA", now, 6u);
+		profiler.EndFrame();
+		const auto reset = GetZoneStats("ProfilerTestA");
+		MAGE_CHECK(1u  == reset.m_nb_frames);
+		MAGE_CHECK(6.0 == reset.m_min);
+		MAGE_CHECK(6.0 == reset.m_max);
+	}
+
+	MAGE_TEST(ProfilerCollectsZonesOfAllThreads) {
+		static constexpr std::size_t s_nb_threads = 4u;
+		static constexpr std::size_t s_nb_zones   = 10u;
+
+		auto& profiler = Profiler::Get();
+
+		std::vector< std::thread > threads;
+		for (std::size_t t = 0u; t < s_nb_threads; ++t) {
+			threads.emplace_back([]() {
+				for (std::size_t i = 0u; i < s_nb_zones; ++i) {
+					const ProfileZone zone("ProfilerTestWorker");
+					const ProfileZone child("ProfilerTestWorkerChild");
+				}
+			});
+		}
+		for (auto& thread : threads) {
+			thread.join();
+		}
+
+		// The profile events of terminated threads are still collected.
+		profiler.EndFrame();
+
+		const auto parent = GetZoneStats("ProfilerTestWorker");
+		const auto child  = GetZoneStats("ProfilerTestWorkerChild");
+		MAGE_CHECK(1u == parent.m_nb_frames);
+		MAGE_CHECK(1u == child.m_nb_frames);
+		MAGE_CHECK(parent.m_depth + 1u == child.m_depth);
+		MAGE_CHECK(child.m_total <= parent.m_total);
+
+		// Each thread has its own track in the trace.
+		const auto trace = ExportTrace();
+		static constexpr std::string_view s_name
+			= R"("name":"ProfilerTestWorker",)";
+		std::set< std::string > tracks;
+		std::size_t nb_zones = 0u;
+		for (auto pos = trace.find(s_name); std::string::npos != pos;
+			 pos = trace.find(s_name, pos + 1u)) {
+
+			const auto tid   = trace.find("\"tid\":", pos) + 6u;
+			const auto end   = trace.find('}', tid);
+			tracks.insert(trace.substr(tid, end - tid));
+			++nb_zones;
+		}
+		MAGE_CHECK(s_nb_threads == tracks.size());
+		MAGE_CHECK(s_nb_threads * s_nb_zones == nb_zones);
+	}
+
+	MAGE_TEST(ProfilerExportsWellFormedTrace) {
+		auto& profiler = Profiler::Get();
+		const auto now = std::chrono::high_resolution_clock::now();
+
+		Record("ProfilerTest \"quoted\" C:\\path\tzone\n\x01", now, 1u);
+		Record("ProfilerTest plain zone", now, 1u);
+		profiler.EndFrame();
+
+		const auto trace = ExportTrace();
+		MAGE_CHECK(JSONValidator(trace).IsValid());
+		MAGE_CHECK(std::string::npos != trace.find(
+			R"("name":"ProfilerTest \"quoted\" C:\\path\tzone\n\u0001",)"));
+		MAGE_CHECK(std::string::npos != trace.find(
+			R"("name":"ProfilerTest plain zone",)"));
+
+		// The validator rejects malformed traces.
+		MAGE_CHECK(!JSONValidator(R"({"name":"a"b"})").IsValid());
+		MAGE_CHECK(!JSONValidator(R"({"name":"a\qb"})").IsValid());
+		MAGE_CHECK(!JSONValidator("{\"name\":\"a\nb\"}").IsValid());
+		MAGE_CHECK(!JSONValidator(R"({"traceEvents":[{},]})").IsValid());
+	}
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdio>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 The number of failed checks.
+		 */
+		std::size_t g_nb_failures = 0u;
+	}
+
+	[[nodiscard]]
+	std::vector< TestCase >& GetTestCases() {
+		// Function-local static: the test case registrars are global objects
+		// of other translation units.
+		static std::vector< TestCase > s_test_cases;
+		return s_test_cases;
+	}
+
+	void ReportFailure(const char* file, int line, const char* expression) {
+		std::printf("%s(%d): check failed: %s\n", file, line, expression);
+		++g_nb_failures;
+	}
+
+	[[nodiscard]]
+	std::size_t GetNumberOfFailures() noexcept {
+		return g_nb_failures;
+	}
+
+	void ReportMeasurement(std::string_view label, F64 milliseconds) {
+		std::printf("  %-48.*s %12.4f ms\n",
+					static_cast< int >(label.size()), label.data(),
+					milliseconds);
+	}
+
+	void ReportValue(std::string_view label, F64 value, std::string_view unit) {
+		std::printf("  %-48.*s %12.4f %.*s\n",
+					static_cast< int >(label.size()), label.data(),
+					value,
+					static_cast< int >(unit.size()), unit.data());
+	}
+}
\ No newline at end of file
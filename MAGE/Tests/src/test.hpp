@@ -0,0 +1,263 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	//-------------------------------------------------------------------------
+	// TestCase
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of test cases.
+	 */
+	struct TestCase {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The function type of test cases.
+		 */
+		using Function = void (*)();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The name of this test case.
+		 */
+		const char* m_name;
+
+		/**
+		 The function of this test case.
+		 */
+		Function m_function;
+
+		/**
+		 Flag indicating whether this test case is a benchmark.
+		 */
+		bool m_benchmark;
+	};
+
+	/**
+	 Returns all registered test cases.
+
+	 @return		A reference to a vector containing all registered test
+					cases.
+	 */
+	[[nodiscard]]
+	std::vector< TestCase >& GetTestCases();
+
+	/**
+	 A struct of test case registrars.
+	 */
+	struct TestCaseRegistrar {
+
+	public:
+
+		/**
+		 Registers the given test case.
+
+		 @param[in]		name
+						The name of the test case.
+		 @param[in]		function
+						The function of the test case.
+		 @param[in]		benchmark
+						@c true if the test case is a benchmark. @c false
+						otherwise.
+		 */
+		TestCaseRegistrar(const char* name,
+						  TestCase::Function function,
+						  bool benchmark) {
+
+			GetTestCases().push_back({ name, function, benchmark });
+		}
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Checks and Reports
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 Reports a failed check of the current test case.
+
+	 @param[in]		file
+					The file containing the check.
+	 @param[in]		line
+					The line of the check.
+	 @param[in]		expression
+					The checked expression.
+	 */
+	void ReportFailure(const char* file, int line, const char* expression);
+
+	/**
+	 Returns the number of failed checks.
+
+	 @return		The number of failed checks.
+	 */
+	[[nodiscard]]
+	std::size_t GetNumberOfFailures() noexcept;
+
+	/**
+	 Reports the given measurement of the current benchmark.
+
+	 @param[in]		label
+					The label of the measurement.
+	 @param[in]		milliseconds
+					The measured time in milliseconds.
+	 */
+	void ReportMeasurement(std::string_view label, F64 milliseconds);
+
+	/**
+	 Reports the given value of the current benchmark.
+
+	 @param[in]		label
+					The label of the value.
+	 @param[in]		value
+					The value.
+	 @param[in]		unit
+					The unit of the value.
+	 */
+	void ReportValue(std::string_view label, F64 value, std::string_view unit);
+
+	/**
+	 Measures the average time of the given action.
+
+	 @tparam		ActionT
+					The action type.
+	 @param[in]		nb_iterations
+					The number of iterations.
+	 @param[in]		action
+					The action.
+	 @return		The average time in milliseconds of one iteration of the
+					given action.
+	 */
+	template< typename ActionT >
+	[[nodiscard]]
+	F64 Measure(std::size_t nb_iterations, ActionT&& action) {
+		const auto begin = std::chrono::high_resolution_clock::now();
+		for (std::size_t i = 0u; i < nb_iterations; ++i) {
+			action();
+		}
+		const auto end   = std::chrono::high_resolution_clock::now();
+
+		return std::chrono::duration< F64, std::milli >(end - begin).count()
+			   / static_cast< F64 >(nb_iterations);
+	}
+
+	/**
+	 Prevents the compiler from optimizing away the computation of the given
+	 value.
+
+	 @tparam		T
+					The value type.
+	 @param[in]		value
+					A reference to the value.
+	 */
+	template< typename T >
+	inline void DoNotOptimize(const T& value) noexcept {
+		if constexpr (std::is_arithmetic_v< T >) {
+			// Publishing the address of a temporary does not keep its value
+			// alive.
+			static volatile T s_sink;
+			s_sink = value;
+		}
+		else {
+			static const void* volatile s_sink;
+			s_sink = &value;
+		}
+	}
+
+	#pragma endregion
+}
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+#define MAGE_TEST_CASE(name, benchmark)                                       \
+	static void name();                                                       \
+	static const mage::test::TestCaseRegistrar                                \
+		g_##name##_registrar(#name, &name, benchmark);                        \
+	static void name()
+
+/**
+ Defines a test.
+
+ @param[in]		name
+				The name of the test.
+ */
+#define MAGE_TEST(name) MAGE_TEST_CASE(name, false)
+
+/**
+ Defines a benchmark. Benchmarks only run if requested on the command line.
+
+ @param[in]		name
+				The name of the benchmark.
+ */
+#define MAGE_BENCHMARK(name) MAGE_TEST_CASE(name, true)
+
+/**
+ Checks the given expression.
+
+ @param[in]		expression
+				The expression.
+ */
+#define MAGE_CHECK(expression)                                                \
+	do {                                                                      \
+		if (!(expression)) {                                                  \
+			mage::test::ReportFailure(__FILE__, __LINE__, #expression);       \
+		}                                                                     \
+	} while (false)
+
+/**
+ Checks whether the given expression throws an exception.
+
+ @param[in]		expression
+				The expression.
+ */
+#define MAGE_CHECK_THROWS(expression)                                         \
+	do {                                                                      \
+		bool thrown = false;                                                  \
+		try {                                                                 \
+			expression;                                                       \
+		}                                                                     \
+		catch (...) {                                                         \
+			thrown = true;                                                    \
+		}                                                                     \
+		MAGE_CHECK(thrown && #expression);                                    \
+	} while (false)
+
+#pragma endregion
\ No newline at end of file
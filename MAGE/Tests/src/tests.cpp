@@ -0,0 +1,83 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <cstdio>
+#include <cstring>
+#include <exception>
+
+#pragma endregion
+
+/**
+ The entry point of the tests and benchmarks.
+
+ Usage: Tests [--benchmark] [filter]
+
+ Without @c --benchmark, all tests are run. With @c --benchmark, all
+ benchmarks are run instead. If a filter is given, only the test cases whose
+ name contains the filter are run.
+
+ @param[in]		argc
+				The number of command line arguments.
+ @param[in]		argv
+				The command line arguments.
+ @return		@c 0 if all checks succeeded. @c 1 otherwise.
+ */
+int main(int argc, char* argv[]) {
+	using namespace mage::test;
+
+	bool benchmark = false;
+	const char* filter = "";
+	for (int i = 1; i < argc; ++i) {
+		if (0 == std::strcmp(argv[i], "--benchmark")) {
+			benchmark = true;
+		}
+		else {
+			filter = argv[i];
+		}
+	}
+
+	std::size_t nb_test_cases = 0u;
+	std::size_t nb_failed_test_cases = 0u;
+	for (const auto& test_case : GetTestCases()) {
+		if (benchmark != test_case.m_benchmark
+			|| nullptr == std::strstr(test_case.m_name, filter)) {
+			continue;
+		}
+
+		std::printf("[ RUN  ] %s\n", test_case.m_name);
+		const auto nb_failures = GetNumberOfFailures();
+
+		// The test cases may throw: an uncaught exception fails the test case
+		// without aborting the remaining test cases.
+		try {
+			test_case.m_function();
+		}
+		catch (const std::exception& e) {
+			ReportFailure(test_case.m_name, 0, e.what());
+		}
+
+		const bool failed = (nb_failures != GetNumberOfFailures());
+		std::printf("[ %s ] %s\n", failed ? "FAIL" : " OK ", test_case.m_name);
+
+		++nb_test_cases;
+		if (failed) {
+			++nb_failed_test_cases;
+		}
+	}
+
+	std::printf("%zu/%zu test cases passed.\n",
+				nb_test_cases - nb_failed_test_cases, nb_test_cases);
+
+	return (0u == nb_failed_test_cases) ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,282 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "test.hpp"
+#include "collection\vector.hpp"
+#include "transform\transform_utils.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Test Definitions
+//-----------------------------------------------------------------------------
+namespace mage::test {
+
+	namespace {
+
+		/**
+		 A 4x4 matrix of doubles.
+		 */
+		using F64x4x4 = F64[4][4];
+
+		/**
+		 Inverts the given matrix in double precision (Gauss-Jordan
+		 elimination with partial pivoting).
+		 */
+		void Invert(CXMMATRIX matrix, F64x4x4& inverse) noexcept {
+			F64 a[4][8] = {};
+			for (U32 i = 0u; i < 4u; ++i) {
+				const auto row = XMStore< F32x4 >(matrix.r[i]);
+				for (U32 j = 0u; j < 4u; ++j) {
+					a[i][j] = row[j];
+				}
+				a[i][4u + i] = 1.0;
+			}
+
+			for (U32 c = 0u; c < 4u; ++c) {
+				auto pivot = c;
+				for (auto r = c + 1u; r < 4u; ++r) {
+					if (std::abs(a[pivot][c]) < std::abs(a[r][c])) {
+						pivot = r;
+					}
+				}
+				std::swap(a[c], a[pivot]);
+
+				const auto inv_pivot = 1.0 / a[c][c];
+				for (U32 j = 0u; j < 8u; ++j) {
+					a[c][j] *= inv_pivot;
+				}
+				for (U32 r = 0u; r < 4u; ++r) {
+					if (r == c) {
+						continue;
+					}
+					const auto f = a[r][c];
+					for (U32 j = 0u; j < 8u; ++j) {
+						a[r][j] -= f * a[c][j];
+					}
+				}
+			}
+
+			for (U32 i = 0u; i < 4u; ++i) {
+				for (U32 j = 0u; j < 4u; ++j) {
+					inverse[i][j] = a[i][4u + j];
+				}
+			}
+		}
+
+		/**
+		 Returns the maximum absolute difference between the given matrix
+		 and the given reference matrix, relative to the maximum absolute
+		 element of the reference matrix.
+		 */
+		[[nodiscard]]
+		F64 GetRelativeError(CXMMATRIX matrix,
+							 const F64x4x4& reference) noexcept {
+			F64 max_error   = 0.0;
+			F64 max_element = 0.0;
+			for (U32 i = 0u; i < 4u; ++i) {
+				const auto row = XMStore< F32x4 >(matrix.r[i]);
+				for (U32 j = 0u; j < 4u; ++j) {
+					const F64 element = row[j];
+					max_error   = std::max(max_error,
+										   std::abs(element - reference[i][j]));
+					max_element = std::max(max_element,
+										   std::abs(reference[i][j]));
+				}
+			}
+			return max_error / max_element;
+		}
+
+		/**
+		 A struct of affine transformations (i.e. a non-uniform scale
+		 followed by a rotation and a translation).
+		 */
+		struct AffineTransformation {
+
+		public:
+
+			XMVECTOR m_scale;
+			XMVECTOR m_rotation;
+			XMVECTOR m_translation;
+		};
+
+		/**
+		 Returns the given number of random affine transformations with
+		 scale factors in [min_scale, max_scale].
+		 */
+		[[nodiscard]]
+		const AlignedVector< AffineTransformation >
+			CreateTransformations(std::size_t nb_transformations,
+								  F32 min_scale,
+								  F32 max_scale,
+								  bool uniform) {
+
+			std::mt19937 generator(17u);
+			std::uniform_real_distribution< F32 > log_scale(std::log(min_scale),
+															std::log(max_scale));
+			std::uniform_real_distribution< F32 > angle(-XM_PI, XM_PI);
+			std::uniform_real_distribution< F32 > position(-1000.0f, 1000.0f);
+
+			AlignedVector< AffineTransformation > transformations;
+			transformations.reserve(nb_transformations);
+			for (std::size_t i = 0u; i < nb_transformations; ++i) {
+				const auto sx = std::exp(log_scale(generator));
+				const auto sy = uniform ? sx : std::exp(log_scale(generator));
+				const auto sz = uniform ? sx : std::exp(log_scale(generator));
+				transformations.push_back({
+					XMVectorSet(sx, sy, sz, 0.0f),
+					XMVectorSet(angle(generator), angle(generator),
+								angle(generator), 0.0f),
+					XMVectorSet(position(generator), position(generator),
+								position(generator), 0.0f)
+				});
+			}
+			return transformations;
+		}
+
+		/**
+		 Returns the maximum relative error of the inverses computed by the
+		 given function for the given affine transformations.
+		 */
+		template< typename InverseT >
+		[[nodiscard]]
+		F64 GetMaximumRelativeError(
+			const AlignedVector< AffineTransformation >& transformations,
+			InverseT&& inverse) {
+
+			F64 max_error = 0.0;
+			for (const auto& t : transformations) {
+				const auto matrix = GetAffineTransformationMatrix(
+					t.m_scale, t.m_rotation, t.m_translation);
+
+				F64x4x4 reference;
+				Invert(matrix, reference);
+
+				max_error = std::max(max_error,
+									 GetRelativeError(inverse(matrix), reference));
+			}
+			return max_error;
+		}
+	}
+
+	MAGE_TEST(InverseAffineTransformationMatrixPrecision) {
+		// Non-uniform scale factors up to a ratio of 10^4: the rounding errors
+		// of the rotation are amplified by the ratio of the scale factors
+		// unless the inverse is computed without assuming orthogonal rows.
+		{
+			const auto transformations
+				= CreateTransformations(10000u, 0.01f, 100.0f, false);
+
+			MAGE_CHECK(GetMaximumRelativeError(transformations,
+				[](FXMMATRIX matrix) noexcept {
+					return XMMatrixInverse(nullptr, matrix);
+				}) < 1e-4);
+			MAGE_CHECK(GetMaximumRelativeError(transformations,
+				[](FXMMATRIX matrix) noexcept {
+					return GetInverseAffineTransformationMatrix(matrix);
+				}) < 1e-4);
+		}
+
+		// Uniform scale factors.
+		{
+			const auto transformations
+				= CreateTransformations(10000u, 0.01f, 100.0f, true);
+
+			MAGE_CHECK(GetMaximumRelativeError(transformations,
+				[](FXMMATRIX matrix) noexcept {
+					return XMMatrixInverse(nullptr, matrix);
+				}) < 1e-5);
+			MAGE_CHECK(GetMaximumRelativeError(transformations,
+				[](FXMMATRIX matrix) noexcept {
+					return GetInverseAffineTransformationMatrix(matrix);
+				}) < 1e-5);
+			MAGE_CHECK(GetMaximumRelativeError(transformations,
+				[](FXMMATRIX matrix) noexcept {
+					return GetUniformInverseAffineTransformationMatrix(matrix);
+				}) < 1e-5);
+		}
+	}
+
+	MAGE_TEST(InverseAffineTransformationMatrixMatchesDecomposedInverse) {
+		const auto transformations
+			= CreateTransformations(1000u, 0.1f, 10.0f, false);
+
+		for (const auto& t : transformations) {
+			const auto matrix = GetAffineTransformationMatrix(
+				t.m_scale, t.m_rotation, t.m_translation);
+			const auto expected = GetInverseAffineTransformationMatrix(
+				t.m_scale, t.m_rotation, t.m_translation);
+			const auto actual = GetInverseAffineTransformationMatrix(matrix);
+
+			const auto product = matrix * actual;
+			for (U32 i = 0u; i < 4u; ++i) {
+				MAGE_CHECK(XMVector4NearEqual(expected.r[i], actual.r[i],
+											  XMVectorReplicate(1e-2f)));
+				MAGE_CHECK(XMVector4NearEqual(XMMatrixIdentity().r[i], product.r[i],
+											  XMVectorReplicate(1e-3f)));
+			}
+		}
+	}
+
+	MAGE_BENCHMARK(InverseAffineTransformationMatrix) {
+		static constexpr std::size_t s_nb_matrices = 1u << 20u;
+
+		const auto transformations
+			= CreateTransformations(s_nb_matrices, 0.01f, 100.0f, false);
+		AlignedVector< XMMATRIX > matrices;
+		matrices.reserve(s_nb_matrices);
+		for (const auto& t : transformations) {
+			matrices.push_back(GetAffineTransformationMatrix(
+				t.m_scale, t.m_rotation, t.m_translation));
+		}
+		AlignedVector< XMMATRIX > inverses(s_nb_matrices);
+
+		const auto measure = [&matrices, &inverses](auto&& inverse) {
+			const auto milliseconds = Measure(10u, [&matrices, &inverses, &inverse]() {
+				for (std::size_t i = 0u; i < s_nb_matrices; ++i) {
+					inverses[i] = inverse(matrices[i]);
+				}
+				DoNotOptimize(inverses.back());
+			});
+			return 1.0e6 * milliseconds / static_cast< F64 >(s_nb_matrices);
+		};
+
+		ReportValue("XMMatrixInverse (1M matrices)",
+			measure([](FXMMATRIX matrix) noexcept {
+				return XMMatrixInverse(nullptr, matrix);
+			}), "ns/matrix");
+		ReportValue("GetInverseAffineTransformationMatrix (1M matrices)",
+			measure([](FXMMATRIX matrix) noexcept {
+				return GetInverseAffineTransformationMatrix(matrix);
+			}), "ns/matrix");
+		ReportValue("GetUniformInverseAffineTransformationMatrix (1M matrices)",
+			measure([](FXMMATRIX matrix) noexcept {
+				return GetUniformInverseAffineTransformationMatrix(matrix);
+			}), "ns/matrix");
+
+		// The maximum relative error (w.r.t. a double precision inverse).
+		const auto precision = CreateTransformations(10000u, 0.01f, 100.0f, false);
+		ReportValue("XMMatrixInverse maximum relative error",
+			1.0e6 * GetMaximumRelativeError(precision, [](FXMMATRIX matrix) noexcept {
+				return XMMatrixInverse(nullptr, matrix);
+			}), "ppm");
+		ReportValue("GetInverseAffineTransformationMatrix maximum relative error",
+			1.0e6 * GetMaximumRelativeError(precision, [](FXMMATRIX matrix) noexcept {
+				return GetInverseAffineTransformationMatrix(matrix);
+			}), "ppm");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,413 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <deque>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of vectors whose elements are referenced by proxy pointers.
+
+	 Each element owns a proxy slot. The proxy slots are kept up to date when
+	 the elements are relocated, and their generation is incremented when
+	 an element is erased or cleared. Therefore, proxy pointers to the
+	 elements survive reallocations and detect reuse.
+
+	 Erased elements are not destructed immediately, but their positions are
+	 pushed onto a free list and reused in O(1) by subsequent emplacements.
+	 Once more than a quarter of the positions are free, the remaining
+	 elements are compacted to keep iteration dense.
+
+	 Proxy pointers must not outlive the proxy vector whose elements they
+	 point to.
+
+	 @tparam		T
+					The element type. If the element type is a @c UniquePtr,
+					proxy pointers reference the pointee instead.
+	 */
+	template< typename T >
+	class ProxyVector {
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		template< typename U >
+		[[nodiscard]]
+		static U* GetAddress(U& element) noexcept {
+			return &element;
+		}
+
+		template< typename U >
+		[[nodiscard]]
+		static U* GetAddress(UniquePtr< U >& element) noexcept {
+			return element.get();
+		}
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		using vector_type = AlignedVector< T >;
+
+		using value_type = typename vector_type::value_type;
+		using size_type = typename vector_type::size_type;
+		using difference_type = typename vector_type::difference_type;
+		using reference = typename vector_type::reference;
+		using const_reference = typename vector_type::const_reference;
+
+		using iterator = typename vector_type::iterator;
+		using const_iterator = typename vector_type::const_iterator;
+
+		using resource_type = std::remove_pointer_t<
+			decltype(GetAddress(std::declval< T& >())) >;
+		using proxy_type = ProxyPtr< resource_type >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		ProxyVector()
+			: m_elements(),
+			m_element_slots(),
+			m_free_elements(),
+			m_free_slots(),
+			m_slots(MakeUnique< std::deque< details::ProxySlot > >()) {}
+
+		ProxyVector(const ProxyVector& v) = delete;
+
+		ProxyVector(ProxyVector&& v) noexcept = default;
+
+		~ProxyVector() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		ProxyVector& operator=(const ProxyVector& v) = delete;
+
+		/**
+		 Moves the given proxy vector to this proxy vector.
+
+		 Proxy pointers to the elements of the given proxy vector remain
+		 valid. Proxy pointers to the elements of this proxy vector become
+		 @c nullptr: the slots of this proxy vector are handed over to the
+		 given proxy vector (instead of being destructed) so that these proxy
+		 pointers remain resolvable for the lifetime of the given proxy
+		 vector.
+
+		 @param[in]		v
+						A reference to the proxy vector to move.
+		 @return		A reference to the moved proxy vector (i.e. this proxy
+						vector).
+		 */
+		ProxyVector& operator=(ProxyVector&& v) noexcept {
+			clear();
+
+			using std::swap;
+			swap(m_elements,      v.m_elements);
+			swap(m_element_slots, v.m_element_slots);
+			swap(m_free_elements, v.m_free_elements);
+			swap(m_free_slots,    v.m_free_slots);
+			swap(m_slots,         v.m_slots);
+
+			return *this;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Element Access
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		reference operator[](size_type index) noexcept {
+			return m_elements[index];
+		}
+
+		[[nodiscard]]
+		const_reference operator[](size_type index) const noexcept {
+			return m_elements[index];
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Iterators
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		iterator begin() noexcept {
+			return m_elements.begin();
+		}
+
+		[[nodiscard]]
+		const_iterator begin() const noexcept {
+			return m_elements.begin();
+		}
+
+		[[nodiscard]]
+		const_iterator cbegin() const noexcept {
+			return m_elements.cbegin();
+		}
+
+		[[nodiscard]]
+		iterator end() noexcept {
+			return m_elements.end();
+		}
+
+		[[nodiscard]]
+		const_iterator end() const noexcept {
+			return m_elements.end();
+		}
+
+		[[nodiscard]]
+		const_iterator cend() const noexcept {
+			return m_elements.cend();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Capacity
+		//---------------------------------------------------------------------
+
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_elements.empty();
+		}
+
+		[[nodiscard]]
+		size_type size() const noexcept {
+			return m_elements.size();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Modifiers
+		//---------------------------------------------------------------------
+
+		/**
+		 Removes all elements of this proxy vector. All proxy pointers to the
+		 elements of this proxy vector become @c nullptr.
+		 */
+		void clear() noexcept {
+			m_elements.clear();
+			m_element_slots.clear();
+			m_free_elements.clear();
+			m_free_slots.clear();
+
+			if (nullptr == m_slots) {
+				// This proxy vector has been moved.
+				return;
+			}
+
+			// The capacity of the unused slot indices always covers all slots.
+			for (size_type i = 0u; i < m_slots->size(); ++i) {
+				auto& slot = (*m_slots)[i];
+				slot.m_ptr = nullptr;
+				++slot.m_generation;
+				m_free_slots.push_back(i);
+			}
+		}
+
+		/**
+		 Inserts an element constructed from the given arguments into this
+		 proxy vector. The element reuses the most recently freed position, if
+		 any, and is appended otherwise.
+
+		 @tparam		ConstructorArgsT
+						The constructor argument types of the element.
+		 @param[in]		args
+						A reference to the constructor arguments of the
+						element.
+		 @return		A proxy pointer to the inserted element.
+		 */
+		template< typename... ConstructorArgsT >
+		proxy_type emplace(ConstructorArgsT&&... args) {
+			if (m_free_elements.empty()) {
+				return emplace_back(std::forward< ConstructorArgsT >(args)...);
+			}
+
+			const auto index = m_free_elements.back();
+			auto& element    = m_elements[index];
+			element          = T(std::forward< ConstructorArgsT >(args)...);
+			m_free_elements.pop_back();
+
+			auto& slot = (*m_slots)[m_element_slots[index]];
+			slot.m_ptr = GetAddress(element);
+
+			return proxy_type(slot);
+		}
+
+		/**
+		 Appends an element constructed from the given arguments to the end
+		 of this proxy vector.
+
+		 @tparam		ConstructorArgsT
+						The constructor argument types of the element.
+		 @param[in]		args
+						A reference to the constructor arguments of the
+						element.
+		 @return		A proxy pointer to the appended element.
+		 */
+		template< typename... ConstructorArgsT >
+		proxy_type emplace_back(ConstructorArgsT&&... args) {
+			if (nullptr == m_slots) {
+				// This proxy vector has been moved.
+				m_slots = MakeUnique< std::deque< details::ProxySlot > >();
+			}
+			if (m_free_slots.empty()) {
+				// Keep the capacity of the unused slot indices large enough
+				// for all slots (see clear).
+				Grow(m_free_slots, m_slots->size() + 1u);
+				m_free_slots.push_back(m_slots->size());
+				m_slots->push_back({ nullptr, 0u });
+			}
+			Grow(m_element_slots, m_elements.size() + 1u);
+
+			const auto data = m_elements.data();
+			m_elements.emplace_back(std::forward< ConstructorArgsT >(args)...);
+
+			const auto slot_index = m_free_slots.back();
+			m_free_slots.pop_back();
+			m_element_slots.push_back(slot_index);
+
+			auto& slot = (*m_slots)[slot_index];
+			slot.m_ptr = GetAddress(m_elements.back());
+			if (data != m_elements.data()) {
+				// The elements are relocated.
+				UpdateSlots();
+			}
+
+			return proxy_type(slot);
+		}
+
+		/**
+		 Erases all elements satisfying the given predicate. All proxy
+		 pointers to the erased elements become @c nullptr. The erased
+		 elements are reused by subsequent emplacements or removed by the
+		 next compaction.
+
+		 @tparam		PredicateT
+						The predicate type.
+		 @param[in]		predicate
+						The predicate.
+		 */
+		template< typename PredicateT >
+		void erase_if(PredicateT&& predicate) {
+			for (size_type i = 0u; i < m_elements.size(); ++i) {
+				auto& slot = (*m_slots)[m_element_slots[i]];
+				if (nullptr == slot.m_ptr || !predicate(m_elements[i])) {
+					continue;
+				}
+
+				m_free_elements.push_back(i);
+				slot.m_ptr = nullptr;
+				++slot.m_generation;
+			}
+
+			if (4u * m_free_elements.size() > m_elements.size()) {
+				Compact();
+			}
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Reserves capacity for at least the given number of indices in the
+		 given vector, growing its capacity geometrically.
+		 */
+		static void Grow(std::vector< size_type >& indices, size_type size) {
+			if (indices.capacity() < size) {
+				indices.reserve(std::max(size, 2u * indices.capacity()));
+			}
+		}
+
+		void UpdateSlots() noexcept {
+			for (size_type i = 0u; i < m_elements.size(); ++i) {
+				auto& slot = (*m_slots)[m_element_slots[i]];
+				if (nullptr != slot.m_ptr) {
+					slot.m_ptr = GetAddress(m_elements[i]);
+				}
+			}
+		}
+
+		void Compact() {
+			m_free_slots.reserve(m_free_slots.size() + m_free_elements.size());
+			m_free_elements.clear();
+
+			// Move the remaining elements to the front.
+			size_type last = 0u;
+			for (size_type i = 0u; i < m_elements.size(); ++i) {
+				const auto slot_index = m_element_slots[i];
+				if (nullptr == (*m_slots)[slot_index].m_ptr) {
+					m_free_slots.push_back(slot_index);
+					continue;
+				}
+
+				if (last != i) {
+					m_elements[last]      = std::move(m_elements[i]);
+					m_element_slots[last] = slot_index;
+				}
+
+				++last;
+			}
+
+			m_elements.erase(m_elements.begin() + last, m_elements.end());
+			m_element_slots.resize(last);
+
+			UpdateSlots();
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		vector_type m_elements;
+
+		/**
+		 The slot indices of the elements of this proxy vector.
+		 */
+		std::vector< size_type > m_element_slots;
+
+		/**
+		 The free list (i.e. a stack of erased element indices) of this
+		 proxy vector.
+		 */
+		std::vector< size_type > m_free_elements;
+
+		/**
+		 The unused slot indices of this proxy vector.
+		 */
+		std::vector< size_type > m_free_slots;
+
+		/**
+		 A pointer to the slots of this proxy vector. The slots are stored in
+		 a deque so that their addresses are preserved when slots are added,
+		 and are allocated separately so that their addresses are preserved
+		 when this proxy vector is moved.
+		 */
+		UniquePtr< std::deque< details::ProxySlot > > m_slots;
+	};
+}
\ No newline at end of file
@@ -15,7 +15,9 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include <unordered_map>
+#include <functional>
+#include <limits>
+#include <vector>
 
 #pragma endregion
 
@@ -140,7 +142,7 @@ namespace mage {
 		
 		using EntityContainer    = AlignedVector< Entity >;
 		
-		using MappingContainer   = std::unordered_map< Entity, std::size_t >;
+		using MappingContainer   = std::vector< std::vector< U32 > >;
 
 		using value_type
 			= typename ComponentContainer::value_type;
@@ -478,29 +480,19 @@ namespace mage {
 
 		[[nodiscard]]
 		bool Contains(Entity entity) const noexcept {
-			return m_mapping.find(entity) != m_mapping.cend();
+			return s_invalid_index != GetIndex(entity);
 		}
 
 		[[nodiscard]]
 		pointer Get(Entity entity) noexcept {
-			if (const auto it = m_mapping.find(entity);
-				it != m_mapping.cend()) {
-
-				return &m_components[it->second];
-			}
-
-			return nullptr;
+			const auto index = GetIndex(entity);
+			return (s_invalid_index != index) ? &m_components[index] : nullptr;
 		}
 
 		[[nodiscard]]
 		const_pointer Get(Entity entity) const noexcept {
-			if (const auto it = m_mapping.find(entity);
-				it != m_mapping.cend()) {
-
-				return &m_components[it->second];
-			}
-
-			return nullptr;
+			const auto index = GetIndex(entity);
+			return (s_invalid_index != index) ? &m_components[index] : nullptr;
 		}
 
 		[[nodiscard]]
@@ -553,6 +545,11 @@ namespace mage {
 			return m_components.data();
 		}
 
+		[[nodiscard]]
+		const EntityContainer& GetEntities() const noexcept {
+			return m_entities;
+		}
+
 		//---------------------------------------------------------------------
 		// Member Methods: Iterators
 		//---------------------------------------------------------------------
@@ -649,7 +646,6 @@ namespace mage {
 		void reserve(size_type new_capacity) {
 			m_components.reserve(new_capacity);
 			m_entities.reserve(new_capacity);
-			m_mapping.reserve(new_capacity);
 		}
 
 		[[nodiscard]]
@@ -682,29 +678,31 @@ namespace mage {
 
 		template< typename... ConstructorArgsT  >
 		reference emplace_back(Entity entity, ConstructorArgsT&&... args) {
-			if (const auto it = m_mapping.find(entity);
-				it != m_mapping.cend()) {
-				
-				return m_components[it->second];
+			auto& index = GetOrCreateIndex(entity);
+			if (s_invalid_index != index) {
+				return m_components[index];
 			}
 
-			m_mapping.emplace(entity, size());
+			auto& component = m_components.emplace_back(
+				std::forward< ConstructorArgsT >(args)...);
 			m_entities.push_back(entity);
-			return m_components.emplace_back(std::forward< ConstructorArgsT >(args)...);
+			index = static_cast< U32 >(size() - 1u);
+
+			return component;
 		}
 
 		void pop_back() {
-			m_mapping.erase(m_entities.back());
+			GetExistingIndex(m_entities.back()) = s_invalid_index;
 			m_components.pop_back();
 			m_entities.pop_back();
 		}
 
 		void erase(Entity entity) {
-			if (const auto it = m_mapping.find(entity);
-				it != m_mapping.cend()) {
+			if (const auto index = GetIndex(entity);
+				s_invalid_index != index) {
 
-				const auto index1 = it->second;
-				const auto index2 = size() - 1u;
+				const std::size_t index1 = index;
+				const std::size_t index2 = size() - 1u;
 				if (index1 != index2) {
 					SwapComponents(index1, index2);
 				}
@@ -726,14 +724,43 @@ namespace mage {
 		// Member Methods
 		//---------------------------------------------------------------------
         
+		[[nodiscard]]
+		U32 GetIndex(Entity entity) const noexcept {
+			const std::size_t page = entity.GetID() / s_page_size;
+			if (m_mapping.size() <= page || m_mapping[page].empty()) {
+				return s_invalid_index;
+			}
+
+			return m_mapping[page][entity.GetID() % s_page_size];
+		}
+
+		[[nodiscard]]
+		U32& GetOrCreateIndex(Entity entity) {
+			const std::size_t page = entity.GetID() / s_page_size;
+			if (m_mapping.size() <= page) {
+				m_mapping.resize(page + 1u);
+			}
+			if (m_mapping[page].empty()) {
+				m_mapping[page].resize(s_page_size, s_invalid_index);
+			}
+
+			return m_mapping[page][entity.GetID() % s_page_size];
+		}
+
+		[[nodiscard]]
+		U32& GetExistingIndex(Entity entity) noexcept {
+			return m_mapping[entity.GetID() / s_page_size]
+				            [entity.GetID() % s_page_size];
+		}
+
         void SwapComponents(std::size_t index1, std::size_t index2) noexcept {
 			auto& component1 = m_components[index1];
 			auto& entity1    = m_entities[index1];
-			auto& mapping1   = m_mapping[entity1];
+			auto& mapping1   = GetExistingIndex(entity1);
             
             auto& component2 = m_components[index2];
 			auto& entity2    = m_entities[index2];
-			auto& mapping2   = m_mapping[entity2];
+			auto& mapping2   = GetExistingIndex(entity2);
 
             using std::swap;
 			swap(component1, component2);
@@ -741,6 +768,20 @@ namespace mage {
 			swap(mapping1, mapping2);
 		}
 
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of entities per page of the sparse mapping.
+		 */
+		static constexpr std::size_t s_page_size = 4096u;
+
+		/**
+		 The component index marking entities without component.
+		 */
+		static constexpr U32 s_invalid_index = std::numeric_limits< U32 >::max();
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -749,6 +790,11 @@ namespace mage {
 		
 		AlignedVector< Entity > m_entities;
 
-		std::unordered_map< Entity, std::size_t > m_mapping;
+		/**
+		 The sparse mapping from entity ids to component indices. The mapping
+		 is paged so that only the pages of used entity id ranges are
+		 allocated.
+		 */
+		MappingContainer m_mapping;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,363 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "ecs\ecs.hpp"
+#include "parallel\job_system.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <tuple>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of entity registries.
+
+	 An entity registry owns one component manager per component type, and
+	 iterates the entities having a given combination of components. Such a
+	 view is driven by the dense entities of the smallest component manager
+	 involved, so that the other component managers are only probed through
+	 their O(1) sparse mappings.
+
+	 @tparam		ComponentsT
+					The component types.
+	 */
+	template< typename... ComponentsT >
+	class Registry {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an entity registry.
+		 */
+		Registry()
+			: m_component_managers(),
+			m_next_id(0u) {}
+
+		/**
+		 Constructs an entity registry from the given entity registry.
+
+		 @param[in]		registry
+						A reference to the entity registry to copy.
+		 */
+		Registry(const Registry& registry) = delete;
+
+		/**
+		 Constructs an entity registry by moving the given entity registry.
+
+		 @param[in]		registry
+						A reference to the entity registry to move.
+		 */
+		Registry(Registry&& registry) noexcept = default;
+
+		/**
+		 Destructs this entity registry.
+		 */
+		~Registry() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given entity registry to this entity registry.
+
+		 @param[in]		registry
+						A reference to the entity registry to copy.
+		 @return		A reference to the copy of the given entity registry
+						(i.e. this entity registry).
+		 */
+		Registry& operator=(const Registry& registry) = delete;
+
+		/**
+		 Moves the given entity registry to this entity registry.
+
+		 @param[in]		registry
+						A reference to the entity registry to move.
+		 @return		A reference to the moved entity registry (i.e. this
+						entity registry).
+		 */
+		Registry& operator=(Registry&& registry) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods: Entities
+		//---------------------------------------------------------------------
+
+		/**
+		 Creates a new entity in this entity registry.
+
+		 @return		The created entity.
+		 */
+		[[nodiscard]]
+		Entity CreateEntity() noexcept {
+			return Entity(m_next_id++);
+		}
+
+		/**
+		 Destroys the given entity (i.e. removes all its components) in this
+		 entity registry.
+
+		 @param[in]		entity
+						The entity.
+		 */
+		void DestroyEntity(Entity entity) {
+			(GetComponents< ComponentsT >().erase(entity), ...);
+		}
+
+		/**
+		 Removes all entities and components of this entity registry.
+		 */
+		void Clear() noexcept {
+			(GetComponents< ComponentsT >().clear(), ...);
+			m_next_id = 0u;
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Components
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the component manager of the given component type of this
+		 entity registry.
+
+		 @tparam		T
+						The component type.
+		 @return		A reference to the component manager of the given
+						component type of this entity registry.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		ComponentManager< T >& GetComponents() noexcept {
+			return std::get< ComponentManager< T > >(m_component_managers);
+		}
+
+		/**
+		 Returns the component manager of the given component type of this
+		 entity registry.
+
+		 @tparam		T
+						The component type.
+		 @return		A reference to the component manager of the given
+						component type of this entity registry.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		const ComponentManager< T >& GetComponents() const noexcept {
+			return std::get< ComponentManager< T > >(m_component_managers);
+		}
+
+		/**
+		 Adds a component constructed from the given arguments to the given
+		 entity. If the given entity already has a component of the given
+		 type, that component is returned instead.
+
+		 @tparam		T
+						The component type.
+		 @tparam		ConstructorArgsT
+						The constructor argument types of the component.
+		 @param[in]		entity
+						The entity.
+		 @param[in]		args
+						A reference to the constructor arguments of the
+						component.
+		 @return		A reference to the component of the given entity.
+		 */
+		template< typename T, typename... ConstructorArgsT >
+		T& AddComponent(Entity entity, ConstructorArgsT&&... args) {
+			return GetComponents< T >().emplace_back(
+				entity, std::forward< ConstructorArgsT >(args)...);
+		}
+
+		/**
+		 Removes the component of the given type from the given entity.
+
+		 @tparam		T
+						The component type.
+		 @param[in]		entity
+						The entity.
+		 */
+		template< typename T >
+		void RemoveComponent(Entity entity) {
+			GetComponents< T >().erase(entity);
+		}
+
+		/**
+		 Returns the component of the given type of the given entity.
+
+		 @tparam		T
+						The component type.
+		 @param[in]		entity
+						The entity.
+		 @return		@c nullptr if the given entity has no component of the
+						given type.
+		 @return		A pointer to the component of the given type of the
+						given entity.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		T* GetComponent(Entity entity) noexcept {
+			return GetComponents< T >().Get(entity);
+		}
+
+		/**
+		 Returns the component of the given type of the given entity.
+
+		 @tparam		T
+						The component type.
+		 @param[in]		entity
+						The entity.
+		 @return		@c nullptr if the given entity has no component of the
+						given type.
+		 @return		A pointer to the component of the given type of the
+						given entity.
+		 */
+		template< typename T >
+		[[nodiscard]]
+		const T* GetComponent(Entity entity) const noexcept {
+			return GetComponents< T >().Get(entity);
+		}
+
+		/**
+		 Checks whether the given entity has components of all the given
+		 types.
+
+		 @tparam		T
+						The component types.
+		 @param[in]		entity
+						The entity.
+		 @return		@c true if the given entity has components of all the
+						given types. @c false otherwise.
+		 */
+		template< typename... T >
+		[[nodiscard]]
+		bool HasComponents(Entity entity) const noexcept {
+			return (GetComponents< T >().Contains(entity) && ...);
+		}
+
+		//---------------------------------------------------------------------
+		// Member Methods: Views
+		//---------------------------------------------------------------------
+
+		/**
+		 Applies the given action to all entities having components of all
+		 the given types.
+
+		 @pre			The given action does not add or remove components.
+		 @tparam		T
+						The component types.
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(Entity, T&...)@endcode.
+		 @param[in]		action
+						The action.
+		 */
+		template< typename... T, typename ActionT >
+		void ForEach(ActionT&& action) {
+			static_assert(0u < sizeof...(T));
+
+			const auto& entities = GetSmallestEntities< T... >();
+			ForEachInRange< T... >(action, entities, 0u, entities.size());
+		}
+
+		/**
+		 Applies the given action to all entities having components of all
+		 the given types, distributing the entities of the smallest
+		 component manager involved over the threads of the given job
+		 system.
+
+		 @pre			The given action does not add or remove components.
+		 @pre			The given action can be applied concurrently to
+						different entities.
+		 @tparam		T
+						The component types.
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(Entity, T&...)@endcode.
+		 @param[in]		job_system
+						A reference to the job system.
+		 @param[in]		action
+						The action.
+		 @param[in]		grain_size
+						The number of entities per job. If zero, the grain
+						size is chosen by the job system.
+		 @throws		...
+						The first exception thrown by the given action.
+		 */
+		template< typename... T, typename ActionT >
+		void ParallelForEach(JobSystem& job_system,
+							 ActionT&& action,
+							 std::size_t grain_size = 0u) {
+
+			static_assert(0u < sizeof...(T));
+
+			const auto& entities = GetSmallestEntities< T... >();
+			job_system.ParallelFor(0u, entities.size(),
+				[this, &action, &entities](std::size_t begin, std::size_t end) {
+					ForEachInRange< T... >(action, entities, begin, end);
+				}, grain_size);
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		template< typename FirstT, typename... OtherT >
+		[[nodiscard]]
+		const AlignedVector< Entity >& GetSmallestEntities() const noexcept {
+			const auto* entities = &GetComponents< FirstT >().GetEntities();
+			((entities = (GetComponents< OtherT >().size() < entities->size())
+						 ? &GetComponents< OtherT >().GetEntities() : entities),
+			 ...);
+			return *entities;
+		}
+
+		template< typename... T, typename ActionT >
+		void ForEachInRange(ActionT& action,
+							const AlignedVector< Entity >& entities,
+							std::size_t begin,
+							std::size_t end) {
+
+			for (auto i = begin; i < end; ++i) {
+				const auto entity = entities[i];
+				const std::tuple< T*... > components(GetComponent< T >(entity)...);
+				if (((nullptr != std::get< T* >(components)) && ...)) {
+					action(entity, *std::get< T* >(components)...);
+				}
+			}
+		}
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The component managers of this entity registry.
+		 */
+		std::tuple< ComponentManager< ComponentsT >... > m_component_managers;
+
+		/**
+		 The id of the next entity of this entity registry.
+		 */
+		U32 m_next_id;
+	};
+}
\ No newline at end of file
@@ -147,7 +147,13 @@ namespace mage {
 	}
 
 	void BigEndianBinaryReader::ReadFromMemory(gsl::span< const U8 > input) {
-		m_path = L"input string";
+		ReadFromMemory(input, L"input string");
+	}
+
+	void BigEndianBinaryReader::ReadFromMemory(gsl::span< const U8 > input,
+											   std::filesystem::path path) {
+
+		m_path = std::move(path);
 
 		m_pos  = input.data();
 		m_end  = input.data() + input.size();
@@ -289,6 +289,20 @@ namespace mage {
 		 */
 		void ReadFromMemory(gsl::span< const U8 > input);
 
+		/**
+		 Reads the input string which contains the bytes of the file
+		 associated with the given path.
+
+		 @param[in]		input
+						The input byte string.
+		 @param[in]		path
+						The path of the file containing the input string.
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void ReadFromMemory(gsl::span< const U8 > input,
+							std::filesystem::path path);
+
 	protected:
 
 		//---------------------------------------------------------------------
@@ -350,6 +364,18 @@ namespace mage {
 			return m_pos < m_end;
 		}
 
+		/**
+		 Returns the number of bytes left to read by this big endian binary
+		 reader.
+
+		 @return		The number of bytes left to read by this big endian
+						binary reader.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfRemainingBytes() const noexcept {
+			return static_cast< std::size_t >(m_end - m_pos);
+		}
+
 		/**
 		 Reads a @c T value.
 
@@ -4,6 +4,7 @@
 #pragma region
 
 #include "io\line_reader.hpp"
+#include "io\binary_reader.hpp"
 #include "logging\logging.hpp"
 
 #pragma endregion
@@ -31,19 +32,55 @@ namespace mage {
 		return match[2].length() ? match[2] : match[3];
 	};
 
+	namespace {
+
+		/**
+		 Checks whether the given character is a whitespace character (i.e.
+		 matches @c \s).
+
+		 @param[in]		c
+						The character.
+		 @return		@c true if the given character is a whitespace
+						character. @c false otherwise.
+		 */
+		[[nodiscard]]
+		constexpr bool IsWhitespace(char c) noexcept {
+			switch (c) {
+
+			case ' ':
+			case '\t':
+			case '\n':
+			case '\v':
+			case '\f':
+			case '\r':
+				return true;
+			default:
+				return false;
+			}
+		}
+	}
+
 	LineReader::LineReader()
 		: m_regex(),
 		m_selection_function(),
 		m_path(),
 		m_iterator(),
-		m_line_number(0) {}
+		m_line(),
+		m_token(),
+		m_line_number(0),
+		m_contains_token(false),
+		m_use_regex(false) {}
 
 	LineReader::LineReader(LineReader&& reader) noexcept
 		: m_regex(std::move(reader.m_regex)),
 		m_selection_function(std::move(reader.m_selection_function)),
 		m_path(std::move(reader.m_path)),
 		m_iterator(reader.m_iterator),
-		m_line_number(reader.m_line_number) {}
+		m_line(reader.m_line),
+		m_token(reader.m_token),
+		m_line_number(reader.m_line_number),
+		m_contains_token(reader.m_contains_token),
+		m_use_regex(reader.m_use_regex) {}
 
 	LineReader::~LineReader() = default;
 
@@ -52,10 +89,35 @@ namespace mage {
 		m_selection_function = std::move(reader.m_selection_function);
 		m_path               = std::move(reader.m_path);
 		m_iterator           = reader.m_iterator;
+		m_line               = reader.m_line;
+		m_token              = reader.m_token;
 		m_line_number        = reader.m_line_number;
+		m_contains_token     = reader.m_contains_token;
+		m_use_regex          = reader.m_use_regex;
 		return *this;
 	}
 
+	void LineReader::ReadFromFile(std::filesystem::path path) {
+		m_path               = std::move(path);
+		m_regex              = {};
+		m_selection_function = {};
+		m_line_number        = 0u;
+		m_use_regex          = false;
+
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		UniquePtr< U8[] > data;
+		std::size_t nb_bytes = 0u;
+		ReadBinaryFile(m_path, data, nb_bytes);
+		Process(std::string_view(reinterpret_cast< const char* >(data.get()),
+								 nb_bytes));
+
+		// Postprocessing
+		Postprocess();
+	}
+
 	void LineReader::ReadFromFile(std::filesystem::path path,
 								  std::regex regex,
 								  SelectionFunction selection_function) {
@@ -63,6 +125,7 @@ namespace mage {
 		m_path               = std::move(path);
 		m_regex              = std::move(regex);
 		m_selection_function = std::move(selection_function);
+		m_use_regex          = true;
 
 		// Preprocessing
 		Preprocess();
@@ -76,13 +139,38 @@ namespace mage {
 		Postprocess();
 	}
 
-	void LineReader::ReadFromMemory(const std::string &input,
+	void LineReader::ReadFromMemory(std::string_view input) {
+		ReadFromMemory(input, L"input string", 0u);
+	}
+
+	void LineReader::ReadFromMemory(std::string_view input,
+									std::filesystem::path path,
+									U32 line_number) {
+
+		m_path               = std::move(path);
+		m_regex              = {};
+		m_selection_function = {};
+		m_line_number        = line_number;
+		m_use_regex          = false;
+
+		// Preprocessing
+		Preprocess();
+
+		// Processing
+		Process(input);
+
+		// Postprocessing
+		Postprocess();
+	}
+
+	void LineReader::ReadFromMemory(const std::string& input,
 									std::regex regex,
 									SelectionFunction selection_function) {
 
 		m_path               = L"input string";
 		m_regex              = std::move(regex);
 		m_selection_function = std::move(selection_function);
+		m_use_regex          = true;
 
 		// Preprocessing
 		Preprocess();
@@ -97,6 +185,27 @@ namespace mage {
 
 	void LineReader::Preprocess() {}
 
+	void LineReader::Process(std::string_view input) {
+		while (!input.empty()) {
+			// Split the input at the next line feed (cfr. std::getline).
+			const auto end = input.find('\n');
+			m_line = input.substr(0u, end);
+			input.remove_prefix((std::string_view::npos == end)
+								? input.size() : end + 1u);
+
+			ScanNextToken();
+			if (ContainsTokens()) {
+				ReadLine();
+			}
+
+			++m_line_number;
+		}
+
+		m_line           = {};
+		m_token          = {};
+		m_contains_token = false;
+	}
+
 	void LineReader::Process(std::istream& stream) {
 		m_line_number = 0u;
 
@@ -125,12 +234,69 @@ namespace mage {
 
 	[[nodiscard]]
 	bool LineReader::ContainsTokens() const noexcept {
+		if (!m_use_regex) {
+			return m_contains_token;
+		}
+
 		static const std::sregex_iterator end_iterator;
 		return end_iterator != m_iterator;
 	}
 
+	void LineReader::ReadNextToken() noexcept {
+		if (m_use_regex) {
+			++m_iterator;
+		}
+		else {
+			ScanNextToken();
+		}
+	}
+
+	void LineReader::ScanNextToken() noexcept {
+		const auto size = m_line.size();
+
+		// Skip the leading whitespace.
+		std::size_t begin = 0u;
+		while (begin < size && IsWhitespace(m_line[begin])) {
+			++begin;
+		}
+
+		if (begin == size) {
+			m_line           = {};
+			m_token          = {};
+			m_contains_token = false;
+			return;
+		}
+
+		m_contains_token = true;
+
+		// Quoted token: "([^"]*)"
+		if ('"' == m_line[begin]) {
+			if (const auto end = m_line.find('"', begin + 1u);
+				std::string_view::npos != end) {
+
+				m_token = m_line.substr(begin + 1u, end - begin - 1u);
+				m_line.remove_prefix(end + 1u);
+				return;
+			}
+			// Unmatched double quote: fall through to a non-quoted token.
+		}
+
+		// Non-quoted token: \S+
+		auto end = begin + 1u;
+		while (end < size && !IsWhitespace(m_line[end])) {
+			++end;
+		}
+
+		m_token = m_line.substr(begin, end - begin);
+		m_line.remove_prefix(end);
+	}
+
 	[[nodiscard]]
 	const std::string_view LineReader::GetCurrentToken() const noexcept {
+		if (!m_use_regex) {
+			return m_token;
+		}
+
 		const auto token = m_selection_function(*m_iterator);
 		if (token.matched) {
 			return { &*token.first,
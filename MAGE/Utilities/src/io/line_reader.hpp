@@ -16,6 +16,7 @@
 
 #include <istream>
 #include <regex>
+#include <string_view>
 
 #pragma endregion
 
@@ -84,6 +85,22 @@ namespace mage {
 		// Member Methods
 		//---------------------------------------------------------------------
 
+		/**
+		 Reads from the file associated with the given path.
+
+		 The file is read into a single buffer which is tokenized in place
+		 (i.e. without allocating a string per line or per token). Tokens are
+		 separated by whitespace. A token starting with a double quote extends
+		 till the next double quote on the same line (if any) and excludes
+		 both double quotes.
+
+		 @param[in]		path
+						The path.
+		 @throws		Exception
+						Failed to read from the file.
+		 */
+		void ReadFromFile(std::filesystem::path path);
+
 		/**
 		 Reads from the file associated with the given path.
 
@@ -97,10 +114,45 @@ namespace mage {
 						Failed to read from the file.
 		 */
 		void ReadFromFile(std::filesystem::path path,
-						  std::regex regex = s_default_regex,
+						  std::regex regex,
 						  SelectionFunction selection_function
 						  = s_default_selection_function);
 
+		/**
+		 Reads from the given input string.
+
+		 The input string is tokenized in place (i.e. without allocating a
+		 string per line or per token) with the same semantics as
+		 @c s_default_regex.
+
+		 @param[in]		input
+						The input string.
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void ReadFromMemory(std::string_view input);
+
+		/**
+		 Reads from the given input string which is a part, starting at the
+		 given line number, of the file associated with the given path.
+
+		 The input string is tokenized in place (i.e. without allocating a
+		 string per line or per token) with the same semantics as
+		 @c s_default_regex.
+
+		 @param[in]		input
+						The input string.
+		 @param[in]		path
+						The path of the file containing the input string.
+		 @param[in]		line_number
+						The line number of the first line of the input string.
+		 @throws		Exception
+						Failed to read from the given input string.
+		 */
+		void ReadFromMemory(std::string_view input,
+							std::filesystem::path path,
+							U32 line_number);
+
 		/**
 		 Reads from the given input string.
 
@@ -113,8 +165,8 @@ namespace mage {
 		 @throws		Exception
 						Failed to read from the given input string.
 		 */
-		void ReadFromMemory(const std::string &input,
-							std::regex regex = s_default_regex,
+		void ReadFromMemory(const std::string& input,
+							std::regex regex,
 							SelectionFunction selection_function
 							= s_default_selection_function);
 
@@ -234,6 +286,17 @@ namespace mage {
 		[[nodiscard]]
 		bool ContainsTokens() const noexcept;
 
+		/**
+		 Processes the given input string (line by line), starting at the
+		 current line number of this line reader, without using a regex.
+
+		 @param[in]		input
+						The input string.
+		 @throws		Exception
+						Failed to process the given input string.
+		 */
+		virtual void Process(std::string_view input);
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -249,7 +312,8 @@ namespace mage {
 		virtual void Preprocess();
 
 		/**
-		 Processes the given input stream (line by line).
+		 Processes the given input stream (line by line) using the current
+		 regex of this line reader.
 
 		 @param[in]		stream
 						A reference to the input stream.
@@ -274,6 +338,17 @@ namespace mage {
 		 */
 		virtual void Postprocess();
 
+		/**
+		 Advances to the next token of the current line of this line reader.
+		 */
+		void ReadNextToken() noexcept;
+
+		/**
+		 Scans the next token of the remaining characters of the current line
+		 of this line reader without using a regex.
+		 */
+		void ScanNextToken() noexcept;
+
 		/**
 		 Returns the current token of this line reader.
 
@@ -308,10 +383,35 @@ namespace mage {
 		 */
 		std::sregex_iterator m_iterator;
 
+		/**
+		 The remaining characters (i.e. following the current token) of the
+		 current line of this line reader. Only used if this line reader does
+		 not use a regex.
+		 */
+		std::string_view m_line;
+
+		/**
+		 The current token of the current line of this line reader. Only used
+		 if this line reader does not use a regex.
+		 */
+		std::string_view m_token;
+
 		/**
 		 The current line number of this line reader.
 		 */
 		U32 m_line_number;
+
+		/**
+		 A flag indicating whether this line reader has a current token. Only
+		 used if this line reader does not use a regex.
+		 */
+		bool m_contains_token;
+
+		/**
+		 A flag indicating whether this line reader uses a regex for
+		 tokenizing lines.
+		 */
+		bool m_use_regex;
 	};
 }
 
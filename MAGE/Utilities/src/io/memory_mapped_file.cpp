@@ -0,0 +1,63 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "io\memory_mapped_file.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	MemoryMappedFile::MemoryMappedFile(std::filesystem::path path)
+		: m_path(std::move(path)),
+		m_file(),
+		m_mapping(),
+		m_view(),
+		m_size(0u) {
+
+		m_file = CreateUniqueHandle(CreateFile2(m_path.c_str(),
+												GENERIC_READ,
+												FILE_SHARE_READ,
+												OPEN_EXISTING,
+												nullptr));
+		ThrowIfFailed((nullptr != m_file),
+					  "{}: could not open file.", m_path);
+
+		LARGE_INTEGER file_size = {};
+		{
+			const BOOL result = GetFileSizeEx(m_file.get(), &file_size);
+			ThrowIfFailed(result, "{}: could not retrieve file size.", m_path);
+		}
+
+		m_size = static_cast< std::size_t >(file_size.QuadPart);
+		if (0u == m_size) {
+			// Empty files cannot be mapped.
+			return;
+		}
+
+		m_mapping = CreateUniqueHandle(CreateFileMapping(m_file.get(),
+														 nullptr,
+														 PAGE_READONLY,
+														 0u,
+														 0u,
+														 nullptr));
+		ThrowIfFailed((nullptr != m_mapping),
+					  "{}: could not create file mapping.", m_path);
+
+		m_view.reset(MapViewOfFile(m_mapping.get(), FILE_MAP_READ, 0u, 0u, 0u));
+		ThrowIfFailed((nullptr != m_view),
+					  "{}: could not map file view.", m_path);
+	}
+
+	MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& file) noexcept = default;
+
+	MemoryMappedFile::~MemoryMappedFile() = default;
+
+	MemoryMappedFile& MemoryMappedFile
+		::operator=(MemoryMappedFile&& file) noexcept = default;
+}
\ No newline at end of file
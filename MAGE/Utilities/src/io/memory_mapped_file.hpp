@@ -0,0 +1,175 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <filesystem>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace details {
+
+		/**
+		 A struct of file view destructors (i.e. for unmapping file views).
+		 */
+		struct FileViewUnmapper {
+
+			/**
+			 Destructs the given file view.
+
+			 @param[in]		view
+							A pointer to the file view to destruct.
+			 */
+			void operator()(const void* view) const noexcept {
+				if (view) {
+					UnmapViewOfFile(view);
+				}
+			}
+		};
+	}
+
+	/**
+	 A class of read-only memory-mapped files.
+
+	 The bytes of a memory-mapped file are paged in on demand by the operating
+	 system, and can be consumed in place (i.e. without copying them into a
+	 separate buffer) for as long as the memory-mapped file is alive.
+	 */
+	class MemoryMappedFile {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a memory-mapped file for the file associated with the
+		 given path.
+
+		 @param[in]		path
+						The path.
+		 @throws		Exception
+						Failed to map the file.
+		 */
+		explicit MemoryMappedFile(std::filesystem::path path);
+
+		/**
+		 Constructs a memory-mapped file from the given memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to copy.
+		 */
+		MemoryMappedFile(const MemoryMappedFile& file) = delete;
+
+		/**
+		 Constructs a memory-mapped file by moving the given memory-mapped
+		 file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to move.
+		 */
+		MemoryMappedFile(MemoryMappedFile&& file) noexcept;
+
+		/**
+		 Destructs this memory-mapped file.
+		 */
+		~MemoryMappedFile();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given memory-mapped file to this memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to copy.
+		 @return		A reference to the copy of the given memory-mapped
+						file (i.e. this memory-mapped file).
+		 */
+		MemoryMappedFile& operator=(const MemoryMappedFile& file) = delete;
+
+		/**
+		 Moves the given memory-mapped file to this memory-mapped file.
+
+		 @param[in]		file
+						A reference to the memory-mapped file to move.
+		 @return		A reference to the moved memory-mapped file (i.e. this
+						memory-mapped file).
+		 */
+		MemoryMappedFile& operator=(MemoryMappedFile&& file) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the path of this memory-mapped file.
+
+		 @return		A reference to the path of this memory-mapped file.
+		 */
+		[[nodiscard]]
+		const std::filesystem::path& GetPath() const noexcept {
+			return m_path;
+		}
+
+		/**
+		 Returns the bytes of this memory-mapped file.
+
+		 @return		The bytes of this memory-mapped file.
+		 */
+		[[nodiscard]]
+		gsl::span< const U8 > GetData() const noexcept {
+			return { static_cast< const U8* >(m_view.get()),
+				     static_cast< std::ptrdiff_t >(m_size) };
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The path of this memory-mapped file.
+		 */
+		std::filesystem::path m_path;
+
+		/**
+		 A handle to the file of this memory-mapped file.
+		 */
+		UniqueHandle m_file;
+
+		/**
+		 A handle to the file mapping object of this memory-mapped file.
+		 */
+		UniqueHandle m_mapping;
+
+		/**
+		 A pointer to the mapped view of this memory-mapped file.
+		 */
+		UniquePtr< const void, details::FileViewUnmapper > m_view;
+
+		/**
+		 The size in bytes of this memory-mapped file.
+		 */
+		std::size_t m_size;
+	};
+}
\ No newline at end of file
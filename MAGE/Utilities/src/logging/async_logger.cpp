@@ -0,0 +1,354 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "logging\async_logger.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <functional>
+#include <iterator>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The maximum number of pending log records of a single thread.
+		 */
+		constexpr std::size_t g_ring_buffer_capacity = 1024u;
+
+		/**
+		 The maximum time the background thread sleeps before draining the
+		 ring buffers again.
+		 */
+		constexpr std::chrono::milliseconds g_poll_interval(10);
+
+		/**
+		 The default maximum number of log records with the same format
+		 string written within a time window.
+		 */
+		constexpr std::size_t g_rate_limit = 10u;
+
+		/**
+		 The default time window of the rate limits.
+		 */
+		constexpr std::chrono::milliseconds g_rate_limit_window(1000);
+	}
+
+	//-------------------------------------------------------------------------
+	// AsyncLogger::ThreadRingBuffer
+	//-------------------------------------------------------------------------
+
+	class AsyncLogger::ThreadRingBuffer {
+
+	public:
+
+		ThreadRingBuffer() noexcept = default;
+		ThreadRingBuffer(const ThreadRingBuffer& buffer) = delete;
+		ThreadRingBuffer(ThreadRingBuffer&& buffer) = delete;
+
+		~ThreadRingBuffer() {
+			if (nullptr != m_buffer) {
+				// The pending log records of the terminating thread will
+				// still be drained.
+				AsyncLogger::Get().ReleaseRingBuffer(*m_buffer);
+			}
+		}
+
+		ThreadRingBuffer& operator=(const ThreadRingBuffer& buffer) = delete;
+		ThreadRingBuffer& operator=(ThreadRingBuffer&& buffer) = delete;
+
+		/**
+		 A pointer to the ring buffer leased by the thread.
+		 */
+		RingBuffer< LogRecord >* m_buffer = nullptr;
+	};
+
+	//-------------------------------------------------------------------------
+	// AsyncLogger
+	//-------------------------------------------------------------------------
+
+	AsyncLogger AsyncLogger::s_logger;
+
+	thread_local AsyncLogger::ThreadRingBuffer AsyncLogger::s_ring_buffer;
+
+	AsyncLogger::AsyncLogger()
+		: m_ring_buffers(),
+		m_released_ring_buffers(),
+		m_thread(),
+		m_file_stream(),
+		m_console(true),
+		m_rate_limits(),
+		m_rate_limit(g_rate_limit),
+		m_rate_limit_window(g_rate_limit_window),
+		m_nb_flush_requests(0u),
+		m_nb_flushes(0u),
+		m_running(false),
+		m_stop(false),
+		m_mutex(),
+		m_condition(),
+		m_flush_condition() {}
+
+	AsyncLogger::~AsyncLogger() {
+		Stop();
+	}
+
+	void AsyncLogger::Start() {
+		if (IsRunning()) {
+			return;
+		}
+
+		m_stop = false;
+		m_running.store(true, std::memory_order_release);
+		m_thread = std::thread(&AsyncLogger::Run, this);
+	}
+
+	void AsyncLogger::Start(std::filesystem::path path, bool console) {
+		if (IsRunning()) {
+			return;
+		}
+
+		std::FILE* file;
+		{
+			const errno_t result = _wfopen_s(&file, path.c_str(), L"w");
+			ThrowIfFailed((0 == result), "{}: could not open file.", path);
+		}
+
+		m_file_stream.reset(file);
+		m_console = console;
+
+		Start();
+	}
+
+	void AsyncLogger::Stop() noexcept {
+		if (!IsRunning()) {
+			return;
+		}
+
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_stop = true;
+		}
+		m_condition.notify_all();
+
+		// The background thread drains all pending log records before
+		// returning.
+		m_thread.join();
+		m_running.store(false, std::memory_order_release);
+		m_flush_condition.notify_all();
+
+		m_rate_limits.clear();
+
+		m_file_stream.reset();
+		m_console = true;
+	}
+
+	void AsyncLogger::Write(std::string text, std::size_t format) {
+		Write(LogRecord{ std::move(text), {}, format });
+	}
+
+	void AsyncLogger::Write(std::wstring text, std::size_t format) {
+		Write(LogRecord{ {}, std::move(text), format });
+	}
+
+	void AsyncLogger::Write(LogRecord&& record) {
+		if (!IsRunning()) {
+			OutputToSinks(record);
+			return;
+		}
+
+		auto& buffer = GetRingBuffer();
+		while (!buffer.Push(std::move(record))) {
+			// The ring buffer is full: wake up the background thread and wait
+			// until it made some room.
+			m_condition.notify_one();
+			std::this_thread::yield();
+		}
+	}
+
+	void AsyncLogger::Flush() {
+		if (!IsRunning()) {
+			std::fflush(stdout);
+			return;
+		}
+
+		std::unique_lock< std::mutex > lock(m_mutex);
+		const auto request = ++m_nb_flush_requests;
+		m_condition.notify_all();
+		m_flush_condition.wait(lock, [this, request]() {
+			return request <= m_nb_flushes || !IsRunning();
+		});
+	}
+
+	RingBuffer< LogRecord >& AsyncLogger::GetRingBuffer() {
+		auto& buffer = s_ring_buffer.m_buffer;
+		if (nullptr == buffer) {
+			const std::lock_guard< std::mutex > lock(m_mutex);
+
+			// The ring buffer of a terminated thread has a single producer
+			// again: the lock orders the pushes of both threads.
+			if (m_released_ring_buffers.empty()) {
+				m_ring_buffers.push_back(
+					MakeUnique< RingBuffer< LogRecord > >(g_ring_buffer_capacity));
+				buffer = m_ring_buffers.back().get();
+			}
+			else {
+				buffer = m_released_ring_buffers.back();
+				m_released_ring_buffers.pop_back();
+			}
+		}
+
+		return *buffer;
+	}
+
+	void AsyncLogger::ReleaseRingBuffer(RingBuffer< LogRecord >& buffer) {
+		const std::lock_guard< std::mutex > lock(m_mutex);
+		m_released_ring_buffers.push_back(&buffer);
+	}
+
+	void AsyncLogger::Run() {
+		std::vector< RingBuffer< LogRecord >* > buffers;
+
+		std::unique_lock< std::mutex > lock(m_mutex);
+		while (true) {
+			const auto nb_flush_requests = m_nb_flush_requests;
+			const bool stop              = m_stop;
+
+			buffers.clear();
+			for (const auto& buffer : m_ring_buffers) {
+				buffers.push_back(buffer.get());
+			}
+
+			lock.unlock();
+
+			const bool drained = Drain(buffers);
+			const bool flush   = stop || m_nb_flushes != nb_flush_requests;
+			if (!drained || flush) {
+				OutputSuppressed(flush);
+				std::fflush(stdout);
+				if (m_file_stream) {
+					std::fflush(m_file_stream.get());
+				}
+			}
+
+			lock.lock();
+
+			if (m_nb_flushes != nb_flush_requests) {
+				m_nb_flushes = nb_flush_requests;
+				m_flush_condition.notify_all();
+			}
+
+			if (stop) {
+				break;
+			}
+
+			if (!drained && !m_stop
+				&& m_nb_flushes == m_nb_flush_requests) {
+				// Wake up on a flush request, on a stop request, on a full
+				// ring buffer or after the poll interval.
+				m_condition.wait_for(lock, g_poll_interval);
+			}
+		}
+	}
+
+	bool AsyncLogger::Drain(const std::vector< RingBuffer< LogRecord >* >& buffers) {
+		bool drained = false;
+
+		for (const auto buffer : buffers) {
+			while (auto record = buffer->Pop()) {
+				Output(std::move(*record));
+				drained = true;
+			}
+		}
+
+		return drained;
+	}
+
+	void AsyncLogger::Output(LogRecord&& record) {
+		const auto format = (0u != record.m_format)
+			? record.m_format
+			: std::hash< std::string >()(record.m_text)
+			^ std::hash< std::wstring >()(record.m_wtext);
+		const auto now = std::chrono::steady_clock::now();
+
+		auto& rate_limit = m_rate_limits[format];
+		if (now - rate_limit.m_window_start >= m_rate_limit_window) {
+			// Start a new time window.
+			OutputSuppressed(rate_limit);
+			rate_limit.m_window_start = now;
+			rate_limit.m_nb_records   = 0u;
+		}
+
+		if (m_rate_limit <= rate_limit.m_nb_records) {
+			++rate_limit.m_nb_suppressed;
+			rate_limit.m_last = std::move(record);
+			return;
+		}
+
+		++rate_limit.m_nb_records;
+		OutputToSinks(record);
+	}
+
+	void AsyncLogger::OutputSuppressed(bool all) {
+		const auto now = std::chrono::steady_clock::now();
+
+		for (auto it = m_rate_limits.begin(); it != m_rate_limits.end();) {
+			auto& rate_limit = it->second;
+			const bool expired
+				= (now - rate_limit.m_window_start >= m_rate_limit_window);
+
+			if (all || expired) {
+				OutputSuppressed(rate_limit);
+			}
+
+			// Expired rate limits are removed to bound the number of rate
+			// limits by the number of format strings of a single time window.
+			it = expired ? m_rate_limits.erase(it) : std::next(it);
+		}
+	}
+
+	void AsyncLogger::OutputSuppressed(RateLimit& rate_limit) {
+		if (0u == rate_limit.m_nb_suppressed) {
+			return;
+		}
+
+		const LogRecord record{
+			Format("Suppressed {} similar messages, the last of which was:\n",
+				   rate_limit.m_nb_suppressed), {}, 0u };
+		OutputToSinks(record);
+		OutputToSinks(rate_limit.m_last);
+		rate_limit.m_nb_suppressed = 0u;
+	}
+
+	void AsyncLogger::OutputToSinks(const LogRecord& record) const noexcept {
+		if (!record.m_text.empty()) {
+			if (m_console) {
+				std::fputs(record.m_text.c_str(), stdout);
+			}
+			if (m_file_stream) {
+				std::fputs(record.m_text.c_str(), m_file_stream.get());
+			}
+		}
+		if (!record.m_wtext.empty()) {
+			if (m_console) {
+				std::fputws(record.m_wtext.c_str(), stdout);
+			}
+			if (m_file_stream) {
+				std::fputws(record.m_wtext.c_str(), m_file_stream.get());
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,468 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory\memory.hpp"
+#include "parallel\ring_buffer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A struct of log records.
+	 */
+	struct LogRecord {
+
+	public:
+
+		/**
+		 The (formatted) narrow text of this log record.
+		 */
+		std::string m_text;
+
+		/**
+		 The (formatted) wide text of this log record.
+		 */
+		std::wstring m_wtext;
+
+		/**
+		 The hash of the format string of this log record (or zero if this
+		 log record has no format string).
+		 */
+		std::size_t m_format;
+	};
+
+	/**
+	 A class of asynchronous loggers.
+
+	 Each thread pushes its (formatted) log records into its own lock-free
+	 ring buffer. A background thread drains the ring buffers of all threads
+	 and writes the log records to the console and (optionally) to a file.
+	 The order of the log records of a single thread is preserved, the order
+	 of the log records of different threads is not.
+
+	 Log records are rate-limited per format string: within a time window,
+	 only a limited number of log records with the same format string are
+	 written (e.g. a warning about an unused token emitted for each line of
+	 a file). The suppressed log records are summarized by their number and
+	 the last suppressed log record once the time window expired. Log records
+	 without a format string are rate-limited per text.
+
+	 If the asynchronous logger is not running, the log records are written
+	 synchronously to the console.
+	 */
+	class AsyncLogger {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the global asynchronous logger.
+
+		 @return		A reference to the global asynchronous logger.
+		 */
+		[[nodiscard]]
+		static AsyncLogger& Get() noexcept {
+			return s_logger;
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an asynchronous logger from the given asynchronous logger.
+
+		 @param[in]		logger
+						A reference to the asynchronous logger to copy.
+		 */
+		AsyncLogger(const AsyncLogger& logger) = delete;
+
+		/**
+		 Constructs an asynchronous logger by moving the given asynchronous
+		 logger.
+
+		 @param[in]		logger
+						A reference to the asynchronous logger to move.
+		 */
+		AsyncLogger(AsyncLogger&& logger) = delete;
+
+		/**
+		 Destructs this asynchronous logger.
+		 */
+		~AsyncLogger();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given asynchronous logger to this asynchronous logger.
+
+		 @param[in]		logger
+						A reference to the asynchronous logger to copy.
+		 @return		A reference to the copy of the given asynchronous
+						logger (i.e. this asynchronous logger).
+		 */
+		AsyncLogger& operator=(const AsyncLogger& logger) = delete;
+
+		/**
+		 Moves the given asynchronous logger to this asynchronous logger.
+
+		 @param[in]		logger
+						A reference to the asynchronous logger to move.
+		 @return		A reference to the moved asynchronous logger (i.e.
+						this asynchronous logger).
+		 */
+		AsyncLogger& operator=(AsyncLogger&& logger) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this asynchronous logger is running.
+
+		 @return		@c true if this asynchronous logger is running.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsRunning() const noexcept {
+			return m_running.load(std::memory_order_acquire);
+		}
+
+		/**
+		 Starts this asynchronous logger. Log records are written to the
+		 console.
+		 */
+		void Start();
+
+		/**
+		 Starts this asynchronous logger. Log records are written to the
+		 file with the given path and (optionally) to the console.
+
+		 @param[in]		path
+						The path of the file.
+		 @param[in]		console
+						@c true if the log records need to be written to the
+						console as well. @c false otherwise.
+		 @throws		Exception
+						Failed to open the file.
+		 */
+		void Start(std::filesystem::path path, bool console = true);
+
+		/**
+		 Stops this asynchronous logger. All pending log records are written
+		 before returning.
+		 */
+		void Stop() noexcept;
+
+		/**
+		 Sets the rate limit of this asynchronous logger.
+
+		 @pre			This asynchronous logger is not running.
+		 @param[in]		nb_records
+						The maximum number of log records with the same
+						format string written within the given time window.
+		 @param[in]		window
+						The time window.
+		 */
+		void SetRateLimit(std::size_t nb_records,
+						  std::chrono::milliseconds window) noexcept {
+
+			m_rate_limit        = nb_records;
+			m_rate_limit_window = window;
+		}
+
+		/**
+		 Writes the given narrow text.
+
+		 @param[in]		text
+						The (formatted) narrow text.
+		 @param[in]		format
+						The hash of the format string of the given text (or
+						zero if the given text has no format string).
+		 */
+		void Write(std::string text, std::size_t format = 0u);
+
+		/**
+		 Writes the given wide text.
+
+		 @param[in]		text
+						The (formatted) wide text.
+		 @param[in]		format
+						The hash of the format string of the given text (or
+						zero if the given text has no format string).
+		 */
+		void Write(std::wstring text, std::size_t format = 0u);
+
+		/**
+		 Writes all pending log records of this asynchronous logger before
+		 returning.
+
+		 @throws		std::system_error
+						Failed to wait for the background thread.
+		 */
+		void Flush();
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The global asynchronous logger.
+		 */
+		static AsyncLogger s_logger;
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A class of ring buffer leases of a thread.
+		 */
+		class ThreadRingBuffer;
+
+		/**
+		 A struct of rate limits of the log records with the same format
+		 string.
+		 */
+		struct RateLimit {
+
+		public:
+
+			/**
+			 The start of the current time window of this rate limit.
+			 */
+			std::chrono::steady_clock::time_point m_window_start;
+
+			/**
+			 The number of log records written within the current time
+			 window of this rate limit.
+			 */
+			std::size_t m_nb_records = 0u;
+
+			/**
+			 The number of suppressed log records of this rate limit.
+			 */
+			std::size_t m_nb_suppressed = 0u;
+
+			/**
+			 The last suppressed log record of this rate limit.
+			 */
+			LogRecord m_last;
+		};
+
+		/**
+		 The ring buffer lease of the calling thread.
+		 */
+		static thread_local ThreadRingBuffer s_ring_buffer;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs an asynchronous logger.
+		 */
+		AsyncLogger();
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the ring buffer of the calling thread. The ring buffer is
+		 leased the first time the calling thread writes a log record.
+
+		 @return		A reference to the ring buffer of the calling thread.
+		 */
+		[[nodiscard]]
+		RingBuffer< LogRecord >& GetRingBuffer();
+
+		/**
+		 Releases the given ring buffer of a terminating thread.
+
+		 @param[in]		buffer
+						A reference to the ring buffer.
+		 */
+		void ReleaseRingBuffer(RingBuffer< LogRecord >& buffer);
+
+		/**
+		 Writes the given log record.
+
+		 @param[in]		record
+						A reference to the log record to move.
+		 */
+		void Write(LogRecord&& record);
+
+		/**
+		 Drains the ring buffers of this asynchronous logger until this
+		 asynchronous logger is stopped.
+		 */
+		void Run();
+
+		/**
+		 Drains the given ring buffers.
+
+		 @param[in]		buffers
+						A reference to a vector containing pointers to the
+						ring buffers.
+		 @return		@c true if at least one log record was drained.
+						@c false otherwise.
+		 */
+		bool Drain(const std::vector< RingBuffer< LogRecord >* >& buffers);
+
+		/**
+		 Outputs the given log record, unless the rate limit of its format
+		 string is exceeded.
+
+		 @param[in]		record
+						A reference to the log record to move.
+		 */
+		void Output(LogRecord&& record);
+
+		/**
+		 Outputs the suppressed log records of the rate limits whose time
+		 window expired, and removes these rate limits.
+
+		 @param[in]		all
+						@c true if the suppressed log records of all rate
+						limits need to be output. @c false otherwise.
+		 */
+		void OutputSuppressed(bool all);
+
+		/**
+		 Outputs the suppressed log records of the given rate limit (if any).
+
+		 @param[in,out]	rate_limit
+						A reference to the rate limit.
+		 */
+		void OutputSuppressed(RateLimit& rate_limit);
+
+		/**
+		 Outputs the given log record to the sinks of this asynchronous
+		 logger.
+
+		 @param[in]		record
+						A reference to the log record.
+		 */
+		void OutputToSinks(const LogRecord& record) const noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The ring buffers of this asynchronous logger. Each thread that writes
+		 a log record leases a ring buffer until it terminates. The ring
+		 buffers are never destroyed (they may still contain pending log
+		 records), but released ring buffers are leased again by new threads:
+		 the number of ring buffers is bounded by the maximum number of
+		 threads writing log records at the same time.
+		 */
+		std::vector< UniquePtr< RingBuffer< LogRecord > > > m_ring_buffers;
+
+		/**
+		 Pointers to the released ring buffers of this asynchronous logger.
+		 */
+		std::vector< RingBuffer< LogRecord >* > m_released_ring_buffers;
+
+		/**
+		 The background thread of this asynchronous logger.
+		 */
+		std::thread m_thread;
+
+		/**
+		 A pointer to the file stream (sink) of this asynchronous logger.
+		 */
+		UniqueFileStream m_file_stream;
+
+		/**
+		 Flag indicating whether the console is a sink of this asynchronous
+		 logger.
+		 */
+		bool m_console;
+
+		/**
+		 The rate limits of this asynchronous logger indexed by the hash of
+		 their format string.
+		 */
+		std::unordered_map< std::size_t, RateLimit > m_rate_limits;
+
+		/**
+		 The maximum number of log records with the same format string
+		 written by this asynchronous logger within a time window.
+		 */
+		std::size_t m_rate_limit;
+
+		/**
+		 The time window of the rate limits of this asynchronous logger.
+		 */
+		std::chrono::milliseconds m_rate_limit_window;
+
+		/**
+		 The number of flush requests of this asynchronous logger.
+		 */
+		U64 m_nb_flush_requests;
+
+		/**
+		 The number of flush requests handled by this asynchronous logger.
+		 */
+		U64 m_nb_flushes;
+
+		/**
+		 Flag indicating whether this asynchronous logger is running.
+		 */
+		AtomicBool m_running;
+
+		/**
+		 Flag indicating whether this asynchronous logger must stop.
+		 */
+		bool m_stop;
+
+		/**
+		 The mutex of this asynchronous logger.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable for waking up the background thread of this
+		 asynchronous logger.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 The condition variable for signaling handled flush requests of this
+		 asynchronous logger.
+		 */
+		std::condition_variable m_flush_condition;
+	};
+}
\ No newline at end of file
@@ -38,6 +38,13 @@ namespace mage {
 			EXCEPTION_POINTERS* exception_record) noexcept {
 
 			CreateMiniDump(exception_record);
+			// Write all pending log records before terminating.
+			try {
+				AsyncLogger::Get().Flush();
+			}
+			catch (...) {
+				// Terminate without the pending log records.
+			}
 			return EXCEPTION_CONTINUE_SEARCH;
 		}
 
@@ -5,6 +5,7 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
+#include "logging\async_logger.hpp"
 #include "string\format.hpp"
 
 #pragma endregion
@@ -15,6 +16,8 @@
 #pragma region
 
 #include <cassert>
+#include <functional>
+#include <iterator>
 
 #pragma endregion
 
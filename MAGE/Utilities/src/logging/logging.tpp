@@ -5,36 +5,69 @@
 //-----------------------------------------------------------------------------
 namespace mage {
 
+	namespace details {
+
+		/**
+		 Logs a message.
+
+		 The message is formatted on the calling thread and written by the
+		 asynchronous logger, which rate-limits the messages with the same
+		 format string. Messages which abort the execution are flushed
+		 before returning.
+
+		 @tparam		CharT
+						The character type.
+		 @tparam		ArgsT
+						The format argument types.
+		 @param[in]		disposition
+						The message disposition.
+		 @param[in]		prefix
+						The prefix of the message.
+		 @param[in]		format_str
+						The format string.
+		 @param[in]		args
+						A reference to the format arguments.
+		 */
+		template< typename CharT, typename... ArgsT >
+		inline void Log(MessageDisposition disposition,
+						std::basic_string_view< CharT > prefix,
+						std::basic_string_view< CharT > format_str,
+						const ArgsT&... args) {
+
+			if (MessageDisposition::Ignore == disposition) {
+				return;
+			}
+
+			std::basic_string< CharT > text(prefix);
+			AppendWrite(std::back_inserter(text), format_str, args...);
+			text += CharT('\n');
+
+			// The log records are rate-limited per format string.
+			const auto format
+				= std::hash< std::basic_string_view< CharT > >()(format_str);
+
+			auto& logger = AsyncLogger::Get();
+			logger.Write(std::move(text), format);
+
+			if (MessageDisposition::Abort == disposition) {
+				logger.Flush();
+				__debugbreak();
+			}
+		}
+	}
+
 	template< typename... ArgsT >
 	inline void Log(MessageDisposition disposition,
 					std::string_view format_str, const ArgsT&... args) {
 
-		if (MessageDisposition::Ignore == disposition) {
-			return;
-		}
-
-		Print(format_str, args...);
-		Print("\n");
-
-		if (MessageDisposition::Abort == disposition) {
-			__debugbreak();
-		}
+		details::Log(disposition, std::string_view(), format_str, args...);
 	}
 
 	template< typename... ArgsT >
 	inline void Log(MessageDisposition disposition,
 					std::wstring_view format_str, const ArgsT&... args) {
 
-		if (MessageDisposition::Ignore == disposition) {
-			return;
-		}
-
-		Print(format_str, args...);
-		Print("\n");
-
-		if (MessageDisposition::Abort == disposition) {
-			__debugbreak();
-		}
+		details::Log(disposition, std::wstring_view(), format_str, args...);
 	}
 
 	template< typename... ArgsT >
@@ -49,8 +82,8 @@ namespace mage {
 			return;
 		}
 
-		Print("Debug:   ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log(MessageDisposition::Continue, std::string_view("Debug:   "),
+					 format_str, args...);
 		#endif
 	}
 
@@ -66,8 +99,8 @@ namespace mage {
 			return;
 		}
 
-		Print("Debug:   ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log(MessageDisposition::Continue, std::wstring_view(L"Debug:   "),
+					 format_str, args...);
 		#endif
 	}
 
@@ -80,8 +113,8 @@ namespace mage {
 			return;
 		}
 
-		Print("Info:    ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log(MessageDisposition::Continue, std::string_view("Info:    "),
+					 format_str, args...);
 	}
 
 	template< typename... ArgsT >
@@ -93,8 +126,8 @@ namespace mage {
 			return;
 		}
 
-		Print("Info:    ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log(MessageDisposition::Continue, std::wstring_view(L"Info:    "),
+					 format_str, args...);
 	}
 
 	template< typename... ArgsT >
@@ -104,8 +137,8 @@ namespace mage {
 			return;
 		}
 
-		Print("Warning: ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log(MessageDisposition::Continue, std::string_view("Warning: "),
+					 format_str, args...);
 	}
 
 	template< typename... ArgsT >
@@ -115,31 +148,31 @@ namespace mage {
 			return;
 		}
 
-		Print("Warning: ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log(MessageDisposition::Continue, std::wstring_view(L"Warning: "),
+					 format_str, args...);
 	}
 
 	template< typename... ArgsT >
 	inline void Error(std::string_view format_str, const ArgsT&... args) {
-		Print("Error:   ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log(MessageDisposition::Continue, std::string_view("Error:   "),
+					 format_str, args...);
 	}
 
 	template< typename... ArgsT >
 	inline void Error(std::wstring_view format_str, const ArgsT&... args) {
-		Print("Error:   ");
-		Log(MessageDisposition::Continue, format_str, args...);
+		details::Log(MessageDisposition::Continue, std::wstring_view(L"Error:   "),
+					 format_str, args...);
 	}
 
 	template< typename... ArgsT >
 	inline void Fatal(std::string_view format_str, const ArgsT&... args) {
-		Print("Fatal:   ");
-		Log(MessageDisposition::Abort, format_str, args...);
+		details::Log(MessageDisposition::Abort, std::string_view("Fatal:   "),
+					 format_str, args...);
 	}
 
 	template< typename... ArgsT >
 	inline void Fatal(std::wstring_view format_str, const ArgsT&... args) {
-		Print("Fatal:   ");
-		Log(MessageDisposition::Abort, format_str, args...);
+		details::Log(MessageDisposition::Abort, std::wstring_view(L"Fatal:   "),
+					 format_str, args...);
 	}
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma region
 
 #include "platform\windows.hpp"
+#include "type\scalar_types.hpp"
 
 #pragma endregion
 
@@ -17,6 +18,7 @@
 #include <functional>
 #include <gsl\gsl>
 #include <memory>
+#include <vector>
 #include <wrl.h>
 
 #pragma endregion
@@ -354,9 +356,42 @@ namespace mage {
 	//-------------------------------------------------------------------------
 	#pragma region
 
+	namespace details {
+
+		/**
+		 A struct of proxy slots.
+
+		 A proxy slot holds the current address of a memory resource which
+		 may be relocated (e.g., due to a vector reallocation) and a
+		 generation which changes whenever the slot is reused for another
+		 memory resource.
+		 */
+		struct ProxySlot {
+
+		public:
+
+			/**
+			 A pointer to the memory resource of this proxy slot.
+			 */
+			void* m_ptr;
+
+			/**
+			 The generation of this proxy slot.
+			 */
+			U32 m_generation;
+		};
+	}
+
 	/**
 	 A class of proxy pointers.
 
+	 A proxy pointer is a generational handle (i.e. a slot and a slot
+	 generation) instead of a raw pointer. Proxy pointers remain valid if the
+	 memory resource is relocated, and become @c nullptr if the slot of the
+	 memory resource is reused. Proxy pointers are trivially copyable and
+	 resolve to a raw pointer with a single load of their slot. The slots
+	 must outlive all proxy pointers referencing them.
+
 	 @tparam		T
 					The memory resource type.
 	 */
@@ -372,41 +407,60 @@ namespace mage {
 		/**
 		 Constructs a proxy pointer.
 		 */
-		ProxyPtr() noexcept
-			: ProxyPtr([]() noexcept -> T* {
-				return nullptr;
-			}) {}
+		constexpr ProxyPtr() noexcept
+			: m_slot(nullptr),
+			m_generation(0u),
+			m_offset(0) {}
 
 		/**
 		 Constructs a proxy pointer.
 		 */
-		ProxyPtr(std::nullptr_t) noexcept
+		constexpr ProxyPtr(std::nullptr_t) noexcept
 			: ProxyPtr() {}
 
 		/**
-		 Constructs a proxy pointer for the given container and index.
-
-		 @tparam		ContainerT
-						The container type.
-		 @param[in]		container
-						A reference to the container.
-		 @param[in]		index
-						The index into the container.
+		 Constructs a proxy pointer for the given slot.
+
+		 @pre			The given slot points to a @c T memory resource.
+		 @pre			The address of the given slot does not change during
+						the lifetime of this proxy pointer.
+		 @param[in]		slot
+						A reference to the slot.
 		 */
-		template< typename ContainerT >
-		explicit ProxyPtr(ContainerT& container, std::size_t index) noexcept
-			: ProxyPtr([&container, index]() noexcept {
-				return &container[index];
-			}) {}
+		explicit ProxyPtr(const details::ProxySlot& slot) noexcept
+			: m_slot(&slot),
+			m_generation(slot.m_generation),
+			m_offset(0) {}
 
 		/**
-		 Constructs a proxy pointer with the given getter function.
+		 Constructs a proxy pointer from the given proxy pointer which
+		 resolves to the given pointer instead (i.e. an aliasing
+		 constructor used for casting).
 
-		 @param[in]		getter
-						The getter function.
+		 @tparam		FromT
+						The memory resource type.
+		 @param[in]		ptr
+						A reference to the proxy pointer.
+		 @param[in]		resource
+						A pointer to the memory resource obtained by
+						converting the memory resource of the given proxy
+						pointer.
 		 */
-		explicit ProxyPtr(std::function< T*() > getter) noexcept
-			: m_getter(std::move(getter)) {}
+		template< typename FromT >
+		explicit ProxyPtr(const ProxyPtr< FromT >& ptr, T* resource) noexcept
+			: ProxyPtr() {
+
+			if (nullptr == resource) {
+				return;
+			}
+
+			const auto from = reinterpret_cast< const volatile U8* >(ptr.Get());
+			const auto to   = reinterpret_cast< const volatile U8* >(resource);
+
+			m_slot       = ptr.m_slot;
+			m_generation = ptr.m_generation;
+			m_offset     = ptr.m_offset + (to - from);
+		}
 
 		/**
 		 Constructs a proxy pointer from the given proxy pointer.
@@ -414,8 +468,7 @@ namespace mage {
 		 @param[in]		ptr
 						A reference to the proxy pointer.
 		 */
-		ProxyPtr(const ProxyPtr& ptr) noexcept
-			: m_getter(ptr.m_getter) {}
+		constexpr ProxyPtr(const ProxyPtr& ptr) noexcept = default;
 
 		/**
 		 Constructs a proxy pointer by moving the given proxy pointer.
@@ -423,8 +476,7 @@ namespace mage {
 		 @param[in]		ptr
 						A reference to the proxy pointer to move.
 		 */
-		ProxyPtr(ProxyPtr&& ptr) noexcept
-			: m_getter(std::move(ptr.m_getter)) {}
+		constexpr ProxyPtr(ProxyPtr&& ptr) noexcept = default;
 
 		/**
 		 Constructs a proxy pointer from the given proxy pointer.
@@ -437,20 +489,18 @@ namespace mage {
 		template< typename FromT,
 			      typename = std::enable_if_t< std::is_convertible_v< FromT*, T* > > >
 		ProxyPtr(const ProxyPtr< FromT >& ptr) noexcept
-			: ProxyPtr(ptr.m_getter) {}
-
-		/**
-		 Constructs a proxy pointer by moving the given proxy pointer.
+			: ProxyPtr() {
 
-		 @tparam		FromT
-						The memory resource type.
-		 @param[in]		ptr
-						A reference to the proxy pointer to move.
-		 */
-		template< typename FromT,
-			      typename = std::enable_if_t< std::is_convertible_v< FromT*, T* > > >
-		ProxyPtr(ProxyPtr< FromT >&& ptr) noexcept
-			: ProxyPtr(std::move(ptr.m_getter)) {}
+			if constexpr (std::is_same_v< std::remove_cv_t< FromT >,
+										  std::remove_cv_t< T > >) {
+				m_slot       = ptr.m_slot;
+				m_generation = ptr.m_generation;
+				m_offset     = ptr.m_offset;
+			}
+			else {
+				*this = ProxyPtr(ptr, static_cast< T* >(ptr.Get()));
+			}
+		}
 
 		/**
 		 Destructs this proxy pointer.
@@ -469,10 +519,7 @@ namespace mage {
 		 @return		A reference to the copy of the given proxy pointer
 						(i.e. this proxy pointer).
 		 */
-		ProxyPtr& operator=(const ProxyPtr& ptr) noexcept {
-			m_getter = ptr.m_getter;
-			return *this;
-		}
+		constexpr ProxyPtr& operator=(const ProxyPtr& ptr) noexcept = default;
 
 		/**
 		 Moves the given proxy pointer to this proxy pointer.
@@ -482,10 +529,7 @@ namespace mage {
 		 @return		A reference to the moved proxy pointer (i.e. this proxy
 						pointer).
 		 */
-		ProxyPtr& operator=(ProxyPtr&& ptr) noexcept {
-			m_getter = std::move(ptr.m_getter);
-			return *this;
-		}
+		constexpr ProxyPtr& operator=(ProxyPtr&& ptr) noexcept = default;
 
 		//---------------------------------------------------------------------
 		// Member Methods
@@ -524,11 +568,19 @@ namespace mage {
 		 Returns the memory resource pointed to by this proxy pointer.
 
 		 @return		A pointer to the memory resource pointed to by this
-						proxy pointer.
+						proxy pointer. @c nullptr if this proxy pointer is
+						empty or if its slot has been reused.
 		 */
 		[[nodiscard]]
 		T* Get() const noexcept {
-			return m_getter();
+			if (nullptr == m_slot
+				|| m_slot->m_generation != m_generation
+				|| nullptr == m_slot->m_ptr) {
+				return nullptr;
+			}
+
+			return reinterpret_cast< T* >(
+				static_cast< U8* >(m_slot->m_ptr) + m_offset);
 		}
 
 		/**
@@ -564,16 +616,39 @@ namespace mage {
 			return !(*this == rhs);
 		}
 
+	private:
+
+		//---------------------------------------------------------------------
+		// Friends
+		//---------------------------------------------------------------------
+
+		template< typename U >
+		friend class ProxyPtr;
+
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
 
 		/**
-		 The getter of this proxy pointer.
+		 A pointer to the slot of this proxy pointer.
 		 */
-		std::function< T*() > m_getter;
+		const details::ProxySlot* m_slot;
+
+		/**
+		 The slot generation of this proxy pointer.
+		 */
+		U32 m_generation;
+
+		/**
+		 The offset in bytes between the memory resource of the slot of this
+		 proxy pointer and the memory resource pointed to by this proxy
+		 pointer.
+		 */
+		std::ptrdiff_t m_offset;
 	};
 
+	static_assert(std::is_trivially_copyable_v< ProxyPtr< int > >);
+
 	/**
 	 Checks whether the given proxy pointer is equal to @c nullptr.
 
@@ -639,8 +714,8 @@ namespace mage {
 	}
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by statically
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose resolved pointer is obtained by statically
+	 casting the resolved pointer of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -654,8 +729,8 @@ namespace mage {
 	ProxyPtr< ToT > static_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by statically
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose resolved pointer is obtained by statically
+	 casting the resolved pointer of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -666,11 +741,18 @@ namespace mage {
 	 @return		The moved proxy pointer.
 	 */
 	template< typename ToT, typename FromT >
-	ProxyPtr< ToT > static_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
+	ProxyPtr< ToT > static_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by dynamically
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose resolved pointer is obtained by dynamically
+	 casting the resolved pointer of the given proxy pointer.
+
+	 Unlike for raw pointers, the cast is evaluated once when the proxy
+	 pointer is created, not each time it is resolved. The resulting proxy
+	 pointer shares the slot and generation of the given proxy pointer, and
+	 thus becomes @c nullptr as well once that slot is reused. If the cast
+	 fails (or the given proxy pointer is @c nullptr), the resulting proxy
+	 pointer is and remains @c nullptr.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -684,8 +766,15 @@ namespace mage {
 	ProxyPtr< ToT > dynamic_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by dynamically
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose resolved pointer is obtained by dynamically
+	 casting the resolved pointer of the given proxy pointer.
+
+	 Unlike for raw pointers, the cast is evaluated once when the proxy
+	 pointer is created, not each time it is resolved. The resulting proxy
+	 pointer shares the slot and generation of the given proxy pointer, and
+	 thus becomes @c nullptr as well once that slot is reused. If the cast
+	 fails (or the given proxy pointer is @c nullptr), the resulting proxy
+	 pointer is and remains @c nullptr.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -699,8 +788,8 @@ namespace mage {
 	ProxyPtr< ToT > dynamic_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by const
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose resolved pointer is obtained by const
+	 casting the resolved pointer of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -714,8 +803,8 @@ namespace mage {
 	ProxyPtr< ToT > const_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by const
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose resolved pointer is obtained by const
+	 casting the resolved pointer of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -729,8 +818,8 @@ namespace mage {
 	ProxyPtr< ToT > const_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by reinterpret
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose resolved pointer is obtained by reinterpret
+	 casting the resolved pointer of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
@@ -744,8 +833,8 @@ namespace mage {
 	ProxyPtr< ToT > reinterpret_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept;
 
 	/**
-	 Creates a proxy pointer whose stored getter is obtained by reinterpret
-	 casting the stored getter of the given proxy pointer.
+	 Creates a proxy pointer whose resolved pointer is obtained by reinterpret
+	 casting the resolved pointer of the given proxy pointer.
 
 	 @tparam		ToT
 					The conversion to-type.
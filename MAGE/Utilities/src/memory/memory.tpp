@@ -69,58 +69,42 @@ namespace mage {
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > static_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(ptr.m_getter)]() noexcept {
-			return static_cast< ToT* >(getter());
-		});
+		return ProxyPtr< ToT >(ptr, static_cast< ToT* >(ptr.Get()));
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > static_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(std::move(ptr.m_getter))]() noexcept {
-			return static_cast< ToT* >(getter());
-		});
+		return static_pointer_cast< ToT >(static_cast< const ProxyPtr< FromT >& >(ptr));
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > dynamic_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(ptr.m_getter)]() noexcept {
-			return dynamic_cast< ToT* >(getter());
-		});
+		return ProxyPtr< ToT >(ptr, dynamic_cast< ToT* >(ptr.Get()));
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > dynamic_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(std::move(ptr.m_getter))]() noexcept {
-			return dynamic_cast< ToT* >(getter());
-		});
+		return dynamic_pointer_cast< ToT >(static_cast< const ProxyPtr< FromT >& >(ptr));
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > const_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(ptr.m_getter)]() noexcept {
-			return const_cast< ToT* >(getter());
-		});
+		return ProxyPtr< ToT >(ptr, const_cast< ToT* >(ptr.Get()));
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > const_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(std::move(ptr.m_getter))]() noexcept {
-			return const_cast< ToT* >(getter());
-		});
+		return const_pointer_cast< ToT >(static_cast< const ProxyPtr< FromT >& >(ptr));
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > reinterpret_pointer_cast(const ProxyPtr< FromT >& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(ptr.m_getter)]() noexcept {
-			return reinterpret_cast< ToT* >(getter());
-		});
+		return ProxyPtr< ToT >(ptr, reinterpret_cast< ToT* >(ptr.Get()));
 	}
 
 	template< typename ToT, typename FromT >
 	inline ProxyPtr< ToT > reinterpret_pointer_cast(ProxyPtr< FromT >&& ptr) noexcept {
-		return ProxyPtr< ToT >([getter(std::move(ptr.m_getter))]() noexcept {
-			return reinterpret_cast< ToT* >(getter());
-		});
+		return reinterpret_pointer_cast< ToT >(static_cast< const ProxyPtr< FromT >& >(ptr));
 	}
 
 	#pragma endregion
@@ -0,0 +1,240 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.hpp"
+#include "parallel\parallel.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Pins the given thread to the given logical processor.
+
+		 @param[in]		thread
+						A reference to the thread.
+		 @param[in]		core
+						The index of the logical processor.
+		 */
+		void PinThread(std::thread& thread, std::size_t core) noexcept {
+			if (std::numeric_limits< DWORD_PTR >::digits <= core) {
+				return;
+			}
+
+			SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1u) << core);
+		}
+	}
+
+	JobSystem::JobSystem()
+		: JobSystem(std::max(NumberOfPhysicalCores(), FU16(1u)) - 1u) {}
+
+	JobSystem::JobSystem(std::size_t nb_workers)
+		: m_deques(),
+		m_thread_ids(),
+		m_workers(),
+		m_shared_jobs(),
+		m_nb_jobs(0u),
+		m_nb_sleeping(0u),
+		m_stop(false),
+		m_mutex(),
+		m_condition() {
+
+		m_deques.reserve(nb_workers + 1u);
+		for (std::size_t i = 0u; i <= nb_workers; ++i) {
+			m_deques.push_back(MakeUnique< WorkStealingDeque< Job* > >());
+		}
+
+		m_thread_ids.reserve(nb_workers + 1u);
+		m_thread_ids.push_back(std::this_thread::get_id());
+
+		// Spread the workers over the physical cores (i.e. skip the sibling
+		// logical processors of the physical core of a previous thread).
+		const std::size_t nb_cores = std::max(NumberOfSystemCores(), FU16(1u));
+		const auto stride = std::max(nb_cores / (nb_workers + 1u),
+									 std::size_t(1u));
+
+		m_workers.reserve(nb_workers);
+		for (std::size_t i = 1u; i <= nb_workers; ++i) {
+			m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+			m_thread_ids.push_back(m_workers.back().get_id());
+			PinThread(m_workers.back(), (i * stride) % nb_cores);
+		}
+	}
+
+	JobSystem::~JobSystem() {
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_stop = true;
+		}
+		m_condition.notify_all();
+
+		for (auto& worker : m_workers) {
+			worker.join();
+		}
+
+		// Destruct the jobs that were never started.
+		for (auto& deque : m_deques) {
+			while (const auto job = deque->Steal()) {
+				delete *job;
+			}
+		}
+		for (const auto job : m_shared_jobs) {
+			delete job;
+		}
+	}
+
+	void JobSystem::Execute(Task task, JobCounter* counter) {
+		auto job = MakeUnique< Job >(Job{ std::move(task), counter });
+
+		if (nullptr != counter) {
+			counter->m_count.fetch_add(1u, std::memory_order_relaxed);
+		}
+		m_nb_jobs.fetch_add(1u);
+
+		if (const auto index = GetThreadIndex();
+			index < m_deques.size() && m_deques[index]->Push(job.get())) {
+
+			job.release();
+		}
+		else {
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_shared_jobs.push_back(job.release());
+		}
+
+		WakeWorker();
+	}
+
+	void JobSystem::Wait(JobCounter& counter) {
+		WaitUntilDone(GetThreadIndex(), counter);
+
+		if (counter.m_failed.load(std::memory_order_relaxed)) {
+			counter.m_failed.store(false, std::memory_order_relaxed);
+			std::rethrow_exception(std::exchange(counter.m_exception, nullptr));
+		}
+	}
+
+	[[nodiscard]]
+	std::size_t JobSystem::GetThreadIndex() const noexcept {
+		// The thread ids are not modified after construction.
+		const auto it = std::find(m_thread_ids.cbegin(), m_thread_ids.cend(),
+								  std::this_thread::get_id());
+		return static_cast< std::size_t >(it - m_thread_ids.cbegin());
+	}
+
+	void JobSystem::WaitUntilDone(std::size_t index, const JobCounter& counter) {
+		while (!counter.IsDone()) {
+			if (!ExecuteNextJob(index)) {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSystem::WorkerLoop(std::size_t index) {
+		while (!m_stop) {
+			if (ExecuteNextJob(index)) {
+				continue;
+			}
+
+			std::unique_lock< std::mutex > lock(m_mutex);
+			++m_nb_sleeping;
+			m_condition.wait(lock, [this]() noexcept {
+				return m_stop || 0u != m_nb_jobs;
+			});
+			--m_nb_sleeping;
+		}
+	}
+
+	bool JobSystem::ExecuteNextJob(std::size_t index) {
+		if (0u == m_nb_jobs) {
+			return false;
+		}
+
+		Job* job = nullptr;
+
+		// Pop a job from the own deque.
+		if (index < m_deques.size()) {
+			if (const auto popped = m_deques[index]->Pop()) {
+				job = *popped;
+			}
+		}
+
+		// Steal a job from the other deques.
+		const auto nb_deques = m_deques.size();
+		for (std::size_t i = 1u; nullptr == job && i <= nb_deques; ++i) {
+			if (const auto stolen = m_deques[(index + i) % nb_deques]->Steal()) {
+				job = *stolen;
+			}
+		}
+
+		// Take a job from the shared queue.
+		if (nullptr == job) {
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			if (!m_shared_jobs.empty()) {
+				job = m_shared_jobs.back();
+				m_shared_jobs.pop_back();
+			}
+		}
+
+		if (nullptr == job) {
+			return false;
+		}
+
+		--m_nb_jobs;
+		ExecuteJob(job);
+		return true;
+	}
+
+	void JobSystem::ExecuteJob(Job* job) noexcept {
+		const UniquePtr< Job > owned_job(job);
+		const auto counter = owned_job->m_counter;
+
+		if (nullptr == counter) {
+			owned_job->m_task();
+			return;
+		}
+
+		try {
+			owned_job->m_task();
+		}
+		catch (...) {
+			// Keep the first exception only.
+			if (!counter->m_failed.exchange(true, std::memory_order_relaxed)) {
+				counter->m_exception = std::current_exception();
+			}
+		}
+
+		// Publishes the exception, if any, to the waiting thread.
+		counter->m_count.fetch_sub(1u, std::memory_order_release);
+	}
+
+	void JobSystem::WakeWorker() {
+		if (0u == m_nb_sleeping) {
+			return;
+		}
+
+		// Acquire the mutex to not notify in between the predicate check
+		// and the sleep of a worker.
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+		}
+		m_condition.notify_one();
+	}
+}
\ No newline at end of file
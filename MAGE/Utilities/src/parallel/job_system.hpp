@@ -0,0 +1,447 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\work_stealing_deque.hpp"
+#include "collection\vector.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of job counters.
+
+	 A job counter counts the number of unfinished jobs associated with it.
+	 Waiting on a job counter expresses a dependency on these jobs. The first
+	 exception thrown by one of these jobs is kept by the job counter, and
+	 rethrown to the thread waiting on it.
+	 */
+	class JobCounter {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a job counter.
+		 */
+		JobCounter() noexcept
+			: m_count(0u),
+			m_failed(false),
+			m_exception() {}
+
+		/**
+		 Constructs a job counter from the given job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to copy.
+		 */
+		JobCounter(const JobCounter& counter) = delete;
+
+		/**
+		 Constructs a job counter by moving the given job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to move.
+		 */
+		JobCounter(JobCounter&& counter) = delete;
+
+		/**
+		 Destructs this job counter.
+		 */
+		~JobCounter() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given job counter to this job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to copy.
+		 @return		A reference to the copy of the given job counter (i.e.
+						this job counter).
+		 */
+		JobCounter& operator=(const JobCounter& counter) = delete;
+
+		/**
+		 Moves the given job counter to this job counter.
+
+		 @param[in]		counter
+						A reference to the job counter to move.
+		 @return		A reference to the moved job counter (i.e. this job
+						counter).
+		 */
+		JobCounter& operator=(JobCounter&& counter) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether all jobs associated with this job counter are
+		 finished.
+
+		 @return		@c true if all jobs associated with this job counter
+						are finished. @c false otherwise.
+		 */
+		[[nodiscard]]
+		bool IsDone() const noexcept {
+			return 0u == m_count.load(std::memory_order_acquire);
+		}
+
+	private:
+
+		friend class JobSystem;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of unfinished jobs of this job counter.
+		 */
+		AtomicU32 m_count;
+
+		/**
+		 A flag indicating whether a job of this job counter threw an
+		 exception.
+		 */
+		AtomicBool m_failed;
+
+		/**
+		 The first exception thrown by a job of this job counter.
+		 */
+		std::exception_ptr m_exception;
+	};
+
+	/**
+	 A class of job systems.
+
+	 A job system owns one worker thread per additional physical core, each
+	 pinned to its own core. Every participating thread (i.e. the workers and
+	 the thread constructing the job system) owns a work-stealing deque: jobs
+	 are pushed to and popped from the deque of the executing thread, and
+	 idle threads steal jobs from the other deques. Jobs submitted by other
+	 threads go through a shared, locked queue. A thread can participate in
+	 multiple job systems.
+	 */
+	class JobSystem {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The task type of jobs.
+		 */
+		using Task = std::function< void() >;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a job system with one worker per additional physical
+		 core.
+
+		 @throws		Exception
+						Failed to retrieve the number of cores.
+		 */
+		JobSystem();
+
+		/**
+		 Constructs a job system.
+
+		 @param[in]		nb_workers
+						The number of worker threads (excluding the thread
+						constructing the job system).
+		 */
+		explicit JobSystem(std::size_t nb_workers);
+
+		/**
+		 Constructs a job system from the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system to copy.
+		 */
+		JobSystem(const JobSystem& job_system) = delete;
+
+		/**
+		 Constructs a job system by moving the given job system.
+
+		 @param[in]		job_system
+						A reference to the job system to move.
+		 */
+		JobSystem(JobSystem&& job_system) = delete;
+
+		/**
+		 Destructs this job system. The worker threads are joined after
+		 finishing their current jobs.
+		 */
+		~JobSystem();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given job system to this job system.
+
+		 @param[in]		job_system
+						A reference to the job system to copy.
+		 @return		A reference to the copy of the given job system (i.e.
+						this job system).
+		 */
+		JobSystem& operator=(const JobSystem& job_system) = delete;
+
+		/**
+		 Moves the given job system to this job system.
+
+		 @param[in]		job_system
+						A reference to the job system to move.
+		 @return		A reference to the moved job system (i.e. this job
+						system).
+		 */
+		JobSystem& operator=(JobSystem&& job_system) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the number of threads executing jobs of this job system
+		 (i.e. the workers and the thread constructing this job system).
+
+		 @return		The number of threads of this job system.
+		 */
+		[[nodiscard]]
+		std::size_t GetNumberOfThreads() const noexcept {
+			return m_deques.size();
+		}
+
+		/**
+		 Submits a job for the given task.
+
+		 @pre			If no job counter is given, the given task does not
+						throw.
+		 @param[in]		task
+						The task.
+		 @param[in]		counter
+						A pointer to the job counter to associate the job
+						with. The job counter must outlive the job.
+		 */
+		void Execute(Task task, JobCounter* counter = nullptr);
+
+		/**
+		 Waits until all jobs associated with the given job counter are
+		 finished. The calling thread executes other jobs while waiting, so
+		 that jobs can wait on the jobs they depend on.
+
+		 @param[in,out]	counter
+						A reference to the job counter.
+		 @throws		...
+						The first exception thrown by a job associated with
+						the given job counter (after all these jobs are
+						finished).
+		 */
+		void Wait(JobCounter& counter);
+
+		/**
+		 Applies the given action to subranges of the given range in
+		 parallel, and waits until all subranges are processed.
+
+		 @tparam		ActionT
+						An action type. It should define an equivalent of the
+						function @code void F(std::size_t, std::size_t)@endcode
+						processing a subrange [begin, end).
+		 @param[in]		begin
+						The begin of the range.
+		 @param[in]		end
+						The end of the range.
+		 @param[in]		action
+						A reference to the action.
+		 @param[in]		grain_size
+						The number of elements per subrange. If zero, the
+						range is split into four subranges per thread.
+		 @throws		...
+						The first exception thrown by the given action (after
+						all subranges are processed or abandoned).
+		 */
+		template< typename ActionT >
+		void ParallelFor(std::size_t begin,
+						 std::size_t end,
+						 ActionT&& action,
+						 std::size_t grain_size = 0u);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of jobs.
+		 */
+		struct Job {
+
+		public:
+
+			/**
+			 The task of this job.
+			 */
+			Task m_task;
+
+			/**
+			 A pointer to the job counter of this job.
+			 */
+			JobCounter* m_counter;
+		};
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the index of the deque owned by the calling thread.
+
+		 @return		The index of the deque owned by the calling thread, or
+						the number of deques if the calling thread does not
+						participate in this job system.
+		 */
+		[[nodiscard]]
+		std::size_t GetThreadIndex() const noexcept;
+
+		/**
+		 Waits until all jobs associated with the given job counter are
+		 finished, without rethrowing the exceptions of these jobs.
+
+		 @param[in]		index
+						The index of the deque owned by the calling thread.
+		 @param[in]		counter
+						A reference to the job counter.
+		 */
+		void WaitUntilDone(std::size_t index, const JobCounter& counter);
+
+		/**
+		 Executes jobs until this job system is stopped.
+
+		 @param[in]		index
+						The index of the deque owned by the worker.
+		 */
+		void WorkerLoop(std::size_t index);
+
+		/**
+		 Tries to execute a single job. The calling thread first pops a job
+		 from its own deque, next steals a job from the other deques, and
+		 finally takes a job from the shared queue.
+
+		 @param[in]		index
+						The index of the deque owned by the calling thread.
+		 @return		@c true if a job was executed. @c false otherwise.
+		 */
+		bool ExecuteNextJob(std::size_t index);
+
+		/**
+		 Executes and destructs the given job. The exception thrown by the
+		 task of the given job is kept by the job counter of the given job.
+
+		 @param[in]		job
+						A pointer to the job.
+		 */
+		void ExecuteJob(Job* job) noexcept;
+
+		/**
+		 Wakes a sleeping worker, if any.
+		 */
+		void WakeWorker();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The deques of this job system. The first deque is owned by the
+		 thread constructing this job system, the others by the workers.
+		 */
+		std::vector< UniquePtr< WorkStealingDeque< Job* > > > m_deques;
+
+		/**
+		 The ids of the threads of this job system. The i-th thread owns the
+		 i-th deque of this job system.
+		 */
+		std::vector< std::thread::id > m_thread_ids;
+
+		/**
+		 The worker threads of this job system.
+		 */
+		std::vector< std::thread > m_workers;
+
+		/**
+		 The jobs submitted by non-participating threads, or by
+		 participating threads whose deque is full.
+		 */
+		std::vector< Job* > m_shared_jobs;
+
+		/**
+		 The number of submitted, not yet started jobs of this job system.
+		 */
+		AtomicU32 m_nb_jobs;
+
+		/**
+		 The number of sleeping workers of this job system.
+		 */
+		AtomicU32 m_nb_sleeping;
+
+		/**
+		 A flag indicating whether this job system is stopped.
+		 */
+		AtomicBool m_stop;
+
+		/**
+		 The mutex guarding the shared jobs and the sleep of the workers of
+		 this job system.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The condition variable the idle workers of this job system sleep
+		 on.
+		 */
+		std::condition_variable m_condition;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "parallel\job_system.tpp"
+
+#pragma endregion
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename ActionT >
+	void JobSystem::ParallelFor(std::size_t begin,
+								std::size_t end,
+								ActionT&& action,
+								std::size_t grain_size) {
+
+		if (end <= begin) {
+			return;
+		}
+
+		const auto nb_elements = end - begin;
+		if (0u == grain_size) {
+			grain_size = nb_elements / (4u * GetNumberOfThreads());
+		}
+		grain_size = std::max(grain_size, std::size_t(1u));
+
+		JobCounter counter;
+		try {
+			auto first = begin;
+			for (; end - first > grain_size; first += grain_size) {
+				const auto last = first + grain_size;
+				Execute([&action, first, last]() {
+					action(first, last);
+				}, &counter);
+			}
+
+			// The calling thread processes the last subrange itself.
+			action(first, end);
+		}
+		catch (...) {
+			// The submitted jobs refer to the action and the job counter.
+			WaitUntilDone(GetThreadIndex(), counter);
+			throw;
+		}
+
+		Wait(counter);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,191 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection\dynamic_array.hpp"
+#include "type\atomic_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of bounded, lock-free single-producer single-consumer ring
+	 buffers.
+
+	 One thread (i.e. the producer) pushes elements at the tail of a ring
+	 buffer, while one other thread (i.e. the consumer) pops elements from
+	 the head of the ring buffer.
+
+	 @tparam		T
+					The element type. Must be default constructible and move
+					assignable.
+	 */
+	template< typename T >
+	class RingBuffer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a ring buffer.
+
+		 @pre			@a capacity is a power of two.
+		 @param[in]		capacity
+						The maximum number of elements of the ring buffer.
+		 */
+		explicit RingBuffer(std::size_t capacity = 1024u)
+			: m_head(0u),
+			m_tail(0u),
+			m_elements(capacity),
+			m_mask(capacity - 1u) {}
+
+		/**
+		 Constructs a ring buffer from the given ring buffer.
+
+		 @param[in]		buffer
+						A reference to the ring buffer to copy.
+		 */
+		RingBuffer(const RingBuffer& buffer) = delete;
+
+		/**
+		 Constructs a ring buffer by moving the given ring buffer.
+
+		 @param[in]		buffer
+						A reference to the ring buffer to move.
+		 */
+		RingBuffer(RingBuffer&& buffer) = delete;
+
+		/**
+		 Destructs this ring buffer.
+		 */
+		~RingBuffer() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given ring buffer to this ring buffer.
+
+		 @param[in]		buffer
+						A reference to the ring buffer to copy.
+		 @return		A reference to the copy of the given ring buffer (i.e.
+						this ring buffer).
+		 */
+		RingBuffer& operator=(const RingBuffer& buffer) = delete;
+
+		/**
+		 Moves the given ring buffer to this ring buffer.
+
+		 @param[in]		buffer
+						A reference to the ring buffer to move.
+		 @return		A reference to the moved ring buffer (i.e. this ring
+						buffer).
+		 */
+		RingBuffer& operator=(RingBuffer&& buffer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this ring buffer is empty.
+
+		 @return		@c true if this ring buffer is empty. @c false
+						otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return m_head.load(std::memory_order_acquire)
+				== m_tail.load(std::memory_order_acquire);
+		}
+
+		/**
+		 Pushes the given element at the tail of this ring buffer.
+
+		 @pre			The calling thread is the producer of this ring
+						buffer.
+		 @param[in]		element
+						The element.
+		 @return		@c true if the given element is pushed. @c false if
+						this ring buffer is full.
+		 */
+		bool Push(T&& element) {
+			const auto tail = m_tail.load(std::memory_order_relaxed);
+			const auto head = m_head.load(std::memory_order_acquire);
+			if (m_mask < tail - head) {
+				return false;
+			}
+
+			m_elements[tail & m_mask] = std::move(element);
+			m_tail.store(tail + 1u, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 Pops an element from the head of this ring buffer.
+
+		 @pre			The calling thread is the consumer of this ring
+						buffer.
+		 @return		The popped element, if any.
+		 */
+		[[nodiscard]]
+		std::optional< T > Pop() {
+			const auto head = m_head.load(std::memory_order_relaxed);
+			const auto tail = m_tail.load(std::memory_order_acquire);
+			if (head == tail) {
+				// The ring buffer is empty.
+				return {};
+			}
+
+			std::optional< T > element(std::move(m_elements[head & m_mask]));
+			m_head.store(head + 1u, std::memory_order_release);
+			return element;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the head element of this ring buffer.
+		 */
+		alignas(64) AtomicU64 m_head;
+
+		/**
+		 The index past the tail element of this ring buffer.
+		 */
+		alignas(64) AtomicU64 m_tail;
+
+		/**
+		 The (circular buffer of) elements of this ring buffer.
+		 */
+		alignas(64) DynamicArray< T > m_elements;
+
+		/**
+		 The index mask of this ring buffer.
+		 */
+		U64 m_mask;
+	};
+}
\ No newline at end of file
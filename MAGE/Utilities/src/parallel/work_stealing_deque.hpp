@@ -0,0 +1,221 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "collection\dynamic_array.hpp"
+#include "type\atomic_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <optional>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of bounded, lock-free work-stealing deques (Chase and Lev 2005,
+	 with the memory orderings of Lê et al. 2013).
+
+	 The owning thread pushes and pops elements at the bottom of a
+	 work-stealing deque, while any other thread can steal elements from the
+	 top of the work-stealing deque.
+
+	 @tparam		T
+					The element type. Must be trivially copyable (e.g. a
+					pointer type).
+	 */
+	template< typename T >
+	class WorkStealingDeque {
+
+	public:
+
+		static_assert(std::is_trivially_copyable_v< T >);
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a work-stealing deque.
+
+		 @pre			@a capacity is a power of two.
+		 @param[in]		capacity
+						The maximum number of elements of the work-stealing
+						deque.
+		 */
+		explicit WorkStealingDeque(std::size_t capacity = 4096u)
+			: m_top(0),
+			m_bottom(0),
+			m_elements(capacity),
+			m_mask(capacity - 1u) {}
+
+		/**
+		 Constructs a work-stealing deque from the given work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to copy.
+		 */
+		WorkStealingDeque(const WorkStealingDeque& deque) = delete;
+
+		/**
+		 Constructs a work-stealing deque by moving the given work-stealing
+		 deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to move.
+		 */
+		WorkStealingDeque(WorkStealingDeque&& deque) = delete;
+
+		/**
+		 Destructs this work-stealing deque.
+		 */
+		~WorkStealingDeque() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given work-stealing deque to this work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to copy.
+		 @return		A reference to the copy of the given work-stealing
+						deque (i.e. this work-stealing deque).
+		 */
+		WorkStealingDeque& operator=(const WorkStealingDeque& deque) = delete;
+
+		/**
+		 Moves the given work-stealing deque to this work-stealing deque.
+
+		 @param[in]		deque
+						A reference to the work-stealing deque to move.
+		 @return		A reference to the moved work-stealing deque (i.e.
+						this work-stealing deque).
+		 */
+		WorkStealingDeque& operator=(WorkStealingDeque&& deque) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Pushes the given element at the bottom of this work-stealing deque.
+
+		 @pre			The calling thread owns this work-stealing deque.
+		 @param[in]		element
+						The element.
+		 @return		@c true if the given element is pushed. @c false if
+						this work-stealing deque is full.
+		 */
+		bool Push(T element) noexcept {
+			const auto bottom = m_bottom.load(std::memory_order_relaxed);
+			const auto top    = m_top.load(std::memory_order_acquire);
+			if (m_mask < bottom - top) {
+				return false;
+			}
+
+			m_elements[bottom & m_mask].store(element, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		/**
+		 Pops an element from the bottom of this work-stealing deque.
+
+		 @pre			The calling thread owns this work-stealing deque.
+		 @return		The popped element, if any.
+		 */
+		[[nodiscard]]
+		std::optional< T > Pop() noexcept {
+			const auto bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+			m_bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			auto top = m_top.load(std::memory_order_relaxed);
+
+			if (bottom < top) {
+				// The deque is empty.
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return {};
+			}
+
+			const auto element
+				= m_elements[bottom & m_mask].load(std::memory_order_relaxed);
+			if (bottom != top) {
+				return element;
+			}
+
+			// The last element: race against the thieves.
+			const bool popped = m_top.compare_exchange_strong(
+				top, top + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed);
+			m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+			return popped ? std::optional< T >(element) : std::nullopt;
+		}
+
+		/**
+		 Steals an element from the top of this work-stealing deque.
+
+		 @return		The stolen element, if any.
+		 */
+		[[nodiscard]]
+		std::optional< T > Steal() noexcept {
+			auto top = m_top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const auto bottom = m_bottom.load(std::memory_order_acquire);
+
+			if (bottom <= top) {
+				// The deque is empty.
+				return {};
+			}
+
+			const auto element
+				= m_elements[top & m_mask].load(std::memory_order_relaxed);
+			const bool stolen = m_top.compare_exchange_strong(
+				top, top + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed);
+
+			return stolen ? std::optional< T >(element) : std::nullopt;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The index of the top element of this work-stealing deque.
+		 */
+		alignas(64) AtomicS64 m_top;
+
+		/**
+		 The index past the bottom element of this work-stealing deque.
+		 */
+		alignas(64) AtomicS64 m_bottom;
+
+		/**
+		 The (circular buffer of) elements of this work-stealing deque.
+		 */
+		alignas(64) DynamicArray< std::atomic< T > > m_elements;
+
+		/**
+		 The index mask of this work-stealing deque.
+		 */
+		S64 m_mask;
+	};
+}
\ No newline at end of file
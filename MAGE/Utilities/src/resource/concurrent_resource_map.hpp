@@ -0,0 +1,560 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\types.hpp"
+#include "string\hashed_string.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 Computes the hash of the given resource key.
+
+	 @tparam		KeyT
+					The key type.
+	 @param[in]		key
+					A reference to the key.
+	 @return		The hash of the given resource key.
+	 */
+	template< typename KeyT >
+	[[nodiscard]]
+	inline U64 HashResourceKey(const KeyT& key) noexcept {
+		return static_cast< U64 >(std::hash< KeyT >()(key));
+	}
+
+	/**
+	 Computes the hash of the given resource key.
+
+	 String keys are hashed with @c HashString, which allows lookups with
+	 hashed string views whose hash is computed at compile time.
+
+	 @tparam		CharT
+					The character type.
+	 @param[in]		key
+					A reference to the key.
+	 @return		The hash of the given resource key.
+	 */
+	template< typename CharT >
+	[[nodiscard]]
+	inline U64 HashResourceKey(const std::basic_string< CharT >& key) noexcept {
+		return HashString(key);
+	}
+
+	/**
+	 A class of concurrent resource maps.
+
+	 A concurrent resource map is a hash table that is split into a fixed
+	 number of shards. Each shard is an open-addressing (linear probing)
+	 table of pointers to immutable entries. Writers lock the mutex of a
+	 single shard, readers do not lock at all: a table and its entries are
+	 published with release semantics and are never modified or destroyed
+	 while they can still be reached by a reader. Erased entries are replaced
+	 by a tombstone and tables that are replaced while growing are retired.
+
+	 Readers announce themselves with a read guard, which only increments a
+	 counter of the shard. Retired entries and tables are reclaimed by the
+	 next writer of their shard that observes no readers. Erasing and
+	 reinserting the same key (e.g. a resource that expires and is
+	 recreated) therefore does not accumulate entries.
+
+	 @tparam		KeyT
+					The key type.
+	 @tparam		ValueT
+					The value type.
+	 */
+	template< typename KeyT, typename ValueT >
+	class ConcurrentResourceMap {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of concurrent resource map entries.
+		 */
+		struct Entry {
+
+		public:
+
+			/**
+			 The hash of the key of this entry.
+			 */
+			U64 m_hash = 0u;
+
+			/**
+			 The key of this entry.
+			 */
+			KeyT m_key = {};
+
+			/**
+			 The value of this entry.
+			 */
+			ValueT m_value = {};
+		};
+
+		/**
+		 A class of read guards.
+
+		 The entries of a shard that are found while a read guard of that
+		 shard is alive, are not reclaimed before the read guard is
+		 destructed.
+		 */
+		class ReadGuard {
+
+		public:
+
+			//-----------------------------------------------------------------
+			// Constructors and Destructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a read guard from the given read guard.
+
+			 @param[in]		guard
+							A reference to the read guard to copy.
+			 */
+			ReadGuard(const ReadGuard& guard) = delete;
+
+			/**
+			 Constructs a read guard by moving the given read guard.
+
+			 @param[in]		guard
+							A reference to the read guard to move.
+			 */
+			ReadGuard(ReadGuard&& guard) = delete;
+
+			/**
+			 Destructs this read guard.
+			 */
+			~ReadGuard() {
+				m_nb_readers.fetch_sub(1u, std::memory_order_release);
+			}
+
+			//-----------------------------------------------------------------
+			// Assignment Operators
+			//-----------------------------------------------------------------
+
+			/**
+			 Copies the given read guard to this read guard.
+
+			 @param[in]		guard
+							A reference to the read guard to copy.
+			 @return		A reference to the copy of the given read guard
+							(i.e. this read guard).
+			 */
+			ReadGuard& operator=(const ReadGuard& guard) = delete;
+
+			/**
+			 Moves the given read guard to this read guard.
+
+			 @param[in]		guard
+							A reference to the read guard to move.
+			 @return		A reference to the moved read guard (i.e. this
+							read guard).
+			 */
+			ReadGuard& operator=(ReadGuard&& guard) = delete;
+
+		private:
+
+			//-----------------------------------------------------------------
+			// Friends
+			//-----------------------------------------------------------------
+
+			friend class ConcurrentResourceMap;
+
+			//-----------------------------------------------------------------
+			// Constructors
+			//-----------------------------------------------------------------
+
+			/**
+			 Constructs a read guard.
+
+			 @param[in,out]	nb_readers
+							A reference to the number of readers of the shard.
+			 */
+			explicit ReadGuard(std::atomic< std::size_t >& nb_readers) noexcept
+				: m_nb_readers(nb_readers) {
+
+				m_nb_readers.fetch_add(1u, std::memory_order_relaxed);
+				// Pairs with the fence of Reclaim: either the writer observes
+				// this reader, or this reader observes the retirements of
+				// the writer.
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+			}
+
+			//-----------------------------------------------------------------
+			// Member Variables
+			//-----------------------------------------------------------------
+
+			/**
+			 A reference to the number of readers of the shard of this read
+			 guard.
+			 */
+			std::atomic< std::size_t >& m_nb_readers;
+		};
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a concurrent resource map.
+		 */
+		ConcurrentResourceMap();
+
+		/**
+		 Constructs a concurrent resource map from the given concurrent
+		 resource map.
+
+		 @param[in]		map
+						A reference to the concurrent resource map to copy.
+		 */
+		ConcurrentResourceMap(const ConcurrentResourceMap& map) = delete;
+
+		/**
+		 Constructs a concurrent resource map by moving the given concurrent
+		 resource map.
+
+		 @param[in]		map
+						A reference to the concurrent resource map to move.
+		 */
+		ConcurrentResourceMap(ConcurrentResourceMap&& map) noexcept = default;
+
+		/**
+		 Destructs this concurrent resource map.
+		 */
+		~ConcurrentResourceMap() {
+			Clear();
+		}
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given concurrent resource map to this concurrent resource
+		 map.
+
+		 @param[in]		map
+						A reference to the concurrent resource map to copy.
+		 @return		A reference to the copy of the given concurrent
+						resource map (i.e. this concurrent resource map).
+		 */
+		ConcurrentResourceMap& operator=(
+			const ConcurrentResourceMap& map) = delete;
+
+		/**
+		 Moves the given concurrent resource map to this concurrent resource
+		 map.
+
+		 @param[in]		map
+						A reference to the concurrent resource map to move.
+		 @return		A reference to the moved concurrent resource map
+						(i.e. this concurrent resource map).
+		 */
+		ConcurrentResourceMap& operator=(
+			ConcurrentResourceMap&& map) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this concurrent resource map is empty.
+
+		 @return		@c true if this concurrent resource map is empty.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool empty() const noexcept {
+			return 0u == size();
+		}
+
+		/**
+		 Returns the number of entries contained in this concurrent resource
+		 map.
+
+		 @return		The number of entries contained in this concurrent
+						resource map.
+		 */
+		[[nodiscard]]
+		std::size_t size() const noexcept;
+
+		/**
+		 Returns the mutex of the shard of this concurrent resource map
+		 containing the keys with the given hash.
+
+		 @param[in]		hash
+						The hash of the key.
+		 @return		A reference to the mutex of the shard containing the
+						keys with the given hash.
+		 */
+		[[nodiscard]]
+		std::mutex& GetMutex(U64 hash) const noexcept {
+			return GetShard(hash).m_mutex;
+		}
+
+		/**
+		 Returns a read guard for the shard of this concurrent resource map
+		 containing the keys with the given hash.
+
+		 @param[in]		hash
+						The hash of the key.
+		 @return		A read guard for the shard containing the keys with
+						the given hash.
+		 */
+		[[nodiscard]]
+		ReadGuard Read(U64 hash) const noexcept {
+			return ReadGuard(GetShard(hash).m_nb_readers);
+		}
+
+		/**
+		 Finds the entry corresponding to the given key in this concurrent
+		 resource map.
+
+		 This member method does not lock and can be called concurrently
+		 with all other member methods except @c Clear.
+
+		 @pre			A read guard for the given hash is alive, or the mutex
+						of the shard containing the keys with the given hash
+						is locked by the calling thread.
+
+		 @tparam		KeyViewT
+						The key view type (i.e. a type comparable to the key
+						type).
+		 @param[in]		hash
+						The hash of the key.
+		 @param[in]		key
+						A reference to the key.
+		 @return		@c nullptr, if no entry corresponding to the given key
+						is contained in this concurrent resource map.
+		 @return		A pointer to the entry corresponding to the given key.
+						The entry remains valid while the read guard is alive
+						or the mutex is locked.
+		 */
+		template< typename KeyViewT >
+		[[nodiscard]]
+		const Entry* Find(U64 hash, const KeyViewT& key) const noexcept;
+
+		/**
+		 Inserts an entry for the given key and value into this concurrent
+		 resource map.
+
+		 @pre			The mutex of the shard containing the keys with the
+						given hash is locked by the calling thread.
+		 @pre			No entry corresponding to the given key is contained
+						in this concurrent resource map.
+		 @param[in]		hash
+						The hash of the key.
+		 @param[in]		key
+						The key.
+		 @param[in]		value
+						The value.
+		 */
+		void Insert(U64 hash, KeyT key, ValueT value);
+
+		/**
+		 Erases the entry corresponding to the given key from this concurrent
+		 resource map.
+
+		 The erased entry is retired (i.e. it remains valid for concurrent
+		 readers) until no read guard of its shard is alive.
+
+		 @pre			The mutex of the shard containing the keys with the
+						given hash is locked by the calling thread.
+		 @tparam		KeyViewT
+						The key view type (i.e. a type comparable to the key
+						type).
+		 @param[in]		hash
+						The hash of the key.
+		 @param[in]		key
+						A reference to the key.
+		 */
+		template< typename KeyViewT >
+		void Erase(U64 hash, const KeyViewT& key) noexcept;
+
+		/**
+		 Removes all entries (including the retired entries) from this
+		 concurrent resource map.
+
+		 This member method must not be called concurrently with @c Find.
+		 */
+		void Clear() noexcept;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 A struct of open-addressing tables.
+		 */
+		struct Table {
+
+		public:
+
+			/**
+			 Constructs a table.
+
+			 @pre			@a capacity is a power of two.
+			 @param[in]		capacity
+							The number of slots.
+			 */
+			explicit Table(std::size_t capacity)
+				: m_slots(capacity) {}
+
+			/**
+			 The slots of this table.
+			 */
+			std::vector< std::atomic< const Entry* > > m_slots;
+		};
+
+		/**
+		 A struct of shards.
+		 */
+		struct alignas(64) Shard {
+
+		public:
+
+			/**
+			 A pointer to the current table of this shard.
+			 */
+			std::atomic< Table* > m_table = nullptr;
+
+			/**
+			 The number of live entries of this shard.
+			 */
+			std::atomic< std::size_t > m_size = 0u;
+
+			/**
+			 The number of readers (i.e. alive read guards) of this shard.
+			 */
+			std::atomic< std::size_t > m_nb_readers = 0u;
+
+			/**
+			 The number of occupied slots (i.e. live entries and tombstones)
+			 of the current table of this shard.
+			 */
+			std::size_t m_nb_occupied = 0u;
+
+			/**
+			 The tombstone entry of this shard.
+			 */
+			Entry m_tombstone;
+
+			/**
+			 The tables (i.e. the retired tables followed by the current
+			 table) of this shard.
+			 */
+			std::vector< UniquePtr< Table > > m_tables;
+
+			/**
+			 The retired entries of this shard. The live entries are owned
+			 by the current table of this shard.
+			 */
+			std::vector< UniquePtr< const Entry > > m_retired_entries;
+
+			/**
+			 The mutex for modifying this shard.
+			 */
+			mutable std::mutex m_mutex;
+		};
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The number of shards of concurrent resource maps.
+		 */
+		static constexpr std::size_t s_nb_shards = 16u;
+
+		/**
+		 The minimum number of slots of the table of a shard.
+		 */
+		static constexpr std::size_t s_min_capacity = 16u;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the shard of this concurrent resource map containing the keys
+		 with the given hash.
+
+		 @param[in]		hash
+						The hash of the key.
+		 @return		A reference to the shard containing the keys with the
+						given hash.
+		 */
+		[[nodiscard]]
+		Shard& GetShard(U64 hash) const noexcept {
+			// The high bits select the shard, the low bits the slot.
+			return m_shards[static_cast< std::size_t >(hash >> 60u)
+							% s_nb_shards];
+		}
+
+		/**
+		 Replaces the current table of the given shard with a larger table
+		 containing the live entries of the given shard.
+
+		 @pre			The mutex of the given shard is locked by the calling
+						thread.
+		 @param[in,out]	shard
+						A reference to the shard.
+		 @return		A pointer to the new table of the given shard.
+		 */
+		Table* Grow(Shard& shard);
+
+		/**
+		 Reclaims the retired entries and tables of the given shard, if no
+		 reader of the given shard is alive.
+
+		 @pre			The mutex of the given shard is locked by the calling
+						thread.
+		 @param[in,out]	shard
+						A reference to the shard.
+		 */
+		void Reclaim(Shard& shard) noexcept;
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 A pointer to the shards of this concurrent resource map.
+		 */
+		UniquePtr< Shard[] > m_shards;
+	};
+}
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\concurrent_resource_map.tpp"
+
+#pragma endregion
\ No newline at end of file
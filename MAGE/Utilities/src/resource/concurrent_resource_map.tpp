@@ -0,0 +1,229 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	template< typename KeyT, typename ValueT >
+	ConcurrentResourceMap< KeyT, ValueT >::ConcurrentResourceMap()
+		: m_shards(std::make_unique< Shard[] >(s_nb_shards)) {}
+
+	template< typename KeyT, typename ValueT >
+	ConcurrentResourceMap< KeyT, ValueT >& ConcurrentResourceMap< KeyT, ValueT >
+		::operator=(ConcurrentResourceMap&& map) noexcept {
+
+		// The live entries are owned by the tables of the shards.
+		Clear();
+		m_shards = std::move(map.m_shards);
+		return *this;
+	}
+
+	template< typename KeyT, typename ValueT >
+	[[nodiscard]]
+	std::size_t ConcurrentResourceMap< KeyT, ValueT >::size() const noexcept {
+		if (nullptr == m_shards) {
+			return 0u;
+		}
+
+		std::size_t size = 0u;
+		for (std::size_t i = 0u; i < s_nb_shards; ++i) {
+			size += m_shards[i].m_size.load(std::memory_order_relaxed);
+		}
+		return size;
+	}
+
+	template< typename KeyT, typename ValueT >
+	template< typename KeyViewT >
+	[[nodiscard]]
+	const typename ConcurrentResourceMap< KeyT, ValueT >::Entry*
+		ConcurrentResourceMap< KeyT, ValueT >
+		::Find(U64 hash, const KeyViewT& key) const noexcept {
+
+		const auto& shard = GetShard(hash);
+		const auto  table = shard.m_table.load(std::memory_order_acquire);
+		if (nullptr == table) {
+			return nullptr;
+		}
+
+		const auto mask = table->m_slots.size() - 1u;
+		auto index      = static_cast< std::size_t >(hash) & mask;
+		for (std::size_t i = 0u; i <= mask; ++i, index = (index + 1u) & mask) {
+			const auto entry
+				= table->m_slots[index].load(std::memory_order_acquire);
+
+			if (nullptr == entry) {
+				return nullptr;
+			}
+			if (&shard.m_tombstone != entry
+				&& hash == entry->m_hash && entry->m_key == key) {
+				return entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	template< typename KeyT, typename ValueT >
+	void ConcurrentResourceMap< KeyT, ValueT >
+		::Insert(U64 hash, KeyT key, ValueT value) {
+
+		auto& shard = GetShard(hash);
+		auto  table = shard.m_table.load(std::memory_order_relaxed);
+
+		// Keep the load factor (including tombstones) below one half.
+		if (nullptr == table
+			|| table->m_slots.size() < 2u * (shard.m_nb_occupied + 1u)) {
+			table = Grow(shard);
+		}
+
+		// The entry is owned by the table once it is stored.
+		const auto entry
+			= new Entry{ hash, std::move(key), std::move(value) };
+
+		const auto mask = table->m_slots.size() - 1u;
+		auto index      = static_cast< std::size_t >(hash) & mask;
+		while (true) {
+			auto& slot = table->m_slots[index];
+			const auto current = slot.load(std::memory_order_relaxed);
+
+			if (nullptr == current || &shard.m_tombstone == current) {
+				if (nullptr == current) {
+					++shard.m_nb_occupied;
+				}
+
+				slot.store(entry, std::memory_order_release);
+				break;
+			}
+
+			index = (index + 1u) & mask;
+		}
+
+		shard.m_size.fetch_add(1u, std::memory_order_relaxed);
+
+		Reclaim(shard);
+	}
+
+	template< typename KeyT, typename ValueT >
+	template< typename KeyViewT >
+	void ConcurrentResourceMap< KeyT, ValueT >
+		::Erase(U64 hash, const KeyViewT& key) noexcept {
+
+		auto& shard = GetShard(hash);
+		const auto table = shard.m_table.load(std::memory_order_relaxed);
+		if (nullptr == table) {
+			return;
+		}
+
+		const auto mask = table->m_slots.size() - 1u;
+		auto index      = static_cast< std::size_t >(hash) & mask;
+		for (std::size_t i = 0u; i <= mask; ++i, index = (index + 1u) & mask) {
+			auto& slot = table->m_slots[index];
+			const auto entry = slot.load(std::memory_order_relaxed);
+
+			if (nullptr == entry) {
+				return;
+			}
+			if (&shard.m_tombstone != entry
+				&& hash == entry->m_hash && entry->m_key == key) {
+
+				// The entry itself is retired, not destroyed.
+				slot.store(&shard.m_tombstone, std::memory_order_release);
+				shard.m_size.fetch_sub(1u, std::memory_order_relaxed);
+				shard.m_retired_entries.emplace_back(entry);
+
+				Reclaim(shard);
+				return;
+			}
+		}
+	}
+
+	template< typename KeyT, typename ValueT >
+	void ConcurrentResourceMap< KeyT, ValueT >::Clear() noexcept {
+		if (nullptr == m_shards) {
+			return;
+		}
+
+		for (std::size_t i = 0u; i < s_nb_shards; ++i) {
+			auto& shard = m_shards[i];
+			const std::scoped_lock lock(shard.m_mutex);
+
+			if (const auto table = shard.m_table.load(std::memory_order_relaxed);
+				nullptr != table) {
+
+				for (const auto& slot : table->m_slots) {
+					const auto entry = slot.load(std::memory_order_relaxed);
+					if (&shard.m_tombstone != entry) {
+						delete entry;
+					}
+				}
+			}
+
+			shard.m_table.store(nullptr, std::memory_order_release);
+			shard.m_size.store(0u, std::memory_order_relaxed);
+			shard.m_nb_occupied = 0u;
+			shard.m_tables.clear();
+			shard.m_retired_entries.clear();
+		}
+	}
+
+	template< typename KeyT, typename ValueT >
+	typename ConcurrentResourceMap< KeyT, ValueT >::Table*
+		ConcurrentResourceMap< KeyT, ValueT >::Grow(Shard& shard) {
+
+		const auto old_table = shard.m_table.load(std::memory_order_relaxed);
+		const auto size      = shard.m_size.load(std::memory_order_relaxed);
+
+		auto capacity = s_min_capacity;
+		while (capacity < 4u * (size + 1u)) {
+			capacity *= 2u;
+		}
+
+		auto new_table  = MakeUnique< Table >(capacity);
+		const auto mask = capacity - 1u;
+
+		// Rehash the live entries (i.e. drop the tombstones).
+		if (nullptr != old_table) {
+			for (const auto& old_slot : old_table->m_slots) {
+				const auto entry = old_slot.load(std::memory_order_relaxed);
+				if (nullptr == entry || &shard.m_tombstone == entry) {
+					continue;
+				}
+
+				auto index = static_cast< std::size_t >(entry->m_hash) & mask;
+				while (nullptr != new_table->m_slots[index]
+					              .load(std::memory_order_relaxed)) {
+					index = (index + 1u) & mask;
+				}
+				new_table->m_slots[index].store(entry,
+												std::memory_order_relaxed);
+			}
+		}
+
+		// The old table is retired, since concurrent readers may still use it.
+		const auto table = new_table.get();
+		shard.m_tables.push_back(std::move(new_table));
+		shard.m_nb_occupied = size;
+		shard.m_table.store(table, std::memory_order_release);
+
+		return table;
+	}
+
+	template< typename KeyT, typename ValueT >
+	void ConcurrentResourceMap< KeyT, ValueT >::Reclaim(Shard& shard) noexcept {
+		if (shard.m_retired_entries.empty() && 1u >= shard.m_tables.size()) {
+			return;
+		}
+
+		// Pairs with the fence of ReadGuard: a reader that is not observed,
+		// observes the retirements and cannot reach the retired entries and
+		// tables anymore.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (0u != shard.m_nb_readers.load(std::memory_order_acquire)) {
+			return;
+		}
+
+		shard.m_retired_entries.clear();
+		shard.m_tables.erase(shard.m_tables.begin(), shard.m_tables.end() - 1);
+	}
+}
\ No newline at end of file
@@ -5,20 +5,13 @@
 //-----------------------------------------------------------------------------
 #pragma region
 
-#include "type\types.hpp"
+#include "resource\concurrent_resource_map.hpp"
 
 #pragma endregion
 
 //-----------------------------------------------------------------------------
 // System Includes
 //-----------------------------------------------------------------------------
-#pragma region
-
-#include <map>
-#include <mutex>
-
-#pragma endregion
-
 //-----------------------------------------------------------------------------
 // Engine Declarations and Definitions
 //-----------------------------------------------------------------------------
@@ -32,6 +25,9 @@ namespace mage {
 	/**
 	 A class of resource pools.
 
+	 Resource pools reference but do not manage their resources. Lookups of
+	 live resources do not lock (see @c ConcurrentResourceMap).
+
 	 @tparam		KeyT
 					The key type.
 	 @tparam		ResourceT
@@ -158,6 +154,27 @@ namespace mage {
 		[[nodiscard]]
 		SharedPtr< ResourceT > Get(const KeyT& key) noexcept;
 
+		/**
+		 Returns the resource corresponding to the given key from this
+		 resource pool.
+
+		 @tparam		KeyViewT
+						The key view type (i.e. a type comparable to the key
+						type).
+		 @param[in]		hash
+						The (precomputed) hash of the key (see
+						@c HashResourceKey).
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @return		@c nullptr, if no resource is contained in this
+						resource pool corresponding to the given key.
+		 @return		A pointer to the resource corresponding to the given key
+						from this resource pool.
+		 */
+		template< typename KeyViewT >
+		[[nodiscard]]
+		SharedPtr< ResourceT > Get(U64 hash, const KeyViewT& key) noexcept;
+
 		/**
 		 Returns the resource corresponding to the given key from this resource
 		 pool.
@@ -223,15 +240,6 @@ namespace mage {
 
 	private:
 
-		//---------------------------------------------------------------------
-		// Class Member Types
-		//---------------------------------------------------------------------
-
-		/**
-		 A resource map used by a resource pool.
-		 */
-		using ResourceMap = std::map< KeyT, WeakPtr< ResourceT > >;
-
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -239,12 +247,7 @@ namespace mage {
 		/**
 		 The resource map of this resource pool.
 		 */
-		ResourceMap m_resource_map;
-
-		/**
-		 The mutex for accessing the resource map of this resource pool.
-		 */
-		mutable std::mutex m_mutex;
+		ConcurrentResourceMap< KeyT, WeakPtr< ResourceT > > m_resource_map;
 
 		/**
 		 A class of resources.
@@ -358,6 +361,11 @@ namespace mage {
 	/**
 	 A class of persistent resource pools.
 
+	 Persistent resource pools manage their resources. Lookups do not lock
+	 (see @c ConcurrentResourceMap). Since concurrent lookups may still
+	 reference a removed resource, removed resources are only released when
+	 all resources are removed.
+
 	 @tparam		KeyT
 					The key type.
 	 @tparam		ResourceT
@@ -492,6 +500,28 @@ namespace mage {
 		[[nodiscard]]
 		SharedPtr< ResourceT > Get(const KeyT& key) noexcept;
 
+		/**
+		 Returns the resource corresponding to the given key from this
+		 persistent resource pool.
+
+		 @tparam		KeyViewT
+						The key view type (i.e. a type comparable to the key
+						type).
+		 @param[in]		hash
+						The (precomputed) hash of the key (see
+						@c HashResourceKey).
+		 @param[in]		key
+						A reference to the key of the resource.
+		 @return		@c nullptr, if no resource is contained in this
+						persistent resource pool corresponding to the given
+						key.
+		 @return		A pointer to the resource corresponding to
+						the given key from this persistent resource pool.
+		 */
+		template< typename KeyViewT >
+		[[nodiscard]]
+		SharedPtr< ResourceT > Get(U64 hash, const KeyViewT& key) noexcept;
+
 		/**
 		 Returns the resource corresponding to the given key from this
 		 persistent resource pool.
@@ -557,15 +587,6 @@ namespace mage {
 
 	private:
 
-		//---------------------------------------------------------------------
-		// Class Member Types
-		//---------------------------------------------------------------------
-
-		/**
-		 A resource map used by a persistent resource pool.
-		 */
-		using ResourceMap = std::map< KeyT, SharedPtr< ResourceT > >;
-
 		//---------------------------------------------------------------------
 		// Member Variables
 		//---------------------------------------------------------------------
@@ -573,13 +594,7 @@ namespace mage {
 		/**
 		 The resource map of this persistent resource pool.
 		 */
-		ResourceMap m_resource_map;
-
-		/**
-		 The mutex for accessing the resource map of this persistent resource
-		 pool.
-		 */
-		mutable std::mutex m_mutex;
+		ConcurrentResourceMap< KeyT, SharedPtr< ResourceT > > m_resource_map;
 	};
 
 	#pragma endregion
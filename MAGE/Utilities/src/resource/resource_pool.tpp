@@ -12,71 +12,48 @@ namespace mage {
 
 	template< typename KeyT, typename ResourceT >
 	ResourcePool< KeyT, ResourceT >::ResourcePool(ResourcePool&& pool) noexcept
-		: m_mutex() {
-
-		const std::scoped_lock lock(pool.m_mutex);
-
-		m_resource_map = std::move(pool.m_resource_map);
-	}
+		: m_resource_map(std::move(pool.m_resource_map)) {}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	inline bool ResourcePool< KeyT, ResourceT >::empty() const noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		using std::empty;
-		return empty(m_resource_map);
+		return m_resource_map.empty();
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	inline std::size_t ResourcePool< KeyT, ResourceT >::size() const noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		using std::size;
-		return size(m_resource_map);
+		return m_resource_map.size();
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	bool ResourcePool< KeyT, ResourceT >::Contains(const KeyT& key) noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
-
-			const auto resource = it->second.lock();
-
-			if (resource) {
-				return true;
-			}
-
-			m_resource_map.erase(it);
-		}
-
-		return false;
+		const auto hash  = HashResourceKey(key);
+		const auto guard = m_resource_map.Read(hash);
+		const auto entry = m_resource_map.Find(hash, key);
+		return nullptr != entry && !entry->m_value.expired();
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
-	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
+	inline SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::Get(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
-
-			const auto resource = it->second.lock();
-
-			if (resource) {
-				return resource;
-			}
+		return Get(HashResourceKey(key), key);
+	}
 
-			m_resource_map.erase(it);
-		}
+	template< typename KeyT, typename ResourceT >
+	template< typename KeyViewT >
+	[[nodiscard]]
+	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
+		::Get(U64 hash, const KeyViewT& key) noexcept {
 
-		return SharedPtr< ResourceT >();
+		// Expired entries are removed by the destructor of their resource.
+		const auto guard = m_resource_map.Read(hash);
+		const auto entry = m_resource_map.Find(hash, key);
+		return (nullptr != entry) ? entry->m_value.lock()
+			                      : SharedPtr< ResourceT >();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -93,44 +70,49 @@ namespace mage {
 	SharedPtr< ResourceT > ResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = HashResourceKey(key);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		// Fast path: the resource is alive and the lookup does not lock.
+		if (auto resource = Get(hash, key); resource) {
+			return resource;
+		}
+
+		const std::scoped_lock lock(m_resource_map.GetMutex(hash));
+
+		if (const auto entry = m_resource_map.Find(hash, key);
+			nullptr != entry) {
 
-			const auto resource = it->second.lock();
-			if (resource) {
+			if (auto resource = entry->m_value.lock(); resource) {
 				return resource;
 			}
 
-			m_resource_map.erase(it);
+			m_resource_map.Erase(hash, key);
 		}
 
 		const auto new_resource
 			= MakeAllocatedShared< Resource< DerivedResourceT > >
 			  (*this, key, std::forward< ConstructorArgsT >(args)...);
 
-		m_resource_map.emplace(key, new_resource);
+		m_resource_map.Insert(hash, key, new_resource);
 
 		return new_resource;
 	}
 
 	template< typename KeyT, typename ResourceT >
 	void ResourcePool< KeyT, ResourceT >::Remove(const KeyT& key) {
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = HashResourceKey(key);
+		const std::scoped_lock lock(m_resource_map.GetMutex(hash));
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end() && it->second.expired()) {
+		if (const auto entry = m_resource_map.Find(hash, key);
+			nullptr != entry && entry->m_value.expired()) {
 
-			m_resource_map.erase(it);
+			m_resource_map.Erase(hash, key);
 		}
 	}
 
 	template< typename KeyT, typename ResourceT >
 	inline void ResourcePool< KeyT, ResourceT >::RemoveAll() noexcept {
-		const std::scoped_lock lock(m_mutex);
-
-		m_resource_map.clear();
+		m_resource_map.Clear();
 	}
 
 	#pragma endregion
@@ -175,22 +157,14 @@ namespace mage {
 	template< typename KeyT, typename ResourceT >
 	PersistentResourcePool< KeyT, ResourceT >
 		::PersistentResourcePool(PersistentResourcePool&& pool) noexcept
-		: m_mutex() {
-
-		const std::scoped_lock lock(pool.m_mutex);
-
-		m_resource_map = std::move(pool.m_resource_map);
-	}
+		: m_resource_map(std::move(pool.m_resource_map)) {}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]
 	inline bool PersistentResourcePool< KeyT, ResourceT >
 		::empty() const noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		using std::empty;
-		return empty(m_resource_map);
+		return m_resource_map.empty();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -198,31 +172,35 @@ namespace mage {
 	inline std::size_t PersistentResourcePool< KeyT, ResourceT >
 		::size() const noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		using std::size;
-		return size(m_resource_map);
+		return m_resource_map.size();
 	}
 
 	template< typename KeyT, typename ResourceT >
 	[[nodiscard]]bool PersistentResourcePool< KeyT, ResourceT >
 		::Contains(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		const auto it = m_resource_map.find(key);
-		return (it != m_resource_map.end());
+		const auto hash  = HashResourceKey(key);
+		const auto guard = m_resource_map.Read(hash);
+		return nullptr != m_resource_map.Find(hash, key);
 	}
 
 	template< typename KeyT, typename ResourceT >
-	[[nodiscard]]SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
+	[[nodiscard]]
+	inline SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
 		::Get(const KeyT& key) noexcept {
 
-		const std::scoped_lock lock(m_mutex);
+		return Get(HashResourceKey(key), key);
+	}
+
+	template< typename KeyT, typename ResourceT >
+	template< typename KeyViewT >
+	[[nodiscard]]SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
+		::Get(U64 hash, const KeyViewT& key) noexcept {
 
-		const auto it = m_resource_map.find(key);
-		return (it != m_resource_map.end()) ? it->second
-			                                : SharedPtr< ResourceT >();
+		const auto guard = m_resource_map.Read(hash);
+		const auto entry = m_resource_map.Find(hash, key);
+		return (nullptr != entry) ? entry->m_value
+			                      : SharedPtr< ResourceT >();
 	}
 
 	template< typename KeyT, typename ResourceT >
@@ -239,18 +217,25 @@ namespace mage {
 	SharedPtr< ResourceT > PersistentResourcePool< KeyT, ResourceT >
 		::GetOrCreateDerived(const KeyT& key, ConstructorArgsT&&... args) {
 
-		const std::scoped_lock lock(m_mutex);
+		const auto hash = HashResourceKey(key);
 
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		// Fast path: the resource exists and the lookup does not lock.
+		if (auto resource = Get(hash, key); resource) {
+			return resource;
+		}
 
-			return it->second;
+		const std::scoped_lock lock(m_resource_map.GetMutex(hash));
+
+		if (const auto entry = m_resource_map.Find(hash, key);
+			nullptr != entry) {
+
+			return entry->m_value;
 		}
 
 		const auto new_resource = MakeAllocatedShared< DerivedResourceT >
 			                      (std::forward< ConstructorArgsT >(args)...);
 
-		m_resource_map.emplace(key, new_resource);
+		m_resource_map.Insert(hash, key, new_resource);
 
 		return new_resource;
 	}
@@ -259,22 +244,17 @@ namespace mage {
 	void PersistentResourcePool< KeyT, ResourceT >
 		::Remove(const KeyT& key) {
 
-		const std::scoped_lock lock(m_mutex);
-
-		if (const auto it = m_resource_map.find(key);
-			it != m_resource_map.end()) {
+		const auto hash = HashResourceKey(key);
+		const std::scoped_lock lock(m_resource_map.GetMutex(hash));
 
-			m_resource_map.erase(it);
-		}
+		m_resource_map.Erase(hash, key);
 	}
 
 	template< typename KeyT, typename ResourceT >
 	inline void PersistentResourcePool< KeyT, ResourceT >
 		::RemoveAll() noexcept {
 
-		const std::scoped_lock lock(m_mutex);
-
-		m_resource_map.clear();
+		m_resource_map.Clear();
 	}
 
 	#pragma endregion
@@ -0,0 +1,131 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "resource\resource_streamer.hpp"
+#include "system\profiler.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 Flag indicating whether the calling thread is a worker thread of a
+		 resource streamer.
+		 */
+		thread_local bool g_worker_thread = false;
+	}
+
+	[[nodiscard]]
+	bool ResourceStreamer::IsWorkerThread() noexcept {
+		return g_worker_thread;
+	}
+
+	ResourceStreamer::ResourceStreamer(std::size_t nb_workers)
+		: m_load_tasks(),
+		m_create_tasks(),
+		m_nb_active_load_tasks(0u),
+		m_stop(false),
+		m_mutex(),
+		m_condition(),
+		m_workers() {
+
+		m_workers.reserve(nb_workers);
+		for (std::size_t i = 0u; i < nb_workers; ++i) {
+			m_workers.emplace_back(&ResourceStreamer::WorkerLoop, this);
+		}
+	}
+
+	ResourceStreamer::~ResourceStreamer() {
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_stop = true;
+		}
+		m_condition.notify_all();
+
+		// The worker threads finish their current loading task before
+		// returning.
+		for (auto& worker : m_workers) {
+			worker.join();
+		}
+	}
+
+	[[nodiscard]]
+	bool ResourceStreamer::HasPendingTasks() const noexcept {
+		const std::lock_guard< std::mutex > lock(m_mutex);
+		return !m_load_tasks.empty()
+			|| !m_create_tasks.empty()
+			|| 0u != m_nb_active_load_tasks;
+	}
+
+	void ResourceStreamer::Load(Task task) {
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_load_tasks.push_back(std::move(task));
+		}
+		m_condition.notify_one();
+	}
+
+	void ResourceStreamer::Create(Task task) {
+		const std::lock_guard< std::mutex > lock(m_mutex);
+		m_create_tasks.push_back(std::move(task));
+	}
+
+	void ResourceStreamer::Update(TimeIntervalSeconds budget) {
+		MAGE_PROFILE_ZONE("ResourceStreamer::Update");
+
+		const auto begin = std::chrono::high_resolution_clock::now();
+
+		while (true) {
+			Task task;
+			{
+				const std::lock_guard< std::mutex > lock(m_mutex);
+				if (m_create_tasks.empty()) {
+					return;
+				}
+
+				task = std::move(m_create_tasks.front());
+				m_create_tasks.pop_front();
+			}
+
+			task();
+
+			if (budget <= std::chrono::high_resolution_clock::now() - begin) {
+				return;
+			}
+		}
+	}
+
+	void ResourceStreamer::WorkerLoop() {
+		g_worker_thread = true;
+
+		std::unique_lock< std::mutex > lock(m_mutex);
+		while (true) {
+			m_condition.wait(lock, [this]() {
+				return m_stop || !m_load_tasks.empty();
+			});
+
+			if (m_stop) {
+				return;
+			}
+
+			auto task = std::move(m_load_tasks.front());
+			m_load_tasks.pop_front();
+			++m_nb_active_load_tasks;
+
+			lock.unlock();
+			task();
+			// Destruct the task (and its captured state) before locking.
+			task = nullptr;
+			lock.lock();
+
+			--m_nb_active_load_tasks;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,222 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system\timer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 A class of resource streamers.
+
+	 A resource streamer splits the creation of a resource in two stages:
+	 the loading stage (i.e. file I/O, decoding and parsing) is executed on
+	 the worker threads of the resource streamer, the creation stage (i.e.
+	 creating the GPU objects) is executed on the thread updating the
+	 resource streamer (i.e. the rendering thread) within a time budget per
+	 update.
+	 */
+	class ResourceStreamer {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Types
+		//---------------------------------------------------------------------
+
+		/**
+		 The task type of resource streamers.
+		 */
+		using Task = std::function< void() >;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether the calling thread is a worker thread of a resource
+		 streamer.
+
+		 @return		@c true if the calling thread is a worker thread of a
+						resource streamer. @c false otherwise.
+		 */
+		[[nodiscard]]
+		static bool IsWorkerThread() noexcept;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a resource streamer.
+
+		 @param[in]		nb_workers
+						The number of worker threads.
+		 */
+		explicit ResourceStreamer(std::size_t nb_workers = 2u);
+
+		/**
+		 Constructs a resource streamer from the given resource streamer.
+
+		 @param[in]		streamer
+						A reference to the resource streamer to copy.
+		 */
+		ResourceStreamer(const ResourceStreamer& streamer) = delete;
+
+		/**
+		 Constructs a resource streamer by moving the given resource
+		 streamer.
+
+		 @param[in]		streamer
+						A reference to the resource streamer to move.
+		 */
+		ResourceStreamer(ResourceStreamer&& streamer) = delete;
+
+		/**
+		 Destructs this resource streamer. The loading tasks which are not
+		 started yet and all creation tasks are discarded.
+		 */
+		~ResourceStreamer();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given resource streamer to this resource streamer.
+
+		 @param[in]		streamer
+						A reference to the resource streamer to copy.
+		 @return		A reference to the copy of the given resource streamer
+						(i.e. this resource streamer).
+		 */
+		ResourceStreamer& operator=(const ResourceStreamer& streamer) = delete;
+
+		/**
+		 Moves the given resource streamer to this resource streamer.
+
+		 @param[in]		streamer
+						A reference to the resource streamer to move.
+		 @return		A reference to the moved resource streamer (i.e. this
+						resource streamer).
+		 */
+		ResourceStreamer& operator=(ResourceStreamer&& streamer) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Checks whether this resource streamer has pending (loading or
+		 creation) tasks.
+
+		 @return		@c true if this resource streamer has pending tasks.
+						@c false otherwise.
+		 */
+		[[nodiscard]]
+		bool HasPendingTasks() const noexcept;
+
+		/**
+		 Executes the given loading task on a worker thread of this resource
+		 streamer.
+
+		 @param[in]		task
+						The loading task.
+		 */
+		void Load(Task task);
+
+		/**
+		 Executes the given creation task on the thread updating this
+		 resource streamer.
+
+		 @param[in]		task
+						The creation task.
+		 */
+		void Create(Task task);
+
+		/**
+		 Executes the creation tasks of this resource streamer in order of
+		 submission until the given time budget is exceeded. At least one
+		 creation task is executed (if any).
+
+		 @param[in]		budget
+						The time budget.
+		 */
+		void Update(TimeIntervalSeconds budget);
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Executes loading tasks until this resource streamer is destructed.
+		 */
+		void WorkerLoop();
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The loading tasks of this resource streamer.
+		 */
+		std::deque< Task > m_load_tasks;
+
+		/**
+		 The creation tasks of this resource streamer.
+		 */
+		std::deque< Task > m_create_tasks;
+
+		/**
+		 The number of loading tasks which are being executed by the worker
+		 threads of this resource streamer.
+		 */
+		std::size_t m_nb_active_load_tasks;
+
+		/**
+		 Flag indicating whether the worker threads of this resource streamer
+		 must stop.
+		 */
+		bool m_stop;
+
+		/**
+		 The mutex of this resource streamer.
+		 */
+		mutable std::mutex m_mutex;
+
+		/**
+		 The condition variable for waking up the worker threads of this
+		 resource streamer.
+		 */
+		std::condition_variable m_condition;
+
+		/**
+		 The worker threads of this resource streamer.
+		 */
+		std::vector< std::thread > m_workers;
+	};
+}
\ No newline at end of file
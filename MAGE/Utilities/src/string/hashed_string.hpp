@@ -0,0 +1,271 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "type\scalar_types.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+/**
+ Constructs a hashed string view for the given string literal whose hash is
+ guaranteed to be computed at compile time.
+ */
+#define MAGE_HASHED_STRING(str) \
+	mage::BasicHashedStringView(str, \
+		std::integral_constant< mage::U64, mage::HashString(str) >::value)
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	/**
+	 Computes the (64-bit FNV-1a) hash of the given string.
+
+	 @tparam		CharT
+					The character type.
+	 @param[in]		str
+					The string.
+	 @return		The hash of the given string.
+	 */
+	template< typename CharT >
+	[[nodiscard]]
+	constexpr U64 HashString(std::basic_string_view< CharT > str) noexcept {
+		auto hash = 0xCBF29CE484222325ull;
+		for (const auto c : str) {
+			using unsigned_type = std::make_unsigned_t< CharT >;
+			hash ^= static_cast< U64 >(static_cast< unsigned_type >(c));
+			hash *= 0x100000001B3ull;
+		}
+		return hash;
+	}
+
+	/**
+	 Computes the (64-bit FNV-1a) hash of the given string literal.
+
+	 @tparam		CharT
+					The character type.
+	 @tparam		N
+					The number of characters of the string literal (including
+					the terminating null character).
+	 @param[in]		str
+					A reference to the string literal.
+	 @return		The hash of the given string literal.
+	 */
+	template< typename CharT, std::size_t N >
+	[[nodiscard]]
+	constexpr U64 HashString(const CharT (&str)[N]) noexcept {
+		return HashString(std::basic_string_view< CharT >(str, N - 1u));
+	}
+
+	/**
+	 Computes the (64-bit FNV-1a) hash of the given string.
+
+	 @tparam		CharT
+					The character type.
+	 @param[in]		str
+					A reference to the string.
+	 @return		The hash of the given string.
+	 */
+	template< typename CharT >
+	[[nodiscard]]
+	inline U64 HashString(const std::basic_string< CharT >& str) noexcept {
+		return HashString(std::basic_string_view< CharT >(str));
+	}
+
+	/**
+	 A class of hashed string views (i.e. string views with a precomputed
+	 hash).
+
+	 @tparam		CharT
+					The character type.
+	 */
+	template< typename CharT >
+	class BasicHashedStringView {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a hashed string view for the given string view.
+
+		 @param[in]		view
+						The string view.
+		 */
+		constexpr BasicHashedStringView(
+			std::basic_string_view< CharT > view) noexcept
+			: m_view(view),
+			m_hash(HashString(view)) {}
+
+		/**
+		 Constructs a hashed string view for the given string view and hash.
+
+		 @pre			@a hash is equal to the hash of the given string view.
+		 @param[in]		view
+						The string view.
+		 @param[in]		hash
+						The hash of the given string view.
+		 */
+		constexpr BasicHashedStringView(std::basic_string_view< CharT > view,
+										U64 hash) noexcept
+			: m_view(view),
+			m_hash(hash) {}
+
+		/**
+		 Constructs a hashed string view for the given string.
+
+		 @param[in]		str
+						A reference to the string.
+		 */
+		BasicHashedStringView(const std::basic_string< CharT >& str) noexcept
+			: BasicHashedStringView(std::basic_string_view< CharT >(str)) {}
+
+		/**
+		 Constructs a hashed string view for the given string literal and
+		 hash.
+
+		 @pre			@a hash is equal to the hash of the given string
+						literal.
+		 @tparam		N
+						The number of characters of the string literal
+						(including the terminating null character).
+		 @param[in]		str
+						A reference to the string literal.
+		 @param[in]		hash
+						The hash of the given string literal.
+		 */
+		template< std::size_t N >
+		constexpr BasicHashedStringView(const CharT (&str)[N],
+										U64 hash) noexcept
+			: BasicHashedStringView(
+				std::basic_string_view< CharT >(str, N - 1u), hash) {}
+
+		/**
+		 Constructs a hashed string view from the given hashed string view.
+
+		 @param[in]		view
+						A reference to the hashed string view to copy.
+		 */
+		constexpr BasicHashedStringView(
+			const BasicHashedStringView& view) noexcept = default;
+
+		/**
+		 Constructs a hashed string view by moving the given hashed string
+		 view.
+
+		 @param[in]		view
+						A reference to the hashed string view to move.
+		 */
+		constexpr BasicHashedStringView(
+			BasicHashedStringView&& view) noexcept = default;
+
+		/**
+		 Destructs this hashed string view.
+		 */
+		~BasicHashedStringView() = default;
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given hashed string view to this hashed string view.
+
+		 @param[in]		view
+						A reference to the hashed string view to copy.
+		 @return		A reference to the copy of the given hashed string
+						view (i.e. this hashed string view).
+		 */
+		constexpr BasicHashedStringView& operator=(
+			const BasicHashedStringView& view) noexcept = default;
+
+		/**
+		 Moves the given hashed string view to this hashed string view.
+
+		 @param[in]		view
+						A reference to the hashed string view to move.
+		 @return		A reference to the moved hashed string view (i.e.
+						this hashed string view).
+		 */
+		constexpr BasicHashedStringView& operator=(
+			BasicHashedStringView&& view) noexcept = default;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the string view of this hashed string view.
+
+		 @return		The string view of this hashed string view.
+		 */
+		[[nodiscard]]
+		constexpr std::basic_string_view< CharT > GetView() const noexcept {
+			return m_view;
+		}
+
+		/**
+		 Returns the hash of this hashed string view.
+
+		 @return		The hash of this hashed string view.
+		 */
+		[[nodiscard]]
+		constexpr U64 GetHash() const noexcept {
+			return m_hash;
+		}
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The string view of this hashed string view.
+		 */
+		std::basic_string_view< CharT > m_view;
+
+		/**
+		 The hash of this hashed string view.
+		 */
+		U64 m_hash;
+	};
+
+	template< typename CharT, std::size_t N >
+	BasicHashedStringView(const CharT (&)[N], U64)
+		-> BasicHashedStringView< CharT >;
+
+	/**
+	 A type of hashed string views of narrow characters.
+	 */
+	using HashedStringView = BasicHashedStringView< char >;
+
+	/**
+	 A type of hashed string views of wide characters.
+	 */
+	using HashedWStringView = BasicHashedStringView< wchar_t >;
+}
\ No newline at end of file
@@ -0,0 +1,279 @@
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "system\profiler.hpp"
+#include "exception\exception.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <algorithm>
+#include <string>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	namespace {
+
+		/**
+		 The nesting depth of the current profile zone of the calling thread.
+		 */
+		thread_local U32 g_depth = 0u;
+
+		/**
+		 A pointer to the ring buffer of the calling thread.
+		 */
+		thread_local RingBuffer< ProfileEvent >* g_ring_buffer = nullptr;
+
+		/**
+		 Converts the given time interval to milliseconds.
+
+		 @tparam		DurationT
+						The duration type.
+		 @param[in]		duration
+						The time interval.
+		 @return		The time interval in milliseconds.
+		 */
+		template< typename DurationT >
+		[[nodiscard]]
+		inline F64 ToMilliseconds(DurationT duration) noexcept {
+			return std::chrono::duration< F64, std::milli >(duration).count();
+		}
+
+		/**
+		 Converts the given time interval to microseconds.
+
+		 @tparam		DurationT
+						The duration type.
+		 @param[in]		duration
+						The time interval.
+		 @return		The time interval in microseconds.
+		 */
+		template< typename DurationT >
+		[[nodiscard]]
+		inline F64 ToMicroseconds(DurationT duration) noexcept {
+			return std::chrono::duration< F64, std::micro >(duration).count();
+		}
+
+		/**
+		 Converts the given string to a (quoted and escaped) JSON string.
+
+		 @param[in]		str
+						The (UTF-8) string.
+		 @return		The JSON string.
+		 */
+		[[nodiscard]]
+		const std::string ToJSONString(std::string_view str) {
+			static constexpr char s_hex_digits[] = "0123456789abcdef";
+
+			std::string json;
+			json.reserve(str.size() + 2u);
+
+			json += '"';
+			for (const auto c : str) {
+				switch (c) {
+
+				case '"': {
+					json += "\\\"";
+					break;
+				}
+
+				case '\\': {
+					json += "\\\\";
+					break;
+				}
+
+				case '\n': {
+					json += "\\n";
+					break;
+				}
+
+				case '\r': {
+					json += "\\r";
+					break;
+				}
+
+				case '\t': {
+					json += "\\t";
+					break;
+				}
+
+				default: {
+					const auto code = static_cast< unsigned char >(c);
+					if (0x20u > code) {
+						// Control characters
+						json += "\\u00";
+						json += s_hex_digits[code >> 4u];
+						json += s_hex_digits[code & 0xFu];
+					}
+					else {
+						json += c;
+					}
+					break;
+				}
+
+				}
+			}
+			json += '"';
+
+			return json;
+		}
+	}
+
+	Profiler Profiler::s_profiler;
+
+	Profiler::Profiler()
+		: m_ring_buffers(),
+		m_mutex(),
+		m_frames(),
+		m_zone_stats(),
+		m_zone_indices(),
+		m_frame_times(),
+		m_start(std::chrono::high_resolution_clock::now()) {}
+
+	Profiler::~Profiler() = default;
+
+	U32 Profiler::BeginZone() noexcept {
+		return g_depth++;
+	}
+
+	void Profiler::EndZone(ProfileEvent event) noexcept {
+		--g_depth;
+
+		// The profile event is dropped if the ring buffer is full.
+		GetRingBuffer().Push(std::move(event));
+	}
+
+	void Profiler::EndFrame() {
+		std::vector< ProfileEvent > events;
+		if (s_nb_trace_frames <= m_frames.size()) {
+			// Recycle the profile events of the oldest frame.
+			events = std::move(m_frames.front());
+			m_frames.pop_front();
+			events.clear();
+		}
+
+		{
+			const std::lock_guard< std::mutex > lock(m_mutex);
+
+			for (std::size_t i = 0u; i < m_ring_buffers.size(); ++i) {
+				auto& buffer = *m_ring_buffers[i];
+				while (auto event = buffer.Pop()) {
+					event->m_thread = static_cast< U32 >(i);
+					events.push_back(std::move(*event));
+				}
+			}
+		}
+
+		// Order the profile events of each thread by their begin time stamps
+		// (i.e. parent profile zones precede their child profile zones).
+		std::sort(events.begin(), events.end(),
+				  [](const ProfileEvent& lhs, const ProfileEvent& rhs) noexcept {
+			return (lhs.m_thread == rhs.m_thread) ? lhs.m_begin < rhs.m_begin
+												  : lhs.m_thread < rhs.m_thread;
+		});
+
+		UpdateZoneStats(events);
+
+		m_frames.push_back(std::move(events));
+	}
+
+	void Profiler::ResetZoneStats() noexcept {
+		for (auto& stats : m_zone_stats) {
+			stats.m_nb_frames = 0u;
+			stats.m_min       = 0.0;
+			stats.m_max       = 0.0;
+			stats.m_total     = 0.0;
+		}
+	}
+
+	void Profiler::ExportTrace(std::filesystem::path path) const {
+		std::FILE* file;
+		{
+			const errno_t result = _wfopen_s(&file, path.c_str(), L"w");
+			ThrowIfFailed((0 == result), "{}: could not open file.", path);
+		}
+
+		const UniqueFileStream file_stream(file);
+		const NotNull< std::FILE* > stream(file);
+
+		WriteTo(stream, "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+		bool first = true;
+		for (const auto& events : m_frames) {
+			for (const auto& event : events) {
+				WriteTo(stream,
+						"{}\n{{\"name\":{},\"cat\":\"cpu\",\"ph\":\"X\","
+						"\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":0,\"tid\":{}}}",
+						first ? "" : ",",
+						ToJSONString(event.m_name),
+						ToMicroseconds(event.m_begin - m_start),
+						ToMicroseconds(event.m_end - event.m_begin),
+						event.m_thread);
+				first = false;
+			}
+		}
+
+		WriteTo(stream, "\n]}}\n");
+	}
+
+	RingBuffer< ProfileEvent >& Profiler::GetRingBuffer() {
+		if (nullptr == g_ring_buffer) {
+			auto buffer
+				= MakeUnique< RingBuffer< ProfileEvent > >(s_nb_thread_events);
+			g_ring_buffer = buffer.get();
+
+			// The ring buffer outlives its thread: all its pending profile
+			// events will still be collected.
+			const std::lock_guard< std::mutex > lock(m_mutex);
+			m_ring_buffers.push_back(std::move(buffer));
+		}
+
+		return *g_ring_buffer;
+	}
+
+	void Profiler::UpdateZoneStats(const std::vector< ProfileEvent >& events) {
+		// A negative time denotes a profile zone absent in this frame.
+		m_frame_times.assign(m_zone_stats.size(), -1.0);
+
+		for (const auto& event : events) {
+			const std::string_view name(event.m_name);
+
+			const auto [it, inserted]
+				= m_zone_indices.try_emplace(name, m_zone_stats.size());
+			if (inserted) {
+				auto& stats   = m_zone_stats.emplace_back();
+				stats.m_name  = name;
+				stats.m_depth = event.m_depth;
+				m_frame_times.push_back(-1.0);
+			}
+
+			auto& time = m_frame_times[it->second];
+			time = std::max(time, 0.0) + ToMilliseconds(event.m_end - event.m_begin);
+		}
+
+		for (std::size_t i = 0u; i < m_zone_stats.size(); ++i) {
+			const auto time = m_frame_times[i];
+			if (0.0 > time) {
+				continue;
+			}
+
+			auto& stats = m_zone_stats[i];
+			stats.m_min = (0u == stats.m_nb_frames) ? time
+													: std::min(stats.m_min, time);
+			stats.m_max = std::max(stats.m_max, time);
+			stats.m_total += time;
+			++stats.m_nb_frames;
+		}
+	}
+}
\ No newline at end of file
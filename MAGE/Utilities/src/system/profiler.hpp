@@ -0,0 +1,594 @@
+#pragma once
+
+//-----------------------------------------------------------------------------
+// Engine Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include "memory\memory.hpp"
+#include "parallel\ring_buffer.hpp"
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// System Includes
+//-----------------------------------------------------------------------------
+#pragma region
+
+#include <chrono>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Defines
+//-----------------------------------------------------------------------------
+#pragma region
+
+// Profiling definition
+// The macro MAGE_PROFILING controls whether profile zones are active or not.
+// Profile zones are active by default in debug builds.
+#ifndef MAGE_PROFILING
+	#ifndef NDEBUG
+		#define MAGE_PROFILING
+	#endif
+#endif
+
+#define MAGE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define MAGE_PROFILE_CONCAT(a, b) MAGE_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef MAGE_PROFILING
+	#define MAGE_PROFILE_ZONE(name) \
+		const mage::ProfileZone MAGE_PROFILE_CONCAT(profile_zone_, __LINE__)(name)
+	#define MAGE_PROFILE_FRAME() \
+		const mage::ProfileFrame MAGE_PROFILE_CONCAT(profile_frame_, __LINE__)
+#else
+	#define MAGE_PROFILE_ZONE(name) (__noop)
+	#define MAGE_PROFILE_FRAME() (__noop)
+#endif
+
+#pragma endregion
+
+//-----------------------------------------------------------------------------
+// Engine Declarations and Definitions
+//-----------------------------------------------------------------------------
+namespace mage {
+
+	//-------------------------------------------------------------------------
+	// ProfileEvent
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of profile events (i.e. completed profile zones).
+	 */
+	struct ProfileEvent {
+
+	public:
+
+		/**
+		 A time stamp type of profile events.
+		 */
+		using TimeStamp = std::chrono::high_resolution_clock::time_point;
+
+		/**
+		 A pointer to the (static) name of the profile zone of this profile
+		 event.
+		 */
+		const char* m_name = nullptr;
+
+		/**
+		 The begin time stamp of this profile event.
+		 */
+		TimeStamp m_begin = {};
+
+		/**
+		 The end time stamp of this profile event.
+		 */
+		TimeStamp m_end = {};
+
+		/**
+		 The nesting depth of the profile zone of this profile event.
+		 */
+		U32 m_depth = 0u;
+
+		/**
+		 The (profiler) index of the thread of this profile event.
+		 */
+		U32 m_thread = 0u;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileZoneStats
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A struct of profile zone statistics. The statistics are expressed in
+	 milliseconds per frame (i.e. the total time of all occurrences of a
+	 profile zone within a single frame).
+	 */
+	struct ProfileZoneStats {
+
+	public:
+
+		/**
+		 Returns the average time per frame of this profile zone.
+
+		 @return		The average time per frame (in milliseconds) of this
+						profile zone.
+		 */
+		[[nodiscard]]
+		F64 GetAverage() const noexcept {
+			return (0u == m_nb_frames) ? 0.0 : m_total / m_nb_frames;
+		}
+
+		/**
+		 The name of this profile zone.
+		 */
+		std::string_view m_name;
+
+		/**
+		 The nesting depth of the (first occurrence of) this profile zone.
+		 */
+		U32 m_depth = 0u;
+
+		/**
+		 The number of frames containing this profile zone.
+		 */
+		U32 m_nb_frames = 0u;
+
+		/**
+		 The minimum time per frame (in milliseconds) of this profile zone.
+		 */
+		F64 m_min = 0.0;
+
+		/**
+		 The maximum time per frame (in milliseconds) of this profile zone.
+		 */
+		F64 m_max = 0.0;
+
+		/**
+		 The total time (in milliseconds) of this profile zone.
+		 */
+		F64 m_total = 0.0;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// Profiler
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of hierarchical CPU frame profilers.
+
+	 Each thread pushes its completed profile zones into its own lock-free
+	 ring buffer. At the end of each frame, the thread calling
+	 @c EndFrame collects the profile events of all threads, updates the
+	 per-zone statistics and keeps the profile events of the last frames for
+	 exporting them as a Chrome trace (i.e. chrome://tracing).
+
+	 Profile zones are recorded through the @c MAGE_PROFILE_ZONE and
+	 @c MAGE_PROFILE_FRAME macros, which are compiled out if
+	 @c MAGE_PROFILING is not defined.
+	 */
+	class Profiler {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The maximum number of profile events of a single thread within a
+		 single frame. Excess profile events are dropped.
+		 */
+		static constexpr std::size_t s_nb_thread_events = 4096u;
+
+		/**
+		 The number of (last) frames whose profile events are kept for
+		 exporting.
+		 */
+		static constexpr std::size_t s_nb_trace_frames = 128u;
+
+		//---------------------------------------------------------------------
+		// Class Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the global profiler.
+
+		 @return		A reference to the global profiler.
+		 */
+		[[nodiscard]]
+		static Profiler& Get() noexcept {
+			return s_profiler;
+		}
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profiler from the given profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to copy.
+		 */
+		Profiler(const Profiler& profiler) = delete;
+
+		/**
+		 Constructs a profiler by moving the given profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to move.
+		 */
+		Profiler(Profiler&& profiler) = delete;
+
+		/**
+		 Destructs this profiler.
+		 */
+		~Profiler();
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profiler to this profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to copy.
+		 @return		A reference to the copy of the given profiler (i.e.
+						this profiler).
+		 */
+		Profiler& operator=(const Profiler& profiler) = delete;
+
+		/**
+		 Moves the given profiler to this profiler.
+
+		 @param[in]		profiler
+						A reference to the profiler to move.
+		 @return		A reference to the moved profiler (i.e. this
+						profiler).
+		 */
+		Profiler& operator=(Profiler&& profiler) = delete;
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Begins a profile zone on the calling thread.
+
+		 @return		The nesting depth of the profile zone.
+		 */
+		[[nodiscard]]
+		U32 BeginZone() noexcept;
+
+		/**
+		 Ends a profile zone on the calling thread.
+
+		 @param[in]		event
+						The profile event of the profile zone.
+		 */
+		void EndZone(ProfileEvent event) noexcept;
+
+		/**
+		 Ends the current frame of this profiler. The profile events of all
+		 threads are collected and the per-zone statistics are updated.
+		 */
+		void EndFrame();
+
+		/**
+		 Returns the per-zone statistics of this profiler, ordered by first
+		 occurrence.
+
+		 @pre			The calling thread is the thread calling
+						@c EndFrame.
+		 @return		A reference to the vector containing the per-zone
+						statistics of this profiler.
+		 */
+		[[nodiscard]]
+		const std::vector< ProfileZoneStats >& GetZoneStats() const noexcept {
+			return m_zone_stats;
+		}
+
+		/**
+		 Resets the per-zone statistics of this profiler.
+
+		 @pre			The calling thread is the thread calling
+						@c EndFrame.
+		 */
+		void ResetZoneStats() noexcept;
+
+		/**
+		 Exports the profile events of the last frames of this profiler as a
+		 Chrome trace (i.e. JSON trace event format).
+
+		 @pre			The calling thread is the thread calling
+						@c EndFrame.
+		 @param[in]		path
+						The path of the file.
+		 @throws		Exception
+						Failed to export the profile events to the file.
+		 */
+		void ExportTrace(std::filesystem::path path) const;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Class Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The global profiler.
+		 */
+		static Profiler s_profiler;
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profiler.
+		 */
+		Profiler();
+
+		//---------------------------------------------------------------------
+		// Member Methods
+		//---------------------------------------------------------------------
+
+		/**
+		 Returns the ring buffer of the calling thread. The ring buffer is
+		 created the first time the calling thread ends a profile zone.
+
+		 @return		A reference to the ring buffer of the calling thread.
+		 */
+		[[nodiscard]]
+		RingBuffer< ProfileEvent >& GetRingBuffer();
+
+		/**
+		 Updates the per-zone statistics of this profiler with the given
+		 profile events of a single frame.
+
+		 @param[in]		events
+						A reference to a vector containing the profile events.
+		 */
+		void UpdateZoneStats(const std::vector< ProfileEvent >& events);
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The ring buffers (one for each thread that ended a profile zone) of
+		 this profiler.
+		 */
+		std::vector< UniquePtr< RingBuffer< ProfileEvent > > > m_ring_buffers;
+
+		/**
+		 The mutex protecting the ring buffers of this profiler.
+		 */
+		std::mutex m_mutex;
+
+		/**
+		 The profile events of the last frames of this profiler.
+		 */
+		std::deque< std::vector< ProfileEvent > > m_frames;
+
+		/**
+		 The per-zone statistics of this profiler.
+		 */
+		std::vector< ProfileZoneStats > m_zone_stats;
+
+		/**
+		 A map containing the indices of the per-zone statistics of this
+		 profiler.
+		 */
+		std::unordered_map< std::string_view, std::size_t > m_zone_indices;
+
+		/**
+		 The per-zone time (in milliseconds) of the current frame of this
+		 profiler (indexed by the indices of the per-zone statistics).
+		 */
+		std::vector< F64 > m_frame_times;
+
+		/**
+		 The begin time stamp of this profiler.
+		 */
+		ProfileEvent::TimeStamp m_start;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileZone
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of (scoped) profile zones.
+	 */
+	class ProfileZone {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profile zone.
+
+		 @param[in]		name
+						A pointer to the (static) name of the profile zone.
+		 */
+		explicit ProfileZone(const char* name) noexcept
+			: m_event{ name } {
+
+			m_event.m_depth = Profiler::Get().BeginZone();
+			m_event.m_begin = std::chrono::high_resolution_clock::now();
+		}
+
+		/**
+		 Constructs a profile zone from the given profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to copy.
+		 */
+		ProfileZone(const ProfileZone& zone) = delete;
+
+		/**
+		 Constructs a profile zone by moving the given profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to move.
+		 */
+		ProfileZone(ProfileZone&& zone) = delete;
+
+		/**
+		 Destructs this profile zone.
+		 */
+		~ProfileZone() {
+			m_event.m_end = std::chrono::high_resolution_clock::now();
+			Profiler::Get().EndZone(m_event);
+		}
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profile zone to this profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to copy.
+		 @return		A reference to the copy of the given profile zone
+						(i.e. this profile zone).
+		 */
+		ProfileZone& operator=(const ProfileZone& zone) = delete;
+
+		/**
+		 Moves the given profile zone to this profile zone.
+
+		 @param[in]		zone
+						A reference to the profile zone to move.
+		 @return		A reference to the moved profile zone (i.e. this
+						profile zone).
+		 */
+		ProfileZone& operator=(ProfileZone&& zone) = delete;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The profile event of this profile zone.
+		 */
+		ProfileEvent m_event;
+	};
+
+	#pragma endregion
+
+	//-------------------------------------------------------------------------
+	// ProfileFrame
+	//-------------------------------------------------------------------------
+	#pragma region
+
+	/**
+	 A class of (scoped) profile frames. A profile frame is a profile zone
+	 which ends the current frame of the profiler on destruction.
+	 */
+	class ProfileFrame {
+
+	public:
+
+		//---------------------------------------------------------------------
+		// Constructors and Destructors
+		//---------------------------------------------------------------------
+
+		/**
+		 Constructs a profile frame.
+		 */
+		ProfileFrame() noexcept
+			: m_zone() {
+
+			m_zone.emplace("Frame");
+		}
+
+		/**
+		 Constructs a profile frame from the given profile frame.
+
+		 @param[in]		frame
+						A reference to the profile frame to copy.
+		 */
+		ProfileFrame(const ProfileFrame& frame) = delete;
+
+		/**
+		 Constructs a profile frame by moving the given profile frame.
+
+		 @param[in]		frame
+						A reference to the profile frame to move.
+		 */
+		ProfileFrame(ProfileFrame&& frame) = delete;
+
+		/**
+		 Destructs this profile frame.
+		 */
+		~ProfileFrame() {
+			m_zone.reset();
+			Profiler::Get().EndFrame();
+		}
+
+		//---------------------------------------------------------------------
+		// Assignment Operators
+		//---------------------------------------------------------------------
+
+		/**
+		 Copies the given profile frame to this profile frame.
+
+		 @param[in]		frame
+						A reference to the profile frame to copy.
+		 @return		A reference to the copy of the given profile frame
+						(i.e. this profile frame).
+		 */
+		ProfileFrame& operator=(const ProfileFrame& frame) = delete;
+
+		/**
+		 Moves the given profile frame to this profile frame.
+
+		 @param[in]		frame
+						A reference to the profile frame to move.
+		 @return		A reference to the moved profile frame (i.e. this
+						profile frame).
+		 */
+		ProfileFrame& operator=(ProfileFrame&& frame) = delete;
+
+	private:
+
+		//---------------------------------------------------------------------
+		// Member Variables
+		//---------------------------------------------------------------------
+
+		/**
+		 The profile zone of this profile frame.
+		 */
+		std::optional< ProfileZone > m_zone;
+	};
+
+	#pragma endregion
+}
\ No newline at end of file